@@ -0,0 +1,401 @@
+#include "AnalysisCache.h"
+#include "FileView.h"
+#include <shlobj.h>
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+namespace {
+    const char FileMagic[8] = { 'B', 'A', 'M', 'C', 'A', 'C', 'H', 'E' };
+    constexpr uint32_t FileVersion = 2;
+    constexpr size_t FileHeaderSize = 16;
+
+    // length, checksum, identity (40), sha-256 content hash (32), md5 (16), sha-1 (20), verdict digest, signature, rules length
+    constexpr size_t RecordHeaderSize = 4 + 4 + 8 + 16 + 8 + 8 + 32 + 16 + 20 + 8 + 4 + 4;
+    constexpr size_t Md5Offset = 80;
+    constexpr size_t Sha1Offset = 96;
+    constexpr size_t VerdictDigestOffset = 116;
+
+    const wchar_t* signatureNames[] = { L"Signed", L"Not signed", L"Cheat Signature", L"Fake Signature" };
+
+    uint32_t checksum(const uint8_t* data, size_t size) {
+        uint32_t hash = 2166136261u;
+        for (size_t i = 0; i < size; i++) {
+            hash = (hash ^ data[i]) * 16777619u;
+        }
+        return hash;
+    }
+
+    void put32(std::vector<uint8_t>& out, uint32_t value) {
+        for (int i = 0; i < 4; i++) out.push_back((uint8_t)(value >> (8 * i)));
+    }
+
+    void put64(std::vector<uint8_t>& out, uint64_t value) {
+        for (int i = 0; i < 8; i++) out.push_back((uint8_t)(value >> (8 * i)));
+    }
+
+    uint32_t get32(const uint8_t* p) {
+        return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+    }
+
+    uint64_t get64(const uint8_t* p) {
+        return (uint64_t)get32(p) | ((uint64_t)get32(p + 4) << 32);
+    }
+
+    std::string identityKeyAt(const uint8_t* record) {
+        return std::string((const char*)record + 8, 8 + 16 + 8 + 8);
+    }
+
+    std::string contentKeyAt(const uint8_t* record) {
+        std::string key((const char*)record + 48, 32);
+        return key.find_first_not_of('\0') == std::string::npos ? std::string() : key;
+    }
+}
+
+bool FileIdentity::FromHandle(HANDLE file, FileIdentity& out) {
+    BY_HANDLE_FILE_INFORMATION info;
+    if (!GetFileInformationByHandle(file, &info)) {
+        return false;
+    }
+    out.volumeSerial = info.dwVolumeSerialNumber;
+    out.size = ((uint64_t)info.nFileSizeHigh << 32) | info.nFileSizeLow;
+    out.lastWrite = ((uint64_t)info.ftLastWriteTime.dwHighDateTime << 32) | info.ftLastWriteTime.dwLowDateTime;
+
+    // 128 bit ids (ReFS) when available, the classic 64 bit index otherwise
+    FILE_ID_INFO idInfo = {};
+    if (GetFileInformationByHandleEx(file, FileIdInfo, &idInfo, sizeof(idInfo))) {
+        out.volumeSerial = idInfo.VolumeSerialNumber;
+        memcpy(out.fileId, idInfo.FileId.Identifier, sizeof(out.fileId));
+    }
+    else {
+        uint64_t index = ((uint64_t)info.nFileIndexHigh << 32) | info.nFileIndexLow;
+        memset(out.fileId, 0, sizeof(out.fileId));
+        memcpy(out.fileId, &index, sizeof(index));
+    }
+    return true;
+}
+
+std::string FileIdentity::Key() const {
+    std::string key;
+    key.append((const char*)&volumeSerial, 8);
+    key.append((const char*)fileId, 16);
+    key.append((const char*)&size, 8);
+    key.append((const char*)&lastWrite, 8);
+    return key;
+}
+
+AnalysisCache& AnalysisCache::Instance() {
+    static AnalysisCache cache;
+    return cache;
+}
+
+std::wstring AnalysisCache::DataDirectory() {
+    wchar_t* localAppData = nullptr;
+    if (FAILED(SHGetKnownFolderPath(FOLDERID_LocalAppData, 0, NULL, &localAppData))) {
+        return std::wstring();
+    }
+    std::wstring directory = std::wstring(localAppData) + L"\\BAMParser";
+    CoTaskMemFree(localAppData);
+
+    CreateDirectoryW(directory.c_str(), NULL);
+    return directory;
+}
+
+bool AnalysisCache::Load() {
+    std::wstring directory = DataDirectory();
+    if (directory.empty()) {
+        return false;
+    }
+    return Load(directory + L"\\analysis.cache");
+}
+
+bool AnalysisCache::Load(const std::wstring& path) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    mapping.Close();
+    byIdentity.clear();
+    byContent.clear();
+    pendingRecords.clear();
+    flushedRecords = 0;
+    validBytes = 0;
+    deadRecords = 0;
+    filePath = path;
+
+    if (!mapping.Open(path)) {
+        return true; // no cache yet
+    }
+
+    const uint8_t* data = mapping.Data();
+    size_t size = mapping.Size();
+    if (size < FileHeaderSize || memcmp(data, FileMagic, 8) != 0 || get32(data + 8) != FileVersion) {
+        mapping.Close();
+        DeleteFileW(path.c_str());
+        return true;
+    }
+
+    size_t offset = FileHeaderSize;
+    while (offset + RecordHeaderSize <= size) {
+        const uint8_t* record = data + offset;
+        uint32_t length = get32(record);
+        if (length < RecordHeaderSize || offset + length > size || checksum(record + 8, length - 8) != get32(record + 4)) {
+            break; // torn tail from a crash, everything after it is dropped
+        }
+
+        Slot slot;
+        slot.offset = offset;
+        if (!byIdentity.emplace(identityKeyAt(record), slot).second) {
+            byIdentity[identityKeyAt(record)] = slot;
+            deadRecords++;
+        }
+        std::string contentKey = contentKeyAt(record);
+        if (!contentKey.empty()) {
+            byContent[contentKey] = slot;
+        }
+        offset += length;
+    }
+    validBytes = offset;
+
+    if (validBytes < size || deadRecords > byIdentity.size()) {
+        Compact();
+    }
+    return true;
+}
+
+uint64_t AnalysisCache::VerdictDigest(uint64_t rulesetDigest, uint64_t certStoreDigest) {
+    // the rules decide the matches, the stores decide "Signed" / "Fake Signature"
+    uint64_t digest = 14695981039346656037ULL;
+    for (uint64_t part : { rulesetDigest, certStoreDigest }) {
+        for (int i = 0; i < 8; i++) {
+            digest = (digest ^ ((part >> (8 * i)) & 0xFF)) * 1099511628211ULL;
+        }
+    }
+    return digest;
+}
+
+bool AnalysisCache::DecodeRecord(const uint8_t* record, size_t length, uint64_t verdictDigest, CachedAnalysis& out) const {
+    if (get64(record + VerdictDigestOffset) != verdictDigest) {
+        return false;
+    }
+    uint32_t signature = get32(record + VerdictDigestOffset + 8);
+    uint32_t rulesLength = get32(record + VerdictDigestOffset + 12);
+    if (signature >= sizeof(signatureNames) / sizeof(signatureNames[0]) || RecordHeaderSize + rulesLength > length) {
+        return false;
+    }
+
+    out.signatureStatus = signatureNames[signature];
+    out.hashes.sha256 = contentKeyAt(record);
+    out.hashes.md5.clear();
+    out.hashes.sha1.clear();
+    if (!out.hashes.sha256.empty()) {
+        out.hashes.md5.assign((const char*)record + Md5Offset, 16);
+        out.hashes.sha1.assign((const char*)record + Sha1Offset, 20);
+    }
+    out.matchedRules.clear();
+    const char* rules = (const char*)record + RecordHeaderSize;
+    size_t start = 0;
+    for (size_t i = 0; i <= rulesLength; i++) {
+        if (i == rulesLength || rules[i] == '\n') {
+            if (i > start) out.matchedRules.emplace_back(rules + start, i - start);
+            start = i + 1;
+        }
+    }
+    return true;
+}
+
+bool AnalysisCache::ReadSlot(const Slot& slot, uint64_t verdictDigest, CachedAnalysis& out) const {
+    if (slot.pending) {
+        const auto& record = pendingRecords[slot.pendingIndex];
+        return DecodeRecord(record.data(), record.size(), verdictDigest, out);
+    }
+    const uint8_t* record = mapping.Data() + slot.offset;
+    return DecodeRecord(record, get32(record), verdictDigest, out);
+}
+
+bool AnalysisCache::Lookup(const FileIdentity& identity, uint64_t verdictDigest, CachedAnalysis& out) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = byIdentity.find(identity.Key());
+    if (it != byIdentity.end() && ReadSlot(it->second, verdictDigest, out)) {
+        hits++;
+        return true;
+    }
+    return false;
+}
+
+bool AnalysisCache::LookupContent(const std::string& contentHash, uint64_t verdictDigest, CachedAnalysis& out) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = contentHash.empty() ? byContent.end() : byContent.find(contentHash);
+    if (it != byContent.end() && ReadSlot(it->second, verdictDigest, out)) {
+        contentHits++;
+        return true;
+    }
+    misses++;
+    return false;
+}
+
+void AnalysisCache::Store(const FileIdentity& identity, uint64_t verdictDigest, const CachedAnalysis& analysis) {
+    const std::string& contentHash = analysis.hashes.sha256;
+    uint32_t signature = UINT32_MAX;
+    for (uint32_t i = 0; i < sizeof(signatureNames) / sizeof(signatureNames[0]); i++) {
+        if (analysis.signatureStatus == signatureNames[i]) signature = i;
+    }
+    if (signature == UINT32_MAX) {
+        return; // deleted / unreadable files are never cached
+    }
+
+    std::string rules;
+    for (const auto& rule : analysis.matchedRules) {
+        if (!rules.empty()) rules += '\n';
+        rules += rule;
+    }
+
+    std::vector<uint8_t> record;
+    record.reserve(RecordHeaderSize + rules.size());
+    put32(record, 0);
+    put32(record, 0);
+    put64(record, identity.volumeSerial);
+    record.insert(record.end(), identity.fileId, identity.fileId + 16);
+    put64(record, identity.size);
+    put64(record, identity.lastWrite);
+    // all three or none, the sha-256 doubles as the content key
+    uint8_t hashes[32 + 16 + 20] = {};
+    if (contentHash.size() == 32 && analysis.hashes.md5.size() == 16 && analysis.hashes.sha1.size() == 20) {
+        memcpy(hashes, contentHash.data(), 32);
+        memcpy(hashes + 32, analysis.hashes.md5.data(), 16);
+        memcpy(hashes + 48, analysis.hashes.sha1.data(), 20);
+    }
+    record.insert(record.end(), hashes, hashes + sizeof(hashes));
+    put64(record, verdictDigest);
+    put32(record, signature);
+    put32(record, (uint32_t)rules.size());
+    record.insert(record.end(), rules.begin(), rules.end());
+
+    uint32_t length = (uint32_t)record.size();
+    memcpy(record.data(), &length, 4);
+    uint32_t sum = checksum(record.data() + 8, length - 8);
+    memcpy(record.data() + 4, &sum, 4);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    Slot slot;
+    slot.pending = true;
+    slot.pendingIndex = pendingRecords.size();
+    if (byIdentity.count(identity.Key())) {
+        deadRecords++;
+    }
+    byIdentity[identity.Key()] = slot;
+    if (contentHash.size() == 32) {
+        byContent[contentHash] = slot;
+    }
+    pendingRecords.push_back(std::move(record));
+}
+
+void AnalysisCache::Flush() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (flushedRecords >= pendingRecords.size() || filePath.empty()) {
+        return;
+    }
+
+    HANDLE file = CreateFileW(filePath.c_str(), FILE_APPEND_DATA | GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        return;
+    }
+
+    LARGE_INTEGER size = {};
+    GetFileSizeEx(file, &size);
+    DWORD written = 0;
+    if (size.QuadPart == 0) {
+        uint8_t header[FileHeaderSize] = {};
+        memcpy(header, FileMagic, 8);
+        memcpy(header + 8, &FileVersion, 4);
+        WriteFile(file, header, sizeof(header), &written, NULL);
+    }
+
+    for (size_t i = flushedRecords; i < pendingRecords.size(); i++) {
+        WriteFile(file, pendingRecords[i].data(), (DWORD)pendingRecords[i].size(), &written, NULL);
+    }
+    FlushFileBuffers(file);
+    CloseHandle(file);
+    flushedRecords = pendingRecords.size();
+}
+
+void AnalysisCache::Compact() {
+    // the live records are copied out first: the mapping has to go before the file can be replaced or cut
+    std::vector<std::vector<uint8_t>> live;
+    live.reserve(byIdentity.size());
+    for (const auto& item : byIdentity) {
+        const uint8_t* record = mapping.Data() + item.second.offset;
+        live.emplace_back(record, record + get32(record));
+    }
+    mapping.Close();
+
+    // rewrite the live records into a temp file and swap it in, the old file stays intact until the rename
+    std::wstring tempPath = filePath + L".tmp";
+    bool replaced = false;
+    HANDLE file = CreateFileW(tempPath.c_str(), GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file != INVALID_HANDLE_VALUE) {
+        uint8_t header[FileHeaderSize] = {};
+        memcpy(header, FileMagic, 8);
+        memcpy(header + 8, &FileVersion, 4);
+        DWORD written = 0;
+        bool ok = WriteFile(file, header, sizeof(header), &written, NULL) && written == sizeof(header);
+        for (const auto& record : live) {
+            ok = ok && WriteFile(file, record.data(), (DWORD)record.size(), &written, NULL) && written == record.size();
+        }
+        ok = FlushFileBuffers(file) && ok;
+        CloseHandle(file);
+        replaced = ok && MoveFileExW(tempPath.c_str(), filePath.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH);
+        if (!replaced) {
+            DeleteFileW(tempPath.c_str());
+        }
+    }
+
+    // no rewrite (no temp file, or the other front end holds the cache open): the old file stays, but its torn tail
+    // has to go before Flush appends, Load stops there and would lose everything written after it for good.
+    // when even that fails nothing more is written this run
+    if (!replaced) {
+        HANDLE original = CreateFileW(filePath.c_str(), GENERIC_WRITE, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        LARGE_INTEGER end = {};
+        end.QuadPart = (LONGLONG)validBytes;
+        bool cut = original != INVALID_HANDLE_VALUE && SetFilePointerEx(original, end, NULL, FILE_BEGIN) && SetEndOfFile(original);
+        if (original != INVALID_HANDLE_VALUE) {
+            CloseHandle(original);
+        }
+        if (!cut) {
+            std::wcerr << L"Analysis cache " << filePath << L" could not be repaired, new verdicts are not saved this run" << std::endl;
+            filePath.clear();
+        }
+    }
+
+    // the mapping is gone, serve the live records from memory until the next load
+    byIdentity.clear();
+    byContent.clear();
+    for (auto& record : live) {
+        Slot slot;
+        slot.pending = true;
+        slot.pendingIndex = pendingRecords.size();
+        byIdentity[identityKeyAt(record.data())] = slot;
+        std::string contentKey = contentKeyAt(record.data());
+        if (!contentKey.empty()) {
+            byContent[contentKey] = slot;
+        }
+        pendingRecords.push_back(std::move(record));
+    }
+    deadRecords = 0;
+    // those records are already on disk, in the new file or ahead of the cut in the old one
+    flushedRecords = pendingRecords.size();
+}
+
+FileHashes AnalysisCache::HashFileContent(FileView& view) {
+    MultiHasher hasher;
+    bool ok = view.ForEachChunk([&hasher](const uint8_t* chunk, size_t length) {
+        hasher.Update(chunk, length);
+        return true;
+    }, [&hasher] { hasher = MultiHasher(); });
+    FileHashes hashes = hasher.Final();
+    return ok ? hashes : FileHashes();
+}
+
+void AnalysisCache::ResetStats() {
+    hits = 0;
+    contentHits = 0;
+    misses = 0;
+}
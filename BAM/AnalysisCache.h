@@ -0,0 +1,84 @@
+#pragma once
+#include <windows.h>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "../util/Digest.h"
+#include "../util/MappedFile.h"
+
+class FileView;
+
+// identity of a file on disk, any change in it means the cached verdict is stale
+struct FileIdentity {
+    uint64_t volumeSerial = 0;
+    uint8_t fileId[16] = {};
+    uint64_t size = 0;
+    uint64_t lastWrite = 0;
+
+    static bool FromHandle(HANDLE file, FileIdentity& out);
+    std::string Key() const;
+};
+
+struct CachedAnalysis {
+    std::wstring signatureStatus;
+    std::vector<std::string> matchedRules;
+    FileHashes hashes;
+};
+
+// persistent verdict cache, an append only log of checksummed records that is mapped on load
+// a crash can only leave a torn record at the tail, it fails its checksum and gets cut off on the next load
+class AnalysisCache {
+public:
+    static AnalysisCache& Instance();
+
+    bool Load(const std::wstring& path);
+    bool Load();
+    void Flush();
+
+    // verdictDigest covers what a verdict depends on besides the file itself (VerdictDigest), a record stored under
+    // another one is stale
+    static uint64_t VerdictDigest(uint64_t rulesetDigest, uint64_t certStoreDigest);
+    bool Lookup(const FileIdentity& identity, uint64_t verdictDigest, CachedAnalysis& out);
+    bool LookupContent(const std::string& contentHash, uint64_t verdictDigest, CachedAnalysis& out);
+    // analysis.hashes.sha256 is the content key, records without hashes are only found by identity
+    void Store(const FileIdentity& identity, uint64_t verdictDigest, const CachedAnalysis& analysis);
+
+    // md5, sha-1 and sha-256 of the whole file in one pass, empty if it couldn't be read
+    static FileHashes HashFileContent(FileView& view);
+    // %LOCALAPPDATA%\BAMParser, created on first use; empty if it can't be resolved
+    static std::wstring DataDirectory();
+
+    void ResetStats();
+    long long Hits() const { return hits.load(); }
+    long long ContentHits() const { return contentHits.load(); }
+    long long Misses() const { return misses.load(); }
+
+private:
+    AnalysisCache() = default;
+
+    struct Slot {
+        size_t offset = 0;        // into the mapping when pending is false
+        size_t pendingIndex = 0;  // into pendingRecords otherwise
+        bool pending = false;
+    };
+
+    bool ReadSlot(const Slot& slot, uint64_t verdictDigest, CachedAnalysis& out) const;
+    bool DecodeRecord(const uint8_t* record, size_t length, uint64_t verdictDigest, CachedAnalysis& out) const;
+    void Compact();
+
+    std::mutex mutex;
+    std::wstring filePath;
+    MappedFile mapping;
+    size_t validBytes = 0;
+    size_t deadRecords = 0;
+    std::unordered_map<std::string, Slot> byIdentity;
+    std::unordered_map<std::string, Slot> byContent;
+    std::vector<std::vector<uint8_t>> pendingRecords;
+    size_t flushedRecords = 0; // pendingRecords before this index are already on disk
+    std::atomic<long long> hits{ 0 };
+    std::atomic<long long> contentHits{ 0 };
+    std::atomic<long long> misses{ 0 };
+};
@@ -5,6 +5,20 @@
 #include <locale>
 #include <codecvt>
 #include <fstream>
+#include <chrono>
+#include <thread>
+#include <iterator>
+#include <cwctype>
+#include "WorkQueue.h"
+#include "VolumeMap.h"
+#include "CertStoreIndex.h"
+#include "../signature/AuthenticodeEngine.h"
+#include "../signature/CatalogIndex.h"
+#include "../replaceparser/ReplaceIndex.h"
+#include "../hashset/HashSet.h"
+#include "AnalysisCache.h"
+#include "FileView.h"
+#include "../hive/RegfHive.h"
 #include "../yara/yara.h"
 
 std::vector<GenericRule> genericRules;
@@ -24,38 +38,186 @@ std::string wstringToString(const std::wstring& wstr) {
     return str;
 }
 
-bool BAMParser::VerifyFileViaCatalog(LPCWSTR filePath)
+// one WTD_CHOICE_CATALOG check of a member hash against one catalog, sha-256 hashes need a sha-256 admin context
+static bool VerifyCatalogMember(LPCWSTR catalogPath, BYTE* hash, DWORD hashSize, LPCWSTR filePath, HCATADMIN catAdmin)
 {
-    HANDLE hCatAdmin = NULL;
-    if (!CryptCATAdminAcquireContext(&hCatAdmin, NULL, 0))
+    WINTRUST_CATALOG_INFO wtc = {};
+    wtc.cbStruct = sizeof(wtc);
+    wtc.pcwszCatalogFilePath = catalogPath;
+    wtc.pbCalculatedFileHash = hash;
+    wtc.cbCalculatedFileHash = hashSize;
+    wtc.pcwszMemberFilePath = filePath;
+    wtc.hCatAdmin = catAdmin;
+
+    WINTRUST_DATA wtd = {};
+    wtd.cbStruct = sizeof(wtd);
+    wtd.dwUnionChoice = WTD_CHOICE_CATALOG;
+    wtd.pCatalog = &wtc;
+    wtd.dwUIChoice = WTD_UI_NONE;
+    wtd.fdwRevocationChecks = WTD_REVOKE_NONE;
+    wtd.dwProvFlags = 0;
+    wtd.dwStateAction = WTD_STATEACTION_VERIFY;
+
+    GUID action = WINTRUST_ACTION_GENERIC_VERIFY_V2;
+    LONG res = WinVerifyTrust(NULL, &action, &wtd);
+
+    wtd.dwStateAction = WTD_STATEACTION_CLOSE;
+    WinVerifyTrust(NULL, &action, &wtd);
+
+    return res == ERROR_SUCCESS;
+}
+
+// offline verdicts skip WinVerifyTrust, but a pkcs#7 that verifies only says the signer cert signed it, not who that is.
+// the local chain engine has to take the signer up to a root of this machine from the certs the message carries:
+// nothing is fetched, no revocation, expired certs are fine (timestamps aren't checked)
+static bool SignerChainsToRoot(const BYTE* pkcs7, DWORD size)
+{
+    HCRYPTMSG message = CryptMsgOpenToDecode(X509_ASN_ENCODING | PKCS_7_ASN_ENCODING, 0, 0, NULL, NULL, NULL);
+    if (!message) {
         return false;
+    }
+    bool trusted = false;
+    HCERTSTORE store = NULL;
+    PCCERT_CONTEXT signer = NULL;
+    std::vector<BYTE> signerInfo;
+    DWORD infoSize = 0;
+    if (CryptMsgUpdate(message, pkcs7, size, TRUE) &&
+        (store = CertOpenStore(CERT_STORE_PROV_MSG, X509_ASN_ENCODING | PKCS_7_ASN_ENCODING, NULL, 0, message)) != NULL &&
+        CryptMsgGetParam(message, CMSG_SIGNER_CERT_INFO_PARAM, 0, NULL, &infoSize)) {
+        signerInfo.resize(infoSize);
+        if (CryptMsgGetParam(message, CMSG_SIGNER_CERT_INFO_PARAM, 0, signerInfo.data(), &infoSize)) {
+            signer = CertFindCertificateInStore(store, X509_ASN_ENCODING | PKCS_7_ASN_ENCODING, 0, CERT_FIND_SUBJECT_CERT, signerInfo.data(), NULL);
+        }
+    }
 
-    HANDLE hFile = CreateFileW(filePath, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, 0, NULL);
-    if (hFile == INVALID_HANDLE_VALUE)
-    {
-        CryptCATAdminReleaseContext(hCatAdmin, 0);
+    // the message has to be signed by that cert, and the cert has to be good for code signing all the way up
+    if (signer && CryptMsgControl(message, 0, CMSG_CTRL_VERIFY_SIGNATURE, signer->pCertInfo)) {
+        LPSTR codeSigning = (LPSTR)szOID_PKIX_KP_CODE_SIGNING;
+        CERT_CHAIN_PARA chainPara = {};
+        chainPara.cbSize = sizeof(chainPara);
+        chainPara.RequestedUsage.dwType = USAGE_MATCH_TYPE_AND;
+        chainPara.RequestedUsage.Usage.cUsageIdentifier = 1;
+        chainPara.RequestedUsage.Usage.rgpszUsageIdentifier = &codeSigning;
+
+        PCCERT_CHAIN_CONTEXT chain = NULL;
+        if (CertGetCertificateChain(NULL, signer, NULL, store, &chainPara, CERT_CHAIN_CACHE_ONLY_URL_RETRIEVAL, NULL, &chain)) {
+            CERT_CHAIN_POLICY_PARA policyPara = {};
+            policyPara.cbSize = sizeof(policyPara);
+            policyPara.dwFlags = CERT_CHAIN_POLICY_IGNORE_ALL_NOT_TIME_VALID_FLAGS;
+            CERT_CHAIN_POLICY_STATUS policyStatus = {};
+            policyStatus.cbSize = sizeof(policyStatus);
+            trusted = CertVerifyCertificateChainPolicy(CERT_CHAIN_POLICY_BASE, chain, &policyPara, &policyStatus) &&
+                policyStatus.dwError == ERROR_SUCCESS;
+            CertFreeCertificateChain(chain);
+        }
+    }
+
+    if (signer) {
+        CertFreeCertificateContext(signer);
+    }
+    if (store) {
+        CertCloseStore(store, 0);
+    }
+    CryptMsgClose(message);
+    return trusted;
+}
+
+// the first WIN_CERTIFICATE of the image, the one the engine verified
+static bool EmbeddedSignerChainsToRoot(const uint8_t* image, size_t size)
+{
+    uint32_t offset = 0, length = 0;
+    constexpr uint32_t headerSize = offsetof(WIN_CERTIFICATE, bCertificate);
+    if (!AuthenticodeEngine::LocateCertificateTable(image, size, offset, length) || length <= headerSize) {
         return false;
     }
+    WIN_CERTIFICATE header;
+    memcpy(&header, image + offset, headerSize);
+    uint32_t certificateLength = (std::min)((uint32_t)header.dwLength, length);
+    if (header.wCertificateType != WIN_CERT_TYPE_PKCS_SIGNED_DATA || certificateLength <= headerSize) {
+        return false;
+    }
+    return SignerChainsToRoot(image + offset + headerSize, certificateLength - headerSize);
+}
 
-    DWORD dwHashSize = 0;
-    if (!CryptCATAdminCalcHashFromFileHandle(hFile, &dwHashSize, NULL, 0))
-    {
-        CloseHandle(hFile);
-        CryptCATAdminReleaseContext(hCatAdmin, 0);
+// offline a catalog only vouches for its members when its own signer chains up like an embedded one has to
+static bool CatalogSignerChainsToRoot(const std::filesystem::path& catalogPath)
+{
+    MappedFile catalog;
+    return catalog.Open(catalogPath) && catalog.Size() <= MAXDWORD && SignerChainsToRoot(catalog.Data(), (DWORD)catalog.Size());
+}
+
+bool BAMParser::VerifyFileViaCatalogIndex(FileView& view, LPCWSTR filePath)
+{
+    CatalogIndex& catalogs = CatalogIndex::Instance();
+
+    // sha-1 and sha-256 member hashes in one pass over the bytes the view already holds
+    CatalogMemberHasher hasher(view.Size());
+    if (!view.ForEachChunk([&hasher](const uint8_t* chunk, size_t length) {
+        hasher.Update(chunk, length);
+        return true;
+    }, [&hasher, &view] { hasher = CatalogMemberHasher(view.Size()); })) {
+        return false;
+    }
+    std::string hashes[2];
+    hasher.Final(hashes[0], hashes[1]);
+
+    std::vector<uint32_t> candidates;
+    for (auto& hash : hashes) {
+        candidates.clear();
+        catalogs.Find(hash, candidates);
+        for (uint32_t catalog : candidates) {
+            // the catalog signature is checked once per scan, every other member of it is just the lookup
+            CatalogIndex::Trust trust = catalogs.CatalogTrust(catalog);
+            if (trust == CatalogIndex::Trust::Unknown && options.offlineSignatures) {
+                // a copied catroot is whatever was collected, an unsigned or self-signed .cat in it vouches for nothing
+                bool trusted = CatalogSignerChainsToRoot(catalogs.CatalogPath(catalog));
+                trust = trusted ? CatalogIndex::Trust::Trusted : CatalogIndex::Trust::Untrusted;
+                catalogs.SetCatalogTrust(catalog, trust);
+            }
+            else if (trust == CatalogIndex::Trust::Unknown) {
+                HCATADMIN catAdmin = NULL;
+                if (hash.size() == Sha256::DigestSize && !CryptCATAdminAcquireContext2(&catAdmin, NULL, BCRYPT_SHA256_ALGORITHM, NULL, 0)) {
+                    catAdmin = NULL;
+                }
+                std::wstring catalogPath = catalogs.CatalogPath(catalog).wstring();
+                bool trusted = VerifyCatalogMember(catalogPath.c_str(), (BYTE*)hash.data(), (DWORD)hash.size(), filePath, catAdmin);
+                if (catAdmin) {
+                    CryptCATAdminReleaseContext(catAdmin, 0);
+                }
+                trust = trusted ? CatalogIndex::Trust::Trusted : CatalogIndex::Trust::Untrusted;
+                catalogs.SetCatalogTrust(catalog, trust);
+            }
+            if (trust == CatalogIndex::Trust::Trusted) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool BAMParser::VerifyFileViaCatalog(FileView& view, LPCWSTR filePath)
+{
+    if (CatalogIndex::Instance().IsOpen()) {
+        return VerifyFileViaCatalogIndex(view, filePath);
+    }
+    if (options.offlineSignatures) {
         return false;
     }
 
-    BYTE* pbHash = new BYTE[dwHashSize];
-    if (!CryptCATAdminCalcHashFromFileHandle(hFile, &dwHashSize, pbHash, 0))
+    HANDLE hCatAdmin = NULL;
+    if (!CryptCATAdminAcquireContext(&hCatAdmin, NULL, 0))
+        return false;
+
+    // the hash is at most sha-512 sized, so one call on the shared handle is enough (no size query pass)
+    BYTE pbHash[64];
+    DWORD dwHashSize = sizeof(pbHash);
+    view.NoteExternalRead();
+    if (!CryptCATAdminCalcHashFromFileHandle(view.Handle(), &dwHashSize, pbHash, 0))
     {
-        delete[] pbHash;
-        CloseHandle(hFile);
         CryptCATAdminReleaseContext(hCatAdmin, 0);
         return false;
     }
 
-    CloseHandle(hFile);
-
     CATALOG_INFO catInfo = { 0 };
     catInfo.cbStruct = sizeof(catInfo);
 
@@ -64,29 +226,7 @@ bool BAMParser::VerifyFileViaCatalog(LPCWSTR filePath)
 
     while (hCatInfo && CryptCATCatalogInfoFromContext(hCatInfo, &catInfo, 0))
     {
-        WINTRUST_CATALOG_INFO wtc = {};
-        wtc.cbStruct = sizeof(wtc);
-        wtc.pcwszCatalogFilePath = catInfo.wszCatalogFile;
-        wtc.pbCalculatedFileHash = pbHash;
-        wtc.cbCalculatedFileHash = dwHashSize;
-        wtc.pcwszMemberFilePath = filePath;
-
-        WINTRUST_DATA wtd = {};
-        wtd.cbStruct = sizeof(wtd);
-        wtd.dwUnionChoice = WTD_CHOICE_CATALOG;
-        wtd.pCatalog = &wtc;
-        wtd.dwUIChoice = WTD_UI_NONE;
-        wtd.fdwRevocationChecks = WTD_REVOKE_NONE;
-        wtd.dwProvFlags = 0;
-        wtd.dwStateAction = WTD_STATEACTION_VERIFY;
-
-        GUID action = WINTRUST_ACTION_GENERIC_VERIFY_V2;
-        LONG res = WinVerifyTrust(NULL, &action, &wtd);
-
-        wtd.dwStateAction = WTD_STATEACTION_CLOSE;
-        WinVerifyTrust(NULL, &action, &wtd);
-
-        if (res == ERROR_SUCCESS)
+        if (VerifyCatalogMember(catInfo.wszCatalogFile, pbHash, dwHashSize, filePath, NULL))
         {
             isCatalogSigned = true;
             break;
@@ -98,19 +238,87 @@ bool BAMParser::VerifyFileViaCatalog(LPCWSTR filePath)
         CryptCATAdminReleaseCatalogContext(hCatAdmin, hCatInfo, 0);
 
     CryptCATAdminReleaseContext(hCatAdmin, 0);
-    delete[] pbHash;
 
     return isCatalogSigned;
 }
 
-std::wstring BAMParser::CheckDigitalSignature(const std::wstring& filePath) {
-    if (!PathFileExistsW(filePath.c_str())) {
-        return L"Deleted";
+void BAMParser::OpenCatalogIndex() {
+    std::filesystem::path catroot = options.catrootPath;
+    wchar_t indexName[64] = L"catalogs.index";
+    if (catroot.empty()) {
+        wchar_t systemDirectory[MAX_PATH];
+        UINT length = GetSystemDirectoryW(systemDirectory, MAX_PATH);
+        if (length == 0 || length >= MAX_PATH) {
+            return;
+        }
+        catroot = std::filesystem::path(systemDirectory) / L"CatRoot";
+    }
+    else {
+        // copied catroots get an index each, named after their path
+        uint64_t key = 14695981039346656037ULL;
+        for (wchar_t c : catroot.wstring()) {
+            key = (key ^ (uint64_t)towlower(c)) * 1099511628211ULL;
+        }
+        swprintf_s(indexName, L"catalogs-%016llx.index", (unsigned long long)key);
+    }
+
+    std::wstring directory = AnalysisCache::DataDirectory();
+    std::filesystem::path indexPath = directory.empty() ? std::filesystem::path() : std::filesystem::path(directory) / indexName;
+    if (!CatalogIndex::Instance().Open(catroot, indexPath)) {
+        std::wcout << L"No catalog index for " << catroot.wstring() << L", catalog checks go through CryptCATAdmin" << std::endl;
+    }
+}
+
+void BAMParser::OpenKnownHashes() {
+    std::wstring directory = AnalysisCache::DataDirectory();
+    auto pick = [&](const std::wstring& configured, const wchar_t* defaultName) {
+        if (!configured.empty()) {
+            return std::filesystem::path(configured);
+        }
+        std::error_code error;
+        std::filesystem::path fallback = directory.empty() ? std::filesystem::path() : std::filesystem::path(directory) / defaultName;
+        return !fallback.empty() && std::filesystem::exists(fallback, error) ? fallback : std::filesystem::path();
+    };
+    KnownHashes::Instance().Open(pick(options.allowlistPath, L"allowlist.hashset"), pick(options.blocklistPath, L"blocklist.hashset"));
+}
+
+std::wstring BAMParser::CheckDigitalSignature(FileView& view, const std::wstring& filePath) {
+    // pe images are checked in memory first. only an image without any certificate table skips WinVerifyTrust,
+    // it has nothing to check there either; a signature the engine calls Invalid may just be one it can't parse,
+    // so WinVerifyTrust stays the judge for those unless it is turned off
+    AuthenticodeResult embedded;
+    if (view.ConsumeMapped([&embedded](const uint8_t* data, size_t length) {
+        return AuthenticodeEngine::Verify(data, length, embedded);
+    })) {
+        if (embedded.status == AuthenticodeStatus::NoSignature) {
+            // only a catalog can still vouch for the file
+            return VerifyFileViaCatalog(view, filePath.c_str()) ? L"Signed" : L"Not signed";
+        }
+        if (options.offlineSignatures) {
+            if (embedded.status == AuthenticodeStatus::Invalid) {
+                return VerifyFileViaCatalog(view, filePath.c_str()) ? L"Signed" : L"Not signed";
+            }
+            std::wstring verdict = AuthenticodeEngine::Verdict(embedded);
+            if (verdict == L"Signed" && CertStoreIndex::Instance().ContainsThumbprint(embedded.chain.front().sha1)) {
+                verdict = L"Fake Signature";
+            }
+            // the engine doesn't decide chain trust, a self-made cert verifies as well as a real one. not "Signed",
+            // so the file is still scanned
+            else if (verdict == L"Signed" && !view.ConsumeMapped(EmbeddedSignerChainsToRoot)) {
+                verdict = L"Signed (untrusted chain)";
+            }
+            return verdict;
+        }
+    }
+    else if (options.offlineSignatures) {
+        return VerifyFileViaCatalog(view, filePath.c_str()) ? L"Signed" : L"Not signed";
     }
+
     WINTRUST_FILE_INFO fileInfo;
     ZeroMemory(&fileInfo, sizeof(fileInfo));
     fileInfo.cbStruct = sizeof(fileInfo);
     fileInfo.pcwszFilePath = filePath.c_str();
+    fileInfo.hFile = view.Handle();
 
     GUID guidAction = WINTRUST_ACTION_GENERIC_VERIFY_V2;
 
@@ -123,6 +331,7 @@ std::wstring BAMParser::CheckDigitalSignature(const std::wstring& filePath) {
     winTrustData.dwStateAction = WTD_STATEACTION_VERIFY;
     winTrustData.pFile = &fileInfo;
 
+    view.NoteExternalRead();
     LONG status = WinVerifyTrust(NULL, &guidAction, &winTrustData);
     std::wstring result = L"Not signed";
     PCCERT_CONTEXT signingCert = nullptr;
@@ -140,48 +349,18 @@ std::wstring BAMParser::CheckDigitalSignature(const std::wstring& filePath) {
 
                     char subjectName[256];
                     CertNameToStrA(signingCert->dwCertEncodingType, &signingCert->pCertInfo->Subject, CERT_X500_NAME_STR, subjectName, sizeof(subjectName));
-                    std::string subject(subjectName);
-                    std::transform(subject.begin(), subject.end(), subject.begin(), ::tolower);
-                    static const char* cheats[] = { "manthe industries, llc", "slinkware", "amstion limited", "newfakeco", "faked signatures inc" };
-                    for (auto c : cheats) {
-                        if (subject.find(c) != std::string::npos) {
-                            result = L"Cheat Signature";
-                            break;
-                        }
+                    if (AuthenticodeEngine::IsCheatSubject(subjectName)) {
+                        result = L"Cheat Signature";
                     }
 
-                    DWORD hashLen = 0;
-                    if (CertGetCertificateContextProperty(signingCert, CERT_SHA1_HASH_PROP_ID, nullptr, &hashLen)) {
-                        std::vector<BYTE> hash(hashLen);
-                        if (CertGetCertificateContextProperty(signingCert, CERT_SHA1_HASH_PROP_ID, hash.data(), &hashLen)) {
-                            CRYPT_HASH_BLOB blob{ hashLen, hash.data() };
-                            static const LPCWSTR storeNames[] = { L"MY", L"Root", L"Trust", L"CA", L"UserDS", L"TrustedPublisher", L"Disallowed", L"AuthRoot", L"TrustedPeople", L"ClientAuthIssuer", L"CertificateEnrollment", L"SmartCardRoot" };
-                            const DWORD contexts[] = { CERT_SYSTEM_STORE_CURRENT_USER | CERT_STORE_OPEN_EXISTING_FLAG, CERT_SYSTEM_STORE_LOCAL_MACHINE | CERT_STORE_OPEN_EXISTING_FLAG };
-                            bool found = false;
-                            for (auto ctx : contexts) {
-                                for (auto name : storeNames) {
-                                    HCERTSTORE store = CertOpenStore(CERT_STORE_PROV_SYSTEM_W, X509_ASN_ENCODING | PKCS_7_ASN_ENCODING, NULL, ctx, name);
-                                    if (!store) continue;
-                                    PCCERT_CONTEXT foundCert = CertFindCertificateInStore(store, signingCert->dwCertEncodingType, 0, CERT_FIND_SHA1_HASH, &blob, NULL);
-                                    if (foundCert) {
-                                        found = true;
-                                        CertFreeCertificateContext(foundCert);
-                                    }
-                                    CertCloseStore(store, 0);
-                                    if (found) break;
-                                }
-                                if (found) break;
-                            }
-                            if (found) {
-                                result = L"Fake Signature";
-                            }
-                        }
+                    if (CertStoreIndex::Instance().Contains(signingCert)) {
+                        result = L"Fake Signature";
                     }
                 }
             }
         }
     } else {
-        if (VerifyFileViaCatalog(filePath.c_str())) {
+        if (VerifyFileViaCatalog(view, filePath.c_str())) {
             result = L"Signed";
         }
     }
@@ -193,123 +372,238 @@ std::wstring BAMParser::CheckDigitalSignature(const std::wstring& filePath) {
 }
 
 
-bool BAMParser::IsValidTimeFormat(const std::wstring& timeStr) {
-    if (timeStr.length() != 19) return false;
-    std::wistringstream ss(timeStr);
-    std::tm tm = {};
-    ss >> std::get_time(&tm, L"%Y-%m-%d %H:%M:%S");
-    return !ss.fail();
-}
-
-FILETIME BAMParser::StringToFileTimeUTC(const std::wstring& timeStr) {
-    std::wistringstream ss(timeStr);
-    std::tm tm = {};
-    ss >> std::get_time(&tm, L"%Y-%m-%d %H:%M:%S");
-
-    SYSTEMTIME localSt = {
-        (WORD)(tm.tm_year + 1900),
-        (WORD)(tm.tm_mon + 1),
-        (WORD)tm.tm_wday,
-        (WORD)tm.tm_mday,
-        (WORD)tm.tm_hour,
-        (WORD)tm.tm_min,
-        (WORD)tm.tm_sec,
-        0
-    };
-
-    SYSTEMTIME utcSt;
-    TzSpecificLocalTimeToSystemTime(NULL, &localSt, &utcSt);
-
-    FILETIME ftUTC;
-    SystemTimeToFileTime(&utcSt, &ftUTC);
-    return ftUTC;
-}
+std::wstring BAMParser::FileTimeToStringLocal(uint64_t fileTime) {
+    FILETIME ft;
+    ft.dwLowDateTime = (DWORD)fileTime;
+    ft.dwHighDateTime = (DWORD)(fileTime >> 32);
 
-std::wstring BAMParser::FileTimeToStringLocal(const FILETIME& ft) {
     FILETIME localFt;
     FileTimeToLocalFileTime(&ft, &localFt);
     SYSTEMTIME st;
     FileTimeToSystemTime(&localFt, &st);
 
-    std::wostringstream oss;
-    oss << std::setfill(L'0')
-        << st.wYear << L"-"
-        << std::setw(2) << st.wMonth << L"-"
-        << std::setw(2) << st.wDay << L" "
-        << std::setw(2) << st.wHour << L":"
-        << std::setw(2) << st.wMinute << L":"
-        << std::setw(2) << st.wSecond;
-    return oss.str();
+    wchar_t buffer[32];
+    swprintf_s(buffer, L"%04u-%02u-%02u %02u:%02u:%02u", st.wYear, st.wMonth, st.wDay, st.wHour, st.wMinute, st.wSecond);
+    return buffer;
 }
 
-bool BAMParser::IsInCurrentInstance(const std::wstring& execTime) {
-    if (!IsValidTimeFormat(execTime)) {
-        return false;
+void LogonSessionIndex::Build(const std::vector<LogonSessionInfo>& sessions, uint64_t now) {
+    intervals.clear();
+    latestLogon = 0;
+    captureTime = now;
+
+    for (const auto& session : sessions) {
+        if (!session.isInteractive) continue;
+        uint64_t logon = ((uint64_t)session.logonTime.dwHighDateTime << 32) | session.logonTime.dwLowDateTime;
+        // sessions that are still alive last until the moment the index was captured
+        intervals.push_back({ logon, now });
+        latestLogon = (std::max)(latestLogon, logon);
     }
 
-    auto sessions = GetInteractiveLogonSessions();
-    if (sessions.empty()) {
-        return false;
+    std::sort(intervals.begin(), intervals.end(), [](const Interval& a, const Interval& b) {
+        return a.start < b.start;
+    });
+
+    // merge overlaps so a single upper_bound answers "inside any session"
+    std::vector<Interval> merged;
+    for (const auto& interval : intervals) {
+        if (!merged.empty() && interval.start <= merged.back().end) {
+            merged.back().end = (std::max)(merged.back().end, interval.end);
+        }
+        else {
+            merged.push_back(interval);
+        }
     }
+    intervals = std::move(merged);
+}
+
+bool LogonSessionIndex::InCurrentInstance(uint64_t fileTime) const {
+    return latestLogon != 0 && fileTime >= latestLogon && fileTime <= captureTime;
+}
 
-    const LogonSessionInfo& firstSession = sessions.front();
+bool LogonSessionIndex::InAnySession(uint64_t fileTime) const {
+    auto it = std::upper_bound(intervals.begin(), intervals.end(), fileTime, [](uint64_t value, const Interval& interval) {
+        return value < interval.start;
+    });
+    if (it == intervals.begin()) return false;
+    --it;
+    return fileTime <= it->end;
+}
 
-    SYSTEMTIME utcCurrentSysTime;
-    GetSystemTime(&utcCurrentSysTime);
-    FILETIME currentTime;
-    SystemTimeToFileTime(&utcCurrentSysTime, &currentTime);
+std::vector<LogonSessionInfo> BAMParser::GetInteractiveLogonSessions() {
+    std::vector<LogonSessionInfo> sessions;
+    ULONG sessionCount = 0;
+    PLUID sessionList = nullptr;
 
-    FILETIME execFt = StringToFileTimeUTC(execTime);
+    if (LsaEnumerateLogonSessions(&sessionCount, &sessionList) != STATUS_SUCCESS) {
+        return sessions;
+    }
 
-    return (CompareFileTime(&execFt, &firstSession.logonTime) >= 0 &&
-        CompareFileTime(&execFt, &currentTime) <= 0);
-}
+    for (ULONG i = 0; i < sessionCount; i++) {
+        PSECURITY_LOGON_SESSION_DATA sessionData = nullptr;
+        if (LsaGetLogonSessionData(&sessionList[i], &sessionData) != STATUS_SUCCESS || !sessionData) {
+            continue;
+        }
 
+        SECURITY_LOGON_TYPE type = (SECURITY_LOGON_TYPE)sessionData->LogonType;
+        bool interactive = type == Interactive || type == RemoteInteractive || type == CachedInteractive ||
+            type == CachedRemoteInteractive || type == Unlock;
+
+        if (interactive && sessionData->LogonTime.QuadPart != 0) {
+            LogonSessionInfo info;
+            info.logonTime.dwLowDateTime = sessionData->LogonTime.LowPart;
+            info.logonTime.dwHighDateTime = (DWORD)sessionData->LogonTime.HighPart;
+            info.sessionId = sessionData->Session;
+            info.isInteractive = true;
+            sessions.push_back(info);
+        }
+        LsaFreeReturnBuffer(sessionData);
+    }
 
-std::wstring BAMParser::ConvertHardDiskVolumeToLetter(const std::wstring& path) {
-    wchar_t drives[MAX_PATH];
-    if (GetLogicalDriveStringsW(MAX_PATH, drives)) {
-        wchar_t volumeName[MAX_PATH];
-        wchar_t driveLetter[] = L" :";
+    LsaFreeReturnBuffer(sessionList);
+    return sessions;
+}
 
-        for (wchar_t* drive = drives; *drive; drive += 4) {
-            driveLetter[0] = drive[0];
-            if (QueryDosDeviceW(driveLetter, volumeName, MAX_PATH)) {
-                std::wstring volPath = path;
-                std::wstring volName = volumeName;
+// where the file of a BAM path is read from, empty when it can't be looked at
+std::wstring BAMParser::AnalysisPath(const std::wstring& path) const {
+    if (options.hivePath.empty()) {
+        return VolumeMap::IsUnresolved(path) ? std::wstring() : path;
+    }
+    if (options.evidenceRoot.empty()) {
+        return std::wstring();
+    }
+    std::filesystem::path root = options.evidenceRoot;
+    if (path.size() >= 3 && iswalpha(path[0]) && path[1] == L':' && path[2] == L'\\') {
+        return (root / std::wstring(1, (wchar_t)towupper(path[0])) / path.substr(3)).wstring();
+    }
+    // a volume the hive can't put a letter on is looked for under its device name, <root>\HarddiskVolume3\...
+    size_t nameEnd = path.find(L'\\', 8);
+    if (path.compare(0, 8, L"\\Device\\") == 0 && nameEnd != std::wstring::npos) {
+        return (root / path.substr(8, nameEnd - 8) / path.substr(nameEnd + 1)).wstring();
+    }
+    return std::wstring();
+}
 
-                if (volPath.find(volName) == 0) {
-                    return std::wstring(1, drive[0]) + L":";
-                }
+BAMEntry BAMParser::AnalyzeRecord(const BAMPathRecord& record) {
+    BAMEntry entry;
+    entry.path = record.path;
+    entry.sid = record.sid;
+    entry.host = hiveHost;
+    entry.executionFileTime = ((uint64_t)record.lastExecution.dwHighDateTime << 32) | record.lastExecution.dwLowDateTime;
+    entry.executionTime = FileTimeToStringLocal(entry.executionFileTime);
+    // logon sessions of this machine say nothing about a collected hive
+    entry.isInCurrentInstance = options.hivePath.empty() && sessionIndex.InCurrentInstance(entry.executionFileTime);
+    entry.isInInteractiveSession = options.hivePath.empty() && sessionIndex.InAnySession(entry.executionFileTime);
+
+    // a hive row without an evidence root gets no verdict at all, not one about this machine's file of that name,
+    // and a path on a volume nobody could name has no file to look at
+    std::wstring filePath = AnalysisPath(entry.path);
+    if (filePath.empty()) {
+        entry.signatureStatus = VolumeMap::IsUnresolved(entry.path) ? L"Unresolved" : L"Unchecked";
+        return entry;
+    }
 
-                std::wstring globalRootPrefix = L"\\\\?\\GLOBALROOT";
-                if (volPath.find(globalRootPrefix) == 0) {
-                    volPath = volPath.substr(globalRootPrefix.length());
-                    if (volPath.find(volName) == 0) {
-                        return std::wstring(1, drive[0]) + L":";
-                    }
+    std::string narrowPath = wstringToString(entry.path);
+
+    // one open per file: it is the existence check, the identity, and the bytes every analyzer below reads
+    FileView view;
+    bool exists = view.Open(filePath);
+
+    // unchanged files reuse the verdict of an earlier scan, by identity first and by content after that
+    // partial runs (some analyzers disabled, offline signature verdicts) neither read nor write the cache
+    bool useCache = options.useCache && options.checkSignatures && options.scanYara && !options.offlineSignatures;
+    AnalysisCache& cache = AnalysisCache::Instance();
+    KnownHashes& known = KnownHashes::Instance();
+    uint64_t digest = AnalysisCache::VerdictDigest(getRulesetDigest(), CertStoreIndex::Instance().ContentDigest());
+    FileIdentity identity;
+    bool hasIdentity = useCache && exists && view.Identity(identity);
+    CachedAnalysis cached;
+    FileHashes hashes;
+    HashVerdict verdict = HashVerdict::Unknown;
+
+    if (hasIdentity && cache.Lookup(identity, digest, cached)) {
+        entry.signatureStatus = cached.signatureStatus;
+        entry.matched_rules = cached.matchedRules;
+        hashes = cached.hashes;
+        // the lists change between scans, a cached verdict doesn't hide a file that got blocklisted since
+        if (known.Classify(hashes.sha256) == HashVerdict::KnownBad) {
+            entry.signatureStatus = L"Known Cheat";
+        }
+    }
+    else {
+        // md5 / sha-1 / sha-256 in one pass, the sha-256 is also the content key of the cache and the list key
+        if (exists && (hasIdentity || options.computeHashes || known.IsOpen())) {
+            hashes = AnalysisCache::HashFileContent(view);
+        }
+        // classified before any expensive analyzer: blocklisted files get their verdict here,
+        // allowlisted ones skip yara. neither goes into the cache, the lists may change before the next scan
+        verdict = exists ? known.Classify(hashes.sha256) : HashVerdict::Unknown;
+
+        if (verdict == HashVerdict::KnownBad) {
+            entry.signatureStatus = L"Known Cheat";
+        }
+        else if (hasIdentity && cache.LookupContent(hashes.sha256, digest, cached)) {
+            entry.signatureStatus = cached.signatureStatus;
+            entry.matched_rules = cached.matchedRules;
+            cached.hashes = hashes;
+            cache.Store(identity, digest, cached);
+        }
+        else {
+            if (!exists) {
+                entry.signatureStatus = L"Deleted";
+            }
+            else if (options.checkSignatures) {
+                entry.signatureStatus = CheckDigitalSignature(view, filePath);
+            }
+            else {
+                entry.signatureStatus = L"Unchecked";
+            }
+            if (options.scanYara && exists && entry.signatureStatus != L"Signed" && verdict != HashVerdict::KnownGood) {
+                // files that can't be mapped, or whose mapping failed part way, are read through the handle
+                if (!view.ConsumeMapped([&entry](const uint8_t* data, size_t length) {
+                    return scan_with_yara_memory(data, length, entry.matched_rules);
+                })) {
+                    entry.matched_rules.clear();
+                    scan_with_yara_fd(view.Handle(), entry.matched_rules);
                 }
             }
+            if (hasIdentity && verdict == HashVerdict::Unknown) {
+                cache.Store(identity, digest, { entry.signatureStatus, entry.matched_rules, hashes });
+            }
         }
     }
-    return L"?:";
-}
+    if (options.computeHashes && !hashes.Empty()) {
+        entry.md5 = DigestToHex(hashes.md5);
+        entry.sha1 = DigestToHex(hashes.sha1);
+        entry.sha256 = DigestToHex(hashes.sha256);
+    }
 
-void BAMParser::Parse() {
-    if (!ReplaceScanner::init()) {
-        std::cerr << "Failed to initialize ReplaceParser." << std::endl;
-        return;
+    // journal results of this exact file: its path, plus its (volume, file reference) when it still exists
+    if (replaceIndex) {
+        uint32_t volumeSerial = 0;
+        uint64_t fileReference = 0;
+        if (hasIdentity || (exists && view.Identity(identity))) {
+            volumeSerial = (uint32_t)identity.volumeSerial;
+            memcpy(&fileReference, identity.fileId, sizeof(fileReference));
+        }
+        thread_local std::vector<const ReplaceFileStruct*> matches;
+        replaceIndex->Find(narrowPath, volumeSerial, fileReference, matches);
+        for (const ReplaceFileStruct* match : matches) {
+            entry.replace_results.push_back(*match);
+        }
     }
+    view.Close();
+
+    return entry;
+}
 
+bool BAMParser::EnumerateLiveRecords(const std::function<void(BAMPathRecord&&)>& sink) {
     HKEY hKey;
     const wchar_t* keyPath = L"SYSTEM\\CurrentControlSet\\Services\\bam\\State\\UserSettings";
 
-    entries.clear();
-
     if (RegOpenKeyExW(HKEY_LOCAL_MACHINE, keyPath, 0, KEY_READ, &hKey) != ERROR_SUCCESS) {
         std::wcout << L"Failed to open BAM key\n";
-        ReplaceScanner::destroy();
-        return;
+        return false;
     }
 
     DWORD subKeyCount = 0;
@@ -317,77 +611,277 @@ void BAMParser::Parse() {
         nullptr, nullptr, nullptr, nullptr, nullptr, nullptr) != ERROR_SUCCESS) {
         RegCloseKey(hKey);
         std::wcout << L"Failed to query BAM key info\n";
-        ReplaceScanner::destroy();
-        return;
+        return false;
     }
 
+    volumeMap = VolumeMap::CaptureLive();
+
+    size_t index = 0;
+    std::vector<wchar_t> valueName(32768);
+
     for (DWORD i = 0; i < subKeyCount; i++) {
         wchar_t subKeyName[256];
         DWORD subKeyNameSize = 256;
 
         if (RegEnumKeyExW(hKey, i, subKeyName, &subKeyNameSize, nullptr, nullptr,
-            nullptr, nullptr) == ERROR_SUCCESS) {
-            HKEY hSubKey;
-            std::wstring fullSubKeyPath = std::wstring(keyPath) + L"\\" + subKeyName;
-
-            if (RegOpenKeyExW(HKEY_LOCAL_MACHINE, fullSubKeyPath.c_str(), 0,
-                KEY_READ, &hSubKey) == ERROR_SUCCESS) {
-                DWORD valueCount = 0;
-                if (RegQueryInfoKeyW(hSubKey, nullptr, nullptr, nullptr, nullptr, nullptr,
-                    nullptr, &valueCount, nullptr, nullptr, nullptr,
-                    nullptr) == ERROR_SUCCESS) {
-
-                    for (DWORD j = 0; j < valueCount; j++) {
-                        wchar_t valueName[32768];
-                        DWORD valueNameSize = 32768;
-                        BYTE valueData[1024];
-                        DWORD valueDataSize = 1024;
-                        DWORD valueType;
-
-                        if (RegEnumValueW(hSubKey, j, valueName, &valueNameSize, nullptr,
-                            &valueType, valueData, &valueDataSize) == ERROR_SUCCESS) {
-                            if (valueType == REG_BINARY && valueDataSize >= sizeof(FILETIME)) {
-                                std::wstring path = valueName;
-                                if (path.find(L'\\') != std::wstring::npos) {
-                                    size_t hdvPos = path.find(L"HarddiskVolume");
-                                    if (hdvPos != std::wstring::npos) {
-                                        std::wstring driveLetter = ConvertHardDiskVolumeToLetter(path);
-                                        size_t pathStart = path.find(L'\\', hdvPos);
-                                        if (pathStart != std::wstring::npos) {
-                                            path = driveLetter + path.substr(pathStart);
-                                        }
-                                    }
-
-                                    FILETIME* ft = reinterpret_cast<FILETIME*>(valueData);
-                                    std::wstring execLocalStr = FileTimeToStringLocal(*ft);
-
-                                    BAMEntry entry;
-                                    entry.path = path;
-                                    entry.executionTime = execLocalStr;
-                                    entry.signatureStatus = CheckDigitalSignature(path);
-                                    entry.isInCurrentInstance = IsInCurrentInstance(entry.executionTime);
-
-                                    if (entry.signatureStatus != L"Signed" && entry.signatureStatus != L"Deleted") {
-                                        if (scan_with_yara(wstringToString(path), entry.matched_rules)) {
-                                            // be happy (idk why its a if!)
-                                        }
-                                    }
-
-                                    auto result = ReplaceScanner::scan(wstringToString(path));
-                                    if (!result.empty()) {
-                                        entry.replace_results = result;
-                                    }
-                                    
-                                    entries.push_back(entry);
-                                }
-                            }
-                        }
-                    }
+            nullptr, nullptr) != ERROR_SUCCESS) {
+            continue;
+        }
+
+        HKEY hSubKey;
+        std::wstring fullSubKeyPath = std::wstring(keyPath) + L"\\" + subKeyName;
+
+        if (RegOpenKeyExW(HKEY_LOCAL_MACHINE, fullSubKeyPath.c_str(), 0,
+            KEY_READ, &hSubKey) != ERROR_SUCCESS) {
+            continue;
+        }
+
+        DWORD valueCount = 0;
+        if (RegQueryInfoKeyW(hSubKey, nullptr, nullptr, nullptr, nullptr, nullptr,
+            nullptr, &valueCount, nullptr, nullptr, nullptr,
+            nullptr) == ERROR_SUCCESS) {
+
+            for (DWORD j = 0; j < valueCount; j++) {
+                DWORD valueNameSize = (DWORD)valueName.size();
+                BYTE valueData[1024];
+                DWORD valueDataSize = 1024;
+                DWORD valueType;
+
+                if (RegEnumValueW(hSubKey, j, valueName.data(), &valueNameSize, nullptr,
+                    &valueType, valueData, &valueDataSize) != ERROR_SUCCESS) {
+                    continue;
+                }
+                if (valueType != REG_BINARY || valueDataSize < sizeof(FILETIME)) {
+                    continue;
+                }
+
+                std::wstring path(valueName.data(), valueNameSize);
+                if (path.find(L'\\') == std::wstring::npos) {
+                    continue;
                 }
-                RegCloseKey(hSubKey);
+
+                path = volumeMap.Resolve(path);
+
+                BAMPathRecord record;
+                record.index = index++;
+                record.path = std::move(path);
+                record.sid = subKeyName;
+                memcpy(&record.lastExecution, valueData, sizeof(FILETIME));
+                sink(std::move(record));
             }
         }
+        RegCloseKey(hSubKey);
     }
     RegCloseKey(hKey);
-    ReplaceScanner::destroy();
+    return true;
+}
+
+bool BAMParser::EnumerateHiveRecords(const std::function<void(BAMPathRecord&&)>& sink) {
+    auto start = std::chrono::steady_clock::now();
+
+    RegfHive hive;
+    if (!hive.Open(std::filesystem::path(options.hivePath))) {
+        std::wcout << L"Failed to open hive " << options.hivePath << L"\n";
+        return false;
+    }
+
+    RegfKey controlSet = hive.CurrentControlSet();
+    RegfKey userSettings = hive.FindSubKey(hive.FindSubKey(hive.FindSubKey(hive.FindSubKey(controlSet, "Services"), "bam"), "State"), "UserSettings");
+    if (!userSettings.IsValid()) {
+        // builds before 1809 keep UserSettings right under the service key
+        userSettings = hive.FindSubKey(hive.FindSubKey(hive.FindSubKey(controlSet, "Services"), "bam"), "UserSettings");
+    }
+    if (!userSettings.IsValid()) {
+        std::wcout << L"No BAM key in hive " << options.hivePath << L"\n";
+        return false;
+    }
+
+    volumeMap = VolumeMap::FromHive(hive);
+    // which letter was which volume, so the collected volumes can be laid out under the evidence root
+    for (const VolumeInfo& volume : volumeMap.Volumes()) {
+        if (volume.driveLetter && !volume.volumeGuid.empty()) {
+            std::wcout << L"Hive volume " << volume.driveLetter << L": is " << volume.volumeGuid << L"\n";
+        }
+    }
+
+    // the rows are another machine's, they carry its name like the rows of a snapshot do
+    hiveHost.clear();
+    RegfValue computerName;
+    RegfKey computerNameKey = hive.FindSubKey(hive.FindSubKey(hive.FindSubKey(controlSet, "Control"), "ComputerName"), "ComputerName");
+    if (hive.FindValue(computerNameKey, "ComputerName", computerName) && computerName.type == RegfSz && computerName.data) {
+        hiveHost.resize(computerName.size / sizeof(wchar_t));
+        memcpy(&hiveHost[0], computerName.data, hiveHost.size() * sizeof(wchar_t));
+        hiveHost.erase(std::find(hiveHost.begin(), hiveHost.end(), L'\0'), hiveHost.end());
+    }
+    if (hiveHost.empty()) {
+        hiveHost = std::filesystem::path(options.hivePath).filename().wstring();
+    }
+
+    size_t index = 0;
+    hive.ForEachSubKey(userSettings, [this, &hive, &sink, &index](RegfKey sidKey) {
+        std::wstring sid = hive.KeyName(sidKey).ToWide();
+        hive.ForEachValue(sidKey, [this, &sink, &index, &sid](const RegfValue& value) {
+            if (value.type != RegfBinary || value.size < sizeof(FILETIME)) {
+                return true;
+            }
+
+            std::wstring path = value.name.ToWide();
+            if (path.find(L'\\') == std::wstring::npos) {
+                return true;
+            }
+            path = volumeMap.Resolve(path);
+
+            BAMPathRecord record;
+            record.index = index++;
+            record.path = std::move(path);
+            record.sid = sid;
+            memcpy(&record.lastExecution, value.data, sizeof(FILETIME));
+            sink(std::move(record));
+            return true;
+        });
+        return true;
+    });
+
+    double elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "Hive: " << hive.CellsParsed() << " cells parsed";
+    if (elapsedSeconds > 0) {
+        std::cout << " (" << std::fixed << std::setprecision(0) << hive.CellsParsed() / elapsedSeconds << " cells/s)";
+    }
+    std::cout << std::endl;
+    return true;
+}
+
+bool BAMParser::EnumerateRecords(const std::function<void(BAMPathRecord&&)>& sink) {
+    if (!options.hivePath.empty()) {
+        return EnumerateHiveRecords(sink);
+    }
+    return EnumerateLiveRecords(sink);
+}
+
+void BAMParser::JournalPaths(const BAMParserOptions& options, std::wstring& patternsPath, std::wstring& cursorDirectory) {
+    patternsPath = options.replacePatternsPath;
+    cursorDirectory.clear();
+    std::wstring directory = AnalysisCache::DataDirectory();
+    std::error_code error;
+    if (patternsPath.empty() && !directory.empty() && std::filesystem::exists(std::filesystem::path(directory) / L"replace.patterns", error)) {
+        patternsPath = directory + L"\\replace.patterns";
+    }
+    // the journal cursors are cached state like the analysis cache, --no-cache reads every journal in full
+    if (options.useCache) {
+        cursorDirectory = directory;
+    }
+}
+
+void BAMParser::Parse() {
+    hiveHost.clear();
+    // the journal belongs to this machine, replaces only make sense for the live registry
+    bool useJournal = options.hivePath.empty() && options.checkReplaces;
+    succeeded = false;
+    std::wstring patternsPath;
+    std::wstring cursorDirectory;
+    if (useJournal) {
+        JournalPaths(options, patternsPath, cursorDirectory);
+    }
+    if (useJournal && !ReplaceScanner::init(patternsPath, cursorDirectory, std::chrono::seconds(options.journalTimeoutSeconds))) {
+        std::cerr << "Failed to initialize ReplaceParser." << std::endl;
+        return;
+    }
+    replaceIndex = useJournal ? ReplaceScanner::Snapshot() : nullptr;
+
+    entries.clear();
+    resetYaraTimings();
+
+    CertStoreIndex::Instance().EnsureFresh();
+    CertStoreIndex::Instance().ResetStats();
+    AuthenticodeEngine::Initialize();
+    AuthenticodeEngine::ResetStats();
+    // catalog signatures are looked up in an index of the catroot instead of asking CryptCATAdmin per file
+    if (options.checkSignatures) {
+        OpenCatalogIndex();
+    }
+    CatalogIndex::Instance().ResetStats();
+    OpenKnownHashes();
+    KnownHashes::Instance().ResetStats();
+    AnalysisCache::Instance().ResetStats();
+    FileView::ResetStats();
+    MultiHasher::ResetStats();
+
+    // one snapshot of the logon sessions per scan, every entry is then just a binary search
+    if (options.hivePath.empty()) {
+        FILETIME now;
+        GetSystemTimeAsFileTime(&now);
+        sessionIndex.Build(GetInteractiveLogonSessions(), ((uint64_t)now.dwHighDateTime << 32) | now.dwLowDateTime);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    unsigned workerCount = options.threadCount;
+    if (workerCount == 0) {
+        workerCount = (std::max)(1u, std::thread::hardware_concurrency());
+    }
+
+    // enumeration only produces path records, the expensive checks are drained by the workers
+    WorkQueue<BAMPathRecord> queue(workerCount * 4);
+    std::vector<std::vector<std::pair<size_t, BAMEntry>>> workerResults(workerCount);
+    std::vector<std::thread> workers;
+    workers.reserve(workerCount);
+
+    for (unsigned w = 0; w < workerCount; w++) {
+        workers.emplace_back([this, &queue, &results = workerResults[w]]() {
+            BAMPathRecord record;
+            while (queue.pop(record)) {
+                results.emplace_back(record.index, AnalyzeRecord(record));
+                if (options.onEntry) {
+                    std::lock_guard<std::mutex> lock(onEntryMutex);
+                    options.onEntry(results.back().second);
+                }
+            }
+        });
+    }
+
+    bool enumerated = EnumerateRecords([&queue](BAMPathRecord&& record) {
+        queue.push(std::move(record));
+    });
+
+    queue.close();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    // workers finish out of order, put everything back in registry order
+    std::vector<std::pair<size_t, BAMEntry>> merged;
+    for (auto& results : workerResults) {
+        std::move(results.begin(), results.end(), std::back_inserter(merged));
+    }
+    std::sort(merged.begin(), merged.end(), [](const auto& a, const auto& b) {
+        return a.first < b.first;
+    });
+
+    entries.reserve(merged.size());
+    for (auto& result : merged) {
+        entries.push_back(std::move(result.second));
+    }
+
+    replaceIndex.reset();
+    if (useJournal) {
+        ReplaceScanner::destroy();
+    }
+    succeeded = enumerated;
+
+    double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "Analyzed " << entries.size() << " BAM entries with " << workerCount << " threads in "
+        << std::fixed << std::setprecision(2) << elapsedMs << " ms" << std::endl;
+    AnalysisCache::Instance().Flush();
+
+    reportYaraTimings();
+    CertStoreIndex::Instance().ReportStats();
+    AuthenticodeEngine::ReportStats();
+    if (options.checkSignatures) {
+        CatalogIndex::Instance().ReportStats();
+    }
+    FileView::ReportStats();
+    MultiHasher::ReportStats();
+    KnownHashes::Instance().ReportStats();
+    std::cout << "Analysis cache: " << AnalysisCache::Instance().Hits() << " hits, " << AnalysisCache::Instance().ContentHits()
+        << " content hits, " << AnalysisCache::Instance().Misses() << " misses" << std::endl;
 }
@@ -13,21 +13,43 @@
 #include <wincrypt.h>
 #include <filesystem>
 #include <mscat.h>
-#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include "../replaceparser/ReplaceScanner.hh"
+#include "VolumeMap.h"
+#include "FileView.h"
 
 #pragma comment(lib, "wintrust.lib")
 #pragma comment(lib, "Shlwapi.lib")
 #pragma comment(lib, "Secur32.lib")
 #pragma comment(lib, "Crypt32.lib")
 
+std::string wstringToString(const std::wstring& wstr);
+
 struct BAMEntry {
     std::wstring path;
-    std::wstring executionTime;
+    std::wstring sid; // UserSettings subkey the value was found under
+    uint64_t executionFileTime = 0; // raw UTC FILETIME from the BAM value
+    std::wstring executionTime; // local time, display only
     std::wstring signatureStatus;
-    bool isInCurrentInstance;
+    bool isInCurrentInstance = false;
+    bool isInInteractiveSession = false;
     std::vector<std::string> matched_rules;
     std::vector<ReplaceFileStruct> replace_results;
+    std::wstring host; // machine the row came from, only set for rows of a collected hive or loaded from a snapshot
+    // lowercase hex of the whole file, empty when it doesn't exist or hashing is off
+    std::string md5;
+    std::string sha1;
+    std::string sha256;
+};
+
+// lightweight output of the registry walk, analysis happens later on the worker threads
+struct BAMPathRecord {
+    size_t index = 0;
+    std::wstring path;
+    std::wstring sid;
+    FILETIME lastExecution = {};
 };
 
 struct LogonSessionInfo {
@@ -36,20 +58,84 @@ struct LogonSessionInfo {
     bool isInteractive;
 };
 
+// sorted, merged logon intervals captured once per scan
+class LogonSessionIndex {
+public:
+    void Build(const std::vector<LogonSessionInfo>& sessions, uint64_t now);
+    // executed after the most recent interactive logon
+    bool InCurrentInstance(uint64_t fileTime) const;
+    bool InAnySession(uint64_t fileTime) const;
+
+private:
+    struct Interval {
+        uint64_t start;
+        uint64_t end;
+    };
+    std::vector<Interval> intervals;
+    uint64_t latestLogon = 0;
+    uint64_t captureTime = 0;
+};
+
+struct BAMParserOptions {
+    unsigned threadCount = 0;   // 0 uses one worker per hardware thread
+    std::wstring hivePath;      // collected SYSTEM hive, empty for the live registry
+    // with a hive: the collected volumes of that machine, C:\x.exe is read from <evidenceRoot>\C\x.exe. without one
+    // the files of a hive are not analyzed at all, the local file with the same path says nothing about them
+    std::wstring evidenceRoot;
+    bool checkSignatures = true;
+    bool scanYara = true;
+    bool checkReplaces = true;
+    bool useCache = true;
+    bool computeHashes = true;  // md5 / sha-1 / sha-256 of every file on the entry
+    // verdicts from the embedded signature and the catalog index alone, no WinVerifyTrust
+    bool offlineSignatures = false;
+    std::wstring catrootPath;   // catroot copied off another machine, empty for the live one
+    // sha-256 tables built with hashsetgen, empty picks allowlist.hashset / blocklist.hashset from the data directory
+    std::wstring allowlistPath;
+    std::wstring blocklistPath;
+    // extra replace patterns on top of the builtin ones, empty picks replace.patterns from the data directory
+    std::wstring replacePatternsPath;
+    // how long one volume's journal may take before the scan goes on without the rest of it, 0 waits for every journal
+    unsigned journalTimeoutSeconds = 30;
+    // called from the workers as soon as an entry is analyzed (serialized, not in registry order)
+    std::function<void(const BAMEntry&)> onEntry;
+};
+
 class BAMParser {
 private:
-    bool VerifyFileViaCatalog(LPCWSTR filePath);
+    bool VerifyFileViaCatalog(FileView& view, LPCWSTR filePath);
+    bool VerifyFileViaCatalogIndex(FileView& view, LPCWSTR filePath);
+    void OpenCatalogIndex();
+    void OpenKnownHashes();
     std::vector<BAMEntry> entries;
-    std::wstring ConvertHardDiskVolumeToLetter(const std::wstring& path);
-    std::wstring FileTimeToStringLocal(const FILETIME& ft);
-    std::wstring CheckDigitalSignature(const std::wstring& filePath);
-    bool IsInCurrentInstance(const std::wstring& execTime);
+    std::wstring FileTimeToStringLocal(uint64_t fileTime);
+    std::wstring CheckDigitalSignature(FileView& view, const std::wstring& filePath);
+    BAMEntry AnalyzeRecord(const BAMPathRecord& record);
+    std::wstring AnalysisPath(const std::wstring& path) const;
+    bool EnumerateRecords(const std::function<void(BAMPathRecord&&)>& sink);
+    bool EnumerateLiveRecords(const std::function<void(BAMPathRecord&&)>& sink);
+    bool EnumerateHiveRecords(const std::function<void(BAMPathRecord&&)>& sink);
     void Parse();
+    BAMParserOptions options;
+    std::mutex onEntryMutex;
+    bool succeeded = false;
     std::vector<LogonSessionInfo> GetInteractiveLogonSessions();
-    bool IsValidTimeFormat(const std::wstring& timeStr);
-    FILETIME StringToFileTimeUTC(const std::wstring& timeStr);
+    LogonSessionIndex sessionIndex;
+    VolumeMap volumeMap;
+    std::wstring hiveHost;  // computer name stored in the hive, set before the first record is queued
+    std::shared_ptr<const ReplaceIndex> replaceIndex;  // taken once per scan, the workers share it without locking
 
 public:
-    BAMParser() { Parse(); }
+    explicit BAMParser(const BAMParserOptions& options) : options(options) { Parse(); }
+    explicit BAMParser(unsigned threadCount = 0) { options.threadCount = threadCount; Parse(); }
+    // reads a collected SYSTEM hive instead of the live registry
+    explicit BAMParser(const std::wstring& hivePath, unsigned threadCount = 0) {
+        options.threadCount = threadCount;
+        options.hivePath = hivePath;
+        Parse();
+    }
     const std::vector<BAMEntry>& GetEntries() const { return entries; }
+    // what ReplaceScanner::init / ReplaceWatcher::Start get for these options: the patterns file and the cursor directory
+    static void JournalPaths(const BAMParserOptions& options, std::wstring& patternsPath, std::wstring& cursorDirectory);
+    bool Succeeded() const { return succeeded; }
 };
@@ -0,0 +1,55 @@
+#pragma once
+#include <windows.h>
+#include <wincrypt.h>
+#include <bcrypt.h>
+#include <atomic>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// thumbprints of every cert in the local system stores, built once instead of opening 24 stores per signed file
+class CertStoreIndex {
+public:
+    static CertStoreIndex& Instance();
+
+    // rebuilds when never built or when a store signaled a change since the last build
+    void EnsureFresh();
+    void Refresh();
+
+    // stores (e.g. "LocalMachine\Root") the cert was found in, empty if it isnt installed locally
+    std::vector<std::wstring> Find(PCCERT_CONTEXT cert);
+    bool Contains(PCCERT_CONTEXT cert) { return !Find(cert).empty(); }
+    // raw sha-1 or sha-256 thumbprint, for certs that only exist as parsed bytes (authenticode engine)
+    std::vector<std::wstring> FindThumbprint(const std::string& thumbprint);
+    bool ContainsThumbprint(const std::string& thumbprint) { return !FindThumbprint(thumbprint).empty(); }
+    // digest of which cert is in which store as of the last build, changes whenever a verdict built on the stores may
+    uint64_t ContentDigest();
+
+    void ResetStats();
+    void ReportStats();
+
+private:
+    CertStoreIndex() = default;
+    ~CertStoreIndex();
+    CertStoreIndex(const CertStoreIndex&) = delete;
+    CertStoreIndex& operator=(const CertStoreIndex&) = delete;
+
+    static std::string Thumbprint(PCCERT_CONTEXT cert, DWORD propId);
+    bool Changed();
+    void CloseWatchers();
+
+    std::shared_mutex mutex;
+    // keys are raw sha-1 (20 bytes) and sha-256 (32 bytes) thumbprints, the length keeps them apart
+    std::unordered_map<std::string, std::vector<std::wstring>> thumbprints;
+    std::vector<HCERTSTORE> watchedStores;
+    std::vector<HANDLE> changeEvents;
+    bool built = false;
+    size_t certificateCount = 0;
+    uint64_t contentDigest = 0;
+    double buildMilliseconds = 0.0;
+    double storeOpenMilliseconds = 0.0;
+    size_t storesOpened = 0;
+    std::atomic<long long> lookups{ 0 };
+    std::atomic<long long> lookupNanoseconds{ 0 };
+};
@@ -0,0 +1,195 @@
+#include "FileView.h"
+#include "AnalysisCache.h"
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <iomanip>
+
+static std::atomic<long long> filesOpened{ 0 };
+static std::atomic<long long> filesRead{ 0 };
+static std::atomic<long long> bytesRead{ 0 };
+static std::atomic<long long> largestRead{ 0 };
+static std::atomic<long long> repeatedBytesAvoided{ 0 };
+static std::atomic<long long> externalReadCount{ 0 };
+static std::atomic<long long> mappedReadFaults{ 0 };
+
+namespace {
+    // 1 / 0 is what consume returned, -1 an in-page error while it read the mapping.
+    // nothing in here needs unwinding, __try can't share a function with that
+    int ConsumeGuarded(const std::function<bool(const uint8_t*, size_t)>& consume, const uint8_t* data, size_t length) {
+        __try {
+            return consume(data, length) ? 1 : 0;
+        }
+        __except (GetExceptionCode() == EXCEPTION_IN_PAGE_ERROR ? EXCEPTION_EXECUTE_HANDLER : EXCEPTION_CONTINUE_SEARCH) {
+            return -1;
+        }
+    }
+}
+
+FileView::~FileView() {
+    Close();
+}
+
+bool FileView::Open(const std::wstring& path) {
+    Close();
+    file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL,
+        OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    if (!GetFileInformationByHandle(file, &info) || (info.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)) {
+        Close();
+        return false;
+    }
+    size = ((uint64_t)info.nFileSizeHigh << 32) | info.nFileSizeLow;
+    filesOpened++;
+    return true;
+}
+
+void FileView::Close() {
+    if (contentRead) {
+        filesRead++;
+        bytesRead += (long long)size;
+        long long previous = largestRead.load();
+        while ((long long)size > previous && !largestRead.compare_exchange_weak(previous, (long long)size)) {
+        }
+        if (contentUses > 1) {
+            repeatedBytesAvoided += (long long)size * (contentUses - 1);
+        }
+    }
+    externalReadCount += externalReads;
+
+    DropMapping();
+    if (file != INVALID_HANDLE_VALUE) {
+        CloseHandle(file);
+        file = INVALID_HANDLE_VALUE;
+    }
+    size = 0;
+    info = {};
+    mapAttempted = false;
+    contentRead = false;
+    contentUses = 0;
+    externalReads = 0;
+}
+
+bool FileView::Identity(FileIdentity& out) const {
+    return file != INVALID_HANDLE_VALUE && FileIdentity::FromHandle(file, out);
+}
+
+bool FileView::Map() {
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    if (!mapAttempted) {
+        mapAttempted = true;
+        // empty files can't be mapped, they are still a valid (empty) view
+        if (size > 0 && size <= MapLimit) {
+            mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+            if (mapping) {
+                data = static_cast<const uint8_t*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+            }
+        }
+    }
+    if (!data && size > 0) {
+        return false;
+    }
+    contentRead = true;
+    contentUses++;
+    return true;
+}
+
+void FileView::DropMapping() {
+    // mapAttempted stays set, Map() fails from here on and everything goes through the handle
+    if (data) {
+        UnmapViewOfFile(data);
+        data = nullptr;
+    }
+    if (mapping) {
+        CloseHandle(mapping);
+        mapping = nullptr;
+    }
+}
+
+bool FileView::ConsumeMapped(const std::function<bool(const uint8_t* data, size_t length)>& consume) {
+    if (!Map()) {
+        return false;
+    }
+    int result = ConsumeGuarded(consume, data, (size_t)size);
+    if (result < 0) {
+        mappedReadFaults++;
+        DropMapping();
+    }
+    return result > 0;
+}
+
+bool FileView::ForEachChunk(const std::function<bool(const uint8_t* chunk, size_t length)>& callback,
+    const std::function<void()>& restart) {
+    if (Map()) {
+        int result = 1;
+        for (uint64_t offset = 0; offset < size && result > 0; offset += ChunkSize) {
+            size_t length = (size_t)(std::min)((uint64_t)ChunkSize, size - offset);
+            result = ConsumeGuarded(callback, data + offset, length);
+        }
+        if (result >= 0) {
+            return result > 0;
+        }
+        mappedReadFaults++;
+        DropMapping();
+        if (!restart) {
+            return false;
+        }
+        restart();
+    }
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    // page aligned buffer and chunk aligned offsets, the read ahead of FILE_FLAG_SEQUENTIAL_SCAN does the rest
+    uint8_t* buffer = static_cast<uint8_t*>(VirtualAlloc(NULL, ChunkSize, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE));
+    if (!buffer) {
+        return false;
+    }
+    contentRead = true;
+    contentUses++;
+
+    bool ok = true;
+    for (uint64_t offset = 0; offset < size && ok; offset += ChunkSize) {
+        // a read can come back short (network files), the chunk is filled before it is handed out so offsets
+        // stay chunk aligned. no progress at all means the file shrank, it is failed rather than half hashed
+        DWORD wanted = (DWORD)(std::min)((uint64_t)ChunkSize, size - offset);
+        DWORD filled = 0;
+        while (ok && filled < wanted) {
+            uint64_t at = offset + filled;
+            OVERLAPPED position = {};
+            position.Offset = (DWORD)at;
+            position.OffsetHigh = (DWORD)(at >> 32);
+            DWORD got = 0;
+            ok = ReadFile(file, buffer + filled, wanted - filled, &got, &position) && got > 0;
+            filled += got;
+        }
+        ok = ok && callback(buffer, filled);
+    }
+    VirtualFree(buffer, 0, MEM_RELEASE);
+    return ok;
+}
+
+void FileView::ResetStats() {
+    filesOpened = 0;
+    filesRead = 0;
+    bytesRead = 0;
+    largestRead = 0;
+    repeatedBytesAvoided = 0;
+    externalReadCount = 0;
+    mappedReadFaults = 0;
+}
+
+void FileView::ReportStats() {
+    double mb = 1024.0 * 1024.0;
+    long long files = filesRead.load();
+    std::cout << "File access: " << filesOpened.load() << " files opened once, " << files << " read ("
+        << std::fixed << std::setprecision(2) << bytesRead.load() / mb << " MB, avg "
+        << (files ? bytesRead.load() / 1024.0 / files : 0.0) << " KB/file, max " << largestRead.load() / mb << " MB), "
+        << repeatedBytesAvoided.load() / mb << " MB of repeated reads avoided, "
+        << externalReadCount.load() << " reads left to WinVerifyTrust/catalog on the shared handle, "
+        << mappedReadFaults.load() << " mapped reads failed over to the handle" << std::endl;
+}
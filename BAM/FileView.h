@@ -0,0 +1,64 @@
+#pragma once
+#include <windows.h>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+struct FileIdentity;
+
+// one open (and one mapping) per analyzed file, shared by the identity lookup, the hashers,
+// the signature checks and yara instead of each of them opening and reading the file again
+class FileView {
+public:
+    // files above this are streamed in chunks instead of mapped, keeps 32 bit builds out of address space trouble
+    static constexpr uint64_t MapLimit = 256ull << 20;
+    static constexpr size_t ChunkSize = 4 << 20;
+
+    FileView() = default;
+    ~FileView();
+    FileView(const FileView&) = delete;
+    FileView& operator=(const FileView&) = delete;
+
+    // false when the file is missing or can't be opened, this doubles as the existence check
+    bool Open(const std::wstring& path);
+    void Close();
+
+    HANDLE Handle() const { return file; }
+    uint64_t Size() const { return size; }
+    bool Identity(FileIdentity& out) const;
+
+    // maps the file on first use, false for files above MapLimit or when mapping fails
+    bool Map();
+    const uint8_t* Data() const { return data; }
+
+    // runs consume over the mapping; false when the file can't be mapped or a page of it couldn't be read
+    // (disk error, share or usb stick gone), the mapping is dropped then and the caller reads through the handle
+    bool ConsumeMapped(const std::function<bool(const uint8_t* data, size_t length)>& consume);
+
+    // hands out the whole content in order: slices of the mapping, or ChunkSize reads for huge files.
+    // when the mapping fails part way the content is handed out again from the handle, restart is called
+    // first so the consumer can drop what it has (without one that case just fails)
+    bool ForEachChunk(const std::function<bool(const uint8_t* chunk, size_t length)>& callback,
+        const std::function<void()>& restart = nullptr);
+
+    // an analyzer that had to read the file through the handle by itself (WinVerifyTrust, catalog hash)
+    void NoteExternalRead() { externalReads++; }
+
+    static void ResetStats();
+    static void ReportStats();
+
+private:
+    void CountRead(uint64_t bytes);
+    void DropMapping();
+
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE mapping = nullptr;
+    const uint8_t* data = nullptr;
+    uint64_t size = 0;
+    BY_HANDLE_FILE_INFORMATION info = {};
+    bool mapAttempted = false;
+    bool contentRead = false;   // the bytes were pulled from disk once already
+    unsigned contentUses = 0;   // analyzers that consumed the content through this view
+    unsigned externalReads = 0;
+};
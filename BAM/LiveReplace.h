@@ -0,0 +1,28 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "BAM.h"
+#include "../replaceparser/ReplaceTail.h"
+
+// a live replace alert (ReplaceWatcher) added to the entries of the file it is about, matched on the full path
+// like the journal index does (case insensitive). returns their indices, none when the file has no BAM entry.
+// the journal is this machine's: rows with a host (a collected hive, a snapshot) are never touched
+inline std::vector<size_t> ApplyReplaceAlert(std::vector<BAMEntry>& entries, const ReplaceAlert& alert) {
+    auto lower = [](std::string text) {
+        for (auto& c : text) {
+            if (c >= 'A' && c <= 'Z') {
+                c = (char)(c - 'A' + 'a');
+            }
+        }
+        return text;
+    };
+    std::vector<size_t> matched;
+    std::string path = lower(alert.path);
+    for (size_t i = 0; i < entries.size(); i++) {
+        if (entries[i].host.empty() && lower(wstringToString(entries[i].path)) == path) {
+            entries[i].replace_results.push_back(alert.result);
+            matched.push_back(i);
+        }
+    }
+    return matched;
+}
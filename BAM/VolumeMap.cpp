@@ -0,0 +1,157 @@
+#include "VolumeMap.h"
+#include <algorithm>
+#include <cwctype>
+#include "../hive/RegfHive.h"
+
+namespace {
+    std::wstring lower(std::wstring str) {
+        std::transform(str.begin(), str.end(), str.begin(), [](wchar_t c) { return (wchar_t)std::towlower(c); });
+        return str;
+    }
+
+    const std::wstring globalRootPrefix = L"\\\\?\\GLOBALROOT";
+}
+
+VolumeMap VolumeMap::CaptureLive() {
+    VolumeMap map;
+
+    wchar_t volumeName[MAX_PATH];
+    HANDLE find = FindFirstVolumeW(volumeName, MAX_PATH);
+    if (find == INVALID_HANDLE_VALUE) {
+        return map;
+    }
+
+    do {
+        VolumeInfo volume;
+        volume.volumeGuid = volumeName;
+
+        // QueryDosDeviceW wants "Volume{...}" without the \\?\ prefix and trailing slash
+        std::wstring dosName = volume.volumeGuid.substr(4);
+        if (!dosName.empty() && dosName.back() == L'\\') dosName.pop_back();
+
+        wchar_t deviceName[MAX_PATH];
+        if (!QueryDosDeviceW(dosName.c_str(), deviceName, MAX_PATH)) {
+            continue;
+        }
+        volume.deviceName = deviceName;
+
+        DWORD length = 0;
+        GetVolumePathNamesForVolumeNameW(volumeName, nullptr, 0, &length);
+        if (length > 0) {
+            std::vector<wchar_t> names(length);
+            if (GetVolumePathNamesForVolumeNameW(volumeName, names.data(), length, &length)) {
+                for (const wchar_t* name = names.data(); *name; name += wcslen(name) + 1) {
+                    std::wstring mountPoint = name;
+                    if (mountPoint.size() == 3 && mountPoint[1] == L':' && !volume.driveLetter) {
+                        volume.driveLetter = (wchar_t)std::towupper(mountPoint[0]);
+                    }
+                    volume.mountPoints.push_back(std::move(mountPoint));
+                }
+            }
+        }
+
+        map.volumes.push_back(std::move(volume));
+    } while (FindNextVolumeW(find, volumeName, MAX_PATH));
+
+    FindVolumeClose(find);
+    map.Index();
+    return map;
+}
+
+VolumeMap VolumeMap::FromHive(const RegfHive& hive) {
+    // MountedDevices has no \Device\HarddiskVolumeN names and those numbers are handed out at boot, so the device
+    // paths of a hive are not mapped to a letter: a guess would put a usb stick's file on C:
+    VolumeMap map;
+    map.offline = true;
+
+    // MountedDevices pairs \DosDevices\X: and \??\Volume{guid} entries that share the same identifier blob
+    std::unordered_map<std::string, size_t> byBlob;
+    hive.ForEachValue(hive.OpenPath("MountedDevices"), [&map, &byBlob](const RegfValue& value) {
+        if (!value.data || value.size == 0) {
+            return true;
+        }
+
+        std::wstring name = value.name.ToWide();
+        std::string blob((const char*)value.data, value.size);
+        auto it = byBlob.find(blob);
+        if (it == byBlob.end()) {
+            it = byBlob.emplace(blob, map.volumes.size()).first;
+            map.volumes.emplace_back();
+        }
+        VolumeInfo& volume = map.volumes[it->second];
+
+        if (name.rfind(L"\\DosDevices\\", 0) == 0 && name.size() == 14 && name[13] == L':') {
+            volume.driveLetter = (wchar_t)std::towupper(name[12]);
+            volume.mountPoints.push_back(std::wstring(1, volume.driveLetter) + L":\\");
+        }
+        else if (name.rfind(L"\\??\\Volume{", 0) == 0) {
+            volume.volumeGuid = L"\\\\?\\" + name.substr(4) + L"\\";
+        }
+        return true;
+    });
+
+    map.Index();
+    return map;
+}
+
+void VolumeMap::Index() {
+    byDevice.clear();
+    for (size_t i = 0; i < volumes.size(); i++) {
+        if (!volumes[i].deviceName.empty()) {
+            byDevice[lower(volumes[i].deviceName)] = i;
+        }
+    }
+}
+
+const VolumeInfo* VolumeMap::Find(const std::wstring& deviceName) const {
+    auto it = byDevice.find(lower(deviceName));
+    return it != byDevice.end() ? &volumes[it->second] : nullptr;
+}
+
+std::wstring VolumeMap::Prefix(const VolumeInfo& volume) const {
+    if (volume.driveLetter) {
+        return std::wstring(1, volume.driveLetter) + L":";
+    }
+    if (!volume.mountPoints.empty()) {
+        std::wstring mountPoint = volume.mountPoints.front();
+        if (!mountPoint.empty() && mountPoint.back() == L'\\') mountPoint.pop_back();
+        return mountPoint;
+    }
+    if (!volume.volumeGuid.empty()) {
+        std::wstring guid = volume.volumeGuid;
+        if (guid.back() == L'\\') guid.pop_back();
+        return guid;
+    }
+    return L"?:";
+}
+
+std::wstring VolumeMap::Resolve(const std::wstring& path) const {
+    size_t start = 0;
+    if (path.compare(0, globalRootPrefix.size(), globalRootPrefix) == 0) {
+        start = globalRootPrefix.size();
+    }
+
+    // \Device\<name>\rest, the prefix is everything up to the third backslash
+    if (path.compare(start, 8, L"\\Device\\") != 0) {
+        return path;
+    }
+    size_t pathStart = path.find(L'\\', start + 8);
+    if (pathStart == std::wstring::npos) {
+        return path;
+    }
+
+    const VolumeInfo* volume = Find(path.substr(start, pathStart - start));
+    if (volume) {
+        return Prefix(*volume) + path.substr(pathStart);
+    }
+    // other devices (\Device\Mup and friends) are left untouched like before
+    if (path.find(L"HarddiskVolume", start) == start + 8 && !offline) {
+        return L"?:" + path.substr(pathStart);
+    }
+    return path;
+}
+
+bool VolumeMap::IsUnresolved(const std::wstring& path) {
+    return path.compare(0, 2, L"?:") == 0 || path.compare(0, 8, L"\\Device\\") == 0 ||
+        path.compare(0, globalRootPrefix.size(), globalRootPrefix) == 0;
+}
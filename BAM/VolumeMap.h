@@ -0,0 +1,41 @@
+#pragma once
+#include <windows.h>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class RegfHive;
+
+struct VolumeInfo {
+    std::wstring deviceName;   // \Device\HarddiskVolume3
+    std::wstring volumeGuid;   // \\?\Volume{...} path as returned by FindFirstVolumeW
+    wchar_t driveLetter = 0;
+    std::vector<std::wstring> mountPoints; // drive roots and folder mount points, always with a trailing slash
+};
+
+// device name -> letter / mount point snapshot, taken once per scan instead of once per BAM value
+class VolumeMap {
+public:
+    static VolumeMap CaptureLive();
+    // decodes MountedDevices of a collected SYSTEM hive: letters and volume guids, no device names (see Resolve)
+    static VolumeMap FromHive(const RegfHive& hive);
+
+    // \Device\HarddiskVolume3\Windows\x.exe -> C:\Windows\x.exe, unknown volumes get the old "?:" prefix.
+    // an offline map keeps the device path instead, the volume number is all there is to go on
+    std::wstring Resolve(const std::wstring& path) const;
+    // what Resolve couldn't map: "?:" paths and device paths it left alone
+    static bool IsUnresolved(const std::wstring& path);
+
+    const std::vector<VolumeInfo>& Volumes() const { return volumes; }
+
+private:
+    void Index();
+    const VolumeInfo* Find(const std::wstring& deviceName) const;
+    std::wstring Prefix(const VolumeInfo& volume) const;
+
+    std::vector<VolumeInfo> volumes;
+    // keyed by the lowercased device name, BAM paths only ever carry \Device\<name> as their prefix
+    std::unordered_map<std::wstring, size_t> byDevice;
+    bool offline = false;
+};
@@ -0,0 +1,273 @@
+#include "IconService.h"
+#include <shellapi.h>
+#include <objbase.h>
+#include <algorithm>
+#include <cstring>
+
+namespace {
+    std::string ExtractBasePathFromADS(const std::string& fullPath) {
+        size_t adsPos = fullPath.find(':');
+        if (adsPos != std::string::npos && adsPos < 3) {
+            adsPos = fullPath.find(':', adsPos + 1);
+        }
+        if (adsPos != std::string::npos) {
+            return fullPath.substr(0, adsPos);
+        }
+        return fullPath;
+    }
+
+    std::wstring toWide(const std::string& str) {
+        if (str.empty()) return std::wstring();
+        int size = MultiByteToWideChar(CP_UTF8, 0, str.data(), (int)str.size(), nullptr, 0);
+        std::wstring wide(size, 0);
+        MultiByteToWideChar(CP_UTF8, 0, str.data(), (int)str.size(), &wide[0], size);
+        return wide;
+    }
+
+    std::string extensionOf(const std::string& path) {
+        size_t slash = path.find_last_of("\\/");
+        size_t dot = path.find_last_of('.');
+        if (dot == std::string::npos || (slash != std::string::npos && dot < slash)) {
+            return std::string();
+        }
+        std::string ext = path.substr(dot);
+        std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return (char)std::tolower(c); });
+        return ext;
+    }
+
+    // these carry their own icon, everything else looks the same for every file of the type
+    bool hasOwnIcon(const std::string& ext) {
+        static const char* own[] = { ".exe", ".ico", ".lnk", ".scr", ".cpl", ".msc", ".url" };
+        for (auto e : own) {
+            if (ext == e) return true;
+        }
+        return false;
+    }
+}
+
+IconService& IconService::Instance() {
+    static IconService service;
+    return service;
+}
+
+void IconService::Start() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (worker.joinable()) return;
+    stopping = false;
+    worker = std::thread(&IconService::WorkerLoop, this);
+}
+
+void IconService::Shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+        requests.clear();
+    }
+    wake.notify_all();
+    if (worker.joinable()) {
+        worker.join();
+    }
+
+    for (auto atlas : atlases) {
+        atlas->Release();
+    }
+    atlases.clear();
+    atlasSlotOfIcon.clear();
+    paths.clear();
+    completed.clear();
+    usedSlots = 0;
+}
+
+bool IconService::Get(const std::string& path, ImTextureID& texture, ImVec2& uv0, ImVec2& uv1) {
+    auto it = paths.find(path);
+    if (it == paths.end()) {
+        paths.emplace(path, PathSlot());
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            requests.push_back(path);
+        }
+        wake.notify_one();
+        return false;
+    }
+
+    const PathSlot& slot = it->second;
+    if (slot.state != State::Ready) {
+        return false;
+    }
+
+    int atlasSlot = atlasSlotOfIcon[slot.iconId];
+    int perRow = AtlasSize / IconSize;
+    int local = atlasSlot % IconsPerAtlas;
+    float u = (float)((local % perRow) * IconSize) / AtlasSize;
+    float v = (float)((local / perRow) * IconSize) / AtlasSize;
+    texture = (ImTextureID)atlases[atlasSlot / IconsPerAtlas];
+    uv0 = ImVec2(u, v);
+    uv1 = ImVec2(u + (float)IconSize / AtlasSize, v + (float)IconSize / AtlasSize);
+    return true;
+}
+
+void IconService::Upload(LPDIRECT3DDEVICE9 device, size_t maxIcons) {
+    std::vector<Result> batch;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (completed.empty()) return;
+        size_t count = (std::min)(maxIcons, completed.size());
+        batch.assign(std::make_move_iterator(completed.begin()), std::make_move_iterator(completed.begin() + count));
+        completed.erase(completed.begin(), completed.begin() + count);
+    }
+
+    int lockedAtlas = -1;
+    D3DLOCKED_RECT lockedRect = {};
+
+    for (auto& result : batch) {
+        PathSlot& slot = paths[result.path];
+        if (result.iconId < 0) {
+            slot.state = State::Failed; // misses are cached too, nothing retries them every frame
+            continue;
+        }
+
+        if (!result.pixels.empty()) {
+            int atlasSlot = usedSlots;
+            int atlasIndex = atlasSlot / IconsPerAtlas;
+            if (atlasIndex >= (int)atlases.size()) {
+                if (lockedAtlas >= 0) {
+                    atlases[lockedAtlas]->UnlockRect(0);
+                    lockedAtlas = -1;
+                }
+                LPDIRECT3DTEXTURE9 atlas = nullptr;
+                if (FAILED(device->CreateTexture(AtlasSize, AtlasSize, 1, 0, D3DFMT_A8R8G8B8, D3DPOOL_MANAGED, &atlas, NULL))) {
+                    slot.state = State::Failed;
+                    continue;
+                }
+                atlases.push_back(atlas);
+            }
+            if (lockedAtlas != atlasIndex) {
+                if (lockedAtlas >= 0) {
+                    atlases[lockedAtlas]->UnlockRect(0);
+                }
+                if (FAILED(atlases[atlasIndex]->LockRect(0, &lockedRect, NULL, 0))) {
+                    lockedAtlas = -1;
+                    slot.state = State::Failed;
+                    continue;
+                }
+                lockedAtlas = atlasIndex;
+            }
+
+            int perRow = AtlasSize / IconSize;
+            int local = atlasSlot % IconsPerAtlas;
+            int x = (local % perRow) * IconSize;
+            int y = (local / perRow) * IconSize;
+            for (int row = 0; row < IconSize; row++) {
+                uint8_t* dest = (uint8_t*)lockedRect.pBits + (size_t)(y + row) * lockedRect.Pitch + (size_t)x * 4;
+                memcpy(dest, result.pixels.data() + (size_t)row * IconSize, IconSize * 4);
+            }
+
+            if ((int)atlasSlotOfIcon.size() <= result.iconId) {
+                atlasSlotOfIcon.resize(result.iconId + 1, -1);
+            }
+            atlasSlotOfIcon[result.iconId] = atlasSlot;
+            usedSlots++;
+        }
+
+        if (result.iconId < (int)atlasSlotOfIcon.size() && atlasSlotOfIcon[result.iconId] >= 0) {
+            slot.state = State::Ready;
+            slot.iconId = result.iconId;
+        }
+        else {
+            slot.state = State::Failed;
+        }
+    }
+
+    if (lockedAtlas >= 0) {
+        atlases[lockedAtlas]->UnlockRect(0);
+    }
+}
+
+void IconService::WorkerLoop() {
+    // SHGetFileInfo needs COM on the calling thread
+    CoInitializeEx(NULL, COINIT_APARTMENTTHREADED);
+
+    while (true) {
+        std::string path;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [this] { return stopping || !requests.empty(); });
+            if (stopping) break;
+            path = std::move(requests.front());
+            requests.pop_front();
+        }
+
+        Result result;
+        result.path = path;
+
+        std::string basePath = ExtractBasePathFromADS(path);
+        std::string ext = extensionOf(basePath);
+        bool exists = GetFileAttributesW(toWide(basePath).c_str()) != INVALID_FILE_ATTRIBUTES;
+        std::string dedupeKey = (exists && hasOwnIcon(ext)) ? "path:" + basePath : "ext:" + ext;
+        auto known = iconIdByKey.find(dedupeKey);
+
+        if (known != iconIdByKey.end()) {
+            result.iconId = known->second;
+        }
+        else {
+            std::vector<uint32_t> pixels;
+            if (Resolve(path, dedupeKey, pixels)) {
+                result.iconId = nextIconId++;
+                result.pixels = std::move(pixels);
+            }
+            // failed keys are remembered as well so the next file of that type doesnt retry
+            iconIdByKey[dedupeKey] = result.iconId;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        completed.push_back(std::move(result));
+    }
+
+    CoUninitialize();
+}
+
+bool IconService::Resolve(const std::string& path, std::string& dedupeKey, std::vector<uint32_t>& pixels) {
+    std::string basePath = ExtractBasePathFromADS(path);
+    bool byExtension = dedupeKey.rfind("ext:", 0) == 0;
+    std::wstring query = byExtension ? L"x" + toWide(extensionOf(basePath)) : toWide(basePath);
+
+    SHFILEINFOW shfi = { 0 };
+    DWORD flags = SHGFI_ICON | SHGFI_LARGEICON | (byExtension ? SHGFI_USEFILEATTRIBUTES : 0);
+    if (!SHGetFileInfoW(query.c_str(), FILE_ATTRIBUTE_NORMAL, &shfi, sizeof(shfi), flags) || !shfi.hIcon) {
+        return false;
+    }
+
+    BITMAPINFO bmi = { 0 };
+    bmi.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+    bmi.bmiHeader.biWidth = IconSize;
+    bmi.bmiHeader.biHeight = -IconSize;
+    bmi.bmiHeader.biPlanes = 1;
+    bmi.bmiHeader.biBitCount = 32;
+    bmi.bmiHeader.biCompression = BI_RGB;
+
+    void* bits = nullptr;
+    HDC hDC = CreateCompatibleDC(NULL);
+    HBITMAP dib = CreateDIBSection(hDC, &bmi, DIB_RGB_COLORS, &bits, NULL, 0);
+    bool ok = false;
+    if (dib && bits) {
+        HBITMAP oldBitmap = (HBITMAP)SelectObject(hDC, dib);
+        memset(bits, 0, IconSize * IconSize * 4);
+        ok = DrawIconEx(hDC, 0, 0, shfi.hIcon, IconSize, IconSize, 0, NULL, DI_NORMAL) != 0;
+        GdiFlush();
+        if (ok) {
+            pixels.assign((uint32_t*)bits, (uint32_t*)bits + IconSize * IconSize);
+            // old style icons have no alpha channel, make whatever got drawn opaque
+            bool hasAlpha = std::any_of(pixels.begin(), pixels.end(), [](uint32_t p) { return (p >> 24) != 0; });
+            if (!hasAlpha) {
+                for (auto& p : pixels) {
+                    if (p & 0x00FFFFFF) p |= 0xFF000000;
+                }
+            }
+        }
+        SelectObject(hDC, oldBitmap);
+        DeleteObject(dib);
+    }
+    DeleteDC(hDC);
+    DestroyIcon(shfi.hIcon);
+    return ok;
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include "../include.h"
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// resolves file icons on a worker thread and packs them into a few shared atlas textures
+// the ui only asks for an icon and draws a placeholder until the next batch upload has it
+class IconService {
+public:
+    static constexpr int IconSize = 32;
+    static constexpr int AtlasSize = 512;
+    static constexpr int IconsPerAtlas = (AtlasSize / IconSize) * (AtlasSize / IconSize);
+
+    static IconService& Instance();
+
+    void Start();
+    void Shutdown();
+
+    // true once the icon is in an atlas, false while it is pending or when it failed to load
+    bool Get(const std::string& path, ImTextureID& texture, ImVec2& uv0, ImVec2& uv1);
+
+    // call between frames, copies finished icons into the atlases
+    void Upload(LPDIRECT3DDEVICE9 device, size_t maxIcons = 64);
+
+private:
+    enum class State { Pending, Ready, Failed };
+
+    struct PathSlot {
+        State state = State::Pending;
+        int iconId = -1;
+    };
+
+    struct Result {
+        std::string path;
+        int iconId = -1;                // -1 when the icon couldnt be resolved
+        std::vector<uint32_t> pixels;   // only filled the first time an icon id shows up
+    };
+
+    IconService() = default;
+    void WorkerLoop();
+    bool Resolve(const std::string& path, std::string& dedupeKey, std::vector<uint32_t>& pixels);
+
+    // ui thread only
+    std::unordered_map<std::string, PathSlot> paths;
+    std::vector<int> atlasSlotOfIcon;
+    std::vector<LPDIRECT3DTEXTURE9> atlases;
+    int usedSlots = 0;
+
+    // shared with the worker
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::deque<std::string> requests;
+    std::vector<Result> completed;
+    bool stopping = false;
+    std::thread worker;
+
+    // worker thread only, one icon per extension for missing files and generic types
+    std::unordered_map<std::string, int> iconIdByKey;
+    int nextIconId = 0;
+};
@@ -1,11 +1,22 @@
 #define NOMINMAX
 #include "UI.h"
 #include "font.h"
+#include "IconService.h"
 #include "../BAM/BAM.h"
+#include "../BAM/CertStoreIndex.h"
+#include "../BAM/AnalysisCache.h"
+#include "../BAM/LiveReplace.h"
+#include "../export/EntryExport.h"
+#include "../snapshot/SnapshotEntries.h"
+#include "../diff/ScanDiff.h"
+#include "../replaceparser/ReplaceWatcher.h"
+#include "../util/Utf8.h"
 #include "../yara/yara.h"
 #include <time.h>
 #include <thread>
+#include <iostream>
 #include <shellapi.h>
+#include <commdlg.h>
 #include <string>
 #include <unordered_map>
 #include <sstream>
@@ -18,93 +29,250 @@
 #include <tchar.h>
 #include <ImGui/imgui_internal.h>
 
-struct IconData {
-    LPDIRECT3DTEXTURE9 Texture = nullptr;
-    int Width = 0;
-    int Height = 0;
-    bool IsLoaded = false;
+#pragma comment(lib, "Comdlg32.lib")
+
+struct DisplayRow {
+    size_t entryIndex = 0;
+    std::string time;
+    std::string path;
+    std::string signature;
+    std::string rules;
+    std::string host;
+    std::string change;     // only in the changes view
+    std::string searchText; // lowercased host/time/path/signature/rules/change, matched against the search box
+    bool isSigned = false;
+    bool isFlagged = false;
+    bool inInstance = false;
+    bool hasReplace = false;
 };
 
-std::string ExtractBasePathFromADS(const std::string& fullPath) {
-    size_t adsPos = fullPath.find(':');
-    if (adsPos != std::string::npos && adsPos < 3) {
-        adsPos = fullPath.find(':', adsPos + 1);
+// utf-8 cells, column widths and the filtered row order, built once per dataset instead of every frame
+struct DisplayModel {
+    const std::vector<BAMEntry>* entries = nullptr;
+    size_t entryCount = 0;
+    uint64_t generation = 0;
+    std::vector<DisplayRow> rows;
+    std::vector<int> visible;
+    float timeWidth = 0.0f;
+    float pathWidth = 0.0f;
+    float signatureWidth = 0.0f;
+    float rulesWidth = 0.0f;
+    float changeWidth = 0.0f;
+    bool hasChanges = false;
+
+    bool filterValid = false;
+    bool notSignedOnly = false;
+    bool flaggedOnly = false;
+    bool instanceOnly = false;
+    std::string search;
+
+    static std::string Lower(const std::string& s) {
+        std::string lower = s;
+        std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c) { return (char)std::tolower(c); });
+        return lower;
+    }
+
+    // changes holds one label per entry when the source is a diff
+    void Build(const std::vector<BAMEntry>& source, const std::vector<std::string>* changes = nullptr) {
+        entries = &source;
+        hasChanges = changes != nullptr;
+        entryCount = source.size();
+        rows.clear();
+        rows.reserve(source.size());
+        visible.reserve(source.size());
+
+        timeWidth = ImGui::CalcTextSize("Last Execution").x;
+        pathWidth = ImGui::CalcTextSize("Filepath").x;
+        signatureWidth = ImGui::CalcTextSize("Signature").x;
+        rulesWidth = ImGui::CalcTextSize("Rules").x;
+        changeWidth = ImGui::CalcTextSize("Change").x;
+
+        for (size_t i = 0; i < source.size(); i++) {
+            const BAMEntry& entry = source[i];
+            DisplayRow row;
+            row.entryIndex = i;
+            row.time = wstringToString(entry.executionTime);
+            row.path = wstringToString(entry.path);
+            row.signature = wstringToString(entry.signatureStatus);
+            for (size_t r = 0; r < entry.matched_rules.size(); r++) {
+                if (r > 0) row.rules += ", ";
+                row.rules += entry.matched_rules[r];
+            }
+            if (!entry.host.empty()) {
+                row.host = wstringToString(entry.host);
+            }
+            row.isSigned = row.signature == "Signed";
+            row.isFlagged = !entry.matched_rules.empty();
+            row.inInstance = entry.isInCurrentInstance;
+            row.hasReplace = !entry.replace_results.empty();
+            if (changes) {
+                row.change = (*changes)[i];
+                changeWidth = std::max(changeWidth, ImGui::CalcTextSize(row.change.c_str()).x);
+            }
+            row.searchText = Lower(row.host + '\n' + row.time + '\n' + row.path + '\n' + row.signature + '\n' + row.rules + '\n' + row.change);
+
+            timeWidth = std::max(timeWidth, ImGui::CalcTextSize(row.time.c_str()).x);
+            float hostWidth = row.host.empty() ? 0.0f : ImGui::CalcTextSize(row.host.c_str()).x + ImGui::GetStyle().ItemSpacing.x;
+            pathWidth = std::max(pathWidth, ImGui::CalcTextSize(row.path.c_str()).x + hostWidth);
+            signatureWidth = std::max(signatureWidth, ImGui::CalcTextSize(row.signature.c_str()).x);
+            if (row.isFlagged) {
+                rulesWidth = std::max(rulesWidth, ImGui::CalcTextSize(row.rules.c_str()).x);
+            }
+            rows.push_back(std::move(row));
+        }
+
+        timeWidth += 30;
+        pathWidth += 30;
+        signatureWidth += 30;
+        rulesWidth += 30;
+        changeWidth += 30;
+        filterValid = false;
+    }
+
+    void ApplyFilter(bool notSigned, bool flagged, bool instance, const char* searchQuery) {
+        if (filterValid && notSigned == notSignedOnly && flagged == flaggedOnly && instance == instanceOnly && search == searchQuery) {
+            return;
+        }
+        notSignedOnly = notSigned;
+        flaggedOnly = flagged;
+        instanceOnly = instance;
+        search = searchQuery;
+        std::string lowerSearch = Lower(search);
+
+        visible.clear();
+        for (size_t i = 0; i < rows.size(); i++) {
+            const DisplayRow& row = rows[i];
+            if (notSignedOnly && row.isSigned) continue;
+            if (flaggedOnly && !row.isFlagged) continue;
+            if (instanceOnly && !row.inInstance) continue;
+            if (!lowerSearch.empty() && row.searchText.find(lowerSearch) == std::string::npos) continue;
+            visible.push_back((int)i);
+        }
+        filterValid = true;
+    }
+};
+
+void ProcessEntries(std::atomic<bool>& isProcessing, std::vector<BAMEntry>& entries, const std::wstring& hivePath) {
+    if (hivePath.empty()) {
+        BAMParser parser;
+        entries = parser.GetEntries();
     }
-    if (adsPos != std::string::npos) {
-        return fullPath.substr(0, adsPos);
+    else {
+        BAMParser parser(hivePath);
+        entries = parser.GetEntries();
     }
-    return fullPath;
+    isProcessing = false;
 }
 
-bool LoadFileIcon(const std::string& filePath, IconData* outIconData, LPDIRECT3DDEVICE9 device) {
-    if (filePath.empty() || device == nullptr)
-        return false;
-    std::string basePath = ExtractBasePathFromADS(filePath);
-    DWORD fileAttributes = GetFileAttributesA(basePath.c_str());
-    bool fileExists = (fileAttributes != INVALID_FILE_ATTRIBUTES);
-    SHFILEINFO shfi = { 0 };
-    DWORD dwFlags = SHGFI_ICON | SHGFI_LARGEICON;
-    if (!fileExists) {
-        dwFlags |= SHGFI_USEFILEATTRIBUTES;
-    }
-    DWORD_PTR result = SHGetFileInfoA(basePath.c_str(), fileExists ? 0 : FILE_ATTRIBUTE_NORMAL, &shfi, sizeof(SHFILEINFO), dwFlags);
-    if (result == 0 || shfi.hIcon == NULL)
-        return false;
-    ICONINFO iconInfo;
-    if (!GetIconInfo(shfi.hIcon, &iconInfo)) {
-        DestroyIcon(shfi.hIcon);
-        return false;
+std::wstring PickHiveFile(HWND owner) {
+    wchar_t fileName[MAX_PATH] = L"";
+    OPENFILENAMEW ofn = { 0 };
+    ofn.lStructSize = sizeof(ofn);
+    ofn.hwndOwner = owner;
+    ofn.lpstrFilter = L"Registry hives\0SYSTEM*\0All files\0*.*\0";
+    ofn.lpstrFile = fileName;
+    ofn.nMaxFile = MAX_PATH;
+    ofn.Flags = OFN_FILEMUSTEXIST | OFN_PATHMUSTEXIST;
+    if (!GetOpenFileNameW(&ofn)) {
+        return std::wstring();
     }
-    BITMAP bm;
-    if (!GetObject(iconInfo.hbmColor, sizeof(BITMAP), &bm)) {
-        DeleteObject(iconInfo.hbmMask);
-        DeleteObject(iconInfo.hbmColor);
-        DestroyIcon(shfi.hIcon);
-        return false;
+    return fileName;
+}
+
+std::wstring PickExportFile(HWND owner) {
+    wchar_t fileName[MAX_PATH] = L"bam.ndjson";
+    OPENFILENAMEW ofn = { 0 };
+    ofn.lStructSize = sizeof(ofn);
+    ofn.hwndOwner = owner;
+    ofn.lpstrFilter = L"NDJSON\0*.ndjson\0CSV\0*.csv\0";
+    ofn.lpstrFile = fileName;
+    ofn.nMaxFile = MAX_PATH;
+    ofn.lpstrDefExt = L"ndjson";
+    ofn.Flags = OFN_OVERWRITEPROMPT | OFN_PATHMUSTEXIST;
+    if (!GetSaveFileNameW(&ofn)) {
+        return std::wstring();
     }
-    HDC hDC = CreateCompatibleDC(NULL);
-    HBITMAP oldBitmap = (HBITMAP)SelectObject(hDC, iconInfo.hbmColor);
-    int width = bm.bmWidth;
-    int height = bm.bmHeight;
-    LPDIRECT3DTEXTURE9 texture = nullptr;
-    HRESULT hr = device->CreateTexture(width, height, 1, 0, D3DFMT_A8R8G8B8, D3DPOOL_MANAGED, &texture, NULL);
-    if (FAILED(hr)) {
-        SelectObject(hDC, oldBitmap);
-        DeleteDC(hDC);
-        DeleteObject(iconInfo.hbmMask);
-        DeleteObject(iconInfo.hbmColor);
-        DestroyIcon(shfi.hIcon);
+    return fileName;
+}
+
+bool ExportEntries(const std::wstring& path, const std::vector<BAMEntry>& entries) {
+    ResultExporter exporter;
+    if (!exporter.Open(std::filesystem::path(path), ResultExporter::FormatForPath(path))) {
         return false;
     }
-    D3DLOCKED_RECT lockedRect;
-    texture->LockRect(0, &lockedRect, NULL, 0);
-    BITMAPINFO bmi;
-    ZeroMemory(&bmi, sizeof(BITMAPINFO));
-    bmi.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
-    bmi.bmiHeader.biWidth = width;
-    bmi.bmiHeader.biHeight = -height;
-    bmi.bmiHeader.biPlanes = 1;
-    bmi.bmiHeader.biBitCount = 32;
-    bmi.bmiHeader.biCompression = BI_RGB;
-    GetDIBits(hDC, iconInfo.hbmColor, 0, height, lockedRect.pBits, &bmi, DIB_RGB_COLORS);
-    texture->UnlockRect(0);
-    texture->SetAutoGenFilterType(D3DTEXF_LINEAR);
-    outIconData->Texture = texture;
-    outIconData->Width = width;
-    outIconData->Height = height;
-    outIconData->IsLoaded = true;
-    SelectObject(hDC, oldBitmap);
-    DeleteDC(hDC);
-    DeleteObject(iconInfo.hbmMask);
-    DeleteObject(iconInfo.hbmColor);
-    DestroyIcon(shfi.hIcon);
-    return true;
+    for (const auto& entry : entries) {
+        exporter.Write(MakeExportRecord(entry));
+    }
+    return exporter.Close();
 }
 
-void ProcessEntries(std::atomic<bool>& isProcessing, std::vector<BAMEntry>& entries) {
-    BAMParser parser;
-    entries = parser.GetEntries();
-    isProcessing = false;
+std::wstring PickSnapshotToSave(HWND owner) {
+    wchar_t fileName[MAX_PATH] = L"bam.bamsnap";
+    OPENFILENAMEW ofn = { 0 };
+    ofn.lStructSize = sizeof(ofn);
+    ofn.hwndOwner = owner;
+    ofn.lpstrFilter = L"BAM snapshots\0*.bamsnap\0All files\0*.*\0";
+    ofn.lpstrFile = fileName;
+    ofn.nMaxFile = MAX_PATH;
+    ofn.lpstrDefExt = L"bamsnap";
+    ofn.Flags = OFN_OVERWRITEPROMPT | OFN_PATHMUSTEXIST;
+    if (!GetSaveFileNameW(&ofn)) {
+        return std::wstring();
+    }
+    return fileName;
+}
+
+// several snapshots can be picked at once, they are merged into one table
+std::vector<std::wstring> PickSnapshotsToOpen(HWND owner) {
+    std::vector<wchar_t> buffer(32 * 1024, L'\0');
+    OPENFILENAMEW ofn = { 0 };
+    ofn.lStructSize = sizeof(ofn);
+    ofn.hwndOwner = owner;
+    ofn.lpstrFilter = L"BAM snapshots\0*.bamsnap\0All files\0*.*\0";
+    ofn.lpstrFile = buffer.data();
+    ofn.nMaxFile = (DWORD)buffer.size();
+    ofn.Flags = OFN_FILEMUSTEXIST | OFN_PATHMUSTEXIST | OFN_ALLOWMULTISELECT | OFN_EXPLORER;
+    std::vector<std::wstring> files;
+    if (!GetOpenFileNameW(&ofn)) {
+        return files;
+    }
+
+    // one pick is a full path, several are the directory followed by the names
+    std::wstring first = buffer.data();
+    const wchar_t* name = buffer.data() + first.size() + 1;
+    if (*name == L'\0') {
+        files.push_back(first);
+        return files;
+    }
+    while (*name) {
+        files.push_back(first + L"\\" + name);
+        name += wcslen(name) + 1;
+    }
+    return files;
+}
+
+// the rows that differ from the baseline, removed ones come from the baseline itself
+void BuildChanges(const std::vector<BAMEntry>& baseline, const std::vector<BAMEntry>& current,
+    std::vector<BAMEntry>& changes, std::vector<std::string>& labels) {
+    changes.clear();
+    labels.clear();
+    std::vector<DiffRecord> diff = ScanDiff::Compare(MakeExportRecords(baseline), MakeExportRecords(current), LocalHostName());
+    changes.reserve(diff.size());
+    labels.reserve(diff.size());
+    for (const auto& record : diff) {
+        if (record.kind == DiffKind::Removed) {
+            changes.push_back(baseline[record.before]);
+            labels.push_back(ScanDiff::KindName(record.kind));
+        }
+        else {
+            changes.push_back(current[record.after]);
+            std::string label = ScanDiff::KindName(record.kind);
+            if (record.kind == DiffKind::Changed) {
+                label += ": " + ScanDiff::FieldNames(record.fields);
+            }
+            labels.push_back(std::move(label));
+        }
+    }
 }
 
 LPDIRECT3D9 UI::g_pD3D = nullptr;
@@ -192,6 +360,7 @@ bool UI::Initialize() {
     io.Fonts->AddFontDefault();
     ImGui_ImplWin32_Init(hwnd);
     ImGui_ImplDX9_Init(g_pd3dDevice);
+    IconService::Instance().Start();
     return true;
 }
 
@@ -207,6 +376,7 @@ bool UI::ShouldClose() {
 }
 
 void UI::BeginFrame() {
+    IconService::Instance().Upload(g_pd3dDevice);
     ImGui_ImplDX9_NewFrame();
     ImGui_ImplWin32_NewFrame();
     ImGui::NewFrame();
@@ -226,20 +396,32 @@ void UI::Render() {
     static bool showOnlyInstance = false;
     static bool showDetailsPopup = false;
     static BAMEntry selectedEntry;
-    static std::unordered_map<std::string, IconData> iconCache;
     static char searchBuffer[256] = "";
-
-    auto parseTime = [](const std::wstring& timeStr) -> std::chrono::system_clock::time_point {
-        std::tm tm = {};
-        std::string narrowTimeStr(timeStr.begin(), timeStr.end());
-        std::istringstream ss(narrowTimeStr);
-        ss >> std::get_time(&tm, "%Y-%m-%d %H:%M:%S");
-        return std::chrono::system_clock::from_time_t(std::mktime(&tm));
-        };
-
-    auto sortEntries = [&parseTime](std::vector<BAMEntry>& entriesToSort) {
-        std::sort(entriesToSort.begin(), entriesToSort.end(), [&parseTime](const BAMEntry& a, const BAMEntry& b) {
-            return parseTime(a.executionTime) > parseTime(b.executionTime);
+    static std::wstring hivePath;
+    static DisplayModel displayModel;
+    static uint64_t entriesGeneration = 0;
+    static bool wasProcessing = false;
+    static std::vector<BAMEntry> baselineEntries;
+    static std::vector<BAMEntry> changeEntries;
+    static std::vector<std::string> changeLabels;
+    static uint64_t changesGeneration = UINT64_MAX;
+    static bool showChanges = false;
+    static bool watchReplaces = false;
+    static std::vector<ReplaceAlert> liveAlerts;
+    // formatted once when the alerts are taken, the list is drawn every frame
+    static std::vector<std::string> liveAlertLines;
+    static std::string liveAlertsHeader;
+    static bool snapshotRows = false;   // the table shows opened snapshots instead of a scan
+
+    // the live journal only belongs to rows of the live registry, a hive or a snapshot ends the watch
+    auto stopWatching = []() {
+        watchReplaces = false;
+        ReplaceWatcher::Instance().Stop();
+    };
+
+    auto sortEntries = [](std::vector<BAMEntry>& entriesToSort) {
+        std::sort(entriesToSort.begin(), entriesToSort.end(), [](const BAMEntry& a, const BAMEntry& b) {
+            return a.executionFileTime > b.executionFileTime;
             });
         };
 
@@ -248,9 +430,9 @@ void UI::Render() {
         if (processingThread.joinable()) {
             processingThread.join();
         }
-        processingThread = std::thread([sortEntries, isProcessing_ptr = &isProcessing, entries_ptr = &entries]() {
+        processingThread = std::thread([sortEntries, isProcessing_ptr = &isProcessing, entries_ptr = &entries, source = hivePath]() {
             std::vector<BAMEntry> localEntries;
-            ProcessEntries(*isProcessing_ptr, localEntries);
+            ProcessEntries(*isProcessing_ptr, localEntries, source);
             sortEntries(localEntries);
             *entries_ptr = std::move(localEntries);
             *isProcessing_ptr = false;
@@ -258,6 +440,7 @@ void UI::Render() {
     }
 
     if (isProcessing) {
+        wasProcessing = true;
         const float windowCenterX = (ImGui::GetWindowSize().x - ImGui::CalcTextSize("Processing BAM entries...").x) * 0.5f;
         const float windowCenterY = (ImGui::GetWindowSize().y - ImGui::CalcTextSize("Processing BAM entries...").y) * 0.5f;
         ImGui::SetCursorPos(ImVec2(windowCenterX, windowCenterY));
@@ -265,6 +448,24 @@ void UI::Render() {
         return;
     }
 
+    if (wasProcessing) {
+        wasProcessing = false;
+        entriesGeneration++;
+    }
+
+    // live replaces land on their rows the frame after the journal has them, the row turns red like a scan result
+    size_t alertsBefore = liveAlerts.size();
+    if (ReplaceWatcher::Instance().Running() && ReplaceWatcher::Instance().TakeAlerts(liveAlerts)) {
+        for (size_t i = alertsBefore; i < liveAlerts.size(); i++) {
+            const ReplaceAlert& alert = liveAlerts[i];
+            if (!ApplyReplaceAlert(entries, alert).empty()) {
+                entriesGeneration++;
+            }
+            liveAlertLines.push_back(FileTimeToUtcString(alert.timestamp) + " UTC  " + alert.result.replaceType + "  " + alert.path);
+        }
+        liveAlertsHeader = "Live replaces (" + std::to_string(liveAlerts.size()) + ")###LiveReplaces";
+    }
+
     if (showDetailsPopup) {
         ImGui::PushStyleColor(ImGuiCol_ModalWindowDimBg, ImVec4(0.0f, 0.0f, 0.0f, 0.6f));
         ImGui::OpenPopup("Replace Details Modal");
@@ -296,15 +497,81 @@ void UI::Render() {
         ImGui::PopStyleColor();
     }
 
-    if (ImGui::Button("Parse again", ImVec2(100, 30))) {
+    bool parseAgain = ImGui::Button("Parse again", ImVec2(100, 30));
+    ImGui::SameLine();
+    if (ImGui::Button("Open hive", ImVec2(100, 30))) {
+        std::wstring picked = PickHiveFile(hwnd);
+        if (!picked.empty()) {
+            hivePath = picked;
+            parseAgain = true;
+            stopWatching();
+        }
+    }
+    else if (parseAgain) {
+        hivePath.clear();
+    }
+    if (parseAgain) {
+        snapshotRows = false;
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Reload certs", ImVec2(100, 30))) {
+        CertStoreIndex::Instance().Refresh();
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Export", ImVec2(100, 30))) {
+        std::wstring picked = PickExportFile(hwnd);
+        if (!picked.empty() && !ExportEntries(picked, entries)) {
+            std::wcerr << L"Failed to export to " << picked << std::endl;
+        }
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Save snapshot", ImVec2(110, 30))) {
+        std::wstring picked = PickSnapshotToSave(hwnd);
+        if (!picked.empty() && !SaveSnapshot(picked, entries)) {
+            std::wcerr << L"Failed to save snapshot " << picked << std::endl;
+        }
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Open snapshot", ImVec2(110, 30))) {
+        std::vector<std::wstring> picked = PickSnapshotsToOpen(hwnd);
+        std::vector<BAMEntry> loaded;
+        for (const auto& path : picked) {
+            if (!LoadSnapshot(path, loaded)) {
+                std::wcerr << L"Failed to open snapshot " << path << std::endl;
+            }
+        }
+        if (!loaded.empty()) {
+            sortEntries(loaded);
+            entries = std::move(loaded);
+            entriesGeneration++;
+            snapshotRows = true;
+            stopWatching();
+        }
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Changes since", ImVec2(110, 30))) {
+        std::vector<std::wstring> picked = PickSnapshotsToOpen(hwnd);
+        std::vector<BAMEntry> loaded;
+        for (const auto& path : picked) {
+            if (!LoadSnapshot(path, loaded)) {
+                std::wcerr << L"Failed to open snapshot " << path << std::endl;
+            }
+        }
+        if (!picked.empty()) {
+            baselineEntries = std::move(loaded);
+            showChanges = true;
+            entriesGeneration++;
+        }
+    }
+    if (parseAgain) {
         entries.clear();
         isProcessing = true;
         if (processingThread.joinable()) {
             processingThread.join();
         }
-        processingThread = std::thread([sortEntries, isProcessing_ptr = &isProcessing, entries_ptr = &entries]() {
+        processingThread = std::thread([sortEntries, isProcessing_ptr = &isProcessing, entries_ptr = &entries, source = hivePath]() {
             std::vector<BAMEntry> localEntries;
-            ProcessEntries(*isProcessing_ptr, localEntries);
+            ProcessEntries(*isProcessing_ptr, localEntries, source);
             sortEntries(localEntries);
             *entries_ptr = std::move(localEntries);
             *isProcessing_ptr = false;
@@ -316,6 +583,28 @@ void UI::Render() {
     ImGui::Checkbox("Flagged Only", &showFlaggedOnly);
     ImGui::SameLine();
     ImGui::Checkbox("In Instance Only", &showOnlyInstance);
+    ImGui::SameLine();
+    if (!baselineEntries.empty()) {
+        ImGui::Checkbox("Changes Only", &showChanges);
+        ImGui::SameLine();
+    }
+    bool liveRows = hivePath.empty() && !snapshotRows;
+    if (liveRows && ImGui::Checkbox("Watch Replaces", &watchReplaces)) {
+        if (watchReplaces) {
+            std::wstring patternsPath;
+            std::wstring cursorDirectory;
+            BAMParser::JournalPaths(BAMParserOptions(), patternsPath, cursorDirectory);
+            watchReplaces = ReplaceWatcher::Instance().Start(patternsPath, cursorDirectory);
+        }
+        else {
+            ReplaceWatcher::Instance().Stop();
+        }
+    }
+    if (liveRows) {
+        ImGui::SameLine();
+    }
+    ImGui::TextDisabled("Cache: %lld hits / %lld misses",
+        AnalysisCache::Instance().Hits() + AnalysisCache::Instance().ContentHits(), AnalysisCache::Instance().Misses());
 
     float searchWidth = 450.0f;
     float padding = 25.0f;       
@@ -327,38 +616,46 @@ void UI::Render() {
     ImGui::Spacing();
 
 
+    if (!liveAlerts.empty()) {
+        if (ImGui::CollapsingHeader(liveAlertsHeader.c_str(), ImGuiTreeNodeFlags_DefaultOpen)) {
+            for (size_t i = liveAlerts.size(); i-- > 0;) {
+                const ReplaceAlert& alert = liveAlerts[i];
+                ImGui::PushID((int)i);
+                ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.0f, 0.0f, 0.0f, 1.0f));
+                if (ImGui::Selectable(liveAlertLines[i].c_str())) {
+                    selectedEntry = BAMEntry();
+                    selectedEntry.path = Utf8ToWide(alert.path);
+                    selectedEntry.replace_results.push_back(alert.result);
+                    showDetailsPopup = true;
+                }
+                ImGui::PopStyleColor();
+                ImGui::PopID();
+            }
+        }
+        ImGui::Spacing();
+    }
+
     if (entries.empty()) {
         ImGui::Text("No BAM entries found.");
         return;
     }
 
-    float pathMaxWidth = ImGui::CalcTextSize("Filepath").x;
-    float timeMaxWidth = ImGui::CalcTextSize("Last Execution").x;
-    float signatureMaxWidth = ImGui::CalcTextSize("Signature").x;
-    float rulesMaxWidth = ImGui::CalcTextSize("Rules").x;
-    for (const auto& entry : entries) {
-        std::string path(entry.path.begin(), entry.path.end());
-        std::string time(entry.executionTime.begin(), entry.executionTime.end());
-        std::string signature(entry.signatureStatus.begin(), entry.signatureStatus.end());
-        timeMaxWidth = std::max(timeMaxWidth, ImGui::CalcTextSize(time.c_str()).x);
-        pathMaxWidth = std::max(pathMaxWidth, ImGui::CalcTextSize(path.c_str()).x);
-        signatureMaxWidth = std::max(signatureMaxWidth, ImGui::CalcTextSize(signature.c_str()).x);
-        std::string rules;
-        for (const auto& rule : entry.matched_rules) {
-            rules += rule + ", ";
-        }
-        if (!rules.empty()) {
-            rules = rules.substr(0, rules.length() - 2);
-            rulesMaxWidth = std::max(rulesMaxWidth, ImGui::CalcTextSize(rules.c_str()).x);
-        }
+    // the diff against the baseline is redone once per dataset, not per frame
+    bool changesView = showChanges && !baselineEntries.empty();
+    if (changesView && changesGeneration != entriesGeneration) {
+        BuildChanges(baselineEntries, entries, changeEntries, changeLabels);
+        changesGeneration = entriesGeneration;
+    }
+    const std::vector<BAMEntry>& shown = changesView ? changeEntries : entries;
+
+    // rebuilt only when a scan finishes or a filter changes, drawing a frame never allocates
+    if (displayModel.entries != &shown || displayModel.entryCount != shown.size() || displayModel.generation != entriesGeneration) {
+        displayModel.Build(shown, changesView ? &changeLabels : nullptr);
+        displayModel.generation = entriesGeneration;
     }
-    timeMaxWidth += 30;
-    pathMaxWidth += 30;
-    signatureMaxWidth += 30;
-    rulesMaxWidth += 30;
+    displayModel.ApplyFilter(showNotSignedOnly, showFlaggedOnly, showOnlyInstance, searchBuffer);
 
     auto SelectableText = [&](const char* label, const char* text_to_copy, bool& clicked) {
-        ImGui::PushID(label);
         bool selected = false;
         ImGui::PushStyleColor(ImGuiCol_Header, ImVec4(0.2f, 0.2f, 0.2f, 0.5f));
         ImGui::PushStyleColor(ImGuiCol_HeaderHovered, ImVec4(0.3f, 0.3f, 0.3f, 0.5f));
@@ -373,122 +670,82 @@ void UI::Render() {
             }
         }
         ImGui::PopStyleColor(3);
-        ImGui::PopID();
         };
 
-    auto toLower = [](const std::string& s) -> std::string {
-        std::string lower = s;
-        std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c) { return std::tolower(c); });
-        return lower;
-        };
-
-    if (ImGui::BeginTable("BAMTable", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_Resizable | ImGuiTableFlags_Reorderable)) {
-        ImGui::TableSetupColumn("Last Execution", ImGuiTableColumnFlags_None, timeMaxWidth);
-        ImGui::TableSetupColumn("Filepath", ImGuiTableColumnFlags_None, pathMaxWidth);
-        ImGui::TableSetupColumn("Signature", ImGuiTableColumnFlags_None, signatureMaxWidth);
-        ImGui::TableSetupColumn("Rules", ImGuiTableColumnFlags_None, rulesMaxWidth);
+    const char* tableId = displayModel.hasChanges ? "BAMChangesTable" : "BAMTable";
+    if (ImGui::BeginTable(tableId, displayModel.hasChanges ? 5 : 4, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_Resizable | ImGuiTableFlags_Reorderable | ImGuiTableFlags_ScrollY)) {
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("Last Execution", ImGuiTableColumnFlags_None, displayModel.timeWidth);
+        ImGui::TableSetupColumn("Filepath", ImGuiTableColumnFlags_None, displayModel.pathWidth);
+        ImGui::TableSetupColumn("Signature", ImGuiTableColumnFlags_None, displayModel.signatureWidth);
+        ImGui::TableSetupColumn("Rules", ImGuiTableColumnFlags_None, displayModel.rulesWidth);
+        if (displayModel.hasChanges) {
+            ImGui::TableSetupColumn("Change", ImGuiTableColumnFlags_None, displayModel.changeWidth);
+        }
         ImGui::TableHeadersRow();
-        for (const auto& entry : entries) {
-            bool shouldShow = true;
-            std::string signatureStr(entry.signatureStatus.begin(), entry.signatureStatus.end());
-            if (showNotSignedOnly && signatureStr == "Signed") {
-                shouldShow = false;
-            }
-            if (showFlaggedOnly && entry.matched_rules.empty()) {
-                shouldShow = false;
-            }
-            if (showOnlyInstance && !entry.isInCurrentInstance) {
-                shouldShow = false;
-            }
-            if (!shouldShow)
-                continue;
-
-            std::string searchQuery(searchBuffer);
-            if (!searchQuery.empty()) {
-                std::string lowerSearch = toLower(searchQuery);
-                std::string timeStr(entry.executionTime.begin(), entry.executionTime.end());
-                std::string pathStr(entry.path.begin(), entry.path.end());
-                std::string lowerTime = toLower(timeStr);
-                std::string lowerPath = toLower(pathStr);
-                std::string lowerSignature = toLower(signatureStr);
-                std::string rules;
-                for (const auto& rule : entry.matched_rules) {
-                    rules += rule + ", ";
+
+        ImGuiListClipper clipper;
+        clipper.Begin((int)displayModel.visible.size());
+        while (clipper.Step()) {
+            for (int rowIndex = clipper.DisplayStart; rowIndex < clipper.DisplayEnd; rowIndex++) {
+                const DisplayRow& row = displayModel.rows[displayModel.visible[rowIndex]];
+                const BAMEntry& entry = shown[row.entryIndex];
+
+                ImGui::PushID(rowIndex);
+                ImGui::TableNextRow();
+                bool clicked = false;
+                ImGui::TableNextColumn();
+                SelectableText(row.time.c_str(), row.time.c_str(), clicked);
+                ImGui::TableNextColumn();
+
+                ImTextureID iconTexture = nullptr;
+                ImVec2 iconUv0, iconUv1;
+                const ImVec2 iconSize((float)IconService::IconSize * 0.5f, (float)IconService::IconSize * 0.5f);
+                if (IconService::Instance().Get(row.path, iconTexture, iconUv0, iconUv1)) {
+                    ImGui::Image(iconTexture, iconSize, iconUv0, iconUv1);
                 }
-                if (!rules.empty()) {
-                    rules = rules.substr(0, rules.length() - 2);
+                else {
+                    ImGui::Dummy(iconSize);
                 }
-                std::string lowerRules = toLower(rules);
-                if (lowerTime.find(lowerSearch) == std::string::npos &&
-                    lowerPath.find(lowerSearch) == std::string::npos &&
-                    lowerSignature.find(lowerSearch) == std::string::npos &&
-                    lowerRules.find(lowerSearch) == std::string::npos) {
-                    continue;
+                ImGui::SameLine();
+                if (!row.host.empty()) {
+                    ImGui::TextDisabled("%s", row.host.c_str());
+                    ImGui::SameLine();
                 }
-            }
-
-            std::string timeStr(entry.executionTime.begin(), entry.executionTime.end());
-            std::string pathStr(entry.path.begin(), entry.path.end());
-            ImGui::TableNextRow();
-            bool clicked = false;
-            ImGui::TableNextColumn();
-            SelectableText(timeStr.c_str(), timeStr.c_str(), clicked);
-            ImGui::TableNextColumn();
-
-            IconData icon;
-            bool hasIcon = false;
-            auto it = iconCache.find(pathStr);
-            if (it == iconCache.end()) {
-                IconData loadedIcon;
-                if (LoadFileIcon(pathStr, &loadedIcon, g_pd3dDevice)) {
-                    iconCache[pathStr] = loadedIcon;
-                    icon = loadedIcon;
-                    hasIcon = true;
+                if (row.hasReplace) {
+                    ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.0f, 0.0f, 0.0f, 1.0f));
                 }
-            }
-            else {
-                icon = it->second;
-                hasIcon = icon.IsLoaded;
-            }
-            if (hasIcon) {
-                ImGui::Image((void*)icon.Texture, ImVec2((float)icon.Width * 0.5f, (float)icon.Height * 0.5f));
-                ImGui::SameLine();
-            }
-            if (!entry.replace_results.empty()) {
-                ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.0f, 0.0f, 0.0f, 1.0f));
-            }
-            SelectableText(pathStr.c_str(), pathStr.c_str(), clicked);
-            if (!entry.replace_results.empty()) {
-                ImGui::PopStyleColor();
-            }
-            if (clicked && !ImGui::GetIO().KeyCtrl && !entry.replace_results.empty()) {
-                selectedEntry = entry;
-                showDetailsPopup = true;
-            }
-            ImGui::TableNextColumn();
-            if (signatureStr == "Signed") {
-                ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.0f, 1.0f, 0.0f, 1.0f));
-            }
-            else {
-                ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.9f, 0.2f, 0.2f, 1.0f));
-            }
-            SelectableText(signatureStr.c_str(), signatureStr.c_str(), clicked);
-            ImGui::PopStyleColor();
-            ImGui::TableNextColumn();
-            if (!entry.matched_rules.empty()) {
-                std::string rules;
-                for (size_t i = 0; i < entry.matched_rules.size(); i++) {
-                    rules += entry.matched_rules[i];
-                    if (i < entry.matched_rules.size() - 1) {
-                        rules += ", ";
-                    }
+                SelectableText(row.path.c_str(), row.path.c_str(), clicked);
+                if (row.hasReplace) {
+                    ImGui::PopStyleColor();
                 }
-                ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.0f, 0.0f, 0.0f, 1.0f));
-                SelectableText(rules.c_str(), rules.c_str(), clicked);
+                if (clicked && !ImGui::GetIO().KeyCtrl && row.hasReplace) {
+                    selectedEntry = entry;
+                    showDetailsPopup = true;
+                }
+                ImGui::TableNextColumn();
+                if (row.isSigned) {
+                    ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.0f, 1.0f, 0.0f, 1.0f));
+                }
+                else {
+                    ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.9f, 0.2f, 0.2f, 1.0f));
+                }
+                SelectableText(row.signature.c_str(), row.signature.c_str(), clicked);
                 ImGui::PopStyleColor();
-            }
-            else {
-                SelectableText("-", "-", clicked);
+                ImGui::TableNextColumn();
+                if (row.isFlagged) {
+                    ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.0f, 0.0f, 0.0f, 1.0f));
+                    SelectableText(row.rules.c_str(), row.rules.c_str(), clicked);
+                    ImGui::PopStyleColor();
+                }
+                else {
+                    SelectableText("-", "-", clicked);
+                }
+                if (displayModel.hasChanges) {
+                    ImGui::TableNextColumn();
+                    SelectableText(row.change.c_str(), row.change.c_str(), clicked);
+                }
+                ImGui::PopID();
             }
         }
         ImGui::EndTable();
@@ -514,6 +771,8 @@ void UI::EndFrame() {
 }
 
 void UI::Shutdown() {
+    ReplaceWatcher::Instance().Stop();
+    IconService::Instance().Shutdown();
     ImGui_ImplDX9_Shutdown();
     ImGui_ImplWin32_Shutdown();
     ImGui::DestroyContext();
@@ -0,0 +1,379 @@
+// headless front end, runs the same engine as BAMParser.exe without d3d9, imgui or the font
+// link it with BAM/, hive/, util/, yara/ and replaceparser/ (no UI/), subsystem console
+#include <windows.h>
+#include <io.h>
+#include <fcntl.h>
+#include <atomic>
+#include <iostream>
+#include <chrono>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include "../BAM/BAM.h"
+#include "../BAM/AnalysisCache.h"
+#include "../BAM/LiveReplace.h"
+#include "../export/EntryExport.h"
+#include "../snapshot/SnapshotEntries.h"
+#include "../diff/ScanDiff.h"
+#include "../replaceparser/ReplaceWatcher.h"
+#include "../util/Utf8.h"
+#include "../yara/yara.h"
+
+enum ExitCode {
+    ExitClean = 0,
+    ExitError = 1,
+    ExitFindings = 2,
+};
+
+struct CliArguments {
+    BAMParserOptions options;
+    std::wstring outputPath;
+    std::wstring format;
+    std::wstring inputPath;   // snapshot read instead of scanning
+    std::wstring sincePath;   // baseline snapshot, only the differences are written
+    std::wstring savePath;    // snapshot of the results
+    bool watch = false;       // keep streaming live replace alerts after the scan
+    bool help = false;
+};
+
+static void PrintUsage() {
+    std::cerr <<
+        "usage: BAMParserCLI [options]\n"
+        "results are written as they are found, stdout only ever carries records, everything else goes to stderr\n"
+        "  --hive <path>      parse a collected SYSTEM hive instead of the live registry\n"
+        "  --evidence-root <dir>  with --hive: the collected volumes, C:\\x.exe is read from <dir>\\C\\x.exe and\n"
+        "                     \\Device\\HarddiskVolume3\\x.exe from <dir>\\HarddiskVolume3\\x.exe;\n"
+        "                     without it the files of a hive are not analyzed. the hive's letter -> volume guid\n"
+        "                     pairs are printed to stderr to tell which collected volume goes where\n"
+        "  --output <path>    write results to a file instead of stdout\n"
+        "  --format <fmt>     ndjson or csv, defaults to the output extension (ndjson on stdout)\n"
+        "  --input <snap>     read a saved snapshot instead of scanning\n"
+        "  --since <snap>     only write what changed since a saved snapshot, with change / changed_fields columns\n"
+        "  --save <snap>      save the results as a snapshot\n"
+        "  --threads <n>      analysis workers, 0 = one per hardware thread\n"
+        "  --no-signature     skip the digital signature checks\n"
+        "  --offline-signatures  embedded signatures and the catalog index only, no WinVerifyTrust\n"
+        "  --catroot <dir>    catalogs copied off the analyzed machine instead of the local CatRoot\n"
+        "  --no-yara          skip the generic checks\n"
+        "  --no-replace       skip the journal replace checks\n"
+        "  --no-cache         ignore the analysis cache and the journal cursors (full journal reads)\n"
+        "  --no-hash          don't put md5 / sha-1 / sha-256 on the results\n"
+        "  --allowlist <tbl>  known good sha-256 table (hashsetgen), hits skip the generic checks\n"
+        "  --blocklist <tbl>  known bad sha-256 table, hits are reported as Known Cheat right away\n"
+        "  --patterns <file>  extra replace patterns for the journal checks (see replaceparser/UsnPattern.h)\n"
+        "  --journal-timeout <s>  per volume limit for reading its journal, 0 = none (default 30)\n"
+        "  --watch            after the scan keep watching the journals and stream replaces as they happen, Ctrl+C stops;\n"
+        "                     they come as changed / new_replaces rows (added for files without a BAM entry)\n"
+        "exit codes: 0 nothing found, 1 error, 2 findings\n";
+}
+
+static bool ParseArguments(int argc, wchar_t* argv[], CliArguments& args) {
+    for (int i = 1; i < argc; i++) {
+        std::wstring arg = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (arg == L"--hive" && hasValue) {
+            args.options.hivePath = argv[++i];
+        }
+        else if (arg == L"--evidence-root" && hasValue) {
+            args.options.evidenceRoot = argv[++i];
+        }
+        else if (arg == L"--output" && hasValue) {
+            args.outputPath = argv[++i];
+        }
+        else if (arg == L"--input" && hasValue) {
+            args.inputPath = argv[++i];
+        }
+        else if (arg == L"--since" && hasValue) {
+            args.sincePath = argv[++i];
+        }
+        else if (arg == L"--catroot" && hasValue) {
+            args.options.catrootPath = argv[++i];
+        }
+        else if (arg == L"--allowlist" && hasValue) {
+            args.options.allowlistPath = argv[++i];
+        }
+        else if (arg == L"--blocklist" && hasValue) {
+            args.options.blocklistPath = argv[++i];
+        }
+        else if (arg == L"--patterns" && hasValue) {
+            args.options.replacePatternsPath = argv[++i];
+        }
+        else if (arg == L"--save" && hasValue) {
+            args.savePath = argv[++i];
+        }
+        else if (arg == L"--format" && hasValue) {
+            args.format = argv[++i];
+            if (args.format != L"ndjson" && args.format != L"csv") {
+                std::wcerr << L"Unknown format: " << args.format << L"\n";
+                return false;
+            }
+        }
+        else if (arg == L"--threads" && hasValue) {
+            wchar_t* end = nullptr;
+            unsigned long count = wcstoul(argv[++i], &end, 10);
+            if (end == argv[i] || *end != L'\0') {
+                std::wcerr << L"Invalid thread count: " << argv[i] << L"\n";
+                return false;
+            }
+            args.options.threadCount = (unsigned)count;
+        }
+        else if (arg == L"--journal-timeout" && hasValue) {
+            wchar_t* end = nullptr;
+            unsigned long seconds = wcstoul(argv[++i], &end, 10);
+            if (end == argv[i] || *end != L'\0') {
+                std::wcerr << L"Invalid journal timeout: " << argv[i] << L"\n";
+                return false;
+            }
+            args.options.journalTimeoutSeconds = (unsigned)seconds;
+        }
+        else if (arg == L"--no-signature") {
+            args.options.checkSignatures = false;
+        }
+        else if (arg == L"--offline-signatures") {
+            args.options.offlineSignatures = true;
+        }
+        else if (arg == L"--no-yara") {
+            args.options.scanYara = false;
+        }
+        else if (arg == L"--no-replace") {
+            args.options.checkReplaces = false;
+        }
+        else if (arg == L"--no-cache") {
+            args.options.useCache = false;
+        }
+        else if (arg == L"--watch") {
+            args.watch = true;
+        }
+        else if (arg == L"--no-hash") {
+            args.options.computeHashes = false;
+        }
+        else if (arg == L"--help" || arg == L"-h") {
+            args.help = true;
+        }
+        else {
+            std::wcerr << L"Unknown argument: " << arg << L"\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool IsFinding(const BAMEntry& entry) {
+    return !entry.matched_rules.empty() || !entry.replace_results.empty() ||
+        entry.signatureStatus == L"Cheat Signature" || entry.signatureStatus == L"Fake Signature" ||
+        entry.signatureStatus == L"Known Cheat";
+}
+
+static std::atomic<bool> interrupted{ false };
+
+static BOOL WINAPI OnConsoleCtrl(DWORD) {
+    interrupted = true;
+    return TRUE;
+}
+
+// streams replace alerts until Ctrl+C in the --since output shape: an alert on a BAM entry writes that entry again as
+// "changed" / "new_replaces", one on a file without an entry an "added" row with just the path and the replace
+static bool WatchReplaces(const BAMParserOptions& options, std::vector<BAMEntry>& entries, ResultExporter& exporter, bool& findings) {
+    std::wstring patternsPath;
+    std::wstring cursorDirectory;
+    BAMParser::JournalPaths(options, patternsPath, cursorDirectory);
+    ReplaceWatcher& watcher = ReplaceWatcher::Instance();
+    if (!watcher.Start(patternsPath, cursorDirectory)) {
+        std::cerr << "Failed to watch the USN journals.\n";
+        return false;
+    }
+    SetConsoleCtrlHandler(OnConsoleCtrl, TRUE);
+    std::cerr << "Watching the USN journals for replaces, Ctrl+C stops" << std::endl;
+
+    std::string replacesField = ScanDiff::FieldNames(DiffField::NewReplaces);
+    std::vector<ReplaceAlert> alerts;
+    uint64_t alertCount = 0;
+    while (!interrupted) {
+        alerts.clear();
+        if (!watcher.TakeAlerts(alerts, std::chrono::milliseconds(250))) {
+            continue;
+        }
+        for (const auto& alert : alerts) {
+            std::vector<size_t> matched = ApplyReplaceAlert(entries, alert);
+            for (size_t index : matched) {
+                ExportRecord record = MakeExportRecord(entries[index]);
+                record.change = ScanDiff::KindName(DiffKind::Changed);
+                record.changedFields = replacesField.c_str();
+                exporter.Write(record);
+            }
+            if (matched.empty()) {
+                BAMEntry entry;
+                entry.path = Utf8ToWide(alert.path);
+                entry.replace_results.push_back(alert.result);
+                ExportRecord record = MakeExportRecord(entry);
+                record.change = ScanDiff::KindName(DiffKind::Added);
+                exporter.Write(record);
+            }
+        }
+        alertCount += alerts.size();
+        findings = true;
+        // out of the buffer right away, whoever reads the stream sees the replace while it happens
+        exporter.Flush();
+    }
+
+    watcher.Stop();
+    SetConsoleCtrlHandler(OnConsoleCtrl, FALSE);
+    std::cerr << "Watch stopped, " << alertCount << " live replaces" << std::endl;
+    return true;
+}
+
+int wmain(int argc, wchar_t* argv[]) {
+    CliArguments args;
+    if (!ParseArguments(argc, argv, args)) {
+        PrintUsage();
+        return ExitError;
+    }
+    if (args.help) {
+        PrintUsage();
+        return ExitClean;
+    }
+
+    ExportFormat format = ExportFormat::Ndjson;
+    if (!args.format.empty()) {
+        format = args.format == L"csv" ? ExportFormat::Csv : ExportFormat::Ndjson;
+    }
+    else if (!args.outputPath.empty()) {
+        format = ResultExporter::FormatForPath(args.outputPath);
+    }
+
+    ResultExporter exporter;
+    std::FILE* results = nullptr;   // own handle on the real stdout, only the exporter writes to it
+    int64_t resultsStart = -1;      // its offset when it is a file, -1 for a console or a pipe
+    if (!args.outputPath.empty()) {
+        if (!exporter.Open(std::filesystem::path(args.outputPath), format)) {
+            std::wcerr << L"Failed to open output " << args.outputPath << L"\n";
+            return ExitError;
+        }
+    }
+    else {
+        fflush(stdout);
+        int resultsFd = _dup(_fileno(stdout));
+        results = resultsFd == -1 ? nullptr : _fdopen(resultsFd, "wb");
+        if (!results) {
+            std::cerr << "Failed to open stdout for the results.\n";
+            return ExitError;
+        }
+        _setmode(resultsFd, _O_BINARY);
+        resultsStart = _telli64(resultsFd);
+        exporter.Open(results, format);
+    }
+
+    // stdout itself goes to stderr for the whole run: whatever the engine prints (cout, wcout, printf, libyara)
+    // ends up next to the progress lines instead of between the records
+    _dup2(_fileno(stderr), _fileno(stdout));
+    setvbuf(stdout, nullptr, _IONBF, 0);
+
+    bool findings = false;
+    bool succeeded = true;
+    std::vector<BAMEntry> entries;
+    auto start = std::chrono::steady_clock::now();
+
+    if (!args.inputPath.empty()) {
+        succeeded = LoadSnapshot(args.inputPath, entries);
+        if (!succeeded) {
+            std::wcerr << L"Failed to open snapshot " << args.inputPath << L"\n";
+        }
+    }
+    else {
+        initializeGenericRules();
+        if (args.options.scanYara && !compileGenericRules()) {
+            std::cerr << "Failed to compile YARA rules.\n";
+            return ExitError;
+        }
+        if (args.options.useCache && !AnalysisCache::Instance().Load()) {
+            std::cerr << "Failed to load the analysis cache.\n";
+        }
+
+        // calls are serialized by the parser, entries are written while the scan is still running
+        // a diff needs the whole scan first, so nothing is streamed then
+        if (args.sincePath.empty()) {
+            args.options.onEntry = [&exporter, &findings](const BAMEntry& entry) {
+                exporter.Write(MakeExportRecord(entry));
+                findings |= IsFinding(entry);
+            };
+        }
+
+        BAMParser parser(args.options);
+        succeeded = parser.Succeeded();
+        entries = parser.GetEntries();
+        destroyGenericRules();
+    }
+
+    if (succeeded && !args.savePath.empty() && !SaveSnapshot(args.savePath, entries)) {
+        std::wcerr << L"Failed to save snapshot " << args.savePath << L"\n";
+        succeeded = false;
+    }
+
+    if (succeeded && !args.sincePath.empty()) {
+        std::vector<BAMEntry> baseline;
+        if (!LoadSnapshot(args.sincePath, baseline)) {
+            std::wcerr << L"Failed to open snapshot " << args.sincePath << L"\n";
+            succeeded = false;
+        }
+        else {
+            auto diffStart = std::chrono::steady_clock::now();
+            std::vector<DiffRecord> diff = ScanDiff::Compare(MakeExportRecords(baseline), MakeExportRecords(entries), LocalHostName());
+            double diffMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - diffStart).count();
+            std::cerr << "Diffed " << baseline.size() << " against " << entries.size() << " entries in "
+                << std::fixed << std::setprecision(2) << diffMs << " ms, " << diff.size() << " changes" << std::endl;
+
+            for (const auto& change : diff) {
+                const BAMEntry& entry = change.kind == DiffKind::Removed ? baseline[change.before] : entries[change.after];
+                std::string fields = ScanDiff::FieldNames(change.fields);
+                ExportRecord record = MakeExportRecord(entry);
+                record.change = ScanDiff::KindName(change.kind);
+                record.changedFields = fields.c_str();
+                exporter.Write(record);
+                if (change.kind != DiffKind::Removed) {
+                    findings |= IsFinding(entry);
+                }
+            }
+        }
+    }
+    else if (succeeded && !args.inputPath.empty()) {
+        for (const auto& entry : entries) {
+            exporter.Write(MakeExportRecord(entry));
+            findings |= IsFinding(entry);
+        }
+    }
+
+    if (succeeded && args.watch) {
+        if (!args.inputPath.empty() || !args.options.hivePath.empty() || !args.options.checkReplaces) {
+            std::cerr << "--watch needs a live scan with the replace checks.\n";
+            succeeded = false;
+        }
+        else {
+            succeeded = WatchReplaces(args.options, entries, exporter, findings);
+        }
+    }
+
+    bool written = exporter.Close();
+    if (results) {
+        // a redirected stdout has to hold exactly what the exporter wrote, a stray line breaks whoever parses it
+        int64_t resultsEnd = _telli64(_fileno(results));
+        if (written && resultsStart >= 0 && resultsEnd >= resultsStart && (uint64_t)(resultsEnd - resultsStart) != exporter.BytesWritten()) {
+            std::cerr << "stdout holds " << (uint64_t)(resultsEnd - resultsStart) << " bytes, only " << exporter.BytesWritten()
+                << " of them are results\n";
+            written = false;
+        }
+        fclose(results);
+    }
+    double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::cerr << "Exported " << exporter.RecordsWritten() << " entries (" << exporter.BytesWritten() << " bytes) in "
+        << std::fixed << std::setprecision(2) << elapsedMs << " ms" << std::endl;
+
+    if (!written) {
+        std::cerr << "Failed to write the results.\n";
+        return ExitError;
+    }
+    if (!succeeded) {
+        return ExitError;
+    }
+    return findings ? ExitFindings : ExitClean;
+}
@@ -0,0 +1,289 @@
+#include "ScanDiff.h"
+#include <cstring>
+#include <cwchar>
+#include <cwctype>
+
+static const std::wstring EmptyText;
+
+static const std::wstring& Text(const std::wstring* text) {
+    return text ? *text : EmptyText;
+}
+
+// ascii is folded inline, towlower only for the rest; '/' and '\' are the same separator
+static inline uint32_t Fold(wchar_t c) {
+    if (c < 0x80) {
+        if (c >= L'A' && c <= L'Z') return (uint32_t)(c + (L'a' - L'A'));
+        if (c == L'/') return L'\\';
+        return (uint32_t)c;
+    }
+    return (uint32_t)towlower(c);
+}
+
+// ascii only, no branch per character: 'A'-'Z' get the lowercase bit, '/' becomes '\'
+static inline uint16_t FoldAscii(wchar_t c) {
+    uint16_t value = (uint16_t)c;
+    value += (uint16_t)((uint16_t)(value - L'A') < 26u) << 5;
+    value ^= (uint16_t)(value == L'/') * (L'/' ^ L'\\');
+    return value;
+}
+
+// eight folded characters per step in two independent multiply chains, a char-at-a-time fnv chain was the slowest part
+// of the join. strings that are all ascii (nearly every path, every sid and host) skip Fold's towlower branch; both loops
+// produce the same words, so a path hashes the same whichever one it takes
+static inline uint64_t HashText(const std::wstring& text) {
+    const uint64_t k = 0x9E3779B97F4A7C15ull;
+    const wchar_t* chars = text.data();
+    size_t size = text.size();
+    uint32_t any = 0;
+    for (size_t i = 0; i < size; i++) {
+        any |= (uint32_t)chars[i];
+    }
+
+    uint64_t low = 0x243F6A8885A308D3ull, high = 0x13198A2E03707344ull;
+    size_t i = 0;
+    if (any < 0x80) {
+        for (; i + 8 <= size; i += 8) {
+            // folded into a block first so the compiler can do all eight at once
+            uint16_t block[8];
+            for (size_t j = 0; j < 8; j++) {
+                block[j] = FoldAscii(chars[i + j]);
+            }
+            uint64_t words[2];
+            std::memcpy(words, block, sizeof(words));
+            low = (low ^ words[0]) * k;
+            high = (high ^ words[1]) * k;
+            low ^= low >> 29;
+            high ^= high >> 29;
+        }
+    }
+    else {
+        for (; i + 8 <= size; i += 8) {
+            uint64_t words[2] = {};
+            for (size_t j = 0; j < 8; j++) {
+                words[j >> 2] |= (uint64_t)(uint16_t)Fold(chars[i + j]) << ((j & 3) * 16);
+            }
+            low = (low ^ words[0]) * k;
+            high = (high ^ words[1]) * k;
+            low ^= low >> 29;
+            high ^= high >> 29;
+        }
+    }
+    uint64_t words[2] = {};
+    for (size_t j = 0; i < size; i++, j++) {
+        words[j >> 2] |= (uint64_t)(uint16_t)Fold(chars[i]) << ((j & 3) * 16);
+    }
+    low = (low ^ words[0] ^ size) * k;
+    high = (high ^ words[1]) * k;
+    return (low ^ (high >> 29)) * k + high;
+}
+
+// sids and hosts come in runs (one user key, one merged snapshot), the last few are kept so only the path is hashed
+struct RecentHashes {
+    std::wstring text[4];
+    uint64_t hash[4] = {};
+    size_t count = 0;
+    size_t next = 0;
+
+    uint64_t Get(const std::wstring& value) {
+        for (size_t i = 0; i < count; i++) {
+            if (text[i] == value) {
+                return hash[i];
+            }
+        }
+        text[next] = value;
+        hash[next] = HashText(value);
+        uint64_t result = hash[next];
+        next = (next + 1) & 3;
+        count = count < 4 ? count + 1 : 4;
+        return result;
+    }
+};
+
+// live rows carry no host, a snapshot tags them with the machine's name when it is saved
+static const std::wstring& Host(const ExportRecord& record, const std::wstring& localHost) {
+    return record.host && !record.host->empty() ? *record.host : localHost;
+}
+
+static uint64_t KeyHash(const ExportRecord& record, const std::wstring& localHost, RecentHashes& sids, RecentHashes& hosts) {
+    uint64_t hash = HashText(Text(record.path));
+    hash = (hash ^ sids.Get(Text(record.sid))) * 0xff51afd7ed558ccdull;
+    // merged snapshots share system sids (S-1-5-18) and paths across machines, the host keeps them apart
+    hash = (hash ^ (hash >> 33) ^ hosts.Get(Host(record, localHost))) * 0xc4ceb9fe1a85ec53ull;
+    // mix the high bits back down before masking into the table
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdull;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+static bool FoldedEqual(const std::wstring& a, const std::wstring& b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    // the same scan nearly always spells a path the same way, one memcmp settles it
+    if (std::wmemcmp(a.data(), b.data(), a.size()) == 0) {
+        return true;
+    }
+    for (size_t i = 0; i < a.size(); i++) {
+        if (a[i] != b[i] && Fold(a[i]) != Fold(b[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool SameKey(const ExportRecord& a, const ExportRecord& b, const std::wstring& localHost) {
+    return FoldedEqual(Text(a.path), Text(b.path)) && FoldedEqual(Text(a.sid), Text(b.sid)) &&
+        FoldedEqual(Host(a, localHost), Host(b, localHost));
+}
+
+// rule and replace lists are a handful of items, a nested scan beats building sets
+static bool HasRuleMissingFrom(const std::vector<std::string>* rules, const std::vector<std::string>* other) {
+    if (!rules) {
+        return false;
+    }
+    for (const auto& rule : *rules) {
+        bool found = false;
+        if (other) {
+            for (const auto& candidate : *other) {
+                if (candidate == rule) {
+                    found = true;
+                    break;
+                }
+            }
+        }
+        if (!found) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool HasReplaceMissingFrom(const std::vector<ReplaceFileStruct>* replaces, const std::vector<ReplaceFileStruct>* other) {
+    if (!replaces) {
+        return false;
+    }
+    for (const auto& replace : *replaces) {
+        bool found = false;
+        if (other) {
+            for (const auto& candidate : *other) {
+                if (candidate.replaceType == replace.replaceType && candidate.filename == replace.filename && candidate.details == replace.details) {
+                    found = true;
+                    break;
+                }
+            }
+        }
+        if (!found) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static uint32_t ChangedFields(const ExportRecord& before, const ExportRecord& after) {
+    uint32_t fields = 0;
+    if (before.executionFileTime != after.executionFileTime) fields |= DiffField::ExecutionTime;
+    if (Text(before.signatureStatus) != Text(after.signatureStatus)) fields |= DiffField::Signature;
+    if (HasRuleMissingFrom(after.matchedRules, before.matchedRules)) fields |= DiffField::NewRules;
+    if (HasRuleMissingFrom(before.matchedRules, after.matchedRules)) fields |= DiffField::LostRules;
+    if (HasReplaceMissingFrom(after.replaceResults, before.replaceResults)) fields |= DiffField::NewReplaces;
+    return fields;
+}
+
+std::vector<DiffRecord> ScanDiff::Compare(const std::vector<ExportRecord>& before, const std::vector<ExportRecord>& after,
+    const std::wstring& localHost) {
+    // open addressing over the older scan, power of two and at most half full
+    // hash and row share a slot so a probe touches one cache line
+    struct Slot {
+        uint64_t hash;
+        size_t row;
+    };
+    size_t capacity = 16;
+    while (capacity < before.size() * 2) {
+        capacity <<= 1;
+    }
+    const size_t mask = capacity - 1;
+    std::vector<Slot> slots(capacity, Slot{ 0, SIZE_MAX });
+
+    // hashing is a long dependency chain per row, doing it in its own pass lets the table misses overlap
+    RecentHashes sids, hosts;
+    std::vector<uint64_t> hashes(before.size());
+    for (size_t i = 0; i < before.size(); i++) {
+        hashes[i] = KeyHash(before[i], localHost, sids, hosts);
+    }
+    for (size_t i = 0; i < before.size(); i++) {
+        uint64_t hash = hashes[i];
+        size_t slot = (size_t)hash & mask;
+        while (slots[slot].row != SIZE_MAX) {
+            slot = (slot + 1) & mask;
+        }
+        slots[slot] = { hash, i };
+    }
+
+    std::vector<uint8_t> matched(before.size(), 0);
+    std::vector<DiffRecord> records;
+
+    hashes.resize(after.size());
+    for (size_t i = 0; i < after.size(); i++) {
+        hashes[i] = KeyHash(after[i], localHost, sids, hosts);
+    }
+    for (size_t i = 0; i < after.size(); i++) {
+        uint64_t hash = hashes[i];
+        size_t match = SIZE_MAX;
+        // duplicate keys (the same snapshot merged twice) pair up in order, each older row is used once
+        for (size_t slot = (size_t)hash & mask; slots[slot].row != SIZE_MAX; slot = (slot + 1) & mask) {
+            size_t candidate = slots[slot].row;
+            if (slots[slot].hash == hash && !matched[candidate] && SameKey(before[candidate], after[i], localHost)) {
+                match = candidate;
+                break;
+            }
+        }
+
+        if (match == SIZE_MAX) {
+            records.push_back({ DiffKind::Added, 0, SIZE_MAX, i });
+            continue;
+        }
+        matched[match] = 1;
+        uint32_t fields = ChangedFields(before[match], after[i]);
+        if (fields) {
+            records.push_back({ DiffKind::Changed, fields, match, i });
+        }
+    }
+
+    for (size_t i = 0; i < before.size(); i++) {
+        if (!matched[i]) {
+            records.push_back({ DiffKind::Removed, 0, i, SIZE_MAX });
+        }
+    }
+    return records;
+}
+
+const char* ScanDiff::KindName(DiffKind kind) {
+    switch (kind) {
+    case DiffKind::Added: return "added";
+    case DiffKind::Removed: return "removed";
+    default: return "changed";
+    }
+}
+
+std::string ScanDiff::FieldNames(uint32_t fields) {
+    static const struct {
+        uint32_t field;
+        const char* name;
+    } names[] = {
+        { DiffField::ExecutionTime, "execution_time" },
+        { DiffField::Signature, "signature" },
+        { DiffField::NewRules, "new_rules" },
+        { DiffField::LostRules, "lost_rules" },
+        { DiffField::NewReplaces, "new_replaces" },
+    };
+
+    std::string result;
+    for (const auto& entry : names) {
+        if (fields & entry.field) {
+            if (!result.empty()) result += ';';
+            result += entry.name;
+        }
+    }
+    return result;
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "../export/ResultExporter.h"
+
+// compares two scans (live vs saved, or saved vs saved), no windows headers so it also builds on linux
+// rows are joined on case-folded path + sid + host with one hash table over the older scan, linear in both sides
+
+enum class DiffKind {
+    Added,
+    Removed,
+    Changed,
+};
+
+namespace DiffField {
+    constexpr uint32_t ExecutionTime = 0x01;
+    constexpr uint32_t Signature = 0x02;
+    constexpr uint32_t NewRules = 0x04;     // rules the older scan didn't have
+    constexpr uint32_t LostRules = 0x08;
+    constexpr uint32_t NewReplaces = 0x10;  // replace hits the older scan didn't have
+}
+
+struct DiffRecord {
+    DiffKind kind = DiffKind::Changed;
+    uint32_t fields = 0;                     // DiffField bits, only for Changed
+    size_t before = SIZE_MAX;                // row in the older scan, SIZE_MAX for Added
+    size_t after = SIZE_MAX;                 // row in the newer scan, SIZE_MAX for Removed
+};
+
+class ScanDiff {
+public:
+    // added and changed rows in the order of the newer scan, then removed rows in the order of the older one.
+    // rows without a host are this machine's, they join the rows of a snapshot tagged localHost
+    static std::vector<DiffRecord> Compare(const std::vector<ExportRecord>& before, const std::vector<ExportRecord>& after,
+        const std::wstring& localHost = std::wstring());
+
+    static const char* KindName(DiffKind kind);
+    // "execution_time;signature;..." for the DiffField bits
+    static std::string FieldNames(uint32_t fields);
+};
@@ -0,0 +1,32 @@
+#pragma once
+#include <vector>
+#include "ResultExporter.h"
+#include "../BAM/BAM.h"
+
+// the record only borrows from the entry, write it before the entry goes away
+inline ExportRecord MakeExportRecord(const BAMEntry& entry) {
+    ExportRecord record;
+    record.path = &entry.path;
+    record.sid = &entry.sid;
+    record.host = &entry.host;
+    record.executionFileTime = entry.executionFileTime;
+    record.executionTime = &entry.executionTime;
+    record.signatureStatus = &entry.signatureStatus;
+    record.md5 = &entry.md5;
+    record.sha1 = &entry.sha1;
+    record.sha256 = &entry.sha256;
+    record.matchedRules = &entry.matched_rules;
+    record.replaceResults = &entry.replace_results;
+    record.isInCurrentInstance = entry.isInCurrentInstance;
+    record.isInInteractiveSession = entry.isInInteractiveSession;
+    return record;
+}
+
+inline std::vector<ExportRecord> MakeExportRecords(const std::vector<BAMEntry>& entries) {
+    std::vector<ExportRecord> records;
+    records.reserve(entries.size());
+    for (const auto& entry : entries) {
+        records.push_back(MakeExportRecord(entry));
+    }
+    return records;
+}
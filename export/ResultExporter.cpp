@@ -0,0 +1,416 @@
+#include "ResultExporter.h"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <cwctype>
+
+static const char* CsvHeader = "host,path,sid,execution_filetime,execution_time,signature,md5,sha1,sha256,matched_rules,replaces,in_instance,in_interactive_session,change,changed_fields\n";
+
+ResultExporter::~ResultExporter() {
+    Close();
+}
+
+bool ResultExporter::Open(const std::filesystem::path& path, ExportFormat format) {
+    Close();
+#ifdef _WIN32
+    std::FILE* file = _wfopen(path.c_str(), L"wb");
+#else
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+#endif
+    if (!file) {
+        return false;
+    }
+    stream = file;
+    ownsStream = true;
+    Begin(format);
+    return true;
+}
+
+bool ResultExporter::Open(std::FILE* target, ExportFormat format) {
+    Close();
+    if (!target) {
+        return false;
+    }
+    stream = target;
+    ownsStream = false;
+    Begin(format);
+    return true;
+}
+
+void ResultExporter::Begin(ExportFormat newFormat) {
+    format = newFormat;
+    if (!buffer) {
+        buffer = std::make_unique<char[]>(BufferSize);
+    }
+    used = 0;
+    records = 0;
+    bytes = 0;
+    failed = false;
+    if (format == ExportFormat::Csv) {
+        PutLiteral(CsvHeader);
+    }
+}
+
+bool ResultExporter::Flush() {
+    if (!stream) {
+        return false;
+    }
+    if (used && std::fwrite(buffer.get(), 1, used, stream) != used) {
+        failed = true;
+    }
+    bytes += used;
+    used = 0;
+    if (std::fflush(stream) != 0) {
+        failed = true;
+    }
+    return !failed;
+}
+
+bool ResultExporter::Close() {
+    if (!stream) {
+        return false;
+    }
+    bool ok = Flush();
+    if (ownsStream && std::fclose(stream) != 0) {
+        ok = false;
+    }
+    stream = nullptr;
+    ownsStream = false;
+    return ok;
+}
+
+ExportFormat ResultExporter::FormatForPath(const std::filesystem::path& path) {
+    std::wstring extension = path.extension().wstring();
+    for (auto& c : extension) {
+        c = (wchar_t)towlower(c);
+    }
+    return extension == L".csv" ? ExportFormat::Csv : ExportFormat::Ndjson;
+}
+
+void ResultExporter::Put(char c) {
+    if (used == BufferSize) {
+        if (std::fwrite(buffer.get(), 1, used, stream) != used) {
+            failed = true;
+        }
+        bytes += used;
+        used = 0;
+    }
+    buffer[used++] = c;
+}
+
+void ResultExporter::Put(const char* text, size_t length) {
+    while (length) {
+        if (used == BufferSize) {
+            if (std::fwrite(buffer.get(), 1, used, stream) != used) {
+                failed = true;
+            }
+            bytes += used;
+            used = 0;
+        }
+        size_t chunk = (std::min)(length, BufferSize - used);
+        memcpy(buffer.get() + used, text, chunk);
+        used += chunk;
+        text += chunk;
+        length -= chunk;
+    }
+}
+
+void ResultExporter::PutLiteral(const char* text) {
+    Put(text, strlen(text));
+}
+
+void ResultExporter::PutNumber(uint64_t value) {
+    char digits[24];
+    auto result = std::to_chars(digits, digits + sizeof(digits), value);
+    Put(digits, result.ptr - digits);
+}
+
+// at most 4 bytes
+static char* EncodeUtf8(char* out, uint32_t codePoint) {
+    if (codePoint < 0x80) {
+        *out++ = (char)codePoint;
+    }
+    else if (codePoint < 0x800) {
+        *out++ = (char)(0xC0 | (codePoint >> 6));
+        *out++ = (char)(0x80 | (codePoint & 0x3F));
+    }
+    else if (codePoint < 0x10000) {
+        *out++ = (char)(0xE0 | (codePoint >> 12));
+        *out++ = (char)(0x80 | ((codePoint >> 6) & 0x3F));
+        *out++ = (char)(0x80 | (codePoint & 0x3F));
+    }
+    else {
+        *out++ = (char)(0xF0 | (codePoint >> 18));
+        *out++ = (char)(0x80 | ((codePoint >> 12) & 0x3F));
+        *out++ = (char)(0x80 | ((codePoint >> 6) & 0x3F));
+        *out++ = (char)(0x80 | (codePoint & 0x3F));
+    }
+    return out;
+}
+
+static const char HexDigits[] = "0123456789abcdef";
+
+// at most 6 bytes (\u00XX)
+static char* EscapeJson(char* out, uint32_t c) {
+    if (c >= 0x80) {
+        return EncodeUtf8(out, c);
+    }
+    if (c == '"' || c == '\\') {
+        *out++ = '\\';
+    }
+    else if (c < 0x20) {
+        char escape[6] = { '\\', 'u', '0', '0', HexDigits[c >> 4], HexDigits[c & 0xF] };
+        memcpy(out, escape, sizeof(escape));
+        return out + sizeof(escape);
+    }
+    *out++ = (char)c;
+    return out;
+}
+
+// at most 4 bytes, fields are always quoted so commas and newlines only need the quotes doubled
+static char* EscapeCsv(char* out, uint32_t c) {
+    if (c == '"') {
+        *out++ = '"';
+    }
+    return EncodeUtf8(out, c);
+}
+
+// rule names and replace details are already utf-8, bytes above 0x7f pass through as they are
+static char* EscapeJsonByte(char* out, uint32_t c) {
+    if (c >= 0x80) {
+        *out++ = (char)c;
+        return out;
+    }
+    return EscapeJson(out, c);
+}
+
+static char* EscapeCsvByte(char* out, uint32_t c) {
+    if (c == '"') {
+        *out++ = '"';
+    }
+    *out++ = (char)c;
+    return out;
+}
+
+char* ResultExporter::Reserve(size_t length) {
+    if (BufferSize - used < length) {
+        if (std::fwrite(buffer.get(), 1, used, stream) != used) {
+            failed = true;
+        }
+        bytes += used;
+        used = 0;
+    }
+    return buffer.get() + used;
+}
+
+// utf-16 on windows, utf-32 elsewhere; registry names can hold lone surrogates, those become U+FFFD
+static uint32_t NextCodePoint(const wchar_t*& in, const wchar_t* end) {
+    uint32_t c = (uint32_t)*in++;
+    if (c >= 0xD800 && c <= 0xDBFF) {
+        if (in != end && (uint32_t)*in >= 0xDC00 && (uint32_t)*in <= 0xDFFF) {
+            return 0x10000 + ((c - 0xD800) << 10) + ((uint32_t)*in++ - 0xDC00);
+        }
+        return 0xFFFD;
+    }
+    if ((c >= 0xDC00 && c <= 0xDFFF) || c > 0x10FFFF) {
+        return 0xFFFD;
+    }
+    return c;
+}
+
+// a field that fits the buffer at its worst case gets one space check and is written through a cursor,
+// longer ones check per character. 6 bytes per utf-16 unit covers both escapes (a surrogate pair is 4 bytes of utf-8).
+// the cursor and the input stay in locals: every store through a char* may alias anything the compiler can't see is local
+template <char* (*Escape)(char*, uint32_t)>
+void ResultExporter::PutEscaped(const std::wstring& text) {
+    constexpr size_t Worst = 6;
+    const wchar_t* in = text.data();
+    const wchar_t* end = in + text.size();
+    if (text.size() < BufferSize / Worst) {
+        char* out = Reserve(text.size() * Worst);
+        while (in != end) {
+            // ascii, nearly every character of a path, needs no decoding
+            uint32_t c = (uint32_t)*in;
+            if (c < 0x80) {
+                out = Escape(out, c);
+                in++;
+            }
+            else {
+                out = Escape(out, NextCodePoint(in, end));
+            }
+        }
+        used = out - buffer.get();
+        return;
+    }
+    while (in != end) {
+        uint32_t c = NextCodePoint(in, end);
+        used = Escape(Reserve(Worst), c) - buffer.get();
+    }
+}
+
+template <char* (*Escape)(char*, uint32_t)>
+void ResultExporter::PutEscaped(std::string_view text) {
+    constexpr size_t Worst = 6;
+    if (text.size() < BufferSize / Worst) {
+        char* out = Reserve(text.size() * Worst);
+        for (unsigned char c : text) {
+            out = Escape(out, c);
+        }
+        used = out - buffer.get();
+        return;
+    }
+    for (unsigned char c : text) {
+        used = Escape(Reserve(Worst), c) - buffer.get();
+    }
+}
+
+void ResultExporter::PutHex(const std::string* digest) {
+    if (digest) {
+        Put(digest->data(), digest->size());
+    }
+}
+
+void ResultExporter::PutJsonString(const std::wstring& text) {
+    Put('"');
+    PutEscaped<EscapeJson>(text);
+    Put('"');
+}
+
+void ResultExporter::PutJsonString(std::string_view text) {
+    Put('"');
+    PutEscaped<EscapeJsonByte>(text);
+    Put('"');
+}
+
+void ResultExporter::PutCsvField(const std::wstring& text) {
+    Put('"');
+    PutEscaped<EscapeCsv>(text);
+    Put('"');
+}
+
+void ResultExporter::PutCsvText(std::string_view text) {
+    PutEscaped<EscapeCsvByte>(text);
+}
+
+void ResultExporter::WriteJson(const ExportRecord& record) {
+    static const std::wstring empty;
+
+    PutLiteral("{\"host\":");
+    PutJsonString(record.host ? *record.host : empty);
+    PutLiteral(",\"path\":");
+    PutJsonString(record.path ? *record.path : empty);
+    PutLiteral(",\"sid\":");
+    PutJsonString(record.sid ? *record.sid : empty);
+    PutLiteral(",\"execution_filetime\":");
+    PutNumber(record.executionFileTime);
+    PutLiteral(",\"execution_time\":");
+    PutJsonString(record.executionTime ? *record.executionTime : empty);
+    PutLiteral(",\"signature\":");
+    PutJsonString(record.signatureStatus ? *record.signatureStatus : empty);
+    // hex digests never need escaping
+    PutLiteral(",\"md5\":\"");
+    PutHex(record.md5);
+    PutLiteral("\",\"sha1\":\"");
+    PutHex(record.sha1);
+    PutLiteral("\",\"sha256\":\"");
+    PutHex(record.sha256);
+    Put('"');
+
+    PutLiteral(",\"matched_rules\":[");
+    if (record.matchedRules) {
+        for (size_t i = 0; i < record.matchedRules->size(); i++) {
+            if (i) Put(',');
+            PutJsonString((*record.matchedRules)[i]);
+        }
+    }
+    PutLiteral("],\"replaces\":[");
+    if (record.replaceResults) {
+        for (size_t i = 0; i < record.replaceResults->size(); i++) {
+            const ReplaceFileStruct& replace = (*record.replaceResults)[i];
+            if (i) Put(',');
+            PutLiteral("{\"type\":");
+            PutJsonString(replace.replaceType);
+            PutLiteral(",\"filename\":");
+            PutJsonString(replace.filename);
+            PutLiteral(",\"details\":");
+            PutJsonString(replace.details);
+            Put('}');
+        }
+    }
+    PutLiteral("],\"in_instance\":");
+    PutLiteral(record.isInCurrentInstance ? "true" : "false");
+    PutLiteral(",\"in_interactive_session\":");
+    PutLiteral(record.isInInteractiveSession ? "true" : "false");
+    if (record.change) {
+        PutLiteral(",\"change\":");
+        PutJsonString(record.change);
+        PutLiteral(",\"changed_fields\":");
+        PutJsonString(record.changedFields ? record.changedFields : "");
+    }
+    PutLiteral("}\n");
+}
+
+void ResultExporter::WriteCsv(const ExportRecord& record) {
+    static const std::wstring empty;
+
+    PutCsvField(record.host ? *record.host : empty);
+    Put(',');
+    PutCsvField(record.path ? *record.path : empty);
+    Put(',');
+    PutCsvField(record.sid ? *record.sid : empty);
+    Put(',');
+    PutNumber(record.executionFileTime);
+    Put(',');
+    PutCsvField(record.executionTime ? *record.executionTime : empty);
+    Put(',');
+    PutCsvField(record.signatureStatus ? *record.signatureStatus : empty);
+    // hex digests never need quoting
+    Put(',');
+    PutHex(record.md5);
+    Put(',');
+    PutHex(record.sha1);
+    Put(',');
+    PutHex(record.sha256);
+
+    // lists are joined with ';' inside one quoted field
+    PutLiteral(",\"");
+    if (record.matchedRules) {
+        for (size_t i = 0; i < record.matchedRules->size(); i++) {
+            if (i) Put(';');
+            PutCsvText((*record.matchedRules)[i]);
+        }
+    }
+    PutLiteral("\",\"");
+    if (record.replaceResults) {
+        for (size_t i = 0; i < record.replaceResults->size(); i++) {
+            const ReplaceFileStruct& replace = (*record.replaceResults)[i];
+            if (i) Put(';');
+            PutCsvText(replace.replaceType);
+            PutLiteral(": ");
+            PutCsvText(replace.details);
+        }
+    }
+    Put('"');
+    Put(',');
+    Put(record.isInCurrentInstance ? '1' : '0');
+    Put(',');
+    Put(record.isInInteractiveSession ? '1' : '0');
+    Put(',');
+    PutLiteral(record.change ? record.change : "");
+    PutLiteral(",\"");
+    PutCsvText(record.changedFields ? record.changedFields : "");
+    PutLiteral("\"\n");
+}
+
+void ResultExporter::Write(const ExportRecord& record) {
+    if (!stream) {
+        return;
+    }
+    if (format == ExportFormat::Csv) {
+        WriteCsv(record);
+    }
+    else {
+        WriteJson(record);
+    }
+    records++;
+}
@@ -0,0 +1,94 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "../replaceparser/ReplaceScanner.hh"
+
+// streaming NDJSON / CSV writer for scan results, no windows headers so it also builds on linux
+// every record is escaped straight into one fixed buffer, nothing is allocated per record
+
+enum class ExportFormat {
+    Ndjson,
+    Csv,
+};
+
+// borrowed view of one result, the fields mirror BAMEntry
+struct ExportRecord {
+    const std::wstring* path = nullptr;
+    const std::wstring* sid = nullptr;
+    const std::wstring* host = nullptr;     // machine of a snapshot row, empty for a scan of this one
+    uint64_t executionFileTime = 0;
+    const std::wstring* executionTime = nullptr;
+    const std::wstring* signatureStatus = nullptr;
+    const std::string* md5 = nullptr;       // lowercase hex
+    const std::string* sha1 = nullptr;
+    const std::string* sha256 = nullptr;
+    const std::vector<std::string>* matchedRules = nullptr;
+    const std::vector<ReplaceFileStruct>* replaceResults = nullptr;
+    bool isInCurrentInstance = false;
+    bool isInInteractiveSession = false;
+    // only set when writing a scan diff: "added", "removed" or "changed" and the changed fields
+    const char* change = nullptr;
+    const char* changedFields = nullptr;
+};
+
+class ResultExporter {
+public:
+    static constexpr size_t BufferSize = 1 << 16;
+
+    ResultExporter() = default;
+    ~ResultExporter();
+    ResultExporter(const ResultExporter&) = delete;
+    ResultExporter& operator=(const ResultExporter&) = delete;
+
+    bool Open(const std::filesystem::path& path, ExportFormat format);
+    // writes to an already open stream (stdout), Close flushes but doesn't close it
+    bool Open(std::FILE* stream, ExportFormat format);
+    void Write(const ExportRecord& record);
+    bool Flush();
+    bool Close();
+
+    // .csv picks csv, anything else ndjson
+    static ExportFormat FormatForPath(const std::filesystem::path& path);
+
+    uint64_t RecordsWritten() const { return records; }
+    uint64_t BytesWritten() const { return bytes; }
+    bool Failed() const { return failed; }
+
+private:
+    void Begin(ExportFormat format);
+    void Put(char c);
+    void Put(const char* text, size_t length);
+    void PutLiteral(const char* text);
+    void PutNumber(uint64_t value);
+    void PutJsonString(const std::wstring& text);
+    void PutJsonString(std::string_view text);
+    void PutCsvField(const std::wstring& text);
+    void PutCsvText(std::string_view text);
+    // room for length more bytes, flushes first when the buffer can't take them; the caller advances used
+    char* Reserve(size_t length);
+    // Escape writes one character at the cursor, at most 6 bytes, and returns the new end
+    template <char* (*Escape)(char*, uint32_t)>
+    void PutEscaped(const std::wstring& text);
+    template <char* (*Escape)(char*, uint32_t)>
+    void PutEscaped(std::string_view text);
+    // lowercase hex, written as is
+    void PutHex(const std::string* digest);
+
+    void WriteJson(const ExportRecord& record);
+    void WriteCsv(const ExportRecord& record);
+
+    std::FILE* stream = nullptr;
+    bool ownsStream = false;
+    ExportFormat format = ExportFormat::Ndjson;
+    std::unique_ptr<char[]> buffer;
+    size_t used = 0;
+    uint64_t records = 0;
+    uint64_t bytes = 0;
+    bool failed = false;
+};
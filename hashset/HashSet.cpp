@@ -0,0 +1,330 @@
+#include "HashSet.h"
+#include "../util/Digest.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+
+namespace {
+    constexpr uint64_t BloomBitsPerBlock = HashSetFormat::BloomBlockBytes * 8;
+    constexpr uint64_t BucketBytes = (HashSetFormat::BucketCount + 1) * sizeof(uint32_t);
+
+    uint64_t Align64(uint64_t value) {
+        return (value + 63) & ~63ull;
+    }
+
+    uint64_t Load64(const uint8_t* bytes) {
+        uint64_t value;
+        memcpy(&value, bytes, sizeof(value));
+        return value;
+    }
+
+    // the leading two bytes pick the bucket, so the filter takes its block and bits from further in
+    // sha-256 output is uniform, no need to hash the hash again
+    uint64_t BloomBlock(const uint8_t* hash, uint64_t mask) {
+        return Load64(hash + 8) & mask;
+    }
+
+    uint32_t BloomBit(const uint8_t* hash, uint32_t index) {
+        return (uint32_t)(Load64(hash + 16) >> (index * 9)) & (BloomBitsPerBlock - 1);
+    }
+
+    size_t Bucket(const uint8_t* hash) {
+        return ((size_t)hash[0] << 8) | hash[1];
+    }
+
+    bool EntryLess(const HashSetEntry& a, const HashSetEntry& b) {
+        return memcmp(a.hash, b.hash, sizeof(a.hash)) < 0;
+    }
+
+    bool EntryEqual(const HashSetEntry& a, const HashSetEntry& b) {
+        return memcmp(a.hash, b.hash, sizeof(a.hash)) == 0;
+    }
+
+    bool IsHexDigit(char c) {
+        return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+    }
+}
+
+bool HashSet::Open(const std::filesystem::path& path) {
+    Close();
+    if (!file.Open(path)) {
+        return false;
+    }
+    if (!OpenBuffer(file.Data(), file.Size())) {
+        file.Close();
+        return false;
+    }
+    return true;
+}
+
+void HashSet::Close() {
+    file.Close();
+    bloom = nullptr;
+    bucketTable = nullptr;
+    entries = nullptr;
+    count = 0;
+    bloomMask = 0;
+    bloomHashes = 0;
+    opened = false;
+}
+
+// the whole layout is checked here once, lookups don't check anything
+// the sort order isn't (that would page in the whole table), an unsorted table only loses hits
+bool HashSet::OpenBuffer(const uint8_t* data, size_t size) {
+    opened = false;
+    if (size < sizeof(HashSetHeader) || reinterpret_cast<uintptr_t>(data) % alignof(uint32_t)) {
+        return false;
+    }
+    HashSetHeader header;
+    memcpy(&header, data, sizeof(header));
+    if (memcmp(header.magic, HashSetFormat::Magic, sizeof(header.magic)) != 0 || header.version != HashSetFormat::Version) {
+        return false;
+    }
+    if (header.bloomHashes == 0 || header.bloomHashes > 64 / 9) {
+        return false;
+    }
+    if (header.bloomBlocks == 0 || (header.bloomBlocks & (header.bloomBlocks - 1)) ||
+        header.bloomBlocks > size / HashSetFormat::BloomBlockBytes) {
+        return false;
+    }
+    if (header.count > (std::numeric_limits<uint32_t>::max)() || header.count > size / sizeof(HashSetEntry)) {
+        return false;
+    }
+
+    uint64_t bloomOffset = sizeof(HashSetHeader);
+    uint64_t bucketOffset = bloomOffset + header.bloomBlocks * HashSetFormat::BloomBlockBytes;
+    uint64_t entryOffset = Align64(bucketOffset + BucketBytes);
+    if (header.bloomOffset != bloomOffset || header.bucketOffset != bucketOffset || header.entryOffset != entryOffset ||
+        entryOffset > size || header.count * sizeof(HashSetEntry) != size - entryOffset) {
+        return false;
+    }
+
+    const uint32_t* buckets = reinterpret_cast<const uint32_t*>(data + bucketOffset);
+    if (buckets[0] != 0 || buckets[HashSetFormat::BucketCount] != header.count) {
+        return false;
+    }
+    for (size_t i = 0; i < HashSetFormat::BucketCount; i++) {
+        if (buckets[i] > buckets[i + 1]) {
+            return false;
+        }
+    }
+
+    bloom = data + bloomOffset;
+    bucketTable = buckets;
+    entries = reinterpret_cast<const HashSetEntry*>(data + entryOffset);
+    count = header.count;
+    bloomMask = header.bloomBlocks - 1;
+    bloomHashes = header.bloomHashes;
+    opened = true;
+    return true;
+}
+
+HashSet::Probe HashSet::Lookup(const uint8_t* hash) const {
+    if (!opened) {
+        return Probe::Absent;
+    }
+    const uint8_t* block = bloom + BloomBlock(hash, bloomMask) * HashSetFormat::BloomBlockBytes;
+    for (uint32_t i = 0; i < bloomHashes; i++) {
+        uint32_t bit = BloomBit(hash, i);
+        if (!(block[bit / 8] & (1u << (bit % 8)))) {
+            return Probe::Absent;
+        }
+    }
+
+    size_t bucket = Bucket(hash);
+    const HashSetEntry* first = entries + bucketTable[bucket];
+    const HashSetEntry* last = entries + bucketTable[bucket + 1];
+    HashSetEntry key;
+    memcpy(key.hash, hash, sizeof(key.hash));
+    const HashSetEntry* found = std::lower_bound(first, last, key, EntryLess);
+    return found != last && EntryEqual(*found, key) ? Probe::Present : Probe::FalsePositive;
+}
+
+bool HashSet::Serialize(std::vector<HashSetEntry>& hashes, std::vector<uint8_t>& out) {
+    std::sort(hashes.begin(), hashes.end(), EntryLess);
+    hashes.erase(std::unique(hashes.begin(), hashes.end(), EntryEqual), hashes.end());
+    if (hashes.size() > (std::numeric_limits<uint32_t>::max)()) {
+        return false;
+    }
+
+    uint64_t wantedBlocks = (hashes.size() * HashSetFormat::BloomBitsPerHash + BloomBitsPerBlock - 1) / BloomBitsPerBlock;
+    uint64_t blocks = 1;
+    while (blocks < wantedBlocks) {
+        blocks <<= 1;
+    }
+
+    HashSetHeader header = {};
+    memcpy(header.magic, HashSetFormat::Magic, sizeof(header.magic));
+    header.version = HashSetFormat::Version;
+    header.bloomHashes = HashSetFormat::BloomHashes;
+    header.count = hashes.size();
+    header.bloomBlocks = blocks;
+    header.bloomOffset = sizeof(HashSetHeader);
+    header.bucketOffset = header.bloomOffset + blocks * HashSetFormat::BloomBlockBytes;
+    header.entryOffset = Align64(header.bucketOffset + BucketBytes);
+
+    out.assign(header.entryOffset + hashes.size() * sizeof(HashSetEntry), 0);
+    memcpy(out.data(), &header, sizeof(header));
+
+    uint8_t* bloom = out.data() + header.bloomOffset;
+    std::vector<uint32_t> buckets(HashSetFormat::BucketCount + 1, 0);
+    for (const auto& entry : hashes) {
+        uint8_t* block = bloom + BloomBlock(entry.hash, blocks - 1) * HashSetFormat::BloomBlockBytes;
+        for (uint32_t i = 0; i < header.bloomHashes; i++) {
+            uint32_t bit = BloomBit(entry.hash, i);
+            block[bit / 8] |= (uint8_t)(1u << (bit % 8));
+        }
+        buckets[Bucket(entry.hash) + 1]++;
+    }
+    for (size_t i = 0; i < HashSetFormat::BucketCount; i++) {
+        buckets[i + 1] += buckets[i];
+    }
+    memcpy(out.data() + header.bucketOffset, buckets.data(), BucketBytes);
+    if (!hashes.empty()) {
+        memcpy(out.data() + header.entryOffset, hashes.data(), hashes.size() * sizeof(HashSetEntry));
+    }
+    return true;
+}
+
+bool HashSet::Write(std::vector<HashSetEntry>& hashes, const std::filesystem::path& path) {
+    std::vector<uint8_t> bytes;
+    if (!Serialize(hashes, bytes)) {
+        return false;
+    }
+
+    std::filesystem::path temp = path;
+    temp += ".tmp";
+#ifdef _WIN32
+    std::FILE* out = _wfopen(temp.c_str(), L"wb");
+#else
+    std::FILE* out = std::fopen(temp.c_str(), "wb");
+#endif
+    if (!out) {
+        return false;
+    }
+    bool written = std::fwrite(bytes.data(), 1, bytes.size(), out) == bytes.size();
+    written = std::fclose(out) == 0 && written;
+    if (!written) {
+        std::filesystem::remove(temp);
+        return false;
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temp, path, error);
+    if (error) {
+        std::filesystem::remove(temp);
+        return false;
+    }
+    return true;
+}
+
+bool HashSet::ReadHexList(const std::filesystem::path& path, std::vector<HashSetEntry>& hashes, size_t& skippedLines) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        return false;
+    }
+
+    std::string line;
+    while (std::getline(in, line)) {
+        size_t start = line.find_first_not_of(" \t\r\xEF\xBB\xBF");
+        if (start == std::string::npos || line[start] == '#') {
+            continue;
+        }
+        size_t end = start;
+        while (end < line.size() && IsHexDigit(line[end])) {
+            end++;
+        }
+        bool separated = end == line.size() || line[end] == ' ' || line[end] == '\t' || line[end] == '\r' ||
+            line[end] == ',' || line[end] == ';';
+        HashSetEntry entry;
+        if (!separated || !HexToDigest(line.substr(start, end - start), entry.hash, sizeof(entry.hash))) {
+            skippedLines++;
+            continue;
+        }
+        hashes.push_back(entry);
+    }
+    return !in.bad();
+}
+
+KnownHashes& KnownHashes::Instance() {
+    static KnownHashes instance;
+    return instance;
+}
+
+bool KnownHashes::Open(const std::filesystem::path& allowlist, const std::filesystem::path& blocklist) {
+    auto start = std::chrono::steady_clock::now();
+    Close();
+
+    bool ok = true;
+    if (!allowlist.empty() && !allowed.Open(allowlist)) {
+        std::wcout << L"Failed to open allowlist " << allowlist.wstring() << std::endl;
+        ok = false;
+    }
+    if (!blocklist.empty() && !blocked.Open(blocklist)) {
+        std::wcout << L"Failed to open blocklist " << blocklist.wstring() << std::endl;
+        ok = false;
+    }
+    openMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return ok;
+}
+
+void KnownHashes::Close() {
+    allowed.Close();
+    blocked.Close();
+}
+
+HashVerdict KnownHashes::Classify(const std::string& sha256) const {
+    if (sha256.size() != HashSetFormat::HashSize || !IsOpen()) {
+        return HashVerdict::Unknown;
+    }
+    lookups++;
+    const uint8_t* hash = reinterpret_cast<const uint8_t*>(sha256.data());
+
+    bool passedFilter = false;
+    HashSet::Probe probe = blocked.Lookup(hash);
+    if (probe == HashSet::Probe::Present) {
+        blockHits++;
+        return HashVerdict::KnownBad;
+    }
+    if (probe == HashSet::Probe::FalsePositive) {
+        falsePositives++;
+        passedFilter = true;
+    }
+
+    probe = allowed.Lookup(hash);
+    if (probe == HashSet::Probe::Present) {
+        allowHits++;
+        return HashVerdict::KnownGood;
+    }
+    if (probe == HashSet::Probe::FalsePositive) {
+        falsePositives++;
+        passedFilter = true;
+    }
+    if (!passedFilter) {
+        bloomRejects++;
+    }
+    return HashVerdict::Unknown;
+}
+
+void KnownHashes::ResetStats() {
+    lookups = 0;
+    bloomRejects = 0;
+    falsePositives = 0;
+    allowHits = 0;
+    blockHits = 0;
+}
+
+void KnownHashes::ReportStats() {
+    if (!IsOpen()) {
+        return;
+    }
+    std::cout << "Known hashes: " << allowed.Count() << " allowed / " << blocked.Count() << " blocked, mapped in "
+        << std::fixed << std::setprecision(2) << openMilliseconds << " ms, " << lookups.load() << " lookups, "
+        << allowHits.load() << " allowlist hits (yara skipped), " << blockHits.load() << " blocklist hits, "
+        << bloomRejects.load() << " rejected by the bloom filters, " << falsePositives.load() << " bloom false positives" << std::endl;
+}
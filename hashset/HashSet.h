@@ -0,0 +1,122 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+#include "../util/MappedFile.h"
+
+// sorted sha-256 tables (allowlists of clean launchers and tools, blocklists of known cheat builds),
+// mapped read only and never deserialized. no windows headers so the table tool also builds on linux
+//
+// table file: HashSetHeader, blocked bloom filter (64 byte blocks), uint32_t[BucketCount + 1] first entry per
+// leading two bytes, then the sorted unique hashes. every section starts 64 byte aligned
+
+namespace HashSetFormat {
+    constexpr char Magic[8] = { 'B', 'A', 'M', 'H', 'A', 'S', 'H', 'S' };
+    constexpr uint32_t Version = 1;
+    constexpr size_t HashSize = 32;
+    constexpr size_t BucketCount = 65536;
+    constexpr size_t BloomBlockBytes = 64;     // one cache line, a lookup touches a single block
+    constexpr uint32_t BloomHashes = 7;        // bits set per hash inside its block
+    constexpr uint64_t BloomBitsPerHash = 12;  // before rounding the block count up to a power of two
+}
+
+struct HashSetHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t bloomHashes;
+    uint64_t count;
+    uint64_t bloomBlocks;    // power of two
+    uint64_t bloomOffset;
+    uint64_t bucketOffset;
+    uint64_t entryOffset;
+    uint64_t reserved;
+};
+
+struct HashSetEntry {
+    uint8_t hash[HashSetFormat::HashSize];
+};
+
+static_assert(sizeof(HashSetHeader) == 64, "hash set header layout");
+static_assert(sizeof(HashSetEntry) == 32, "hash set entry layout");
+
+class HashSet {
+public:
+    enum class Probe : uint8_t {
+        Absent,        // the bloom filter ruled it out
+        FalsePositive, // passed the filter, not in the table
+        Present,
+    };
+
+    HashSet() = default;
+    HashSet(const HashSet&) = delete;
+    HashSet& operator=(const HashSet&) = delete;
+
+    bool Open(const std::filesystem::path& path);
+    // the buffer has to outlive the set
+    bool OpenBuffer(const uint8_t* data, size_t size);
+    void Close();
+    bool IsOpen() const { return opened; }
+    size_t Count() const { return (size_t)count; }
+
+    // lock free, the table is immutable once open
+    Probe Lookup(const uint8_t* hash) const;
+    bool Contains(const uint8_t* hash) const { return Lookup(hash) == Probe::Present; }
+    const HashSetEntry* Entries() const { return entries; }
+
+    // both sort and dedup the hashes in place; Write goes through a temp file renamed over path
+    static bool Serialize(std::vector<HashSetEntry>& hashes, std::vector<uint8_t>& out);
+    static bool Write(std::vector<HashSetEntry>& hashes, const std::filesystem::path& path);
+    // every 64 hex digit token that starts a line ("hash", "hash  file" from sha256sum, "hash,..." csv)
+    static bool ReadHexList(const std::filesystem::path& path, std::vector<HashSetEntry>& hashes, size_t& skippedLines);
+
+private:
+    MappedFile file;
+    const uint8_t* bloom = nullptr;
+    const uint32_t* bucketTable = nullptr;
+    const HashSetEntry* entries = nullptr;
+    uint64_t count = 0;
+    uint64_t bloomMask = 0;
+    uint32_t bloomHashes = 0;
+    bool opened = false;
+};
+
+enum class HashVerdict : uint8_t {
+    Unknown,
+    KnownGood,
+    KnownBad,
+};
+
+// the allowlist and blocklist a scan classifies files against before any expensive analyzer runs
+class KnownHashes {
+public:
+    static KnownHashes& Instance();
+
+    // either path may be empty, a missing or damaged table is reported and left out
+    bool Open(const std::filesystem::path& allowlist, const std::filesystem::path& blocklist);
+    void Close();
+    bool IsOpen() const { return allowed.IsOpen() || blocked.IsOpen(); }
+
+    // raw 32 byte sha-256, the blocklist wins when a hash is on both
+    HashVerdict Classify(const std::string& sha256) const;
+
+    void ResetStats();
+    void ReportStats();
+
+private:
+    KnownHashes() = default;
+    KnownHashes(const KnownHashes&) = delete;
+    KnownHashes& operator=(const KnownHashes&) = delete;
+
+    HashSet allowed;
+    HashSet blocked;
+
+    mutable std::atomic<long long> lookups{ 0 };
+    mutable std::atomic<long long> bloomRejects{ 0 };
+    mutable std::atomic<long long> falsePositives{ 0 };
+    mutable std::atomic<long long> allowHits{ 0 };
+    mutable std::atomic<long long> blockHits{ 0 };
+    double openMilliseconds = 0.0;
+};
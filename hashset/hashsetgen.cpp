@@ -0,0 +1,140 @@
+// hashsetgen, builds the allowlist / blocklist tables BAMParser maps at startup and measures their lookup speed
+// only needs HashSet.cpp, util/Digest.cpp and util/MappedFile.cpp, builds on windows and linux alike
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "HashSet.h"
+#include "../util/Digest.h"
+
+static void PrintUsage() {
+    std::cerr << "Usage:\n"
+        << "  hashsetgen build <output table> <input>...   inputs are hash lists (one sha-256 hex per line) or tables\n"
+        << "  hashsetgen lookup <table> <hash list>          prints the hashes of the list found in the table\n"
+        << "  hashsetgen bench <table> [lookups]             single thread lookup throughput, hits and misses" << std::endl;
+}
+
+static int Build(int argc, char* argv[]) {
+    std::vector<HashSetEntry> hashes;
+    for (int i = 3; i < argc; i++) {
+        HashSet existing;
+        if (existing.Open(argv[i])) {
+            hashes.insert(hashes.end(), existing.Entries(), existing.Entries() + existing.Count());
+            std::cout << argv[i] << ": " << existing.Count() << " hashes (table)" << std::endl;
+            continue;
+        }
+        size_t before = hashes.size();
+        size_t skipped = 0;
+        if (!HashSet::ReadHexList(argv[i], hashes, skipped)) {
+            std::cerr << "Failed to read " << argv[i] << std::endl;
+            return 1;
+        }
+        std::cout << argv[i] << ": " << hashes.size() - before << " hashes, " << skipped << " lines skipped" << std::endl;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    size_t read = hashes.size();
+    if (!HashSet::Write(hashes, argv[2])) {
+        std::cerr << "Failed to write " << argv[2] << std::endl;
+        return 1;
+    }
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "Wrote " << hashes.size() << " unique hashes (" << read - hashes.size() << " duplicates) to " << argv[2]
+        << " in " << std::fixed << std::setprecision(2) << ms << " ms" << std::endl;
+    return 0;
+}
+
+static int Lookup(int argc, char* argv[]) {
+    HashSet table;
+    if (!table.Open(argv[2])) {
+        std::cerr << "Failed to open table " << argv[2] << std::endl;
+        return 1;
+    }
+    std::vector<HashSetEntry> hashes;
+    size_t skipped = 0;
+    if (argc < 4 || !HashSet::ReadHexList(argv[3], hashes, skipped)) {
+        std::cerr << "Failed to read hash list" << std::endl;
+        return 1;
+    }
+
+    size_t found = 0;
+    for (const auto& entry : hashes) {
+        if (table.Contains(entry.hash)) {
+            std::cout << DigestToHex(std::string(reinterpret_cast<const char*>(entry.hash), sizeof(entry.hash))) << std::endl;
+            found++;
+        }
+    }
+    std::cerr << found << " of " << hashes.size() << " hashes found" << std::endl;
+    return found ? 2 : 0;
+}
+
+static int Bench(int argc, char* argv[]) {
+    HashSet table;
+    if (!table.Open(argv[2])) {
+        std::cerr << "Failed to open table " << argv[2] << std::endl;
+        return 1;
+    }
+    size_t lookups = argc > 3 ? (size_t)std::stoull(argv[3]) : 10000000;
+
+    // random hashes are misses (the bloom filter path), hashes copied out of the table are hits (filter + bucket search)
+    // the probes are laid out up front so the loop measures the table and not the generator
+    std::mt19937_64 random(0x42414D48);
+    std::vector<HashSetEntry> misses(lookups);
+    for (auto& entry : misses) {
+        for (size_t i = 0; i < sizeof(entry.hash); i += 8) {
+            uint64_t value = random();
+            memcpy(entry.hash + i, &value, 8);
+        }
+    }
+    std::vector<HashSetEntry> hits;
+    if (table.Count()) {
+        hits.resize(lookups);
+        for (auto& entry : hits) {
+            entry = table.Entries()[random() % table.Count()];
+        }
+    }
+
+    auto run = [&](const std::vector<HashSetEntry>& probes, const char* name) {
+        size_t present = 0, falsePositives = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (const auto& entry : probes) {
+            HashSet::Probe probe = table.Lookup(entry.hash);
+            present += probe == HashSet::Probe::Present;
+            falsePositives += probe == HashSet::Probe::FalsePositive;
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cout << std::left << std::setw(7) << name << std::right << std::fixed << std::setprecision(2)
+            << probes.size() / seconds / 1e6 << " M lookups/s, " << seconds * 1e9 / probes.size() << " ns each, "
+            << present << " present, " << falsePositives << " bloom false positives ("
+            << std::setprecision(3) << 100.0 * falsePositives / probes.size() << "%)" << std::endl;
+    };
+
+    std::cout << table.Count() << " hashes, " << lookups << " lookups per run" << std::endl;
+    run(misses, "misses");
+    if (!hits.empty()) {
+        run(hits, "hits");
+    }
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        PrintUsage();
+        return 1;
+    }
+    std::string command = argv[1];
+    if (command == "build" && argc >= 4) {
+        return Build(argc, argv);
+    }
+    if (command == "lookup" && argc >= 4) {
+        return Lookup(argc, argv);
+    }
+    if (command == "bench") {
+        return Bench(argc, argv);
+    }
+    PrintUsage();
+    return 1;
+}
@@ -0,0 +1,278 @@
+#include "RegfHive.h"
+#include <cstdio>
+#include <cstring>
+
+namespace {
+    constexpr size_t BaseBlockSize = 0x1000;
+    constexpr uint16_t KeyCompressedName = 0x0020;
+    constexpr uint16_t ValueCompressedName = 0x0001;
+    constexpr uint32_t DataInline = 0x80000000;
+
+    uint16_t u16(const uint8_t* p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+    uint32_t u32(const uint8_t* p) { return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24); }
+    bool sig(const uint8_t* p, const char* s) { return p[0] == (uint8_t)s[0] && p[1] == (uint8_t)s[1]; }
+
+    uint16_t foldAscii(uint16_t c) { return (c >= 'a' && c <= 'z') ? (uint16_t)(c - 32) : c; }
+}
+
+bool RegfName::EqualsIgnoreCase(const std::string& ascii) const {
+    if (Length() != ascii.size()) return false;
+    for (size_t i = 0; i < ascii.size(); i++) {
+        if (foldAscii(CharAt(i)) != foldAscii((unsigned char)ascii[i])) return false;
+    }
+    return true;
+}
+
+std::wstring RegfName::ToWide() const {
+    std::wstring out;
+    out.reserve(Length());
+    for (size_t i = 0; i < Length(); i++) {
+        out += (wchar_t)CharAt(i);
+    }
+    return out;
+}
+
+std::string RegfName::ToUtf8() const {
+    std::string out;
+    out.reserve(Length());
+    for (size_t i = 0; i < Length(); i++) {
+        uint32_t cp = CharAt(i);
+        if (!compressed && cp >= 0xD800 && cp <= 0xDBFF && i + 1 < Length()) {
+            uint32_t low = CharAt(i + 1);
+            if (low >= 0xDC00 && low <= 0xDFFF) {
+                cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+                i++;
+            }
+        }
+        if (cp < 0x80) {
+            out += (char)cp;
+        }
+        else if (cp < 0x800) {
+            out += (char)(0xC0 | (cp >> 6));
+            out += (char)(0x80 | (cp & 0x3F));
+        }
+        else if (cp < 0x10000) {
+            out += (char)(0xE0 | (cp >> 12));
+            out += (char)(0x80 | ((cp >> 6) & 0x3F));
+            out += (char)(0x80 | (cp & 0x3F));
+        }
+        else {
+            out += (char)(0xF0 | (cp >> 18));
+            out += (char)(0x80 | ((cp >> 12) & 0x3F));
+            out += (char)(0x80 | ((cp >> 6) & 0x3F));
+            out += (char)(0x80 | (cp & 0x3F));
+        }
+    }
+    return out;
+}
+
+bool RegfHive::Open(const std::filesystem::path& path) {
+    Close();
+    if (!file.Open(path)) {
+        return false;
+    }
+    if (!OpenBuffer(file.Data(), file.Size())) {
+        file.Close();
+        return false;
+    }
+    return true;
+}
+
+bool RegfHive::OpenBuffer(const uint8_t* data, size_t length) {
+    base = nullptr;
+    size = 0;
+    root = {};
+    cellsParsed = 0;
+
+    if (data == nullptr || length < BaseBlockSize + 0x20 || memcmp(data, "regf", 4) != 0) {
+        return false;
+    }
+
+    base = data;
+    size = length;
+
+    uint32_t rootOffset = u32(data + 0x24);
+    uint32_t cellSize = 0;
+    const uint8_t* rootCell = Cell(rootOffset, cellSize);
+    if (!rootCell || cellSize < 0x4C || !sig(rootCell, "nk")) {
+        base = nullptr;
+        size = 0;
+        return false;
+    }
+    root.offset = rootOffset;
+    return true;
+}
+
+void RegfHive::Close() {
+    file.Close();
+    base = nullptr;
+    size = 0;
+    root = {};
+}
+
+const uint8_t* RegfHive::Cell(uint32_t offset, uint32_t& cellSize) const {
+    cellSize = 0;
+    if (!base || offset == 0xFFFFFFFF) return nullptr;
+
+    size_t position = BaseBlockSize + (size_t)offset;
+    if (position + 4 > size) return nullptr;
+
+    int32_t rawSize = (int32_t)u32(base + position);
+    // allocated cells have a negative size
+    uint32_t total = rawSize < 0 ? (uint32_t)(-(int64_t)rawSize) : (uint32_t)rawSize;
+    if (total < 4 || position + total > size) return nullptr;
+
+    cellsParsed++;
+    cellSize = total - 4;
+    return base + position + 4;
+}
+
+RegfName RegfHive::KeyName(RegfKey key) const {
+    RegfName name;
+    uint32_t cellSize = 0;
+    const uint8_t* nk = Cell(key.offset, cellSize);
+    if (!nk || cellSize < 0x4C || !sig(nk, "nk")) return name;
+
+    uint16_t length = u16(nk + 0x48);
+    if (0x4C + (size_t)length > cellSize) return name;
+
+    name.data = nk + 0x4C;
+    name.bytes = length;
+    name.compressed = (u16(nk + 0x02) & KeyCompressedName) != 0;
+    return name;
+}
+
+bool RegfHive::WalkSubKeyList(uint32_t listOffset, const std::function<bool(RegfKey)>& onKey, int depth) const {
+    // ri lists only ever point to leaf lists, anything deeper is a corrupted hive
+    if (depth > 2) return true;
+
+    uint32_t cellSize = 0;
+    const uint8_t* list = Cell(listOffset, cellSize);
+    if (!list || cellSize < 4) return true;
+
+    uint16_t count = u16(list + 2);
+    if (sig(list, "lf") || sig(list, "lh")) {
+        if (4 + (size_t)count * 8 > cellSize) return true;
+        for (uint16_t i = 0; i < count; i++) {
+            if (!onKey({ u32(list + 4 + i * 8) })) return false;
+        }
+    }
+    else if (sig(list, "li")) {
+        if (4 + (size_t)count * 4 > cellSize) return true;
+        for (uint16_t i = 0; i < count; i++) {
+            if (!onKey({ u32(list + 4 + i * 4) })) return false;
+        }
+    }
+    else if (sig(list, "ri")) {
+        if (4 + (size_t)count * 4 > cellSize) return true;
+        for (uint16_t i = 0; i < count; i++) {
+            if (!WalkSubKeyList(u32(list + 4 + i * 4), onKey, depth + 1)) return false;
+        }
+    }
+    return true;
+}
+
+void RegfHive::ForEachSubKey(RegfKey key, const std::function<bool(RegfKey)>& onKey) const {
+    uint32_t cellSize = 0;
+    const uint8_t* nk = Cell(key.offset, cellSize);
+    if (!nk || cellSize < 0x4C || !sig(nk, "nk")) return;
+    if (u32(nk + 0x14) == 0) return;
+
+    WalkSubKeyList(u32(nk + 0x1C), onKey, 0);
+}
+
+void RegfHive::ForEachValue(RegfKey key, const std::function<bool(const RegfValue&)>& onValue) const {
+    uint32_t cellSize = 0;
+    const uint8_t* nk = Cell(key.offset, cellSize);
+    if (!nk || cellSize < 0x4C || !sig(nk, "nk")) return;
+
+    uint32_t valueCount = u32(nk + 0x24);
+    if (valueCount == 0) return;
+
+    uint32_t listSize = 0;
+    const uint8_t* list = Cell(u32(nk + 0x28), listSize);
+    if (!list || (size_t)valueCount * 4 > listSize) return;
+
+    for (uint32_t i = 0; i < valueCount; i++) {
+        uint32_t vkSize = 0;
+        const uint8_t* vk = Cell(u32(list + i * 4), vkSize);
+        if (!vk || vkSize < 0x14 || !sig(vk, "vk")) continue;
+
+        RegfValue value;
+        uint16_t nameLength = u16(vk + 0x02);
+        if (0x14 + (size_t)nameLength > vkSize) continue;
+        value.name.data = vk + 0x14;
+        value.name.bytes = nameLength;
+        value.name.compressed = (u16(vk + 0x10) & ValueCompressedName) != 0;
+        value.type = u32(vk + 0x0C);
+
+        uint32_t dataSize = u32(vk + 0x04);
+        if (dataSize & DataInline) {
+            // up to 4 bytes live in the offset field itself
+            value.size = (dataSize & ~DataInline) > 4 ? 4 : (dataSize & ~DataInline);
+            value.data = vk + 0x08;
+        }
+        else if (dataSize > 0) {
+            uint32_t dataCellSize = 0;
+            const uint8_t* data = Cell(u32(vk + 0x08), dataCellSize);
+            // big data ("db") values are split over segments, bam never needs them so they are left empty
+            if (data && dataSize <= dataCellSize && !(dataSize > 16344 && sig(data, "db"))) {
+                value.data = data;
+                value.size = dataSize;
+            }
+        }
+
+        if (!onValue(value)) return;
+    }
+}
+
+RegfKey RegfHive::FindSubKey(RegfKey key, const std::string& name) const {
+    RegfKey found;
+    ForEachSubKey(key, [this, &name, &found](RegfKey child) {
+        if (KeyName(child).EqualsIgnoreCase(name)) {
+            found = child;
+            return false;
+        }
+        return true;
+    });
+    return found;
+}
+
+RegfKey RegfHive::OpenPath(const std::string& path) const {
+    RegfKey key = root;
+    size_t start = 0;
+    while (key.IsValid() && start < path.size()) {
+        size_t end = path.find('\\', start);
+        if (end == std::string::npos) end = path.size();
+        if (end > start) {
+            key = FindSubKey(key, path.substr(start, end - start));
+        }
+        start = end + 1;
+    }
+    return key;
+}
+
+bool RegfHive::FindValue(RegfKey key, const std::string& name, RegfValue& out) const {
+    bool found = false;
+    ForEachValue(key, [&name, &out, &found](const RegfValue& value) {
+        if (value.name.EqualsIgnoreCase(name)) {
+            out = value;
+            found = true;
+            return false;
+        }
+        return true;
+    });
+    return found;
+}
+
+RegfKey RegfHive::CurrentControlSet() const {
+    uint32_t current = 1;
+    RegfValue value;
+    if (FindValue(OpenPath("Select"), "Current", value) && value.size >= 4) {
+        current = u32(value.data);
+    }
+
+    char name[32];
+    snprintf(name, sizeof(name), "ControlSet%03u", current);
+    return OpenPath(name);
+}
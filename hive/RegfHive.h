@@ -0,0 +1,78 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include "../util/MappedFile.h"
+
+// offline regf reader, the hive stays mapped and every name/data handed out points straight into it
+// portable on purpose so collected SYSTEM hives can be triaged from any box
+
+constexpr uint32_t RegfNone = 0;
+constexpr uint32_t RegfSz = 1;
+constexpr uint32_t RegfExpandSz = 2;
+constexpr uint32_t RegfBinary = 3;
+constexpr uint32_t RegfDword = 4;
+constexpr uint32_t RegfMultiSz = 7;
+constexpr uint32_t RegfQword = 11;
+
+// name stored inside a cell, either compressed latin-1 or utf-16le
+struct RegfName {
+    const uint8_t* data = nullptr;
+    size_t bytes = 0;
+    bool compressed = false;
+
+    size_t Length() const { return compressed ? bytes : bytes / 2; }
+    uint16_t CharAt(size_t i) const { return compressed ? data[i] : (uint16_t)(data[i * 2] | (data[i * 2 + 1] << 8)); }
+    bool EqualsIgnoreCase(const std::string& ascii) const;
+    std::wstring ToWide() const;
+    std::string ToUtf8() const;
+};
+
+struct RegfValue {
+    RegfName name;
+    uint32_t type = RegfNone;
+    const uint8_t* data = nullptr;
+    uint32_t size = 0;
+};
+
+struct RegfKey {
+    uint32_t offset = 0;
+    bool IsValid() const { return offset != 0; }
+};
+
+class RegfHive {
+public:
+    bool Open(const std::filesystem::path& path);
+    // the buffer has to outlive the hive, handy for hives that are already in memory
+    bool OpenBuffer(const uint8_t* data, size_t size);
+    void Close();
+
+    RegfKey Root() const { return root; }
+    RegfKey FindSubKey(RegfKey key, const std::string& name) const;
+    // backslash separated, relative to the root key
+    RegfKey OpenPath(const std::string& path) const;
+
+    RegfName KeyName(RegfKey key) const;
+    bool FindValue(RegfKey key, const std::string& name, RegfValue& out) const;
+
+    // callbacks return false to stop the walk
+    void ForEachSubKey(RegfKey key, const std::function<bool(RegfKey)>& onKey) const;
+    void ForEachValue(RegfKey key, const std::function<bool(const RegfValue&)>& onValue) const;
+
+    // resolves Select\Current to the ControlSet00N that CurrentControlSet points to on the live system
+    RegfKey CurrentControlSet() const;
+
+    uint64_t CellsParsed() const { return cellsParsed; }
+
+private:
+    const uint8_t* Cell(uint32_t offset, uint32_t& size) const;
+    bool WalkSubKeyList(uint32_t listOffset, const std::function<bool(RegfKey)>& onKey, int depth) const;
+
+    MappedFile file;
+    const uint8_t* base = nullptr;
+    size_t size = 0;
+    RegfKey root;
+    mutable uint64_t cellsParsed = 0;
+};
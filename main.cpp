@@ -2,10 +2,12 @@
 #include <thread>
 #include <exception>
 #include <atomic>
+#include <cstring>
 #include <windows.h>
 #include <tchar.h>
 #include "UI/UI.h"
 #include "yara/yara.h"
+#include "BAM/AnalysisCache.h"
 
 #define DEBUG_MODE 0 // this is corresponding to the BAMParserDebug.exe or normal BAMParser.exe, some people's crash when opening the programm so this most likely will help me figure out why
 
@@ -78,7 +80,9 @@ void ConsoleThread()
     std::cin.get();
 }
 
-void RunUI()
+// benchmarkRules: compile the rules from source and load the blob once each and print both times (--benchmark-rules),
+// it adds the full source compile to every start so it is off by default
+void RunUI(bool benchmarkRules)
 {
     try {
         if (!UI::Initialize()) {
@@ -87,6 +91,15 @@ void RunUI()
         }
 
         initializeGenericRules();
+        if (benchmarkRules) {
+            benchmarkRuleLoading();
+        }
+        if (!compileGenericRules()) {
+            std::cerr << "Failed to compile YARA rules.\n";
+        }
+        if (!AnalysisCache::Instance().Load()) {
+            std::cerr << "Failed to load the analysis cache.\n";
+        }
 
         while (!UI::ShouldClose()) {
             try {
@@ -105,6 +118,7 @@ void RunUI()
         }
 
         UI::Shutdown();
+        destroyGenericRules();
         std::cout << "UI shut down successfully.\n";
     }
     catch (const std::exception& e) {
@@ -122,7 +136,8 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
 
     Sleep(500);
 
-    std::jthread uiThread(RunUI);
+    bool benchmarkRules = lpCmdLine && strstr(lpCmdLine, "--benchmark-rules") != nullptr;
+    std::jthread uiThread(RunUI, benchmarkRules);
 
     uiThread.join();
 
@@ -141,6 +156,8 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
         return 1;
 
     initializeGenericRules();
+    compileGenericRules();
+    AnalysisCache::Instance().Load();
 
     while (!UI::ShouldClose()) {
         UI::BeginFrame();
@@ -149,6 +166,7 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
     }
 
     UI::Shutdown();
+    destroyGenericRules();
     return 0;
 }
 
@@ -0,0 +1,71 @@
+#include "ReplaceDetector.h"
+#include "UsnPattern.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+    std::string lower(const std::string& str) {
+        std::string result = str;
+        std::transform(result.begin(), result.end(), result.begin(), [](unsigned char c) { return (char)std::tolower(c); });
+        return result;
+    }
+}
+
+bool ReplaceDetector::IsInterestingFile(const std::string& fileName) {
+    static const char* extensions[] = { ".exe", ".dll", ".jar", ".bat", ".cmd", ".ps1", ".vbs", ".scr", ".com", ".py", ".pyc", ".sys" };
+    std::string name = lower(fileName);
+    for (auto ext : extensions) {
+        size_t len = strlen(ext);
+        if (name.size() >= len && name.compare(name.size() - len, len, ext) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::string ReplaceDetector::DescribeRecord(const UsnRecord& record) {
+    char reference[64];
+    snprintf(reference, sizeof(reference), "0x%016llx", (unsigned long long)record.fileReference);
+    return "Time (UTC): " + FileTimeToUtcString(record.timestamp) + "\n"
+        + "Reasons: " + UsnReasonToString(record.reason) + "\n"
+        + "File reference: " + reference + "\n"
+        + "USN: " + std::to_string(record.usn) + "\n";
+}
+
+const char* ReplaceDetector::BuiltinPatterns() {
+    return R"(# the four heuristics of the old replaceparser.exe
+window 3h
+
+# explorer deletes the destination and creates the new file (a new file reference) right after
+pattern Explorer by name
+    Deleted: close file_delete
+    Recreated: close file_create !file_delete new_file within 5s
+end
+
+# CopyFile over an existing file rewrites the data and then copies the source timestamps
+pattern Copy
+    close !file_create data_extend data_truncation|data_overwrite basic_info_change
+end
+
+# "type a > b" truncates and rewrites an existing file without touching its timestamps
+pattern Type
+    close !file_create data_truncation data_extend !basic_info_change
+end
+
+pattern Delete
+    close file_delete
+end
+)";
+}
+
+const UsnPatternSet& ReplaceDetector::Builtin() {
+    static const UsnPatternSet builtin = [] {
+        UsnPatternSet set;
+        std::string error;
+        set.Parse(BuiltinPatterns(), "builtin", error);
+        return set;
+    }();
+    return builtin;
+}
@@ -0,0 +1,23 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "ReplaceScanner.hh"
+#include "UsnRecord.h"
+
+class UsnPatternSet;
+
+// native versions of the heuristics the old replaceparser.exe ran over the journal, written as usn patterns
+// (UsnPattern.h) so new techniques can be added as data; records have to be in usn order
+class ReplaceDetector {
+public:
+    // same "last 3 hours" window the .NET helper used
+    static constexpr int64_t DefaultWindow = 3LL * 60 * 60 * 10000000;
+
+    // Explorer, Copy, Type and Delete
+    static const char* BuiltinPatterns();
+    static const UsnPatternSet& Builtin();
+
+    static bool IsInterestingFile(const std::string& fileName);
+    static std::string DescribeRecord(const UsnRecord& record);
+};
@@ -0,0 +1,217 @@
+#include "ReplaceIndex.h"
+#include <algorithm>
+
+namespace {
+    constexpr uint32_t AttributeDirectory = 0x10;
+    // ntfs references carry a sequence number in the top 16 bits, the root directory is always mft record 5
+    constexpr uint64_t RecordNumberMask = 0x0000FFFFFFFFFFFFull;
+    constexpr uint64_t RootRecord = 5;
+
+    bool IsRoot(uint64_t reference) {
+        return (reference & RecordNumberMask) == RootRecord;
+    }
+
+    // ntfs compares names through its upcase table, ascii folding covers the names that matter here
+    std::string Lower(const std::string& text) {
+        std::string result = text;
+        for (auto& c : result) {
+            if (c >= 'A' && c <= 'Z') {
+                c = (char)(c - 'A' + 'a');
+            }
+        }
+        return result;
+    }
+
+    uint64_t PathHash(const std::string& lowerPath) {
+        uint64_t hash = 14695981039346656037ULL;
+        for (unsigned char c : lowerPath) {
+            hash = (hash ^ c) * 1099511628211ULL;
+        }
+        return hash;
+    }
+}
+
+void DirectoryChain::Note(const UsnRecord& record) {
+    if (!(record.fileAttributes & AttributeDirectory) || record.fileName.empty()) {
+        return;
+    }
+    // the journal is read in usn order, the last record of a directory has its current name and parent
+    auto it = directories.find(record.fileReference);
+    if (it != directories.end()) {
+        Directory& directory = it->second;
+        bool sameName = names.compare(directory.nameOffset, directory.nameLength, record.fileName) == 0;
+        if (sameName && directory.parent == record.parentReference) {
+            return;
+        }
+        directory.parent = record.parentReference;
+        if (!sameName) {
+            directory.nameOffset = (uint32_t)names.size();
+            directory.nameLength = (uint32_t)record.fileName.size();
+            names += record.fileName;
+        }
+    }
+    else {
+        directories.emplace(record.fileReference, Directory{ record.parentReference, (uint32_t)names.size(), (uint32_t)record.fileName.size() });
+        names += record.fileName;
+    }
+    // a tailed journal asks for paths between records, a moved or renamed directory changes every path below it
+    if (!paths.empty()) {
+        paths.clear();
+    }
+}
+
+void DirectoryChain::Save(UsnStateWriter& out) const {
+    out.U32((uint32_t)directories.size());
+    for (const auto& entry : directories) {
+        out.U64(entry.first);
+        out.U64(entry.second.parent);
+        out.String(names.substr(entry.second.nameOffset, entry.second.nameLength));
+    }
+}
+
+bool DirectoryChain::Load(UsnStateReader& in) {
+    constexpr size_t MinDirectorySize = 20;
+    size_t count = 0;
+    if (!in.Count(MinDirectorySize, count)) {
+        return false;
+    }
+    std::unordered_map<uint64_t, Directory> loaded;
+    std::string loadedNames;
+    loaded.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        uint64_t reference = 0;
+        uint64_t parent = 0;
+        std::string name;
+        if (!in.U64(reference) || !in.U64(parent) || !in.String(name)) {
+            return false;
+        }
+        loaded[reference] = Directory{ parent, (uint32_t)loadedNames.size(), (uint32_t)name.size() };
+        loadedNames += name;
+    }
+    directories = std::move(loaded);
+    names = std::move(loadedNames);
+    paths.clear();
+    return true;
+}
+
+bool DirectoryChain::Path(uint64_t reference, const Resolver& resolve, std::string& out) {
+    return Walk(reference, resolve, out, 0);
+}
+
+bool DirectoryChain::Walk(uint64_t reference, const Resolver& resolve, std::string& out, int depth) {
+    if (IsRoot(reference)) {
+        out.clear();
+        return true;
+    }
+    auto memo = paths.find(reference);
+    if (memo != paths.end()) {
+        if (!memo->second) {
+            return false;
+        }
+        out = *memo->second;
+        return true;
+    }
+    if (depth > MaxDepth) {
+        return false;
+    }
+
+    std::optional<std::string> path;
+    auto it = directories.find(reference);
+    if (it != directories.end() && it->second.parent != reference) {
+        // copied out, the recursion below inserts into the memo but never into directories
+        Directory directory = it->second;
+        std::string parentPath;
+        if (Walk(directory.parent, resolve, parentPath, depth + 1)) {
+            path = parentPath + "\\" + names.substr(directory.nameOffset, directory.nameLength);
+        }
+    }
+    if (!path && resolve) {
+        // the journal only has directories that changed while it was recording, the rest comes from the volume
+        resolverCalls++;
+        std::string resolved;
+        if (resolve(reference, resolved)) {
+            path = std::move(resolved);
+        }
+    }
+
+    paths[reference] = path;
+    if (!path) {
+        return false;
+    }
+    out = *path;
+    return true;
+}
+
+void ReplaceIndex::Find(const std::string& path, uint32_t volumeSerial, uint64_t fileReference, std::vector<const ReplaceFileStruct*>& out) const {
+    out.clear();
+    if (results.empty()) {
+        return;
+    }
+
+    std::string lowerPath = Lower(path);
+    uint64_t hash = PathHash(lowerPath);
+    auto pathIt = std::lower_bound(byPath.begin(), byPath.end(), hash, [](const PathKey& key, uint64_t value) {
+        return key.hash < value;
+    });
+    for (; pathIt != byPath.end() && pathIt->hash == hash; ++pathIt) {
+        if (paths[pathIt->result] == lowerPath) {
+            out.push_back(&results[pathIt->result]);
+        }
+    }
+
+    if (fileReference == 0) {
+        return;
+    }
+    auto fileIt = std::lower_bound(byFile.begin(), byFile.end(), std::make_pair(volumeSerial, fileReference),
+        [](const FileKey& key, const std::pair<uint32_t, uint64_t>& value) {
+            return key.volume != value.first ? key.volume < value.first : key.reference < value.second;
+        });
+    for (; fileIt != byFile.end() && fileIt->volume == volumeSerial && fileIt->reference == fileReference; ++fileIt) {
+        // already listed through the path
+        if (paths[fileIt->result] != lowerPath) {
+            out.push_back(&results[fileIt->result]);
+        }
+    }
+}
+
+void ReplaceIndexBuilder::AddVolume(uint32_t volumeSerial, const std::string& root, std::vector<ReplaceFileStruct>&& results,
+    DirectoryChain& chain, const DirectoryChain::Resolver& resolve) {
+    ReplaceIndex& target = *index;
+    for (auto& result : results) {
+        uint32_t slot = (uint32_t)target.results.size();
+        std::string directory;
+        std::string path;
+        if (result.parentReference && chain.Path(result.parentReference, resolve, directory)) {
+            path = root + directory + "\\" + result.filename;
+            result.details = "Path: " + path + "\n" + result.details;
+        }
+        else {
+            target.unresolved++;
+        }
+
+        if (result.fileReference) {
+            target.byFile.push_back({ result.fileReference, volumeSerial, slot });
+        }
+        if (!path.empty()) {
+            path = Lower(path);
+            target.byPath.push_back({ PathHash(path), slot });
+        }
+        target.paths.push_back(std::move(path));
+        target.results.push_back(std::move(result));
+    }
+}
+
+std::shared_ptr<const ReplaceIndex> ReplaceIndexBuilder::Finish() {
+    // sorted once here, stable on the result slot so a file's results keep the detector order
+    std::sort(index->byFile.begin(), index->byFile.end(), [](const ReplaceIndex::FileKey& a, const ReplaceIndex::FileKey& b) {
+        if (a.volume != b.volume) return a.volume < b.volume;
+        if (a.reference != b.reference) return a.reference < b.reference;
+        return a.result < b.result;
+    });
+    std::sort(index->byPath.begin(), index->byPath.end(), [](const ReplaceIndex::PathKey& a, const ReplaceIndex::PathKey& b) {
+        return a.hash != b.hash ? a.hash < b.hash : a.result < b.result;
+    });
+    std::shared_ptr<const ReplaceIndex> finished = std::move(index);
+    index = std::make_shared<ReplaceIndex>();
+    return finished;
+}
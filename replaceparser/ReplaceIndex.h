@@ -0,0 +1,93 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "ReplaceScanner.hh"
+#include "UsnRecord.h"
+#include "UsnState.h"
+
+// replace results keyed by the file they are about instead of by bare file name, so every setup.exe on every
+// volume no longer collides. no windows headers so it also builds on linux
+
+// the directories of one volume as its journal last saw them, enough to rebuild the full path of any record
+// only directory records are kept (the latest one per reference), memory follows the directory count and not the journal size
+class DirectoryChain {
+public:
+    // "\dir\sub" of a directory the journal never mentioned, relative to the volume root ("" for the root itself)
+    using Resolver = std::function<bool(uint64_t reference, std::string& path)>;
+
+    void Note(const UsnRecord& record);
+    // "\dir\sub" of the directory, "" for the root; false when neither the journal nor the resolver know a link of the chain
+    bool Path(uint64_t reference, const Resolver& resolve, std::string& out);
+
+    // the directories themselves, not the memo; Load replaces what the chain held
+    void Save(UsnStateWriter& out) const;
+    bool Load(UsnStateReader& in);
+
+    size_t DirectoryCount() const { return directories.size(); }
+    size_t ResolverCalls() const { return resolverCalls; }
+
+private:
+    static constexpr int MaxDepth = 256;   // deeper than any real path, stops reference loops of a damaged journal
+
+    struct Directory {
+        uint64_t parent;
+        uint32_t nameOffset;
+        uint32_t nameLength;
+    };
+
+    bool Walk(uint64_t reference, const Resolver& resolve, std::string& out, int depth);
+
+    std::unordered_map<uint64_t, Directory> directories;
+    std::string names;
+    std::unordered_map<uint64_t, std::optional<std::string>> paths;  // memo, nullopt = chain broken
+    size_t resolverCalls = 0;
+};
+
+// immutable once built, any number of threads look up at the same time
+class ReplaceIndex {
+public:
+    // results recorded under the path (case insensitive), then the ones of the same file identity recorded under
+    // another path (renamed or moved since). fileReference 0 skips the identity part, e.g. for deleted files
+    // the pointers go into the index, out is cleared first so a reused vector doesn't allocate
+    void Find(const std::string& path, uint32_t volumeSerial, uint64_t fileReference, std::vector<const ReplaceFileStruct*>& out) const;
+
+    size_t ResultCount() const { return results.size(); }
+    size_t UnresolvedCount() const { return unresolved; }
+
+private:
+    friend class ReplaceIndexBuilder;
+
+    struct FileKey {
+        uint64_t reference;
+        uint32_t volume;
+        uint32_t result;
+    };
+
+    struct PathKey {
+        uint64_t hash;
+        uint32_t result;
+    };
+
+    std::vector<ReplaceFileStruct> results;
+    std::vector<std::string> paths;      // lowercased full path per result, empty when the chain couldn't be rebuilt
+    std::vector<FileKey> byFile;         // sorted by volume, reference
+    std::vector<PathKey> byPath;         // sorted by hash, path
+    size_t unresolved = 0;
+};
+
+class ReplaceIndexBuilder {
+public:
+    // root is what rebuilt paths start with ("C:"), the results of one volume's detectors
+    void AddVolume(uint32_t volumeSerial, const std::string& root, std::vector<ReplaceFileStruct>&& results,
+        DirectoryChain& chain, const DirectoryChain::Resolver& resolve);
+    std::shared_ptr<const ReplaceIndex> Finish();
+
+private:
+    std::shared_ptr<ReplaceIndex> index = std::make_shared<ReplaceIndex>();
+};
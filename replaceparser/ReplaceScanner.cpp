@@ -1,215 +1,244 @@
 #include "ReplaceScanner.hh"
-#include <algorithm>
-#include <filesystem>
-#include <fstream>
 #include <iostream>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 #include <windows.h>
-#include "Replaceparser.h"
-
-std::string ReplaceScanner::replaceParserDir;
-std::unordered_map<std::string, std::vector<ReplaceFileStruct>> ReplaceScanner::replaceCache;
-std::mutex ReplaceScanner::cacheMutex;
-
-bool ReplaceScanner::init() {
-    char tempPathBuffer[MAX_PATH];
-    DWORD tempPathLen = GetTempPathA(MAX_PATH, tempPathBuffer);
-    if (tempPathLen == 0 || tempPathLen > MAX_PATH) {
-        std::cerr << "Failed to get temporary path." << std::endl;
-        return false;
-    }
-
-    std::string tempPath = std::string(tempPathBuffer);
-    if (tempPath.back() == '\\' || tempPath.back() == '/') {
-        tempPath.pop_back();
-    }
-
-    replaceParserDir = tempPath + "\\replaceparser";
-
-    if (!CreateDirectoryA(replaceParserDir.c_str(), NULL)) {
-        if (GetLastError() != ERROR_ALREADY_EXISTS) {
-            std::cerr << "Failed to create replaceParserDir: " << replaceParserDir << std::endl;
-            return false;
+#include "ReplaceDetector.h"
+#include "ReplaceIndex.h"
+#include "UsnCursor.h"
+#include "UsnPattern.h"
+#include "UsnJournal.h"
+
+std::shared_ptr<const ReplaceIndex> ReplaceScanner::current;
+
+namespace {
+    // everything one volume's thread produces, merged into the index on the calling thread afterwards
+    struct VolumeScan {
+        wchar_t letter = 0;
+        UsnJournalReader reader;
+        UsnCursor cursor;
+        std::vector<ReplaceFileStruct> results;
+        bool opened = false;
+        bool resumed = false;
+        bool complete = false;
+        bool timedOut = false;
+        DWORD error = ERROR_SUCCESS;
+        size_t inWindow = 0;
+        double readMb = 0;
+        double elapsedMs = 0;
+        std::chrono::steady_clock::time_point deadline = (std::chrono::steady_clock::time_point::max)();
+        bool done = false;      // under ScanProgress::mutex
+    };
+
+    // records aren't stamped in strict usn order, a full read starts this much before the window to catch the stragglers
+    constexpr int64_t WindowMargin = 10LL * 60 * 10000000;
+
+    struct ScanProgress {
+        std::mutex mutex;
+        std::condition_variable changed;
+    };
+
+    void ScanVolume(VolumeScan& scan, const UsnPatternSet& patterns, int64_t windowStart, const std::wstring& cursorDirectory) {
+        const auto deadline = scan.deadline;
+        auto start = std::chrono::steady_clock::now();
+        UsnJournalReader& reader = scan.reader;
+        scan.opened = reader.Open(scan.letter);
+        if (!scan.opened) {
+            // journal disabled, access denied, a drive that went away: nothing to wait for
+            scan.error = reader.LastError();
+            scan.elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            return;
         }
-    }
-
-    if (!WriteExeToTemp()) {
-        std::cerr << "Failed to write replaceparser.exe to temp." << std::endl;
-        return false;
-    }
-
-    if (!ExecuteReplaceParser()) {
-        std::cerr << "Failed to execute replaceparser.exe." << std::endl;
-        return false;
-    }
 
-    if (!loadCache()) {
-        std::cerr << "Failed to load cache from replaces.txt." << std::endl;
-        return false;
-    }
+        UsnJournalReader::JournalInfo info;
+        reader.Query(info);
 
-    return true;
-}
+        std::filesystem::path cursorPath;
+        if (!cursorDirectory.empty()) {
+            cursorPath = UsnCursor::PathFor(cursorDirectory, reader.VolumeSerial());
+        }
 
-bool ReplaceScanner::destroy() {
-    std::lock_guard<std::mutex> lock(cacheMutex);
-    replaceCache.clear();
+        // one pass: every pattern runs on the records as they are decoded, nothing but open matches and
+        // one entry per directory (for rebuilding paths) is kept. a cursor of the same journal carries all of
+        // that over from the last run and the read starts where that one stopped. without one the read starts at
+        // the window, not at firstUsn: a timeout then cuts off the newest records instead of the whole window, and
+        // directories only the older records name are looked up by id like any other parent the journal never mentioned
+        UsnPatternMatcher matcher(patterns);
+        UsnCursor& cursor = scan.cursor;
+        scan.resumed = !cursorPath.empty() && cursor.Load(cursorPath, reader.VolumeSerial(), matcher) &&
+            cursor.Resumable(info.journalId, info.firstUsn, info.lowestValidUsn, info.nextUsn);
+        if (!scan.resumed) {
+            cursor = UsnCursor();
+            matcher.Clear();
+        }
+        int64_t startUsn = cursor.nextUsn;
+        if (!scan.resumed) {
+            auto probe = [&reader](int64_t usn, UsnRecord& record) {
+                return reader.FirstRecordAt(usn, record);
+            };
+            startUsn = FindUsnByTime(info.firstUsn, info.nextUsn, windowStart - WindowMargin, probe);
+        }
 
-    try {
-        return std::filesystem::remove_all(replaceParserDir) > 0;
-    }
-    catch (const std::filesystem::filesystem_error& e) {
-        std::cerr << "Filesystem error during destroy: " << e.what() << std::endl;
-        return false;
+        DirectoryChain& chain = cursor.chain;
+        size_t& inWindow = scan.inWindow;
+        int64_t nextUsn = startUsn;
+        scan.complete = reader.ReadAll(startUsn, [&matcher, &chain, &inWindow, windowStart](const UsnRecord& record) {
+            chain.Note(record);
+            if (record.timestamp >= windowStart && ReplaceDetector::IsInterestingFile(record.fileName)) {
+                matcher.Feed(record);
+                inWindow++;
+            }
+        }, nextUsn, deadline);
+        scan.error = scan.complete ? ERROR_SUCCESS : reader.LastError();
+        scan.timedOut = scan.error == ERROR_TIMEOUT || scan.error == ERROR_OPERATION_ABORTED;
+
+        matcher.Drain(cursor.matches);
+        cursor.Prune(windowStart, matcher);
+        // a read that stopped early still saves how far it got, the next run goes on from there
+        if ((scan.complete || nextUsn > startUsn) && !cursorPath.empty()) {
+            cursor.volumeSerial = reader.VolumeSerial();
+            cursor.journalId = info.journalId;
+            cursor.nextUsn = nextUsn;
+            if (!cursor.Save(cursorPath, matcher)) {
+                std::wcerr << L"Failed to save the USN cursor of " << scan.letter << std::endl;
+            }
+        }
+        scan.results = cursor.Results();
+        scan.readMb = (nextUsn - startUsn) / (1024.0 * 1024.0);
+
+        // parents the journal doesn't know are looked up on the volume here, next to the other volumes' reads,
+        // the merge then only hits the memo. a volume that ran out of time isn't asked anything more
+        if (!scan.timedOut) {
+            auto resolve = [&reader](uint64_t reference, std::string& path) {
+                return reader.DirectoryPath(reference, path);
+            };
+            std::string directory;
+            for (const auto& result : scan.results) {
+                if (std::chrono::steady_clock::now() > deadline) {
+                    scan.timedOut = true;
+                    break;
+                }
+                if (result.parentReference) {
+                    chain.Path(result.parentReference, resolve, directory);
+                }
+            }
+        }
+        scan.elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
     }
 }
 
-std::vector<ReplaceFileStruct> ReplaceScanner::scan(const std::string& filePathOrName) {
-    std::vector<ReplaceFileStruct> results;
-    std::string fileName = extractFileName(filePathOrName);
-    std::string fileNameLower = ToLower(fileName);
-
-    std::lock_guard<std::mutex> lock(cacheMutex);
-    auto it = replaceCache.find(fileNameLower);
-    if (it != replaceCache.end()) {
-        results = it->second;
+bool ReplaceScanner::init(const std::wstring& patternsPath, const std::wstring& cursorDirectory, std::chrono::milliseconds volumeTimeout) {
+    auto start = std::chrono::steady_clock::now();
+    UsnPatternSet patterns = ReplaceDetector::Builtin();
+    std::string error;
+    if (!patternsPath.empty() && !patterns.Load(std::filesystem::path(patternsPath), error)) {
+        std::cerr << "Replace patterns not loaded, " << error << std::endl;
     }
 
-    return results;
-}
-
-std::string ReplaceScanner::getReplaceParserDir() {
-    return replaceParserDir;
-}
-
-std::string ReplaceScanner::ToLower(const std::string& str) {
-    std::string result = str;
-    std::transform(result.begin(), result.end(), result.begin(), [](unsigned char c) { return std::tolower(c); });
-    return result;
-}
-
-bool ReplaceScanner::WriteExeToTemp() {
-    std::string exePath = replaceParserDir + "\\replaceparser.exe";
-    std::ofstream exeFile(exePath, std::ios::binary);
-    if (!exeFile) {
-        std::cerr << "Failed to create replaceparser.exe at: " << exePath << std::endl;
-        return false;
-    }
-    exeFile.write(reinterpret_cast<const char*>(ReplaceParserHex), sizeof(ReplaceParserHex));
-    exeFile.close();
-    return true;
-}
-
-bool ReplaceScanner::ExecuteReplaceParser() {
-    std::string exePath = replaceParserDir + "\\replaceparser.exe";
-    std::string replacesTxtPath = replaceParserDir + "\\replaces.txt";
-    std::string commandLine = "\"" + exePath + "\" \"" + replacesTxtPath + "\"";
-
-    STARTUPINFOA si;
-    PROCESS_INFORMATION pi;
-    ZeroMemory(&si, sizeof(si));
-    si.cb = sizeof(si);
-    si.dwFlags = STARTF_USESHOWWINDOW;
-    si.wShowWindow = SW_HIDE;
-    ZeroMemory(&pi, sizeof(pi));
-
-    if (!CreateProcessA(NULL, const_cast<char*>(commandLine.c_str()), NULL, NULL, FALSE, 0, NULL,
-        replaceParserDir.c_str(), &si, &pi)) {
-        std::cerr << "CreateProcess failed with error: " << GetLastError() << std::endl;
-        return false;
+    FILETIME now;
+    GetSystemTimeAsFileTime(&now);
+    int64_t windowStart = (int64_t)(((uint64_t)now.dwHighDateTime << 32) | now.dwLowDateTime) - patterns.Window();
+
+    // one reader per volume at the same time, the slowest volume sets the time instead of the sum of all of them
+    std::vector<std::unique_ptr<VolumeScan>> scans;
+    std::vector<std::thread> threads;
+    ScanProgress progress;
+    for (wchar_t letter : UsnJournalReader::GetNtfsVolumes()) {
+        scans.push_back(std::make_unique<VolumeScan>());
+        VolumeScan* scan = scans.back().get();
+        scan->letter = letter;
+        // the timeout is each volume's own, counted from when its read starts
+        if (volumeTimeout.count() > 0) {
+            scan->deadline = std::chrono::steady_clock::now() + volumeTimeout;
+        }
+        threads.emplace_back([scan, &patterns, windowStart, &cursorDirectory, &progress]() {
+            ScanVolume(*scan, patterns, windowStart, cursorDirectory);
+            std::lock_guard<std::mutex> lock(progress.mutex);
+            scan->done = true;
+            progress.changed.notify_all();
+        });
     }
 
-    WaitForSingleObject(pi.hProcess, INFINITE);
-    CloseHandle(pi.hProcess);
-    CloseHandle(pi.hThread);
-    return true;
-}
-
-std::string ReplaceScanner::extractFileName(const std::string& filePath) {
-    size_t lastSlash = filePath.find_last_of("/\\");
-    if (lastSlash != std::string::npos) {
-        return filePath.substr(lastSlash + 1);
+    // ReadAll stops by itself between two reads once the deadline has passed, a read stuck in the driver (a dying
+    // usb stick, a disk spinning up) is cancelled until its thread gives up
+    for (size_t i = 0; i < scans.size(); i++) {
+        VolumeScan& scan = *scans[i];
+        auto finished = [&scan] { return scan.done; };
+        std::unique_lock<std::mutex> lock(progress.mutex);
+        if (volumeTimeout.count() <= 0) {
+            progress.changed.wait(lock, finished);
+            continue;
+        }
+        if (!progress.changed.wait_until(lock, scan.deadline, finished)) {
+            while (!scan.done) {
+                CancelSynchronousIo((HANDLE)threads[i].native_handle());
+                progress.changed.wait_for(lock, std::chrono::milliseconds(50), finished);
+            }
+        }
     }
-    return filePath;
-}
-
-bool ReplaceScanner::loadCache() {
-    std::string logPath = replaceParserDir + "\\replaces.txt";
-    std::ifstream file(logPath);
-    if (!file.is_open()) {
-        std::cerr << "Failed to open replaces.txt at: " << logPath << std::endl;
-        return false;
+    for (auto& thread : threads) {
+        thread.join();
     }
 
-    std::lock_guard<std::mutex> lock(cacheMutex);
-    replaceCache.clear();
-
-    std::string line;
-    while (std::getline(file, line)) {
-        if (line.empty()) continue;
-
-        std::string replaceType, pattern;
-        if (line.rfind("Explorer replacement found in file: ", 0) == 0) {
-            replaceType = "Explorer";
-            pattern = "Explorer replacement found in file: ";
-        }
-        else if (line.rfind("Copy replacement found in file: ", 0) == 0) {
-            replaceType = "Copy";
-            pattern = "Copy replacement found in file: ";
-        }
-        else if (line.rfind("Type pattern found in file: ", 0) == 0) {
-            replaceType = "Type";
-            pattern = "Type pattern found in file: ";
+    // merged in drive letter order whatever finished first, the index comes out the same every run
+    ReplaceIndexBuilder builder;
+    size_t volumesRead = 0;
+    double volumeMsSum = 0;
+    for (auto& scanPointer : scans) {
+        VolumeScan& scan = *scanPointer;
+        volumeMsSum += scan.elapsedMs;
+        if (!scan.opened) {
+            std::wcerr << L"Failed to open USN journal of " << scan.letter << L" (error " << scan.error << L"), skipped after "
+                << scan.elapsedMs << L" ms" << std::endl;
+            continue;
         }
-        else if (line.rfind("Delete pattern found in file: ", 0) == 0) {
-            replaceType = "Delete";
-            pattern = "Delete pattern found in file: ";
+        if (scan.timedOut) {
+            std::wcerr << L"USN journal read of " << scan.letter << L": timed out after " << scan.elapsedMs
+                << L" ms, the results read so far are kept" << std::endl;
         }
-        else {
-            continue;
+        else if (!scan.complete) {
+            std::wcerr << L"USN journal read of " << scan.letter << L": stopped early (error " << scan.error << L")" << std::endl;
         }
 
-        size_t pos = line.find(pattern);
-        if (pos == std::string::npos) continue;
-
-        std::string foundFileName = line.substr(pos + pattern.size());
-        std::string foundFileNameLower = ToLower(foundFileName);
-
-        std::string detailsLine;
-        bool openBraceFound = false;
-        std::string detailsCollected;
-
-        while (std::getline(file, detailsLine)) {
-            if (!openBraceFound) {
-                size_t bracePos = detailsLine.find('{');
-                if (bracePos != std::string::npos) {
-                    openBraceFound = true;
-                    if (bracePos + 1 < detailsLine.size()) {
-                        detailsCollected += detailsLine.substr(bracePos + 1) + "\n";
-                    }
-                }
-            }
-            else {
-                size_t closePos = detailsLine.find('}');
-                if (closePos != std::string::npos) {
-                    if (closePos > 0) {
-                        detailsCollected += detailsLine.substr(0, closePos);
-                    }
-                    break;
-                }
-                else {
-                    detailsCollected += detailsLine + "\n";
-                }
-            }
+        size_t resultCount = scan.results.size();
+        std::string root = { (char)scan.letter, ':' };
+        UsnJournalReader& reader = scan.reader;
+        DirectoryChain::Resolver resolve;
+        if (!scan.timedOut) {
+            resolve = [&reader](uint64_t reference, std::string& path) {
+                return reader.DirectoryPath(reference, path);
+            };
         }
+        DirectoryChain& chain = scan.cursor.chain;
+        builder.AddVolume(reader.VolumeSerial(), root, std::move(scan.results), chain, resolve);
+        volumesRead++;
+
+        std::wcout << L"USN journal " << scan.letter << L": " << (scan.resumed ? L"incremental" : L"full") << L" read of " << scan.readMb
+            << L" MB, " << scan.inWindow << L" records in window, " << resultCount << L" results, " << chain.DirectoryCount()
+            << L" directories, " << chain.ResolverCalls() << L" resolved by id, " << scan.elapsedMs << L" ms" << std::endl;
+    }
 
-        ReplaceFileStruct result;
-        result.filename = foundFileName;
-        result.replaceType = replaceType;
-        result.details = detailsCollected;
+    double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::wcout << L"USN journals: " << volumesRead << L" of " << scans.size() << L" volumes read in " << elapsedMs << L" ms (" << volumeMsSum
+        << L" ms one after another)" << std::endl;
 
-        replaceCache[foundFileNameLower].emplace_back(std::move(result));
+    // published whole, a scan that already grabbed the previous index keeps using it untouched
+    std::atomic_store(&current, builder.Finish());
+    // a deleted or disabled journal, a box without ntfs, access denied everywhere: the scan goes on without replace
+    // results instead of showing no BAM rows at all
+    if (volumesRead == 0) {
+        std::wcerr << L"No USN journal could be read, replace checks have no results this scan" << std::endl;
     }
+    return true;
+}
 
-    file.close();
+bool ReplaceScanner::destroy() {
+    std::atomic_store(&current, std::shared_ptr<const ReplaceIndex>());
     return true;
 }
+
+std::shared_ptr<const ReplaceIndex> ReplaceScanner::Snapshot() {
+    return std::atomic_load(&current);
+}
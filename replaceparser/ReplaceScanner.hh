@@ -1,30 +1,34 @@
 #pragma once
+#include <chrono>
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
-#include <unordered_map>
-#include <mutex>
 
 struct ReplaceFileStruct {
     std::string filename;
     std::string replaceType;
     std::string details;
+    // journal identity of the file the result is about, what the index keys on; not exported
+    uint64_t fileReference = 0;
+    uint64_t parentReference = 0;
 };
 
+class ReplaceIndex;
+
 class ReplaceScanner {
 public:
-    static bool init();
+    // reads every ntfs journal once and publishes a new index, the previous one stays valid for whoever still holds it
+    // patternsPath adds replace patterns (UsnPattern.h) to the builtin ones
+    // with a cursorDirectory every volume keeps a cursor there (UsnCursor.h) and later runs only read what the journal got since
+    // the volumes are read in parallel, one that isn't done after volumeTimeout (0 = no limit) is cut off with what it had
+    // volumes without a readable journal are skipped and logged, with none at all the index is just empty
+    static bool init(const std::wstring& patternsPath = std::wstring(), const std::wstring& cursorDirectory = std::wstring(),
+        std::chrono::milliseconds volumeTimeout = std::chrono::milliseconds(0));
     static bool destroy();
-    static std::vector<ReplaceFileStruct> scan(const std::string& filePathOrName);
-    static std::string getReplaceParserDir();
+    // the index of the last init(), grabbed once per scan; lookups on it take no locks and copy nothing
+    static std::shared_ptr<const ReplaceIndex> Snapshot();
 
 private:
-    static std::string replaceParserDir;
-    static std::unordered_map<std::string, std::vector<ReplaceFileStruct>> replaceCache;
-    static std::mutex cacheMutex;
-
-    static std::string ToLower(const std::string& str);
-    static bool WriteExeToTemp();
-    static bool ExecuteReplaceParser();
-    static std::string extractFileName(const std::string& filePath);
-    static bool loadCache();
+    static std::shared_ptr<const ReplaceIndex> current;
 };
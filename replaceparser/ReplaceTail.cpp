@@ -0,0 +1,117 @@
+#include "ReplaceTail.h"
+#include <algorithm>
+#include <iterator>
+#include <thread>
+#include "ReplaceDetector.h"
+
+bool ReplaceTail::Resume(const std::filesystem::path& cursorPath, uint32_t volumeSerial, uint64_t journalId, int64_t firstUsn,
+    int64_t lowestValidUsn, int64_t journalNextUsn) {
+    if (!cursorPath.empty() && cursor.Load(cursorPath, volumeSerial, matcher) &&
+        cursor.Resumable(journalId, firstUsn, lowestValidUsn, journalNextUsn)) {
+        return true;
+    }
+    Start(volumeSerial, journalId, journalNextUsn);
+    return false;
+}
+
+void ReplaceTail::Start(uint32_t volumeSerial, uint64_t journalId, int64_t usn) {
+    cursor = UsnCursor();
+    matcher.Clear();
+    cursor.volumeSerial = volumeSerial;
+    cursor.journalId = journalId;
+    cursor.nextUsn = usn;
+}
+
+void ReplaceTail::Feed(const UsnRecord& record) {
+    records++;
+    cursor.chain.Note(record);
+    if (ReplaceDetector::IsInterestingFile(record.fileName)) {
+        matcher.Feed(record);
+    }
+}
+
+void ReplaceTail::Collect(int64_t nextUsn, int64_t now, const std::string& root, const DirectoryChain::Resolver& resolve,
+    std::vector<ReplaceAlert>& out) {
+    cursor.nextUsn = nextUsn;
+    finished.clear();
+    matcher.Drain(finished);
+    for (const auto& match : finished) {
+        ReplaceAlert alert;
+        alert.volumeSerial = cursor.volumeSerial;
+        alert.timestamp = match.timestamp;
+        alert.result = match.result;
+        std::string directory;
+        if (match.result.parentReference && cursor.chain.Path(match.result.parentReference, resolve, directory)) {
+            alert.path = root + directory + "\\" + match.result.filename;
+            alert.result.details = "Path: " + alert.path + "\n" + alert.result.details;
+        }
+        else {
+            alert.path = match.result.filename;
+        }
+        out.push_back(std::move(alert));
+        alerts++;
+    }
+    // kept for the cursor, a scan started after the tail still lists what it reported
+    std::move(finished.begin(), finished.end(), std::back_inserter(cursor.matches));
+    cursor.Prune(now - matcher.Set().Window(), matcher);
+}
+
+bool UsnReplaySource::Open(const std::filesystem::path& path) {
+    offset = 0;
+    pending.clear();
+    next = 0;
+    started = false;
+    return file.Open(path);
+}
+
+bool UsnReplaySource::Refill() {
+    pending.clear();
+    next = 0;
+    while (pending.empty() && offset < file.Size()) {
+        size_t slice = (std::min)(chunkSize, (size_t)file.Size() - offset);
+        size_t consumed = DecodeUsnRecords(file.Data() + offset, slice, pending);
+        if (offset + slice == file.Size()) {
+            consumed = slice;   // a record cut off by the end of the dump
+        }
+        else if (consumed == 0) {
+            consumed = 8;       // a length longer than the chunk is garbage, realign like the decoder does
+        }
+        offset += consumed;
+    }
+    return !pending.empty();
+}
+
+bool UsnReplaySource::Read(const std::function<void(const UsnRecord&)>& onRecord, int64_t& nextUsn) {
+    if (next == pending.size() && !Refill()) {
+        return false;
+    }
+
+    if (speed > 0) {
+        if (!started) {
+            started = true;
+            firstTimestamp = pending[next].timestamp;
+            startTime = std::chrono::steady_clock::now();
+        }
+        // journal time since the first record, scaled; records a little out of order are simply due right away
+        auto dueOf = [this](const UsnRecord& record) {
+            double seconds = (double)(record.timestamp - firstTimestamp) / 1e7 / speed;
+            return startTime + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(seconds));
+        };
+        due = dueOf(pending[next]);
+        std::this_thread::sleep_until(due);
+        auto now = std::chrono::steady_clock::now();
+        do {
+            onRecord(pending[next++]);
+        } while (next < pending.size() && dueOf(pending[next]) <= now);
+    }
+    else {
+        due = std::chrono::steady_clock::now();
+        for (; next < pending.size(); next++) {
+            onRecord(pending[next]);
+        }
+    }
+
+    // in a $J dump the file offset is the usn
+    nextUsn = next < pending.size() ? pending[next].usn : (int64_t)offset;
+    return true;
+}
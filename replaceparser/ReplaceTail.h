@@ -0,0 +1,91 @@
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <vector>
+#include "ReplaceIndex.h"
+#include "ReplaceScanner.hh"
+#include "UsnCursor.h"
+#include "UsnPattern.h"
+#include "UsnRecord.h"
+#include "../util/MappedFile.h"
+
+// replace detection on a journal that is still being written: records come in chunk by chunk (a blocking
+// FSCTL_READ_USN_JOURNAL in ReplaceWatcher, a recorded dump in UsnReplaySource) and every match is reported as
+// soon as the chunk that completed it is in. no windows headers so it also builds on linux
+
+struct ReplaceAlert {
+    std::string path;           // "C:\dir\file.exe", just the file name when the directory chain is broken
+    uint32_t volumeSerial = 0;
+    int64_t timestamp = 0;      // FILETIME of the record that completed the match
+    ReplaceFileStruct result;   // details start with "Path: " like the ones in the index
+};
+
+// one volume
+class ReplaceTail {
+public:
+    explicit ReplaceTail(const UsnPatternSet& patterns) : matcher(patterns) {}
+
+    // carries on from the cursor ReplaceScanner::init left (open matches, directory names) when it still fits the
+    // journal, otherwise starts empty at journalNextUsn; true when the cursor was taken
+    bool Resume(const std::filesystem::path& cursorPath, uint32_t volumeSerial, uint64_t journalId, int64_t firstUsn,
+        int64_t lowestValidUsn, int64_t journalNextUsn);
+    void Start(uint32_t volumeSerial, uint64_t journalId, int64_t usn);
+
+    void Feed(const UsnRecord& record);
+    // after each chunk: the matches it completed, oldest first; now (FILETIME) ages out what left the pattern window
+    void Collect(int64_t nextUsn, int64_t now, const std::string& root, const DirectoryChain::Resolver& resolve,
+        std::vector<ReplaceAlert>& out);
+
+    // the cursor for the next ReplaceScanner::init, which then skips everything this tail already saw
+    bool Save(const std::filesystem::path& cursorPath) const { return cursor.Save(cursorPath, matcher); }
+
+    int64_t NextUsn() const { return cursor.nextUsn; }
+    size_t RecordCount() const { return records; }
+    size_t AlertCount() const { return alerts; }
+    size_t PendingCount() const { return matcher.PendingCount(); }
+
+private:
+    UsnPatternMatcher matcher;
+    UsnCursor cursor;
+    std::vector<UsnMatch> finished;
+    size_t records = 0;
+    size_t alerts = 0;
+};
+
+// a recorded $UsnJrnl:$J dump (or saved FSCTL_READ_USN_JOURNAL output) played back like a live journal, so the
+// streaming path can be tested and measured anywhere
+class UsnReplaySource {
+public:
+    bool Open(const std::filesystem::path& path);
+
+    // bytes of the dump decoded per read, like the output buffer of one FSCTL_READ_USN_JOURNAL call
+    void SetChunkSize(size_t bytes) { chunkSize = bytes < 4096 ? 4096 : bytes; }
+    // 0 plays as fast as it decodes, 1 at the pace the records were written, 10 ten times faster
+    void SetSpeed(double factor) { speed = factor; }
+
+    // one read: the records that are due (all decoded ones without a speed), blocking until the first of them is.
+    // false once the dump is done
+    bool Read(const std::function<void(const UsnRecord&)>& onRecord, int64_t& nextUsn);
+    // steady clock time the last read's first record was due at, what an alert's latency is measured from
+    std::chrono::steady_clock::time_point DueTime() const { return due; }
+
+    uint64_t Size() const { return file.Size(); }
+
+private:
+    bool Refill();
+
+    MappedFile file;
+    size_t offset = 0;
+    size_t chunkSize = 1 << 16;
+    double speed = 0;
+    std::vector<UsnRecord> pending;
+    size_t next = 0;
+    bool started = false;
+    int64_t firstTimestamp = 0;
+    std::chrono::steady_clock::time_point startTime;
+    std::chrono::steady_clock::time_point due;
+};
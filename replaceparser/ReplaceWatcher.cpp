@@ -0,0 +1,125 @@
+#include "ReplaceWatcher.h"
+#include <iostream>
+#include <iterator>
+#include <windows.h>
+#include "ReplaceDetector.h"
+#include "UsnCursor.h"
+#include "UsnJournal.h"
+
+namespace {
+    int64_t Now() {
+        FILETIME now;
+        GetSystemTimeAsFileTime(&now);
+        return (int64_t)(((uint64_t)now.dwHighDateTime << 32) | now.dwLowDateTime);
+    }
+}
+
+ReplaceWatcher& ReplaceWatcher::Instance() {
+    static ReplaceWatcher watcher;
+    return watcher;
+}
+
+bool ReplaceWatcher::Start(const std::wstring& patternsPath, const std::wstring& cursorDirectory) {
+    if (Running()) {
+        return true;
+    }
+    patterns = ReplaceDetector::Builtin();
+    std::string error;
+    if (!patternsPath.empty() && !patterns.Load(std::filesystem::path(patternsPath), error)) {
+        std::cerr << "Replace patterns not loaded, " << error << std::endl;
+    }
+    this->cursorDirectory = cursorDirectory;
+    stopping = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        alerts.clear();
+    }
+    for (wchar_t letter : UsnJournalReader::GetNtfsVolumes()) {
+        threads.emplace_back(&ReplaceWatcher::WatchVolume, this, letter);
+    }
+    return !threads.empty();
+}
+
+void ReplaceWatcher::Stop() {
+    if (!Running()) {
+        return;
+    }
+    stopping = true;
+    for (auto& thread : threads) {
+        // a read already blocking in the driver is cancelled, one that starts after this returns within PollTimeout
+        CancelSynchronousIo((HANDLE)thread.native_handle());
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    threads.clear();
+    queued.notify_all();
+}
+
+bool ReplaceWatcher::TakeAlerts(std::vector<ReplaceAlert>& out, std::chrono::milliseconds wait) {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (alerts.empty() && wait.count() > 0) {
+        queued.wait_for(lock, wait, [this] { return !alerts.empty() || stopping; });
+    }
+    if (alerts.empty()) {
+        return false;
+    }
+    std::move(alerts.begin(), alerts.end(), std::back_inserter(out));
+    alerts.clear();
+    return true;
+}
+
+void ReplaceWatcher::WatchVolume(wchar_t letter) {
+    UsnJournalReader reader;
+    if (!reader.Open(letter)) {
+        std::wcerr << L"Failed to open USN journal of " << letter << L" (error " << reader.LastError() << L")" << std::endl;
+        return;
+    }
+    UsnJournalReader::JournalInfo info;
+    reader.Query(info);
+
+    std::filesystem::path cursorPath;
+    if (!cursorDirectory.empty()) {
+        cursorPath = UsnCursor::PathFor(cursorDirectory, reader.VolumeSerial());
+    }
+    ReplaceTail tail(patterns);
+    bool resumed = tail.Resume(cursorPath, reader.VolumeSerial(), info.journalId, info.firstUsn, info.lowestValidUsn, info.nextUsn);
+    std::wcout << L"USN journal watch " << letter << L": " << (resumed ? L"from the last scan's cursor" : L"from the end of the journal") << std::endl;
+
+    std::string root = { (char)letter, ':' };
+    auto resolve = [&reader](uint64_t reference, std::string& path) {
+        return reader.DirectoryPath(reference, path);
+    };
+    auto feed = [&tail](const UsnRecord& record) {
+        tail.Feed(record);
+    };
+    std::vector<ReplaceAlert> found;
+    int64_t usn = tail.NextUsn();
+
+    while (!stopping) {
+        // returns as soon as there is one record past usn, or with nothing after PollTimeout
+        int64_t nextUsn = usn;
+        if (!reader.ReadChunk(usn, 1, PollTimeout, feed, nextUsn)) {
+            if (!stopping) {
+                std::wcerr << L"USN journal watch of " << letter << L": read failed (error " << reader.LastError() << L")" << std::endl;
+            }
+            break;
+        }
+        found.clear();
+        tail.Collect(nextUsn, Now(), root, resolve, found);
+        usn = nextUsn;
+        if (!found.empty()) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                std::move(found.begin(), found.end(), std::back_inserter(alerts));
+            }
+            queued.notify_all();
+        }
+    }
+
+    if (!cursorPath.empty() && !tail.Save(cursorPath)) {
+        std::wcerr << L"Failed to save the USN cursor of " << letter << std::endl;
+    }
+    std::wcout << L"USN journal watch " << letter << L": " << tail.RecordCount() << L" records, " << tail.AlertCount()
+        << L" alerts, " << tail.PendingCount() << L" matches open" << std::endl;
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ReplaceTail.h"
+#include "UsnPattern.h"
+
+// live replace alerts: one thread per ntfs volume keeps a blocking FSCTL_READ_USN_JOURNAL open and runs the replace
+// patterns on whatever the journal gets, alerts are queued for the ui / cli to pick up
+class ReplaceWatcher {
+public:
+    // how long one read blocks without new records, also how often open matches are aged out
+    static constexpr uint64_t PollTimeout = 5000000;  // 100ns units, half a second
+
+    static ReplaceWatcher& Instance();
+
+    // same arguments as ReplaceScanner::init; with a cursorDirectory the watch carries on from the cursor the last
+    // scan left (nothing between the two is missed) and leaves its own one behind on Stop
+    bool Start(const std::wstring& patternsPath = std::wstring(), const std::wstring& cursorDirectory = std::wstring());
+    void Stop();
+    bool Running() const { return !threads.empty(); }
+
+    // appends the queued alerts, oldest first; waits up to wait for one when the queue is empty
+    bool TakeAlerts(std::vector<ReplaceAlert>& out, std::chrono::milliseconds wait = std::chrono::milliseconds(0));
+
+private:
+    ReplaceWatcher() = default;
+    ~ReplaceWatcher() { Stop(); }
+    void WatchVolume(wchar_t letter);
+
+    UsnPatternSet patterns;
+    std::wstring cursorDirectory;
+    std::vector<std::thread> threads;
+    std::atomic<bool> stopping{ false };
+
+    // shared with the volume threads
+    std::mutex mutex;
+    std::condition_variable queued;
+    std::vector<ReplaceAlert> alerts;
+};
@@ -1,2095 +0,0 @@
-/*
-This is replaceparser2.exe from my "powershells" repo
-if u wanna check the file itself, its there
-if u still dont trust me, here's code to export this .h content to a .exe:
-
-#include <iostream>
-#include <fstream>
-#include <windows.h>
-#include <shlobj.h>
-#include <string>
-#include "Replaceparser.h"
-
-int main() {
-	// buffer for the desktop path
-	char desktopPath[MAX_PATH];
-
-	// getting desktop path
-	HRESULT result = SHGetFolderPathA(NULL, CSIDL_DESKTOPDIRECTORY, NULL, 0, desktopPath);
-	if (result != S_OK) {
-		std::cerr << "Error, couldnt get desktop path" << std::endl;w
-		return 1;
-	}
-	std::string fileName = "Replaceparser2.exe";
-	std::string fullPath = std::string(desktopPath) + "\\" + fileName; // building full path, path + name
-	std::ofstream outFile(fullPath, std::ios::binary);
-	if (!outFile) {
-		std::cerr << "Error, couldnt open the file: " << fullPath << std::endl;
-		return 1;
-	}
-	// writing the data to the file
-	outFile.write(reinterpret_cast<const char*>(ReplaceParserHex), sizeof(ReplaceParserHex));
-
-	// checking if it was successful
-	if (!outFile) {
-		std::cerr << "Error: error while writing the file" << std::endl;
-		return 1;
-	}
-	outFile.close();
-
-	std::cout << "Successfully wrote the file on: " << fullPath << std::endl;
-	return 0;
-}
-
-*/
-
-unsigned char ReplaceParserHex[24576] = {
-	0x4D, 0x5A, 0x90, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-	0xFF, 0xFF, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x80, 0x00, 0x00, 0x00, 0x0E, 0x1F, 0xBA, 0x0E, 0x00, 0xB4, 0x09, 0xCD,
-	0x21, 0xB8, 0x01, 0x4C, 0xCD, 0x21, 0x54, 0x68, 0x69, 0x73, 0x20, 0x70,
-	0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x20, 0x63, 0x61, 0x6E, 0x6E, 0x6F,
-	0x74, 0x20, 0x62, 0x65, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x69, 0x6E, 0x20,
-	0x44, 0x4F, 0x53, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x2E, 0x0D, 0x0D, 0x0A,
-	0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x45, 0x00, 0x00,
-	0x4C, 0x01, 0x03, 0x00, 0x39, 0x52, 0xA1, 0xFE, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x22, 0x00, 0x0B, 0x01, 0x30, 0x00,
-	0x00, 0x56, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x6E, 0x75, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
-	0x00, 0x00, 0x40, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x60, 0x85, 0x00, 0x00, 0x10, 0x00,
-	0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x19, 0x75, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00,
-	0x00, 0x80, 0x00, 0x00, 0xCC, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xA0, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x90, 0x74, 0x00, 0x00,
-	0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
-	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x08, 0x20, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x00, 0x00, 0x00,
-	0x74, 0x55, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00,
-	0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x60, 0x2E, 0x72, 0x73, 0x72,
-	0x63, 0x00, 0x00, 0x00, 0xCC, 0x05, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
-	0x00, 0x06, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40,
-	0x2E, 0x72, 0x65, 0x6C, 0x6F, 0x63, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00,
-	0x00, 0xA0, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x5E, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x40, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x75, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x02, 0x00, 0x05, 0x00,
-	0x8C, 0x32, 0x00, 0x00, 0x04, 0x42, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00,
-	0x09, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x13, 0x30, 0x03, 0x00, 0x52, 0x00, 0x00, 0x00,
-	0x01, 0x00, 0x00, 0x11, 0x02, 0x28, 0x10, 0x00, 0x00, 0x0A, 0x02, 0x03,
-	0x7D, 0x01, 0x00, 0x00, 0x04, 0x02, 0x17, 0x7D, 0x04, 0x00, 0x00, 0x04,
-	0x7E, 0x11, 0x00, 0x00, 0x0A, 0x0A, 0x02, 0x12, 0x00, 0x28, 0x06, 0x00,
-	0x00, 0x06, 0x0B, 0x07, 0x2D, 0x24, 0x02, 0x06, 0x7D, 0x03, 0x00, 0x00,
-	0x04, 0x02, 0x02, 0x7B, 0x01, 0x00, 0x00, 0x04, 0x02, 0x7C, 0x02, 0x00,
-	0x00, 0x04, 0x28, 0x05, 0x00, 0x00, 0x06, 0x0B, 0x07, 0x2C, 0x0E, 0x07,
-	0x73, 0x12, 0x00, 0x00, 0x0A, 0x7A, 0x07, 0x73, 0x12, 0x00, 0x00, 0x0A,
-	0x7A, 0x2A, 0x00, 0x00, 0x13, 0x30, 0x02, 0x00, 0x2A, 0x00, 0x00, 0x00,
-	0x02, 0x00, 0x00, 0x11, 0x20, 0x6B, 0x42, 0x00, 0x00, 0x0A, 0x02, 0x7B,
-	0x04, 0x00, 0x00, 0x04, 0x2C, 0x1A, 0x02, 0x7C, 0x03, 0x00, 0x00, 0x04,
-	0x28, 0x13, 0x00, 0x00, 0x0A, 0x15, 0x2E, 0x0A, 0x02, 0x03, 0x28, 0x07,
-	0x00, 0x00, 0x06, 0x0A, 0x2B, 0x02, 0x15, 0x0A, 0x06, 0x2A, 0x00, 0x00,
-	0x13, 0x30, 0x08, 0x00, 0xA5, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x11,
-	0x28, 0x14, 0x00, 0x00, 0x0A, 0x26, 0x05, 0x73, 0x15, 0x00, 0x00, 0x0A,
-	0x51, 0x0E, 0x04, 0xFE, 0x15, 0x0B, 0x00, 0x00, 0x02, 0x20, 0x6B, 0x42,
-	0x00, 0x00, 0x0A, 0x02, 0x7B, 0x04, 0x00, 0x00, 0x04, 0x39, 0x7D, 0x01,
-	0x00, 0x00, 0x02, 0x7C, 0x03, 0x00, 0x00, 0x04, 0x28, 0x13, 0x00, 0x00,
-	0x0A, 0x15, 0x3B, 0x6A, 0x01, 0x00, 0x00, 0x02, 0x0E, 0x04, 0x28, 0x07,
-	0x00, 0x00, 0x06, 0x0A, 0x06, 0x3A, 0x5D, 0x01, 0x00, 0x00, 0x17, 0x0B,
-	0x20, 0x00, 0x00, 0x02, 0x00, 0x0C, 0x08, 0x28, 0x16, 0x00, 0x00, 0x0A,
-	0x0D, 0x09, 0x08, 0x28, 0x1F, 0x00, 0x00, 0x06, 0x16, 0x13, 0x04, 0x12,
-	0x05, 0xFE, 0x15, 0x0D, 0x00, 0x00, 0x02, 0x12, 0x05, 0x03, 0x7B, 0x9C,
-	0x00, 0x00, 0x04, 0x7D, 0xC0, 0x00, 0x00, 0x04, 0x12, 0x05, 0x04, 0x7D,
-	0xC1, 0x00, 0x00, 0x04, 0x12, 0x05, 0x16, 0x7D, 0xC2, 0x00, 0x00, 0x04,
-	0x12, 0x05, 0x16, 0x6A, 0x7D, 0xC3, 0x00, 0x00, 0x04, 0x12, 0x05, 0x16,
-	0x6A, 0x7D, 0xC4, 0x00, 0x00, 0x04, 0x12, 0x05, 0x03, 0x7B, 0x9B, 0x00,
-	0x00, 0x04, 0x7D, 0xC5, 0x00, 0x00, 0x04, 0x11, 0x05, 0x28, 0x01, 0x00,
-	0x00, 0x2B, 0x13, 0x06, 0x11, 0x06, 0x28, 0x16, 0x00, 0x00, 0x0A, 0x13,
-	0x07, 0x11, 0x07, 0x11, 0x06, 0x28, 0x1F, 0x00, 0x00, 0x06, 0x11, 0x05,
-	0x11, 0x07, 0x17, 0x28, 0x02, 0x00, 0x00, 0x2B, 0x14, 0x13, 0x08, 0x38,
-	0xBC, 0x00, 0x00, 0x00, 0x02, 0x7B, 0x03, 0x00, 0x00, 0x04, 0x20, 0xBB,
-	0x00, 0x09, 0x00, 0x11, 0x07, 0x11, 0x06, 0x09, 0x08, 0x12, 0x04, 0x7E,
-	0x11, 0x00, 0x00, 0x0A, 0x28, 0x1E, 0x00, 0x00, 0x06, 0x2C, 0x64, 0x12,
-	0x0A, 0x12, 0x03, 0x28, 0x13, 0x00, 0x00, 0x0A, 0x1E, 0x58, 0x28, 0x19,
-	0x00, 0x00, 0x0A, 0x2B, 0x4A, 0x11, 0x0A, 0x73, 0x2C, 0x00, 0x00, 0x06,
-	0x13, 0x08, 0x11, 0x08, 0x6F, 0x32, 0x00, 0x00, 0x06, 0x0E, 0x04, 0x7B,
-	0x9D, 0x00, 0x00, 0x04, 0x32, 0x04, 0x16, 0x0B, 0x2B, 0x51, 0x05, 0x50,
-	0x11, 0x08, 0x6F, 0x1A, 0x00, 0x00, 0x0A, 0x12, 0x0A, 0x12, 0x0A, 0x28,
-	0x13, 0x00, 0x00, 0x0A, 0x6A, 0x11, 0x08, 0x6F, 0x2D, 0x00, 0x00, 0x06,
-	0x6E, 0x58, 0x28, 0x1B, 0x00, 0x00, 0x0A, 0x11, 0x04, 0x11, 0x08, 0x6F,
-	0x2D, 0x00, 0x00, 0x06, 0x59, 0x13, 0x04, 0x11, 0x04, 0x1F, 0x3C, 0x35,
-	0xB0, 0x2B, 0x1C, 0x28, 0x1C, 0x00, 0x00, 0x0A, 0x13, 0x0B, 0x11, 0x0B,
-	0x1F, 0x26, 0x33, 0x04, 0x16, 0x0A, 0x2B, 0x2E, 0x02, 0x11, 0x0B, 0x28,
-	0x04, 0x00, 0x00, 0x06, 0x0A, 0x2B, 0x23, 0x09, 0x16, 0x28, 0x1D, 0x00,
-	0x00, 0x0A, 0x13, 0x09, 0x11, 0x09, 0x0E, 0x04, 0x7B, 0x9D, 0x00, 0x00,
-	0x04, 0x2F, 0x0F, 0x11, 0x07, 0x11, 0x09, 0x28, 0x1E, 0x00, 0x00, 0x0A,
-	0x07, 0x3A, 0x3E, 0xFF, 0xFF, 0xFF, 0x11, 0x07, 0x28, 0x1F, 0x00, 0x00,
-	0x0A, 0x09, 0x28, 0x1F, 0x00, 0x00, 0x0A, 0x2B, 0x02, 0x15, 0x0A, 0x06,
-	0x2A, 0x00, 0x00, 0x00, 0x13, 0x30, 0x02, 0x00, 0x29, 0x00, 0x00, 0x00,
-	0x02, 0x00, 0x00, 0x11, 0x03, 0x2C, 0x15, 0x03, 0x1F, 0x26, 0x2E, 0x14,
-	0x03, 0x20, 0x9B, 0x04, 0x00, 0x00, 0x33, 0x11, 0x20, 0x9B, 0x04, 0x00,
-	0x00, 0x0A, 0x2B, 0x0F, 0x16, 0x0A, 0x2B, 0x0B, 0x1F, 0x26, 0x0A, 0x2B,
-	0x06, 0x20, 0x6D, 0x42, 0x00, 0x00, 0x0A, 0x06, 0x2A, 0x00, 0x00, 0x00,
-	0x13, 0x30, 0x07, 0x00, 0x72, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x11,
-	0x04, 0x16, 0x54, 0x16, 0x0A, 0x72, 0x01, 0x00, 0x00, 0x70, 0x03, 0x6F,
-	0x20, 0x00, 0x00, 0x0A, 0x28, 0x21, 0x00, 0x00, 0x0A, 0x16, 0x19, 0x7E,
-	0x11, 0x00, 0x00, 0x0A, 0x19, 0x20, 0x00, 0x00, 0x00, 0x02, 0x7E, 0x11,
-	0x00, 0x00, 0x0A, 0x28, 0x17, 0x00, 0x00, 0x06, 0x0B, 0x12, 0x01, 0x28,
-	0x13, 0x00, 0x00, 0x0A, 0x15, 0x2E, 0x33, 0x12, 0x02, 0xFE, 0x15, 0x0A,
-	0x00, 0x00, 0x02, 0x07, 0x12, 0x02, 0x28, 0x19, 0x00, 0x00, 0x06, 0x2C,
-	0x12, 0x08, 0x7B, 0x99, 0x00, 0x00, 0x04, 0x6E, 0x26, 0x04, 0x08, 0x7B,
-	0x95, 0x00, 0x00, 0x04, 0x54, 0x2B, 0x06, 0x28, 0x1C, 0x00, 0x00, 0x0A,
-	0x0A, 0x07, 0x28, 0x18, 0x00, 0x00, 0x06, 0x26, 0x2B, 0x06, 0x28, 0x1C,
-	0x00, 0x00, 0x0A, 0x0A, 0x06, 0x2A, 0x00, 0x00, 0x13, 0x30, 0x08, 0x00,
-	0x5A, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x11, 0x16, 0x0A, 0x03, 0x7E,
-	0x11, 0x00, 0x00, 0x0A, 0xDF, 0x72, 0x01, 0x00, 0x00, 0x70, 0x02, 0x7B,
-	0x01, 0x00, 0x00, 0x04, 0x6F, 0x20, 0x00, 0x00, 0x0A, 0x17, 0x8D, 0x24,
-	0x00, 0x00, 0x01, 0x25, 0x16, 0x1F, 0x5C, 0x9D, 0x6F, 0x22, 0x00, 0x00,
-	0x0A, 0x28, 0x21, 0x00, 0x00, 0x0A, 0x0B, 0x03, 0x07, 0x20, 0x00, 0x00,
-	0x00, 0xC0, 0x19, 0x7E, 0x11, 0x00, 0x00, 0x0A, 0x19, 0x16, 0x7E, 0x11,
-	0x00, 0x00, 0x0A, 0x28, 0x17, 0x00, 0x00, 0x06, 0xDF, 0x03, 0x28, 0x13,
-	0x00, 0x00, 0x0A, 0x15, 0x33, 0x06, 0x28, 0x1C, 0x00, 0x00, 0x0A, 0x0A,
-	0x06, 0x2A, 0x00, 0x00, 0x13, 0x30, 0x08, 0x00, 0x43, 0x00, 0x00, 0x00,
-	0x06, 0x00, 0x00, 0x11, 0x16, 0x0A, 0x03, 0x71, 0x0B, 0x00, 0x00, 0x02,
-	0x28, 0x03, 0x00, 0x00, 0x2B, 0x0B, 0x02, 0x7B, 0x03, 0x00, 0x00, 0x04,
-	0x20, 0xF4, 0x00, 0x09, 0x00, 0x7E, 0x11, 0x00, 0x00, 0x0A, 0x16, 0x03,
-	0x07, 0x12, 0x02, 0x7E, 0x11, 0x00, 0x00, 0x0A, 0x28, 0x1D, 0x00, 0x00,
-	0x06, 0x2D, 0x12, 0x28, 0x1C, 0x00, 0x00, 0x0A, 0x26, 0x02, 0x28, 0x1C,
-	0x00, 0x00, 0x0A, 0x28, 0x04, 0x00, 0x00, 0x06, 0x0A, 0x06, 0x2A, 0x36,
-	0x02, 0x7B, 0x03, 0x00, 0x00, 0x04, 0x28, 0x18, 0x00, 0x00, 0x06, 0x26,
-	0x2A, 0x00, 0x00, 0x00, 0x1B, 0x30, 0x03, 0x00, 0xF7, 0x00, 0x00, 0x00,
-	0x07, 0x00, 0x00, 0x11, 0x02, 0x28, 0x0A, 0x00, 0x00, 0x06, 0x0A, 0x28,
-	0x23, 0x00, 0x00, 0x0A, 0x0B, 0x06, 0x73, 0x24, 0x00, 0x00, 0x0A, 0x0D,
-	0x28, 0x25, 0x00, 0x00, 0x0A, 0x7E, 0x4F, 0x00, 0x00, 0x04, 0x25, 0x2D,
-	0x17, 0x26, 0x7E, 0x4E, 0x00, 0x00, 0x04, 0xFE, 0x06, 0x26, 0x00, 0x00,
-	0x06, 0x73, 0x26, 0x00, 0x00, 0x0A, 0x25, 0x80, 0x4F, 0x00, 0x00, 0x04,
-	0x28, 0x04, 0x00, 0x00, 0x2B, 0x6F, 0x28, 0x00, 0x00, 0x0A, 0x13, 0x04,
-	0x2B, 0x3D, 0x11, 0x04, 0x6F, 0x29, 0x00, 0x00, 0x0A, 0x13, 0x05, 0x09,
-	0x72, 0x0B, 0x00, 0x00, 0x70, 0x11, 0x05, 0x6F, 0x20, 0x00, 0x00, 0x0A,
-	0x28, 0x21, 0x00, 0x00, 0x0A, 0x6F, 0x2A, 0x00, 0x00, 0x0A, 0x11, 0x05,
-	0x09, 0x28, 0x0C, 0x00, 0x00, 0x06, 0x09, 0x1F, 0x2D, 0x1F, 0x32, 0x73,
-	0x2B, 0x00, 0x00, 0x0A, 0x6F, 0x2A, 0x00, 0x00, 0x0A, 0x09, 0x6F, 0x2C,
-	0x00, 0x00, 0x0A, 0x11, 0x04, 0x6F, 0x2D, 0x00, 0x00, 0x0A, 0x2D, 0xBA,
-	0xDE, 0x0C, 0x11, 0x04, 0x2C, 0x07, 0x11, 0x04, 0x6F, 0x2E, 0x00, 0x00,
-	0x0A, 0xDC, 0xDE, 0x0A, 0x09, 0x2C, 0x06, 0x09, 0x6F, 0x2E, 0x00, 0x00,
-	0x0A, 0xDC, 0x07, 0x6F, 0x2F, 0x00, 0x00, 0x0A, 0x07, 0x6F, 0x30, 0x00,
-	0x00, 0x0A, 0x0C, 0x06, 0x08, 0x28, 0x0B, 0x00, 0x00, 0x06, 0x72, 0x2D,
-	0x00, 0x00, 0x70, 0x06, 0x28, 0x21, 0x00, 0x00, 0x0A, 0x28, 0x31, 0x00,
-	0x00, 0x0A, 0x02, 0x8E, 0x2D, 0x0C, 0x72, 0x61, 0x00, 0x00, 0x70, 0x06,
-	0x28, 0x32, 0x00, 0x00, 0x0A, 0x26, 0xDE, 0x1A, 0x13, 0x06, 0x72, 0x79,
-	0x00, 0x00, 0x70, 0x11, 0x06, 0x6F, 0x33, 0x00, 0x00, 0x0A, 0x28, 0x21,
-	0x00, 0x00, 0x0A, 0x28, 0x31, 0x00, 0x00, 0x0A, 0xDE, 0x00, 0x2A, 0x00,
-	0x01, 0x28, 0x00, 0x00, 0x02, 0x00, 0x44, 0x00, 0x4A, 0x8E, 0x00, 0x0C,
-	0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x14, 0x00, 0x88, 0x9C, 0x00, 0x0A,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0xCF, 0xDC, 0x00, 0x1A,
-	0x18, 0x00, 0x00, 0x01, 0x76, 0x02, 0x8E, 0x2C, 0x04, 0x02, 0x16, 0x9A,
-	0x2A, 0x28, 0x34, 0x00, 0x00, 0x0A, 0x6F, 0x35, 0x00, 0x00, 0x0A, 0x72,
-	0xA1, 0x00, 0x00, 0x70, 0x28, 0x36, 0x00, 0x00, 0x0A, 0x2A, 0x00, 0x00,
-	0x13, 0x30, 0x04, 0x00, 0x37, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x11,
-	0x02, 0x28, 0x37, 0x00, 0x00, 0x0A, 0x28, 0x05, 0x00, 0x00, 0x2B, 0x0A,
-	0x06, 0x16, 0x72, 0xBF, 0x00, 0x00, 0x70, 0x03, 0x8C, 0x2E, 0x00, 0x00,
-	0x01, 0x28, 0x39, 0x00, 0x00, 0x0A, 0x6F, 0x3A, 0x00, 0x00, 0x0A, 0x06,
-	0x17, 0x7E, 0x3B, 0x00, 0x00, 0x0A, 0x6F, 0x3A, 0x00, 0x00, 0x0A, 0x02,
-	0x06, 0x28, 0x3C, 0x00, 0x00, 0x0A, 0x2A, 0x00, 0x13, 0x30, 0x05, 0x00,
-	0x4C, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x11, 0x02, 0x73, 0x01, 0x00,
-	0x00, 0x06, 0x0A, 0x12, 0x01, 0xFE, 0x15, 0x0B, 0x00, 0x00, 0x02, 0x06,
-	0x12, 0x01, 0x6F, 0x02, 0x00, 0x00, 0x06, 0x0C, 0x08, 0x2C, 0x1D, 0x03,
-	0x72, 0xED, 0x00, 0x00, 0x70, 0x02, 0x6F, 0x20, 0x00, 0x00, 0x0A, 0x08,
-	0x8C, 0x05, 0x00, 0x00, 0x02, 0x28, 0x3D, 0x00, 0x00, 0x0A, 0x6F, 0x2A,
-	0x00, 0x00, 0x0A, 0x2A, 0x02, 0x03, 0x07, 0x28, 0x0D, 0x00, 0x00, 0x06,
-	0x06, 0x07, 0x15, 0x12, 0x03, 0x12, 0x05, 0x6F, 0x03, 0x00, 0x00, 0x06,
-	0x2C, 0x0C, 0x03, 0x72, 0x84, 0x01, 0x00, 0x70, 0x6F, 0x2A, 0x00, 0x00,
-	0x0A, 0x2A, 0x09, 0x28, 0x06, 0x00, 0x00, 0x2B, 0x13, 0x04, 0x03, 0x72,
-	0xD4, 0x01, 0x00, 0x70, 0x11, 0x04, 0x6F, 0x3E, 0x00, 0x00, 0x0A, 0x8C,
-	0x2F, 0x00, 0x00, 0x01, 0x28, 0x39, 0x00, 0x00, 0x0A, 0x6F, 0x2A, 0x00,
-	0x00, 0x0A, 0x03, 0x6F, 0x2C, 0x00, 0x00, 0x0A, 0x11, 0x04, 0x03, 0x28,
-	0x0F, 0x00, 0x00, 0x06, 0x11, 0x04, 0x03, 0x28, 0x10, 0x00, 0x00, 0x06,
-	0x11, 0x04, 0x03, 0x28, 0x0E, 0x00, 0x00, 0x06, 0x11, 0x04, 0x03, 0x28,
-	0x11, 0x00, 0x00, 0x06, 0x11, 0x04, 0x28, 0x07, 0x00, 0x00, 0x2B, 0x39,
-	0x8A, 0x00, 0x00, 0x00, 0x11, 0x04, 0x7E, 0x50, 0x00, 0x00, 0x04, 0x25,
-	0x2D, 0x17, 0x26, 0x7E, 0x4E, 0x00, 0x00, 0x04, 0xFE, 0x06, 0x27, 0x00,
-	0x00, 0x06, 0x73, 0x40, 0x00, 0x00, 0x0A, 0x25, 0x80, 0x50, 0x00, 0x00,
-	0x04, 0x28, 0x08, 0x00, 0x00, 0x2B, 0x28, 0x42, 0x00, 0x00, 0x0A, 0x13,
-	0x06, 0x11, 0x04, 0x7E, 0x51, 0x00, 0x00, 0x04, 0x25, 0x2D, 0x17, 0x26,
-	0x7E, 0x4E, 0x00, 0x00, 0x04, 0xFE, 0x06, 0x28, 0x00, 0x00, 0x06, 0x73,
-	0x40, 0x00, 0x00, 0x0A, 0x25, 0x80, 0x51, 0x00, 0x00, 0x04, 0x28, 0x09,
-	0x00, 0x00, 0x2B, 0x28, 0x42, 0x00, 0x00, 0x0A, 0x13, 0x07, 0x03, 0x72,
-	0x20, 0x02, 0x00, 0x70, 0x11, 0x06, 0x8C, 0x19, 0x00, 0x00, 0x01, 0x28,
-	0x39, 0x00, 0x00, 0x0A, 0x6F, 0x2A, 0x00, 0x00, 0x0A, 0x03, 0x72, 0x58,
-	0x02, 0x00, 0x70, 0x11, 0x07, 0x8C, 0x19, 0x00, 0x00, 0x01, 0x28, 0x39,
-	0x00, 0x00, 0x0A, 0x6F, 0x2A, 0x00, 0x00, 0x0A, 0x2B, 0x0B, 0x03, 0x72,
-	0x90, 0x02, 0x00, 0x70, 0x6F, 0x2A, 0x00, 0x00, 0x0A, 0x03, 0x6F, 0x2C,
-	0x00, 0x00, 0x0A, 0x2A, 0x13, 0x30, 0x04, 0x00, 0xDF, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x03, 0x72, 0xDA, 0x02, 0x00, 0x70, 0x02, 0x6F,
-	0x20, 0x00, 0x00, 0x0A, 0x72, 0x14, 0x03, 0x00, 0x70, 0x28, 0x44, 0x00,
-	0x00, 0x0A, 0x6F, 0x2A, 0x00, 0x00, 0x0A, 0x03, 0x72, 0x18, 0x03, 0x00,
-	0x70, 0x04, 0x7B, 0x9B, 0x00, 0x00, 0x04, 0x8C, 0x30, 0x00, 0x00, 0x01,
-	0x28, 0x39, 0x00, 0x00, 0x0A, 0x6F, 0x2A, 0x00, 0x00, 0x0A, 0x03, 0x72,
-	0x38, 0x03, 0x00, 0x70, 0x04, 0x7B, 0x9C, 0x00, 0x00, 0x04, 0x8C, 0x2E,
-	0x00, 0x00, 0x01, 0x28, 0x39, 0x00, 0x00, 0x0A, 0x6F, 0x2A, 0x00, 0x00,
-	0x0A, 0x03, 0x72, 0x56, 0x03, 0x00, 0x70, 0x04, 0x7B, 0x9D, 0x00, 0x00,
-	0x04, 0x8C, 0x2E, 0x00, 0x00, 0x01, 0x28, 0x39, 0x00, 0x00, 0x0A, 0x6F,
-	0x2A, 0x00, 0x00, 0x0A, 0x03, 0x72, 0x72, 0x03, 0x00, 0x70, 0x04, 0x7B,
-	0x9E, 0x00, 0x00, 0x04, 0x8C, 0x2E, 0x00, 0x00, 0x01, 0x28, 0x39, 0x00,
-	0x00, 0x0A, 0x6F, 0x2A, 0x00, 0x00, 0x0A, 0x03, 0x72, 0x9E, 0x03, 0x00,
-	0x70, 0x04, 0x7B, 0x9F, 0x00, 0x00, 0x04, 0x8C, 0x2E, 0x00, 0x00, 0x01,
-	0x28, 0x39, 0x00, 0x00, 0x0A, 0x6F, 0x2A, 0x00, 0x00, 0x0A, 0x03, 0x72,
-	0xB8, 0x03, 0x00, 0x70, 0x04, 0x7B, 0xA0, 0x00, 0x00, 0x04, 0x8C, 0x30,
-	0x00, 0x00, 0x01, 0x28, 0x39, 0x00, 0x00, 0x0A, 0x6F, 0x2A, 0x00, 0x00,
-	0x0A, 0x03, 0x72, 0xDC, 0x03, 0x00, 0x70, 0x04, 0x7B, 0xA1, 0x00, 0x00,
-	0x04, 0x8C, 0x30, 0x00, 0x00, 0x01, 0x28, 0x39, 0x00, 0x00, 0x0A, 0x6F,
-	0x2A, 0x00, 0x00, 0x0A, 0x03, 0x6F, 0x2C, 0x00, 0x00, 0x0A, 0x2A, 0x00,
-	0x13, 0x30, 0x07, 0x00, 0x32, 0x01, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x11,
-	0x18, 0x8D, 0x07, 0x00, 0x00, 0x1B, 0x25, 0x16, 0x18, 0x8D, 0x23, 0x00,
-	0x00, 0x01, 0x25, 0x16, 0x72, 0x08, 0x04, 0x00, 0x70, 0xA2, 0x25, 0x17,
-	0x72, 0x20, 0x04, 0x00, 0x70, 0xA2, 0xA2, 0x25, 0x17, 0x19, 0x8D, 0x23,
-	0x00, 0x00, 0x01, 0x25, 0x16, 0x72, 0x08, 0x04, 0x00, 0x70, 0xA2, 0x25,
-	0x17, 0x72, 0x20, 0x04, 0x00, 0x70, 0xA2, 0x25, 0x18, 0x72, 0x40, 0x04,
-	0x00, 0x70, 0xA2, 0xA2, 0x0A, 0x18, 0x8D, 0x07, 0x00, 0x00, 0x1B, 0x25,
-	0x16, 0x17, 0x8D, 0x23, 0x00, 0x00, 0x01, 0x25, 0x16, 0x72, 0x20, 0x04,
-	0x00, 0x70, 0xA2, 0xA2, 0x25, 0x17, 0x18, 0x8D, 0x23, 0x00, 0x00, 0x01,
-	0x25, 0x16, 0x72, 0x08, 0x04, 0x00, 0x70, 0xA2, 0x25, 0x17, 0x72, 0x20,
-	0x04, 0x00, 0x70, 0xA2, 0xA2, 0x0B, 0x16, 0x0C, 0x16, 0x0D, 0x38, 0x9A,
-	0x00, 0x00, 0x00, 0x02, 0x09, 0x18, 0x28, 0x13, 0x00, 0x00, 0x06, 0x39,
-	0x89, 0x00, 0x00, 0x00, 0x73, 0x45, 0x00, 0x00, 0x0A, 0x25, 0x02, 0x09,
-	0x6F, 0x46, 0x00, 0x00, 0x0A, 0x6F, 0x34, 0x00, 0x00, 0x06, 0x28, 0x15,
-	0x00, 0x00, 0x06, 0x6F, 0x47, 0x00, 0x00, 0x0A, 0x25, 0x02, 0x09, 0x17,
-	0x58, 0x6F, 0x46, 0x00, 0x00, 0x0A, 0x6F, 0x34, 0x00, 0x00, 0x06, 0x28,
-	0x15, 0x00, 0x00, 0x06, 0x6F, 0x47, 0x00, 0x00, 0x0A, 0x13, 0x04, 0x11,
-	0x04, 0x06, 0x28, 0x12, 0x00, 0x00, 0x06, 0x2D, 0x0A, 0x11, 0x04, 0x07,
-	0x28, 0x12, 0x00, 0x00, 0x06, 0x2C, 0x3E, 0x17, 0x0C, 0x03, 0x72, 0x4C,
-	0x04, 0x00, 0x70, 0x02, 0x09, 0x6F, 0x46, 0x00, 0x00, 0x0A, 0x6F, 0x38,
-	0x00, 0x00, 0x06, 0x28, 0x21, 0x00, 0x00, 0x0A, 0x6F, 0x2A, 0x00, 0x00,
-	0x0A, 0x03, 0x72, 0x86, 0x04, 0x00, 0x70, 0x6F, 0x2A, 0x00, 0x00, 0x0A,
-	0x02, 0x03, 0x09, 0x18, 0x14, 0x28, 0x14, 0x00, 0x00, 0x06, 0x03, 0x72,
-	0x8A, 0x04, 0x00, 0x70, 0x6F, 0x2A, 0x00, 0x00, 0x0A, 0x09, 0x17, 0x58,
-	0x0D, 0x09, 0x02, 0x6F, 0x3E, 0x00, 0x00, 0x0A, 0x17, 0x59, 0x3F, 0x58,
-	0xFF, 0xFF, 0xFF, 0x08, 0x2D, 0x0B, 0x03, 0x72, 0x8E, 0x04, 0x00, 0x70,
-	0x6F, 0x2A, 0x00, 0x00, 0x0A, 0x2A, 0x00, 0x00, 0x13, 0x30, 0x07, 0x00,
-	0x3C, 0x01, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x11, 0x1A, 0x8D, 0x07, 0x00,
-	0x00, 0x1B, 0x25, 0x16, 0x18, 0x8D, 0x23, 0x00, 0x00, 0x01, 0x25, 0x16,
-	0x72, 0xE2, 0x04, 0x00, 0x70, 0xA2, 0x25, 0x17, 0x72, 0x40, 0x04, 0x00,
-	0x70, 0xA2, 0xA2, 0x25, 0x17, 0x17, 0x8D, 0x23, 0x00, 0x00, 0x01, 0x25,
-	0x16, 0x72, 0xFA, 0x04, 0x00, 0x70, 0xA2, 0xA2, 0x25, 0x18, 0x17, 0x8D,
-	0x23, 0x00, 0x00, 0x01, 0x25, 0x16, 0x72, 0x1C, 0x05, 0x00, 0x70, 0xA2,
-	0xA2, 0x25, 0x19, 0x18, 0x8D, 0x23, 0x00, 0x00, 0x01, 0x25, 0x16, 0x72,
-	0x1C, 0x05, 0x00, 0x70, 0xA2, 0x25, 0x17, 0x72, 0x40, 0x04, 0x00, 0x70,
-	0xA2, 0xA2, 0x0A, 0x16, 0x0B, 0x16, 0x0C, 0x38, 0xBB, 0x00, 0x00, 0x00,
-	0x73, 0x45, 0x00, 0x00, 0x0A, 0x25, 0x02, 0x08, 0x6F, 0x46, 0x00, 0x00,
-	0x0A, 0x6F, 0x34, 0x00, 0x00, 0x06, 0x28, 0x15, 0x00, 0x00, 0x06, 0x6F,
-	0x47, 0x00, 0x00, 0x0A, 0x25, 0x02, 0x08, 0x17, 0x58, 0x6F, 0x46, 0x00,
-	0x00, 0x0A, 0x6F, 0x34, 0x00, 0x00, 0x06, 0x28, 0x15, 0x00, 0x00, 0x06,
-	0x6F, 0x47, 0x00, 0x00, 0x0A, 0x25, 0x02, 0x08, 0x18, 0x58, 0x6F, 0x46,
-	0x00, 0x00, 0x0A, 0x6F, 0x34, 0x00, 0x00, 0x06, 0x28, 0x15, 0x00, 0x00,
-	0x06, 0x6F, 0x47, 0x00, 0x00, 0x0A, 0x25, 0x02, 0x08, 0x19, 0x58, 0x6F,
-	0x46, 0x00, 0x00, 0x0A, 0x6F, 0x34, 0x00, 0x00, 0x06, 0x28, 0x15, 0x00,
-	0x00, 0x06, 0x6F, 0x47, 0x00, 0x00, 0x0A, 0x06, 0x28, 0x12, 0x00, 0x00,
-	0x06, 0x2C, 0x48, 0x02, 0x08, 0x1A, 0x28, 0x13, 0x00, 0x00, 0x06, 0x2C,
-	0x3E, 0x17, 0x0B, 0x03, 0x72, 0x3E, 0x05, 0x00, 0x70, 0x02, 0x08, 0x6F,
-	0x46, 0x00, 0x00, 0x0A, 0x6F, 0x38, 0x00, 0x00, 0x06, 0x28, 0x21, 0x00,
-	0x00, 0x0A, 0x6F, 0x2A, 0x00, 0x00, 0x0A, 0x03, 0x72, 0x86, 0x04, 0x00,
-	0x70, 0x6F, 0x2A, 0x00, 0x00, 0x0A, 0x02, 0x03, 0x08, 0x1A, 0x14, 0x28,
-	0x14, 0x00, 0x00, 0x06, 0x03, 0x72, 0x8A, 0x04, 0x00, 0x70, 0x6F, 0x2A,
-	0x00, 0x00, 0x0A, 0x08, 0x17, 0x58, 0x0C, 0x08, 0x02, 0x6F, 0x3E, 0x00,
-	0x00, 0x0A, 0x19, 0x59, 0x3F, 0x37, 0xFF, 0xFF, 0xFF, 0x07, 0x2D, 0x0B,
-	0x03, 0x72, 0x88, 0x05, 0x00, 0x70, 0x6F, 0x2A, 0x00, 0x00, 0x0A, 0x2A,
-	0x13, 0x30, 0x07, 0x00, 0x3C, 0x02, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x11,
-	0x1B, 0x8D, 0x07, 0x00, 0x00, 0x1B, 0x25, 0x16, 0x18, 0x8D, 0x23, 0x00,
-	0x00, 0x01, 0x25, 0x16, 0x72, 0x20, 0x04, 0x00, 0x70, 0xA2, 0x25, 0x17,
-	0x72, 0x11, 0x06, 0x00, 0x70, 0xA2, 0xA2, 0x25, 0x17, 0x19, 0x8D, 0x23,
-	0x00, 0x00, 0x01, 0x25, 0x16, 0x72, 0x08, 0x04, 0x00, 0x70, 0xA2, 0x25,
-	0x17, 0x72, 0x20, 0x04, 0x00, 0x70, 0xA2, 0x25, 0x18, 0x72, 0x11, 0x06,
-	0x00, 0x70, 0xA2, 0xA2, 0x25, 0x18, 0x1A, 0x8D, 0x23, 0x00, 0x00, 0x01,
-	0x25, 0x16, 0x72, 0x31, 0x06, 0x00, 0x70, 0xA2, 0x25, 0x17, 0x72, 0x08,
-	0x04, 0x00, 0x70, 0xA2, 0x25, 0x18, 0x72, 0x20, 0x04, 0x00, 0x70, 0xA2,
-	0x25, 0x19, 0x72, 0x11, 0x06, 0x00, 0x70, 0xA2, 0xA2, 0x25, 0x19, 0x1B,
-	0x8D, 0x23, 0x00, 0x00, 0x01, 0x25, 0x16, 0x72, 0x31, 0x06, 0x00, 0x70,
-	0xA2, 0x25, 0x17, 0x72, 0x08, 0x04, 0x00, 0x70, 0xA2, 0x25, 0x18, 0x72,
-	0x20, 0x04, 0x00, 0x70, 0xA2, 0x25, 0x19, 0x72, 0x11, 0x06, 0x00, 0x70,
-	0xA2, 0x25, 0x1A, 0x72, 0x4F, 0x06, 0x00, 0x70, 0xA2, 0xA2, 0x25, 0x1A,
-	0x1C, 0x8D, 0x23, 0x00, 0x00, 0x01, 0x25, 0x16, 0x72, 0x31, 0x06, 0x00,
-	0x70, 0xA2, 0x25, 0x17, 0x72, 0x08, 0x04, 0x00, 0x70, 0xA2, 0x25, 0x18,
-	0x72, 0x20, 0x04, 0x00, 0x70, 0xA2, 0x25, 0x19, 0x72, 0x11, 0x06, 0x00,
-	0x70, 0xA2, 0x25, 0x1A, 0x72, 0x4F, 0x06, 0x00, 0x70, 0xA2, 0x25, 0x1B,
-	0x72, 0x40, 0x04, 0x00, 0x70, 0xA2, 0xA2, 0x0A, 0x1B, 0x8D, 0x07, 0x00,
-	0x00, 0x1B, 0x25, 0x16, 0x17, 0x8D, 0x23, 0x00, 0x00, 0x01, 0x25, 0x16,
-	0x72, 0x20, 0x04, 0x00, 0x70, 0xA2, 0xA2, 0x25, 0x17, 0x18, 0x8D, 0x23,
-	0x00, 0x00, 0x01, 0x25, 0x16, 0x72, 0x08, 0x04, 0x00, 0x70, 0xA2, 0x25,
-	0x17, 0x72, 0x20, 0x04, 0x00, 0x70, 0xA2, 0xA2, 0x25, 0x18, 0x19, 0x8D,
-	0x23, 0x00, 0x00, 0x01, 0x25, 0x16, 0x72, 0x31, 0x06, 0x00, 0x70, 0xA2,
-	0x25, 0x17, 0x72, 0x08, 0x04, 0x00, 0x70, 0xA2, 0x25, 0x18, 0x72, 0x20,
-	0x04, 0x00, 0x70, 0xA2, 0xA2, 0x25, 0x19, 0x1A, 0x8D, 0x23, 0x00, 0x00,
-	0x01, 0x25, 0x16, 0x72, 0x31, 0x06, 0x00, 0x70, 0xA2, 0x25, 0x17, 0x72,
-	0x08, 0x04, 0x00, 0x70, 0xA2, 0x25, 0x18, 0x72, 0x20, 0x04, 0x00, 0x70,
-	0xA2, 0x25, 0x19, 0x72, 0x4F, 0x06, 0x00, 0x70, 0xA2, 0xA2, 0x25, 0x1A,
-	0x1B, 0x8D, 0x23, 0x00, 0x00, 0x01, 0x25, 0x16, 0x72, 0x31, 0x06, 0x00,
-	0x70, 0xA2, 0x25, 0x17, 0x72, 0x08, 0x04, 0x00, 0x70, 0xA2, 0x25, 0x18,
-	0x72, 0x20, 0x04, 0x00, 0x70, 0xA2, 0x25, 0x19, 0x72, 0x4F, 0x06, 0x00,
-	0x70, 0xA2, 0x25, 0x1A, 0x72, 0x40, 0x04, 0x00, 0x70, 0xA2, 0xA2, 0x0B,
-	0x16, 0x0C, 0x16, 0x0D, 0x38, 0x96, 0x00, 0x00, 0x00, 0x02, 0x09, 0x1B,
-	0x28, 0x13, 0x00, 0x00, 0x06, 0x39, 0x85, 0x00, 0x00, 0x00, 0x02, 0x09,
-	0x1B, 0x6F, 0x48, 0x00, 0x00, 0x0A, 0x7E, 0x52, 0x00, 0x00, 0x04, 0x25,
-	0x2D, 0x17, 0x26, 0x7E, 0x4E, 0x00, 0x00, 0x04, 0xFE, 0x06, 0x29, 0x00,
-	0x00, 0x06, 0x73, 0x49, 0x00, 0x00, 0x0A, 0x25, 0x80, 0x52, 0x00, 0x00,
-	0x04, 0x28, 0x0A, 0x00, 0x00, 0x2B, 0x28, 0x05, 0x00, 0x00, 0x2B, 0x13,
-	0x04, 0x11, 0x04, 0x06, 0x28, 0x12, 0x00, 0x00, 0x06, 0x2D, 0x0A, 0x11,
-	0x04, 0x07, 0x28, 0x12, 0x00, 0x00, 0x06, 0x2C, 0x3E, 0x17, 0x0C, 0x03,
-	0x72, 0x73, 0x06, 0x00, 0x70, 0x02, 0x09, 0x6F, 0x46, 0x00, 0x00, 0x0A,
-	0x6F, 0x38, 0x00, 0x00, 0x06, 0x28, 0x21, 0x00, 0x00, 0x0A, 0x6F, 0x2A,
-	0x00, 0x00, 0x0A, 0x03, 0x72, 0x86, 0x04, 0x00, 0x70, 0x6F, 0x2A, 0x00,
-	0x00, 0x0A, 0x02, 0x03, 0x09, 0x1B, 0x14, 0x28, 0x14, 0x00, 0x00, 0x06,
-	0x03, 0x72, 0x8A, 0x04, 0x00, 0x70, 0x6F, 0x2A, 0x00, 0x00, 0x0A, 0x09,
-	0x17, 0x58, 0x0D, 0x09, 0x02, 0x6F, 0x3E, 0x00, 0x00, 0x0A, 0x1B, 0x59,
-	0x3E, 0x5C, 0xFF, 0xFF, 0xFF, 0x08, 0x2D, 0x0B, 0x03, 0x72, 0xB5, 0x06,
-	0x00, 0x70, 0x6F, 0x2A, 0x00, 0x00, 0x0A, 0x2A, 0x13, 0x30, 0x07, 0x00,
-	0xA6, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x11, 0x17, 0x8D, 0x07, 0x00,
-	0x00, 0x1B, 0x25, 0x16, 0x18, 0x8D, 0x23, 0x00, 0x00, 0x01, 0x25, 0x16,
-	0x72, 0xE2, 0x04, 0x00, 0x70, 0xA2, 0x25, 0x17, 0x72, 0x40, 0x04, 0x00,
-	0x70, 0xA2, 0xA2, 0x0A, 0x16, 0x0B, 0x16, 0x0C, 0x2B, 0x68, 0x02, 0x08,
-	0x6F, 0x46, 0x00, 0x00, 0x0A, 0x6F, 0x34, 0x00, 0x00, 0x06, 0x28, 0x15,
-	0x00, 0x00, 0x06, 0x0D, 0x73, 0x45, 0x00, 0x00, 0x0A, 0x25, 0x09, 0x6F,
-	0x47, 0x00, 0x00, 0x0A, 0x06, 0x28, 0x12, 0x00, 0x00, 0x06, 0x2C, 0x3E,
-	0x17, 0x0B, 0x03, 0x72, 0x35, 0x07, 0x00, 0x70, 0x02, 0x08, 0x6F, 0x46,
-	0x00, 0x00, 0x0A, 0x6F, 0x38, 0x00, 0x00, 0x06, 0x28, 0x21, 0x00, 0x00,
-	0x0A, 0x6F, 0x2A, 0x00, 0x00, 0x0A, 0x03, 0x72, 0x86, 0x04, 0x00, 0x70,
-	0x6F, 0x2A, 0x00, 0x00, 0x0A, 0x02, 0x03, 0x08, 0x17, 0x14, 0x28, 0x14,
-	0x00, 0x00, 0x06, 0x03, 0x72, 0x8A, 0x04, 0x00, 0x70, 0x6F, 0x2A, 0x00,
-	0x00, 0x0A, 0x08, 0x17, 0x58, 0x0C, 0x08, 0x02, 0x6F, 0x3E, 0x00, 0x00,
-	0x0A, 0x32, 0x8F, 0x07, 0x2D, 0x0B, 0x03, 0x72, 0x73, 0x07, 0x00, 0x70,
-	0x6F, 0x2A, 0x00, 0x00, 0x0A, 0x2A, 0x00, 0x00, 0x13, 0x30, 0x04, 0x00,
-	0x75, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x11, 0x73, 0x2A, 0x00, 0x00,
-	0x06, 0x0A, 0x06, 0x02, 0x7D, 0x53, 0x00, 0x00, 0x04, 0x06, 0x7B, 0x53,
-	0x00, 0x00, 0x04, 0x6F, 0x4B, 0x00, 0x00, 0x0A, 0x03, 0x8E, 0x69, 0x2E,
-	0x02, 0x16, 0x2A, 0x06, 0x16, 0x7D, 0x54, 0x00, 0x00, 0x04, 0x2B, 0x40,
-	0x03, 0x06, 0x7B, 0x54, 0x00, 0x00, 0x04, 0x9A, 0x06, 0x7B, 0x55, 0x00,
-	0x00, 0x04, 0x25, 0x2D, 0x16, 0x26, 0x06, 0x06, 0xFE, 0x06, 0x2B, 0x00,
-	0x00, 0x06, 0x73, 0x4C, 0x00, 0x00, 0x0A, 0x25, 0x0B, 0x7D, 0x55, 0x00,
-	0x00, 0x04, 0x07, 0x28, 0x0B, 0x00, 0x00, 0x2B, 0x2D, 0x02, 0x16, 0x2A,
-	0x06, 0x7B, 0x54, 0x00, 0x00, 0x04, 0x0C, 0x06, 0x08, 0x17, 0x58, 0x7D,
-	0x54, 0x00, 0x00, 0x04, 0x06, 0x7B, 0x54, 0x00, 0x00, 0x04, 0x03, 0x8E,
-	0x69, 0x32, 0xB5, 0x17, 0x2A, 0x00, 0x00, 0x00, 0x13, 0x30, 0x03, 0x00,
-	0x34, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x11, 0x02, 0x03, 0x6F, 0x46,
-	0x00, 0x00, 0x0A, 0x6F, 0x38, 0x00, 0x00, 0x06, 0x0A, 0x17, 0x0B, 0x2B,
-	0x1D, 0x02, 0x03, 0x07, 0x58, 0x6F, 0x46, 0x00, 0x00, 0x0A, 0x6F, 0x38,
-	0x00, 0x00, 0x06, 0x06, 0x1B, 0x28, 0x4E, 0x00, 0x00, 0x0A, 0x2D, 0x02,
-	0x16, 0x2A, 0x07, 0x17, 0x58, 0x0B, 0x07, 0x04, 0x32, 0xDF, 0x17, 0x2A,
-	0x13, 0x30, 0x03, 0x00, 0x93, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x11,
-	0x16, 0x0A, 0x38, 0x84, 0x00, 0x00, 0x00, 0x02, 0x04, 0x06, 0x58, 0x6F,
-	0x46, 0x00, 0x00, 0x0A, 0x0B, 0x07, 0x6F, 0x33, 0x00, 0x00, 0x06, 0x28,
-	0x42, 0x00, 0x00, 0x0A, 0x0C, 0x07, 0x6F, 0x34, 0x00, 0x00, 0x06, 0x28,
-	0x15, 0x00, 0x00, 0x06, 0x0D, 0x03, 0x72, 0xA7, 0x07, 0x00, 0x70, 0x07,
-	0x6F, 0x33, 0x00, 0x00, 0x06, 0x8C, 0x2E, 0x00, 0x00, 0x01, 0x28, 0x39,
-	0x00, 0x00, 0x0A, 0x6F, 0x2A, 0x00, 0x00, 0x0A, 0x03, 0x72, 0xB9, 0x07,
-	0x00, 0x70, 0x07, 0x6F, 0x38, 0x00, 0x00, 0x06, 0x28, 0x21, 0x00, 0x00,
-	0x0A, 0x6F, 0x2A, 0x00, 0x00, 0x0A, 0x03, 0x72, 0xC7, 0x07, 0x00, 0x70,
-	0x08, 0x8C, 0x19, 0x00, 0x00, 0x01, 0x28, 0x39, 0x00, 0x00, 0x0A, 0x6F,
-	0x2A, 0x00, 0x00, 0x0A, 0x03, 0x72, 0x03, 0x08, 0x00, 0x70, 0x09, 0x28,
-	0x21, 0x00, 0x00, 0x0A, 0x6F, 0x2A, 0x00, 0x00, 0x0A, 0x03, 0x6F, 0x2C,
-	0x00, 0x00, 0x0A, 0x06, 0x17, 0x58, 0x0A, 0x06, 0x05, 0x3F, 0x75, 0xFF,
-	0xFF, 0xFF, 0x2A, 0x00, 0x13, 0x30, 0x02, 0x00, 0xA1, 0x01, 0x00, 0x00,
-	0x08, 0x00, 0x00, 0x11, 0x73, 0x45, 0x00, 0x00, 0x0A, 0x0A, 0x02, 0x17,
-	0x5F, 0x2C, 0x0B, 0x06, 0x72, 0x31, 0x06, 0x00, 0x70, 0x6F, 0x47, 0x00,
-	0x00, 0x0A, 0x02, 0x18, 0x5F, 0x2C, 0x0B, 0x06, 0x72, 0x08, 0x04, 0x00,
-	0x70, 0x6F, 0x47, 0x00, 0x00, 0x0A, 0x02, 0x1A, 0x5F, 0x2C, 0x0B, 0x06,
-	0x72, 0x20, 0x04, 0x00, 0x70, 0x6F, 0x47, 0x00, 0x00, 0x0A, 0x02, 0x1F,
-	0x10, 0x5F, 0x2C, 0x0B, 0x06, 0x72, 0x15, 0x08, 0x00, 0x70, 0x6F, 0x47,
-	0x00, 0x00, 0x0A, 0x02, 0x1F, 0x20, 0x5F, 0x2C, 0x0B, 0x06, 0x72, 0x3F,
-	0x08, 0x00, 0x70, 0x6F, 0x47, 0x00, 0x00, 0x0A, 0x02, 0x1F, 0x40, 0x5F,
-	0x2C, 0x0B, 0x06, 0x72, 0x63, 0x08, 0x00, 0x70, 0x6F, 0x47, 0x00, 0x00,
-	0x0A, 0x02, 0x20, 0x00, 0x01, 0x00, 0x00, 0x5F, 0x2C, 0x0B, 0x06, 0x72,
-	0x8F, 0x08, 0x00, 0x70, 0x6F, 0x47, 0x00, 0x00, 0x0A, 0x02, 0x20, 0x00,
-	0x02, 0x00, 0x00, 0x5F, 0x2C, 0x0B, 0x06, 0x72, 0xE2, 0x04, 0x00, 0x70,
-	0x6F, 0x47, 0x00, 0x00, 0x0A, 0x02, 0x20, 0x00, 0x04, 0x00, 0x00, 0x5F,
-	0x2C, 0x0B, 0x06, 0x72, 0xA7, 0x08, 0x00, 0x70, 0x6F, 0x47, 0x00, 0x00,
-	0x0A, 0x02, 0x20, 0x00, 0x08, 0x00, 0x00, 0x5F, 0x2C, 0x0B, 0x06, 0x72,
-	0x11, 0x06, 0x00, 0x70, 0x6F, 0x47, 0x00, 0x00, 0x0A, 0x02, 0x20, 0x00,
-	0x10, 0x00, 0x00, 0x5F, 0x2C, 0x0B, 0x06, 0x72, 0xFA, 0x04, 0x00, 0x70,
-	0x6F, 0x47, 0x00, 0x00, 0x0A, 0x02, 0x20, 0x00, 0x20, 0x00, 0x00, 0x5F,
-	0x2C, 0x0B, 0x06, 0x72, 0x1C, 0x05, 0x00, 0x70, 0x6F, 0x47, 0x00, 0x00,
-	0x0A, 0x02, 0x20, 0x00, 0x40, 0x00, 0x00, 0x5F, 0x2C, 0x0B, 0x06, 0x72,
-	0xDB, 0x08, 0x00, 0x70, 0x6F, 0x47, 0x00, 0x00, 0x0A, 0x02, 0x20, 0x00,
-	0x80, 0x00, 0x00, 0x5F, 0x2C, 0x0B, 0x06, 0x72, 0x4F, 0x06, 0x00, 0x70,
-	0x6F, 0x47, 0x00, 0x00, 0x0A, 0x02, 0x20, 0x00, 0x00, 0x01, 0x00, 0x5F,
-	0x2C, 0x0B, 0x06, 0x72, 0xFD, 0x08, 0x00, 0x70, 0x6F, 0x47, 0x00, 0x00,
-	0x0A, 0x02, 0x20, 0x00, 0x00, 0x02, 0x00, 0x5F, 0x2C, 0x0B, 0x06, 0x72,
-	0x1F, 0x09, 0x00, 0x70, 0x6F, 0x47, 0x00, 0x00, 0x0A, 0x02, 0x20, 0x00,
-	0x00, 0x04, 0x00, 0x5F, 0x2C, 0x0B, 0x06, 0x72, 0x45, 0x09, 0x00, 0x70,
-	0x6F, 0x47, 0x00, 0x00, 0x0A, 0x02, 0x20, 0x00, 0x00, 0x08, 0x00, 0x5F,
-	0x2C, 0x0B, 0x06, 0x72, 0x69, 0x09, 0x00, 0x70, 0x6F, 0x47, 0x00, 0x00,
-	0x0A, 0x02, 0x20, 0x00, 0x00, 0x10, 0x00, 0x5F, 0x2C, 0x0B, 0x06, 0x72,
-	0x8B, 0x09, 0x00, 0x70, 0x6F, 0x47, 0x00, 0x00, 0x0A, 0x02, 0x20, 0x00,
-	0x00, 0x20, 0x00, 0x5F, 0x2C, 0x0B, 0x06, 0x72, 0xB5, 0x09, 0x00, 0x70,
-	0x6F, 0x47, 0x00, 0x00, 0x0A, 0x02, 0x20, 0x00, 0x00, 0x00, 0x80, 0x5F,
-	0x2C, 0x0B, 0x06, 0x72, 0x40, 0x04, 0x00, 0x70, 0x6F, 0x47, 0x00, 0x00,
-	0x0A, 0x72, 0xD1, 0x09, 0x00, 0x70, 0x06, 0x28, 0x4F, 0x00, 0x00, 0x0A,
-	0x2A, 0x1E, 0x02, 0x28, 0x10, 0x00, 0x00, 0x0A, 0x2A, 0x1E, 0x02, 0x28,
-	0x10, 0x00, 0x00, 0x0A, 0x2A, 0x66, 0x1F, 0xEC, 0x80, 0x30, 0x00, 0x00,
-	0x04, 0x20, 0x00, 0x00, 0x08, 0x00, 0x80, 0x31, 0x00, 0x00, 0x04, 0x1F,
-	0x20, 0x80, 0x32, 0x00, 0x00, 0x04, 0x2A, 0x2E, 0x73, 0x25, 0x00, 0x00,
-	0x06, 0x80, 0x4E, 0x00, 0x00, 0x04, 0x2A, 0x1E, 0x02, 0x28, 0x10, 0x00,
-	0x00, 0x0A, 0x2A, 0x2A, 0x03, 0x6F, 0x50, 0x00, 0x00, 0x0A, 0x19, 0xFE,
-	0x01, 0x2A, 0x1E, 0x03, 0x6F, 0x33, 0x00, 0x00, 0x06, 0x2A, 0x1E, 0x03,
-	0x6F, 0x33, 0x00, 0x00, 0x06, 0x2A, 0x32, 0x03, 0x6F, 0x34, 0x00, 0x00,
-	0x06, 0x28, 0x15, 0x00, 0x00, 0x06, 0x2A, 0x1E, 0x02, 0x28, 0x10, 0x00,
-	0x00, 0x0A, 0x2A, 0x62, 0x02, 0x7B, 0x53, 0x00, 0x00, 0x04, 0x02, 0x7B,
-	0x54, 0x00, 0x00, 0x04, 0x6F, 0x51, 0x00, 0x00, 0x0A, 0x03, 0x6F, 0x52,
-	0x00, 0x00, 0x0A, 0x2A, 0x13, 0x30, 0x04, 0x00, 0xCA, 0x00, 0x00, 0x00,
-	0x10, 0x00, 0x00, 0x11, 0x02, 0x28, 0x10, 0x00, 0x00, 0x0A, 0x02, 0x03,
-	0x28, 0x53, 0x00, 0x00, 0x0A, 0x7D, 0xB4, 0x00, 0x00, 0x04, 0x02, 0x03,
-	0x1A, 0x28, 0x54, 0x00, 0x00, 0x0A, 0x7D, 0xB5, 0x00, 0x00, 0x04, 0x02,
-	0x03, 0x1C, 0x28, 0x54, 0x00, 0x00, 0x0A, 0x7D, 0xB6, 0x00, 0x00, 0x04,
-	0x02, 0x03, 0x1E, 0x28, 0x1D, 0x00, 0x00, 0x0A, 0x7D, 0xB7, 0x00, 0x00,
-	0x04, 0x02, 0x03, 0x1F, 0x10, 0x28, 0x1D, 0x00, 0x00, 0x0A, 0x7D, 0xB8,
-	0x00, 0x00, 0x04, 0x02, 0x03, 0x1F, 0x18, 0x28, 0x1D, 0x00, 0x00, 0x0A,
-	0x7D, 0xB9, 0x00, 0x00, 0x04, 0x02, 0x03, 0x1F, 0x20, 0x28, 0x1D, 0x00,
-	0x00, 0x0A, 0x7D, 0xBA, 0x00, 0x00, 0x04, 0x02, 0x03, 0x1F, 0x28, 0x28,
-	0x55, 0x00, 0x00, 0x0A, 0x7D, 0xBB, 0x00, 0x00, 0x04, 0x02, 0x03, 0x1F,
-	0x2C, 0x28, 0x55, 0x00, 0x00, 0x0A, 0x7D, 0xBC, 0x00, 0x00, 0x04, 0x02,
-	0x03, 0x1F, 0x30, 0x28, 0x55, 0x00, 0x00, 0x0A, 0x7D, 0xBD, 0x00, 0x00,
-	0x04, 0x02, 0x03, 0x1F, 0x34, 0x28, 0x55, 0x00, 0x00, 0x0A, 0x7D, 0xBE,
-	0x00, 0x00, 0x04, 0x03, 0x1F, 0x38, 0x28, 0x54, 0x00, 0x00, 0x0A, 0x0A,
-	0x03, 0x1F, 0x3A, 0x28, 0x54, 0x00, 0x00, 0x0A, 0x0B, 0x02, 0x0F, 0x01,
-	0x28, 0x13, 0x00, 0x00, 0x0A, 0x07, 0x58, 0x73, 0x19, 0x00, 0x00, 0x0A,
-	0x06, 0x18, 0x5B, 0x28, 0x56, 0x00, 0x00, 0x0A, 0x7D, 0xBF, 0x00, 0x00,
-	0x04, 0x2A, 0x1E, 0x02, 0x7B, 0xB4, 0x00, 0x00, 0x04, 0x2A, 0x1E, 0x02,
-	0x7B, 0xB5, 0x00, 0x00, 0x04, 0x2A, 0x1E, 0x02, 0x7B, 0xB6, 0x00, 0x00,
-	0x04, 0x2A, 0x1E, 0x02, 0x7B, 0xB7, 0x00, 0x00, 0x04, 0x2A, 0x1E, 0x02,
-	0x7B, 0xB8, 0x00, 0x00, 0x04, 0x2A, 0x1E, 0x02, 0x7B, 0xB9, 0x00, 0x00,
-	0x04, 0x2A, 0x1E, 0x02, 0x7B, 0xBA, 0x00, 0x00, 0x04, 0x2A, 0x1E, 0x02,
-	0x7B, 0xBB, 0x00, 0x00, 0x04, 0x2A, 0x1E, 0x02, 0x7B, 0xBC, 0x00, 0x00,
-	0x04, 0x2A, 0x1E, 0x02, 0x7B, 0xBD, 0x00, 0x00, 0x04, 0x2A, 0x1E, 0x02,
-	0x7B, 0xBE, 0x00, 0x00, 0x04, 0x2A, 0x1E, 0x02, 0x7B, 0xBF, 0x00, 0x00,
-	0x04, 0x2A, 0x00, 0x00, 0x13, 0x30, 0x02, 0x00, 0x11, 0x00, 0x00, 0x00,
-	0x11, 0x00, 0x00, 0x11, 0x16, 0x0A, 0x02, 0x28, 0x37, 0x00, 0x00, 0x06,
-	0x1F, 0x10, 0x5F, 0x2C, 0x02, 0x17, 0x0A, 0x06, 0x2A, 0x00, 0x00, 0x00,
-	0x13, 0x30, 0x02, 0x00, 0x11, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11,
-	0x16, 0x0A, 0x02, 0x28, 0x37, 0x00, 0x00, 0x06, 0x1F, 0x10, 0x5F, 0x2D,
-	0x02, 0x17, 0x0A, 0x06, 0x2A, 0x1E, 0x02, 0x28, 0x38, 0x00, 0x00, 0x06,
-	0x2A, 0x00, 0x00, 0x00, 0x42, 0x53, 0x4A, 0x42, 0x01, 0x00, 0x01, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x76, 0x34, 0x2E, 0x30,
-	0x2E, 0x33, 0x30, 0x33, 0x31, 0x39, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-	0x6C, 0x00, 0x00, 0x00, 0xB8, 0x15, 0x00, 0x00, 0x23, 0x7E, 0x00, 0x00,
-	0x24, 0x16, 0x00, 0x00, 0x20, 0x1B, 0x00, 0x00, 0x23, 0x53, 0x74, 0x72,
-	0x69, 0x6E, 0x67, 0x73, 0x00, 0x00, 0x00, 0x00, 0x44, 0x31, 0x00, 0x00,
-	0xDC, 0x09, 0x00, 0x00, 0x23, 0x55, 0x53, 0x00, 0x20, 0x3B, 0x00, 0x00,
-	0x10, 0x00, 0x00, 0x00, 0x23, 0x47, 0x55, 0x49, 0x44, 0x00, 0x00, 0x00,
-	0x30, 0x3B, 0x00, 0x00, 0xD4, 0x06, 0x00, 0x00, 0x23, 0x42, 0x6C, 0x6F,
-	0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01,
-	0x57, 0xBF, 0xA2, 0x1D, 0x09, 0x0A, 0x00, 0x00, 0x00, 0xFA, 0x01, 0x33,
-	0x00, 0x16, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
-	0x10, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x3B, 0x00, 0x00, 0x00,
-	0x6B, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00,
-	0x90, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-	0x06, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-	0x0E, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-	0x09, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-	0x03, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x2E, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
-	0x93, 0x0E, 0x52, 0x18, 0x06, 0x00, 0x00, 0x0F, 0x52, 0x18, 0x06, 0x00,
-	0xC7, 0x0D, 0x08, 0x18, 0x0F, 0x00, 0x72, 0x18, 0x00, 0x00, 0x06, 0x00,
-	0xEF, 0x0D, 0x85, 0x15, 0x06, 0x00, 0x76, 0x0E, 0x85, 0x15, 0x06, 0x00,
-	0x57, 0x0E, 0x85, 0x15, 0x06, 0x00, 0xE7, 0x0E, 0x85, 0x15, 0x06, 0x00,
-	0xB3, 0x0E, 0x85, 0x15, 0x06, 0x00, 0xCC, 0x0E, 0x85, 0x15, 0x06, 0x00,
-	0x06, 0x0E, 0x85, 0x15, 0x06, 0x00, 0xDB, 0x0D, 0x33, 0x18, 0x06, 0x00,
-	0xB9, 0x0D, 0x33, 0x18, 0x06, 0x00, 0x3A, 0x0E, 0x85, 0x15, 0x06, 0x00,
-	0x21, 0x0E, 0x7E, 0x0F, 0x06, 0x00, 0x1B, 0x1A, 0xE0, 0x10, 0x06, 0x00,
-	0x43, 0x0B, 0xE0, 0x10, 0x06, 0x00, 0x64, 0x16, 0x64, 0x06, 0x06, 0x00,
-	0xBF, 0x00, 0xCE, 0x08, 0x06, 0x00, 0xF8, 0x10, 0xE0, 0x10, 0x0A, 0x00,
-	0xA1, 0x0F, 0x08, 0x18, 0x06, 0x00, 0x3F, 0x17, 0x64, 0x06, 0x06, 0x00,
-	0xB1, 0x00, 0xCE, 0x08, 0x06, 0x00, 0xC4, 0x15, 0xE0, 0x10, 0x06, 0x00,
-	0x6C, 0x0C, 0xE0, 0x10, 0x06, 0x00, 0xD8, 0x00, 0xE0, 0x10, 0x06, 0x00,
-	0x9E, 0x0D, 0x52, 0x18, 0x06, 0x00, 0xE2, 0x19, 0x64, 0x06, 0x06, 0x00,
-	0xEA, 0x0C, 0x64, 0x06, 0x06, 0x00, 0xD2, 0x0C, 0xE0, 0x10, 0x06, 0x00,
-	0xF5, 0x03, 0xD8, 0x18, 0x06, 0x00, 0xF3, 0x17, 0xE0, 0x10, 0x0A, 0x00,
-	0xBF, 0x15, 0x8E, 0x10, 0x06, 0x00, 0x67, 0x10, 0x33, 0x18, 0x06, 0x00,
-	0x9A, 0x0F, 0xE0, 0x10, 0x06, 0x00, 0x9D, 0x16, 0xE0, 0x10, 0x0E, 0x00,
-	0x38, 0x0B, 0x91, 0x16, 0x06, 0x00, 0xA3, 0x00, 0xCE, 0x08, 0x06, 0x00,
-	0x4C, 0x17, 0x64, 0x06, 0x06, 0x00, 0xAA, 0x17, 0x90, 0x19, 0x06, 0x00,
-	0x23, 0x0C, 0xE0, 0x10, 0x0A, 0x00, 0xF4, 0x19, 0x08, 0x18, 0x06, 0x00,
-	0x1D, 0x11, 0xE0, 0x10, 0x06, 0x00, 0xD3, 0x0F, 0x64, 0x06, 0x06, 0x00,
-	0x1E, 0x0C, 0x64, 0x06, 0x06, 0x00, 0x02, 0x01, 0xE0, 0x10, 0x06, 0x00,
-	0xD2, 0x00, 0xE0, 0x10, 0x06, 0x00, 0xEC, 0x00, 0xE0, 0x10, 0x06, 0x00,
-	0xE0, 0x15, 0xE0, 0x10, 0x06, 0x00, 0xE0, 0x0C, 0x64, 0x06, 0x00, 0x00,
-	0x00, 0x00, 0x16, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
-	0x01, 0x00, 0x10, 0x00, 0x6F, 0x10, 0x86, 0x10, 0x41, 0x00, 0x01, 0x00,
-	0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0xCF, 0x10, 0x86, 0x10, 0x41, 0x00,
-	0x05, 0x00, 0x09, 0x00, 0x01, 0x00, 0x10, 0x00, 0x16, 0x10, 0x86, 0x10,
-	0x41, 0x00, 0x05, 0x00, 0x17, 0x00, 0x02, 0x01, 0x00, 0x00, 0x02, 0x0B,
-	0x00, 0x00, 0x51, 0x00, 0x39, 0x00, 0x24, 0x00, 0x03, 0x21, 0x10, 0x00,
-	0xCA, 0x08, 0x00, 0x00, 0x41, 0x00, 0x4E, 0x00, 0x24, 0x00, 0x03, 0x01,
-	0x10, 0x00, 0x59, 0x00, 0x00, 0x00, 0x41, 0x00, 0x53, 0x00, 0x2A, 0x00,
-	0x02, 0x01, 0x00, 0x00, 0xEC, 0x10, 0x00, 0x00, 0x51, 0x00, 0x56, 0x00,
-	0x2C, 0x00, 0x02, 0x01, 0x00, 0x00, 0x44, 0x07, 0x00, 0x00, 0x51, 0x00,
-	0x67, 0x00, 0x2C, 0x00, 0x0A, 0x01, 0x10, 0x00, 0x2A, 0x06, 0x00, 0x00,
-	0x79, 0x00, 0x91, 0x00, 0x2C, 0x00, 0x0A, 0x01, 0x10, 0x00, 0x37, 0x01,
-	0x00, 0x00, 0x79, 0x00, 0x9B, 0x00, 0x2C, 0x00, 0x02, 0x00, 0x10, 0x00,
-	0x10, 0x1B, 0x00, 0x00, 0x41, 0x00, 0xA2, 0x00, 0x2C, 0x00, 0x0A, 0x01,
-	0x10, 0x00, 0x32, 0x01, 0x00, 0x00, 0x79, 0x00, 0xC0, 0x00, 0x3C, 0x00,
-	0x0A, 0x01, 0x10, 0x00, 0x45, 0x05, 0x00, 0x00, 0x79, 0x00, 0xC6, 0x00,
-	0x3C, 0x00, 0x0A, 0x01, 0x10, 0x00, 0x22, 0x07, 0x00, 0x00, 0x79, 0x00,
-	0xC8, 0x00, 0x3C, 0x00, 0x0A, 0x01, 0x10, 0x00, 0x01, 0x05, 0x00, 0x00,
-	0x79, 0x00, 0xCE, 0x00, 0x3C, 0x00, 0x01, 0x00, 0x6E, 0x16, 0x50, 0x04,
-	0x01, 0x00, 0xEE, 0x16, 0x54, 0x04, 0x01, 0x00, 0x66, 0x0B, 0x20, 0x00,
-	0x01, 0x00, 0xB4, 0x0C, 0x57, 0x04, 0x56, 0x80, 0x96, 0x04, 0x5A, 0x04,
-	0x56, 0x80, 0x5C, 0x01, 0x54, 0x04, 0x56, 0x80, 0x77, 0x04, 0x54, 0x04,
-	0x56, 0x80, 0x69, 0x01, 0x54, 0x04, 0x56, 0x80, 0x85, 0x04, 0x54, 0x04,
-	0x56, 0x80, 0x90, 0x08, 0x54, 0x04, 0x56, 0x80, 0x85, 0x08, 0x54, 0x04,
-	0x56, 0x80, 0xAE, 0x07, 0x54, 0x04, 0x56, 0x80, 0x22, 0x05, 0x54, 0x04,
-	0x56, 0x80, 0xBC, 0x07, 0x54, 0x04, 0x56, 0x80, 0x10, 0x05, 0x54, 0x04,
-	0x56, 0x80, 0x55, 0x05, 0x54, 0x04, 0x56, 0x80, 0xED, 0x06, 0x54, 0x04,
-	0x56, 0x80, 0xB9, 0x19, 0x54, 0x04, 0x56, 0x80, 0x69, 0x08, 0x54, 0x04,
-	0x56, 0x80, 0xEF, 0x01, 0x54, 0x04, 0x56, 0x80, 0xE4, 0x05, 0x54, 0x04,
-	0x56, 0x80, 0xDB, 0x04, 0x54, 0x04, 0x51, 0x80, 0xCC, 0x05, 0x54, 0x04,
-	0x51, 0x80, 0xB4, 0x06, 0x54, 0x04, 0x51, 0x80, 0x8D, 0x01, 0x54, 0x04,
-	0x51, 0x80, 0x5B, 0x07, 0x54, 0x04, 0x56, 0x80, 0x5D, 0x04, 0x54, 0x04,
-	0x56, 0x80, 0x42, 0x02, 0x54, 0x04, 0x56, 0x80, 0x0F, 0x06, 0x54, 0x04,
-	0x56, 0x80, 0x3D, 0x04, 0x54, 0x04, 0x56, 0x80, 0x25, 0x02, 0x54, 0x04,
-	0x56, 0x80, 0xEE, 0x05, 0x54, 0x04, 0x56, 0x80, 0x0F, 0x04, 0x54, 0x04,
-	0x56, 0x80, 0x26, 0x04, 0x54, 0x04, 0x56, 0x80, 0x89, 0x02, 0x54, 0x04,
-	0x56, 0x80, 0x83, 0x03, 0x54, 0x04, 0x56, 0x80, 0xBF, 0x03, 0x54, 0x04,
-	0x56, 0x80, 0xDA, 0x03, 0x54, 0x04, 0x56, 0x80, 0xBA, 0x02, 0x54, 0x04,
-	0x56, 0x80, 0x46, 0x03, 0x54, 0x04, 0x56, 0x80, 0xD6, 0x02, 0x54, 0x04,
-	0x56, 0x80, 0x0B, 0x03, 0x54, 0x04, 0x56, 0x80, 0x29, 0x03, 0x54, 0x04,
-	0x56, 0x80, 0x9E, 0x02, 0x54, 0x04, 0x56, 0x80, 0x63, 0x03, 0x54, 0x04,
-	0x56, 0x80, 0xF2, 0x02, 0x54, 0x04, 0x56, 0x80, 0xFE, 0x03, 0x54, 0x04,
-	0x16, 0x00, 0xB3, 0x03, 0x5A, 0x04, 0x16, 0x00, 0x9D, 0x01, 0x5A, 0x04,
-	0x16, 0x00, 0x57, 0x08, 0x5A, 0x04, 0x56, 0x80, 0x04, 0x02, 0x54, 0x04,
-	0x56, 0x80, 0x48, 0x01, 0x54, 0x04, 0x56, 0x80, 0x6B, 0x05, 0x54, 0x04,
-	0x56, 0x80, 0x82, 0x05, 0x54, 0x04, 0x56, 0x80, 0xB4, 0x05, 0x54, 0x04,
-	0x56, 0x80, 0x9B, 0x05, 0x54, 0x04, 0x06, 0x06, 0xA9, 0x08, 0x5A, 0x04,
-	0x56, 0x80, 0x96, 0x04, 0x5D, 0x04, 0x56, 0x80, 0x6B, 0x07, 0x5D, 0x04,
-	0x56, 0x80, 0x45, 0x06, 0x5D, 0x04, 0x56, 0x80, 0x59, 0x02, 0x5D, 0x04,
-	0x56, 0x80, 0x6E, 0x02, 0x5D, 0x04, 0x56, 0x80, 0x08, 0x07, 0x5D, 0x04,
-	0x56, 0x80, 0x79, 0x01, 0x5D, 0x04, 0x56, 0x80, 0x9E, 0x03, 0x5D, 0x04,
-	0x56, 0x80, 0x1F, 0x01, 0x5D, 0x04, 0x56, 0x80, 0xF0, 0x04, 0x5D, 0x04,
-	0x56, 0x80, 0xC7, 0x01, 0x5D, 0x04, 0x56, 0x80, 0xC3, 0x06, 0x5D, 0x04,
-	0x56, 0x80, 0x8D, 0x07, 0x5D, 0x04, 0x56, 0x80, 0xAB, 0x04, 0x5D, 0x04,
-	0x56, 0x80, 0xAB, 0x01, 0x5D, 0x04, 0x56, 0x80, 0x8C, 0x06, 0x5D, 0x04,
-	0x56, 0x80, 0xDB, 0x01, 0x5D, 0x04, 0x56, 0x80, 0x34, 0x07, 0x5D, 0x04,
-	0x56, 0x80, 0x6E, 0x06, 0x5D, 0x04, 0x56, 0x80, 0xDB, 0x06, 0x5D, 0x04,
-	0x36, 0x00, 0x12, 0x01, 0x61, 0x04, 0x16, 0x00, 0x01, 0x00, 0x65, 0x04,
-	0x16, 0x00, 0x17, 0x00, 0x6E, 0x04, 0x16, 0x00, 0x88, 0x00, 0x6E, 0x04,
-	0x16, 0x00, 0x32, 0x00, 0x77, 0x04, 0x06, 0x00, 0xB1, 0x19, 0x80, 0x04,
-	0x06, 0x00, 0x1D, 0x10, 0x5A, 0x04, 0x06, 0x00, 0x6E, 0x00, 0x87, 0x04,
-	0x06, 0x06, 0xA9, 0x08, 0x5A, 0x04, 0x56, 0x80, 0x96, 0x04, 0x8F, 0x04,
-	0x56, 0x80, 0x7F, 0x07, 0x8F, 0x04, 0x56, 0x80, 0x45, 0x06, 0x8F, 0x04,
-	0x56, 0x80, 0x59, 0x02, 0x8F, 0x04, 0x56, 0x80, 0x6E, 0x02, 0x8F, 0x04,
-	0x56, 0x80, 0x08, 0x07, 0x8F, 0x04, 0x56, 0x80, 0x79, 0x01, 0x8F, 0x04,
-	0x56, 0x80, 0x9E, 0x03, 0x8F, 0x04, 0x56, 0x80, 0x1F, 0x01, 0x8F, 0x04,
-	0x56, 0x80, 0xF0, 0x04, 0x8F, 0x04, 0x56, 0x80, 0xC7, 0x01, 0x8F, 0x04,
-	0x56, 0x80, 0xC3, 0x06, 0x8F, 0x04, 0x56, 0x80, 0x8D, 0x07, 0x8F, 0x04,
-	0x56, 0x80, 0xC2, 0x04, 0x8F, 0x04, 0x56, 0x80, 0xAB, 0x01, 0x8F, 0x04,
-	0x56, 0x80, 0x8C, 0x06, 0x8F, 0x04, 0x06, 0x06, 0xA9, 0x08, 0x5A, 0x04,
-	0x56, 0x80, 0xE8, 0x14, 0x93, 0x04, 0x56, 0x80, 0x5C, 0x15, 0x93, 0x04,
-	0x56, 0x80, 0x20, 0x15, 0x93, 0x04, 0x56, 0x80, 0x9D, 0x11, 0x93, 0x04,
-	0x56, 0x80, 0xCA, 0x11, 0x93, 0x04, 0x56, 0x80, 0x57, 0x13, 0x93, 0x04,
-	0x56, 0x80, 0x60, 0x11, 0x93, 0x04, 0x56, 0x80, 0x65, 0x14, 0x93, 0x04,
-	0x56, 0x80, 0x31, 0x12, 0x93, 0x04, 0x56, 0x80, 0x7B, 0x12, 0x93, 0x04,
-	0x56, 0x80, 0x2A, 0x13, 0x93, 0x04, 0x56, 0x80, 0x50, 0x14, 0x93, 0x04,
-	0x56, 0x80, 0x1A, 0x14, 0x93, 0x04, 0x56, 0x80, 0x02, 0x14, 0x93, 0x04,
-	0x56, 0x80, 0x72, 0x11, 0x93, 0x04, 0x56, 0x80, 0xE2, 0x11, 0x93, 0x04,
-	0x56, 0x80, 0x96, 0x14, 0x93, 0x04, 0x56, 0x80, 0x6F, 0x13, 0x93, 0x04,
-	0x56, 0x80, 0xCE, 0x13, 0x93, 0x04, 0x56, 0x80, 0xF6, 0x11, 0x93, 0x04,
-	0x56, 0x80, 0x45, 0x12, 0x93, 0x04, 0x56, 0x80, 0x82, 0x13, 0x93, 0x04,
-	0x56, 0x80, 0x91, 0x12, 0x93, 0x04, 0x56, 0x80, 0x3E, 0x13, 0x93, 0x04,
-	0x56, 0x80, 0xA5, 0x12, 0x93, 0x04, 0x56, 0x80, 0xCB, 0x14, 0x93, 0x04,
-	0x56, 0x80, 0x7B, 0x14, 0x93, 0x04, 0x56, 0x80, 0xB3, 0x13, 0x93, 0x04,
-	0x56, 0x80, 0xB2, 0x11, 0x93, 0x04, 0x56, 0x80, 0xE8, 0x13, 0x93, 0x04,
-	0x56, 0x80, 0x35, 0x14, 0x93, 0x04, 0x56, 0x80, 0x88, 0x11, 0x93, 0x04,
-	0x56, 0x80, 0xAF, 0x14, 0x93, 0x04, 0x56, 0x80, 0x98, 0x13, 0x93, 0x04,
-	0x56, 0x80, 0xBF, 0x12, 0x93, 0x04, 0x56, 0x80, 0xDB, 0x12, 0x93, 0x04,
-	0x56, 0x80, 0x01, 0x15, 0x93, 0x04, 0x56, 0x80, 0x3D, 0x15, 0x93, 0x04,
-	0x56, 0x80, 0xF3, 0x12, 0x93, 0x04, 0x56, 0x80, 0x62, 0x12, 0x93, 0x04,
-	0x56, 0x80, 0x12, 0x13, 0x93, 0x04, 0x06, 0x00, 0x19, 0x19, 0x54, 0x04,
-	0x06, 0x00, 0x83, 0x0C, 0x97, 0x04, 0x06, 0x00, 0xA5, 0x0C, 0x97, 0x04,
-	0x06, 0x00, 0x75, 0x0C, 0x97, 0x04, 0x06, 0x00, 0xDB, 0x16, 0x54, 0x04,
-	0x06, 0x00, 0xAB, 0x0F, 0x54, 0x04, 0x06, 0x00, 0xB1, 0x1A, 0x54, 0x04,
-	0x06, 0x00, 0x72, 0x19, 0x54, 0x04, 0x06, 0x00, 0xB8, 0x0F, 0x54, 0x04,
-	0x06, 0x00, 0xBD, 0x1A, 0x54, 0x04, 0x06, 0x00, 0x18, 0x02, 0x9B, 0x04,
-	0x06, 0x00, 0x3D, 0x16, 0x9E, 0x04, 0x06, 0x00, 0x46, 0x16, 0x9E, 0x04,
-	0x06, 0x00, 0x25, 0x16, 0x9E, 0x04, 0x06, 0x00, 0x4E, 0x16, 0x9E, 0x04,
-	0x06, 0x00, 0x49, 0x0F, 0x9B, 0x04, 0x06, 0x00, 0xB1, 0x08, 0x9B, 0x04,
-	0x51, 0x80, 0x3A, 0x05, 0x5A, 0x04, 0x51, 0x80, 0xA6, 0x06, 0x5A, 0x04,
-	0x51, 0x80, 0x30, 0x05, 0x5A, 0x04, 0x51, 0x80, 0x83, 0x02, 0x5A, 0x04,
-	0x51, 0x80, 0x84, 0x02, 0x5A, 0x04, 0x51, 0x80, 0xD2, 0x07, 0x5A, 0x04,
-	0x51, 0x80, 0x3F, 0x08, 0x5A, 0x04, 0x51, 0x80, 0x4B, 0x08, 0x5A, 0x04,
-	0x51, 0x80, 0x35, 0x08, 0x5A, 0x04, 0x51, 0x80, 0x34, 0x08, 0x5A, 0x04,
-	0x51, 0x80, 0x0F, 0x08, 0x5A, 0x04, 0x51, 0x80, 0xEA, 0x07, 0x5A, 0x04,
-	0x51, 0x80, 0x01, 0x08, 0x5A, 0x04, 0x51, 0x80, 0x1A, 0x08, 0x5A, 0x04,
-	0x51, 0x80, 0xDD, 0x07, 0x5A, 0x04, 0x51, 0x80, 0xC8, 0x07, 0x5A, 0x04,
-	0x51, 0x80, 0xF6, 0x07, 0x5A, 0x04, 0x51, 0x80, 0x29, 0x08, 0x5A, 0x04,
-	0x21, 0x00, 0xA1, 0x09, 0x54, 0x04, 0x21, 0x00, 0xBF, 0x09, 0xA1, 0x04,
-	0x21, 0x00, 0xDD, 0x09, 0xA1, 0x04, 0x21, 0x00, 0x4A, 0x0A, 0x9B, 0x04,
-	0x21, 0x00, 0x6F, 0x0A, 0x9B, 0x04, 0x21, 0x00, 0x5A, 0x09, 0x9E, 0x04,
-	0x21, 0x00, 0x2F, 0x0A, 0x9E, 0x04, 0x21, 0x00, 0xFB, 0x09, 0x54, 0x04,
-	0x21, 0x00, 0x13, 0x0A, 0x54, 0x04, 0x21, 0x00, 0x6F, 0x09, 0x54, 0x04,
-	0x21, 0x00, 0x9A, 0x0A, 0x54, 0x04, 0x21, 0x00, 0x8B, 0x09, 0x6D, 0x01,
-	0x06, 0x00, 0x34, 0x16, 0x9E, 0x04, 0x06, 0x00, 0x38, 0x10, 0x54, 0x04,
-	0x06, 0x00, 0x0C, 0x0D, 0x54, 0x04, 0x06, 0x00, 0x89, 0x1A, 0x9B, 0x04,
-	0x06, 0x00, 0x5E, 0x17, 0x9B, 0x04, 0x06, 0x00, 0xE9, 0x08, 0x9B, 0x04,
-	0x06, 0x00, 0x05, 0x1A, 0x54, 0x04, 0x06, 0x00, 0x79, 0x15, 0x9B, 0x04,
-	0x06, 0x00, 0xF9, 0x0F, 0x5A, 0x04, 0x06, 0x00, 0x02, 0x1B, 0x20, 0x00,
-	0x06, 0x00, 0x54, 0x0C, 0x20, 0x00, 0x06, 0x00, 0x52, 0x19, 0x5A, 0x04,
-	0x06, 0x00, 0xD1, 0x17, 0x5A, 0x04, 0x06, 0x00, 0xD9, 0x0A, 0x5A, 0x04,
-	0x06, 0x00, 0xF9, 0x0F, 0xA1, 0x04, 0x06, 0x00, 0xF2, 0x0F, 0xA1, 0x04,
-	0x06, 0x00, 0x38, 0x17, 0x20, 0x00, 0x50, 0x20, 0x00, 0x00, 0x00, 0x00,
-	0x86, 0x18, 0xC4, 0x17, 0xA4, 0x04, 0x01, 0x00, 0xB0, 0x20, 0x00, 0x00,
-	0x00, 0x00, 0x86, 0x00, 0x3B, 0x0D, 0xAA, 0x04, 0x02, 0x00, 0xE8, 0x20,
-	0x00, 0x00, 0x00, 0x00, 0x86, 0x00, 0x95, 0x18, 0xB2, 0x04, 0x03, 0x00,
-	0x9C, 0x22, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x7F, 0x17, 0xC4, 0x04,
-	0x07, 0x00, 0xD4, 0x22, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0xD8, 0x16,
-	0xCB, 0x04, 0x08, 0x00, 0x54, 0x23, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00,
-	0x7C, 0x0B, 0xD4, 0x04, 0x0A, 0x00, 0xBC, 0x23, 0x00, 0x00, 0x00, 0x00,
-	0x81, 0x00, 0x7E, 0x10, 0xAA, 0x04, 0x0B, 0x00, 0x0B, 0x24, 0x00, 0x00,
-	0x00, 0x00, 0xE6, 0x01, 0x1E, 0x0D, 0x06, 0x00, 0x0C, 0x00, 0x1C, 0x24,
-	0x00, 0x00, 0x00, 0x00, 0x91, 0x00, 0x18, 0x11, 0xDB, 0x04, 0x0C, 0x00,
-	0x48, 0x25, 0x00, 0x00, 0x00, 0x00, 0x91, 0x00, 0xC6, 0x0F, 0xE1, 0x04,
-	0x0D, 0x00, 0x68, 0x25, 0x00, 0x00, 0x00, 0x00, 0x91, 0x00, 0x90, 0x0C,
-	0xE7, 0x04, 0x0E, 0x00, 0xAC, 0x25, 0x00, 0x00, 0x00, 0x00, 0x91, 0x00,
-	0x1E, 0x0F, 0xED, 0x04, 0x10, 0x00, 0x04, 0x27, 0x00, 0x00, 0x00, 0x00,
-	0x91, 0x00, 0x26, 0x0D, 0xF5, 0x04, 0x12, 0x00, 0xF0, 0x27, 0x00, 0x00,
-	0x00, 0x00, 0x91, 0x00, 0xF1, 0x15, 0xFF, 0x04, 0x15, 0x00, 0x30, 0x29,
-	0x00, 0x00, 0x00, 0x00, 0x91, 0x00, 0x29, 0x1A, 0xFF, 0x04, 0x17, 0x00,
-	0x78, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x91, 0x00, 0x43, 0x1A, 0xFF, 0x04,
-	0x19, 0x00, 0xC0, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x91, 0x00, 0x81, 0x18,
-	0xFF, 0x04, 0x1B, 0x00, 0x74, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x91, 0x00,
-	0x10, 0x16, 0x0B, 0x05, 0x1D, 0x00, 0xF8, 0x2D, 0x00, 0x00, 0x00, 0x00,
-	0x91, 0x00, 0x48, 0x0C, 0x17, 0x05, 0x1F, 0x00, 0x38, 0x2E, 0x00, 0x00,
-	0x00, 0x00, 0x91, 0x00, 0x03, 0x16, 0x23, 0x05, 0x22, 0x00, 0xD8, 0x2E,
-	0x00, 0x00, 0x00, 0x00, 0x91, 0x00, 0x9A, 0x1A, 0x32, 0x05, 0x27, 0x00,
-	0x85, 0x30, 0x00, 0x00, 0x00, 0x00, 0x86, 0x18, 0xC4, 0x17, 0x06, 0x00,
-	0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x96, 0x20, 0xC2, 0x0B,
-	0x37, 0x05, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x96, 0x20,
-	0x5A, 0x0B, 0x42, 0x05, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
-	0x96, 0x20, 0x95, 0x0B, 0x47, 0x05, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x80, 0x00, 0x96, 0x20, 0xDB, 0x0B, 0x4F, 0x05, 0x34, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x80, 0x00, 0x96, 0x20, 0xB7, 0x0B, 0x54, 0x05, 0x36, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x96, 0x20, 0xE6, 0x0B, 0x5E, 0x05,
-	0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x96, 0x20, 0xBF, 0x10,
-	0x68, 0x05, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x96, 0x20,
-	0xBF, 0x10, 0x77, 0x05, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
-	0x96, 0x20, 0xE5, 0x1A, 0x84, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x80, 0x00, 0x96, 0x20, 0xC0, 0x0B, 0x8A, 0x05, 0x56, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x80, 0x00, 0x96, 0x20, 0xF6, 0x0B, 0xA1, 0x05, 0x61, 0x00,
-	0x8D, 0x30, 0x00, 0x00, 0x00, 0x00, 0x86, 0x18, 0xC4, 0x17, 0x06, 0x00,
-	0x66, 0x00, 0x95, 0x30, 0x00, 0x00, 0x00, 0x00, 0x91, 0x18, 0xCA, 0x17,
-	0xAD, 0x05, 0x66, 0x00, 0xAF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x91, 0x18,
-	0xCA, 0x17, 0xAD, 0x05, 0x66, 0x00, 0xBB, 0x30, 0x00, 0x00, 0x00, 0x00,
-	0x86, 0x18, 0xC4, 0x17, 0x06, 0x00, 0x66, 0x00, 0xC3, 0x30, 0x00, 0x00,
-	0x00, 0x00, 0x83, 0x00, 0x0A, 0x00, 0xB1, 0x05, 0x66, 0x00, 0xCE, 0x30,
-	0x00, 0x00, 0x00, 0x00, 0x83, 0x00, 0x20, 0x00, 0xB7, 0x05, 0x67, 0x00,
-	0xD6, 0x30, 0x00, 0x00, 0x00, 0x00, 0x83, 0x00, 0x91, 0x00, 0xB7, 0x05,
-	0x68, 0x00, 0xDE, 0x30, 0x00, 0x00, 0x00, 0x00, 0x83, 0x00, 0x3B, 0x00,
-	0xBD, 0x05, 0x69, 0x00, 0xEB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x86, 0x18,
-	0xC4, 0x17, 0x06, 0x00, 0x6A, 0x00, 0xF3, 0x30, 0x00, 0x00, 0x00, 0x00,
-	0x83, 0x00, 0x75, 0x00, 0x81, 0x02, 0x6A, 0x00, 0x0C, 0x31, 0x00, 0x00,
-	0x00, 0x00, 0x86, 0x18, 0xC4, 0x17, 0xC3, 0x05, 0x6B, 0x00, 0xE2, 0x31,
-	0x00, 0x00, 0x00, 0x00, 0x86, 0x08, 0xE1, 0x0F, 0xC8, 0x05, 0x6C, 0x00,
-	0xEA, 0x31, 0x00, 0x00, 0x00, 0x00, 0x86, 0x08, 0x3E, 0x11, 0xCC, 0x05,
-	0x6C, 0x00, 0xF2, 0x31, 0x00, 0x00, 0x00, 0x00, 0x86, 0x08, 0x4F, 0x11,
-	0xCC, 0x05, 0x6C, 0x00, 0xFA, 0x31, 0x00, 0x00, 0x00, 0x00, 0x86, 0x08,
-	0xA2, 0x16, 0xD0, 0x05, 0x6C, 0x00, 0x02, 0x32, 0x00, 0x00, 0x00, 0x00,
-	0x86, 0x08, 0xBA, 0x16, 0xD0, 0x05, 0x6C, 0x00, 0x0A, 0x32, 0x00, 0x00,
-	0x00, 0x00, 0x86, 0x08, 0x5C, 0x06, 0x20, 0x01, 0x6C, 0x00, 0x12, 0x32,
-	0x00, 0x00, 0x00, 0x00, 0x86, 0x08, 0x7E, 0x16, 0x20, 0x01, 0x6C, 0x00,
-	0x1A, 0x32, 0x00, 0x00, 0x00, 0x00, 0x86, 0x08, 0xCE, 0x15, 0xC8, 0x05,
-	0x6C, 0x00, 0x22, 0x32, 0x00, 0x00, 0x00, 0x00, 0x86, 0x08, 0x55, 0x16,
-	0xC8, 0x05, 0x6C, 0x00, 0x2A, 0x32, 0x00, 0x00, 0x00, 0x00, 0x86, 0x08,
-	0xF6, 0x08, 0xC8, 0x05, 0x6C, 0x00, 0x32, 0x32, 0x00, 0x00, 0x00, 0x00,
-	0x86, 0x08, 0x15, 0x19, 0xC8, 0x05, 0x6C, 0x00, 0x3A, 0x32, 0x00, 0x00,
-	0x00, 0x00, 0x86, 0x08, 0x2B, 0x0C, 0x8D, 0x00, 0x6C, 0x00, 0x44, 0x32,
-	0x00, 0x00, 0x00, 0x00, 0x86, 0x08, 0x09, 0x17, 0x1C, 0x01, 0x6C, 0x00,
-	0x64, 0x32, 0x00, 0x00, 0x00, 0x00, 0x86, 0x08, 0x0D, 0x0C, 0x1C, 0x01,
-	0x6C, 0x00, 0x81, 0x32, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x00, 0x98, 0x0F,
-	0x8D, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x6F, 0x16, 0x00, 0x00,
-	0x01, 0x00, 0x4E, 0x0D, 0x00, 0x00, 0x01, 0x00, 0x6B, 0x0D, 0x00, 0x00,
-	0x02, 0x00, 0x43, 0x10, 0x02, 0x00, 0x03, 0x00, 0xAA, 0x18, 0x02, 0x00,
-	0x04, 0x00, 0x7C, 0x0D, 0x00, 0x00, 0x01, 0x00, 0x9B, 0x17, 0x00, 0x00,
-	0x01, 0x00, 0x6F, 0x16, 0x02, 0x00, 0x02, 0x00, 0xEF, 0x16, 0x02, 0x00,
-	0x01, 0x00, 0x8A, 0x0B, 0x00, 0x00, 0x01, 0x00, 0x4E, 0x0D, 0x00, 0x00,
-	0x01, 0x00, 0x6D, 0x19, 0x00, 0x00, 0x01, 0x00, 0x6D, 0x19, 0x00, 0x00,
-	0x01, 0x00, 0x18, 0x0C, 0x00, 0x00, 0x02, 0x00, 0xFE, 0x17, 0x00, 0x00,
-	0x01, 0x00, 0x28, 0x0F, 0x00, 0x00, 0x02, 0x00, 0x57, 0x17, 0x00, 0x00,
-	0x01, 0x00, 0x28, 0x0F, 0x00, 0x00, 0x02, 0x00, 0x57, 0x17, 0x00, 0x00,
-	0x03, 0x00, 0x5E, 0x0D, 0x00, 0x00, 0x01, 0x00, 0xB5, 0x18, 0x00, 0x00,
-	0x02, 0x00, 0x57, 0x17, 0x00, 0x00, 0x01, 0x00, 0xB5, 0x18, 0x00, 0x00,
-	0x02, 0x00, 0x57, 0x17, 0x00, 0x00, 0x01, 0x00, 0xB5, 0x18, 0x00, 0x00,
-	0x02, 0x00, 0x57, 0x17, 0x00, 0x00, 0x01, 0x00, 0xB5, 0x18, 0x00, 0x00,
-	0x02, 0x00, 0x57, 0x17, 0x00, 0x00, 0x01, 0x00, 0xB1, 0x19, 0x00, 0x00,
-	0x02, 0x00, 0x1D, 0x16, 0x00, 0x00, 0x01, 0x00, 0xB5, 0x18, 0x00, 0x00,
-	0x02, 0x00, 0xD6, 0x1A, 0x00, 0x00, 0x03, 0x00, 0x6F, 0x1A, 0x00, 0x00,
-	0x01, 0x00, 0xB5, 0x18, 0x00, 0x00, 0x02, 0x00, 0x57, 0x17, 0x00, 0x00,
-	0x03, 0x00, 0xD6, 0x1A, 0x00, 0x00, 0x04, 0x00, 0x00, 0x10, 0x00, 0x00,
-	0x05, 0x00, 0x02, 0x17, 0x00, 0x00, 0x01, 0x00, 0xD9, 0x15, 0x00, 0x00,
-	0x01, 0x00, 0x34, 0x0C, 0x00, 0x00, 0x02, 0x00, 0xD2, 0x19, 0x00, 0x00,
-	0x03, 0x00, 0x17, 0x0B, 0x00, 0x00, 0x04, 0x00, 0x48, 0x19, 0x00, 0x00,
-	0x05, 0x00, 0xA9, 0x15, 0x00, 0x00, 0x06, 0x00, 0x00, 0x19, 0x00, 0x00,
-	0x07, 0x00, 0xCD, 0x0B, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x01, 0x00, 0x1A, 0x1A, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x01, 0x00, 0xF0, 0x0B, 0x02, 0x00, 0x02, 0x00, 0x0F, 0x12, 0x00, 0x20,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x3F, 0x0C, 0x00, 0x20,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xF0, 0x0B, 0x00, 0x00,
-	0x02, 0x00, 0x2A, 0x17, 0x00, 0x00, 0x03, 0x00, 0x05, 0x09, 0x02, 0x00,
-	0x04, 0x00, 0x1A, 0x09, 0x00, 0x00, 0x05, 0x00, 0x42, 0x09, 0x00, 0x20,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xF0, 0x0B, 0x00, 0x00,
-	0x02, 0x00, 0x5D, 0x19, 0x00, 0x00, 0x03, 0x00, 0x88, 0x0D, 0x02, 0x00,
-	0x04, 0x00, 0xFD, 0x10, 0x00, 0x00, 0x05, 0x00, 0x4F, 0x09, 0x00, 0x20,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xD1, 0x0A, 0x00, 0x00,
-	0x02, 0x00, 0xF2, 0x0A, 0x00, 0x00, 0x03, 0x00, 0x1F, 0x17, 0x00, 0x00,
-	0x04, 0x00, 0x55, 0x0F, 0x02, 0x00, 0x05, 0x00, 0x33, 0x17, 0x00, 0x00,
-	0x06, 0x00, 0x63, 0x0F, 0x02, 0x00, 0x07, 0x00, 0x32, 0x09, 0x00, 0x00,
-	0x08, 0x00, 0x42, 0x09, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x01, 0x00, 0xD1, 0x0A, 0x00, 0x00, 0x02, 0x00, 0xF2, 0x0A, 0x00, 0x00,
-	0x03, 0x00, 0x1F, 0x17, 0x00, 0x00, 0x04, 0x00, 0x55, 0x0F, 0x00, 0x00,
-	0x05, 0x00, 0x33, 0x17, 0x00, 0x00, 0x06, 0x00, 0x63, 0x0F, 0x02, 0x00,
-	0x07, 0x00, 0x32, 0x09, 0x00, 0x00, 0x08, 0x00, 0x42, 0x09, 0x00, 0x00,
-	0x01, 0x00, 0xFA, 0x17, 0x00, 0x00, 0x02, 0x00, 0x72, 0x0F, 0x00, 0x00,
-	0x01, 0x00, 0xB0, 0x0B, 0x00, 0x00, 0x02, 0x00, 0xED, 0x19, 0x00, 0x00,
-	0x03, 0x00, 0x37, 0x19, 0x00, 0x00, 0x04, 0x00, 0xFC, 0x19, 0x00, 0x00,
-	0x05, 0x00, 0x3F, 0x0F, 0x00, 0x00, 0x06, 0x00, 0x28, 0x19, 0x00, 0x00,
-	0x07, 0x00, 0xF4, 0x0C, 0x00, 0x00, 0x08, 0x00, 0x97, 0x15, 0x00, 0x00,
-	0x09, 0x00, 0xA3, 0x19, 0x00, 0x00, 0x0A, 0x00, 0x16, 0x17, 0x00, 0x00,
-	0x0B, 0x00, 0xD8, 0x0F, 0x00, 0x00, 0x01, 0x00, 0x4F, 0x0B, 0x00, 0x00,
-	0x02, 0x00, 0x2A, 0x10, 0x00, 0x00, 0x03, 0x00, 0x1F, 0x10, 0x00, 0x00,
-	0x04, 0x00, 0x00, 0x10, 0x00, 0x00, 0x05, 0x00, 0x21, 0x12, 0x00, 0x00,
-	0x01, 0x00, 0xCF, 0x0A, 0x00, 0x00, 0x01, 0x00, 0x75, 0x0F, 0x00, 0x00,
-	0x01, 0x00, 0x75, 0x0F, 0x00, 0x00, 0x01, 0x00, 0x75, 0x0F, 0x00, 0x00,
-	0x01, 0x00, 0xE7, 0x10, 0x00, 0x00, 0x01, 0x00, 0xC2, 0x0A, 0x02, 0x00,
-	0x45, 0x00, 0x09, 0x00, 0xC4, 0x17, 0x01, 0x00, 0x11, 0x00, 0xC4, 0x17,
-	0x06, 0x00, 0x19, 0x00, 0xC4, 0x17, 0x0A, 0x00, 0x29, 0x00, 0xC4, 0x17,
-	0x10, 0x00, 0x31, 0x00, 0xC4, 0x17, 0x10, 0x00, 0x39, 0x00, 0xC4, 0x17,
-	0x10, 0x00, 0x41, 0x00, 0xC4, 0x17, 0x10, 0x00, 0x49, 0x00, 0xC4, 0x17,
-	0x10, 0x00, 0x51, 0x00, 0xC4, 0x17, 0x10, 0x00, 0x59, 0x00, 0xC4, 0x17,
-	0x10, 0x00, 0x61, 0x00, 0xC4, 0x17, 0x15, 0x00, 0x69, 0x00, 0xC4, 0x17,
-	0x10, 0x00, 0x71, 0x00, 0xC4, 0x17, 0x10, 0x00, 0x79, 0x00, 0xC4, 0x17,
-	0x10, 0x00, 0xD9, 0x00, 0xC4, 0x17, 0x06, 0x00, 0x81, 0x00, 0xC4, 0x17,
-	0x06, 0x00, 0x01, 0x01, 0x79, 0x16, 0x20, 0x00, 0x09, 0x01, 0xC4, 0x17,
-	0x01, 0x00, 0x01, 0x01, 0xD0, 0x00, 0x28, 0x00, 0xC9, 0x00, 0xCA, 0x1A,
-	0x3F, 0x00, 0x0C, 0x00, 0xC4, 0x17, 0x06, 0x00, 0x11, 0x01, 0x4E, 0x10,
-	0x4B, 0x00, 0x11, 0x01, 0x77, 0x0F, 0x50, 0x00, 0x11, 0x01, 0xE4, 0x17,
-	0x5C, 0x00, 0x01, 0x01, 0xC4, 0x17, 0x01, 0x00, 0x0C, 0x00, 0x2E, 0x09,
-	0x65, 0x00, 0x01, 0x01, 0xC4, 0x17, 0x6B, 0x00, 0x11, 0x01, 0x6D, 0x17,
-	0x70, 0x00, 0x11, 0x01, 0xF3, 0x00, 0x74, 0x00, 0x11, 0x01, 0xFD, 0x00,
-	0x7A, 0x00, 0x11, 0x01, 0x5B, 0x10, 0x80, 0x00, 0x91, 0x00, 0x2B, 0x0C,
-	0x8D, 0x00, 0x19, 0x01, 0x0C, 0x1A, 0x91, 0x00, 0x19, 0x01, 0xBA, 0x0A,
-	0x9D, 0x00, 0xA9, 0x00, 0xA8, 0x1A, 0xC2, 0x00, 0xB1, 0x00, 0xC4, 0x17,
-	0x10, 0x00, 0x91, 0x00, 0x63, 0x19, 0xC7, 0x00, 0x14, 0x00, 0xC4, 0x17,
-	0xD5, 0x00, 0x29, 0x01, 0xFA, 0x0C, 0xDB, 0x00, 0x1C, 0x00, 0xB6, 0x17,
-	0x01, 0x01, 0x24, 0x00, 0x59, 0x1A, 0x11, 0x01, 0x39, 0x01, 0xC0, 0x0C,
-	0x10, 0x00, 0x19, 0x01, 0xC4, 0x17, 0x16, 0x01, 0x39, 0x01, 0xC0, 0x0C,
-	0x06, 0x00, 0x41, 0x01, 0x91, 0x1A, 0x1C, 0x01, 0x89, 0x00, 0x1E, 0x0D,
-	0x06, 0x00, 0xA9, 0x00, 0x8C, 0x16, 0x06, 0x00, 0xA9, 0x00, 0x1B, 0x18,
-	0x20, 0x01, 0x49, 0x01, 0xC0, 0x0C, 0x24, 0x01, 0x51, 0x01, 0x75, 0x1A,
-	0x29, 0x01, 0xC1, 0x00, 0x23, 0x0B, 0x8D, 0x00, 0x59, 0x01, 0x27, 0x11,
-	0x31, 0x01, 0x59, 0x01, 0xF0, 0x1A, 0x8D, 0x00, 0x61, 0x01, 0xCA, 0x0C,
-	0x91, 0x00, 0x69, 0x01, 0xBD, 0x18, 0x3F, 0x01, 0x29, 0x01, 0x82, 0x1A,
-	0x45, 0x01, 0x19, 0x01, 0x13, 0x1A, 0x5A, 0x01, 0x2C, 0x00, 0x7B, 0x1A,
-	0x66, 0x01, 0x19, 0x01, 0x19, 0x1B, 0x6D, 0x01, 0x69, 0x01, 0xCA, 0x18,
-	0x70, 0x01, 0x19, 0x01, 0x13, 0x1A, 0x96, 0x01, 0x0C, 0x00, 0x65, 0x1A,
-	0x28, 0x00, 0x29, 0x01, 0xE1, 0x1A, 0xA2, 0x01, 0x34, 0x00, 0xC4, 0x17,
-	0xD5, 0x00, 0x29, 0x01, 0x14, 0x11, 0xB6, 0x01, 0xC9, 0x00, 0x5F, 0x0C,
-	0xC9, 0x01, 0x29, 0x01, 0xD2, 0x1A, 0xB6, 0x01, 0x19, 0x01, 0x0C, 0x1A,
-	0xCF, 0x01, 0x2C, 0x00, 0xC4, 0x17, 0x06, 0x00, 0x0C, 0x00, 0xD7, 0x10,
-	0xE9, 0x01, 0x2C, 0x00, 0x2E, 0x09, 0x65, 0x00, 0x0C, 0x00, 0x2F, 0x0B,
-	0xF7, 0x01, 0x44, 0x00, 0xC4, 0x17, 0xD5, 0x00, 0x29, 0x01, 0x22, 0x1A,
-	0x0A, 0x02, 0x2C, 0x00, 0x65, 0x1A, 0x28, 0x00, 0x4C, 0x00, 0xC4, 0x17,
-	0xD5, 0x00, 0x29, 0x01, 0xA4, 0x10, 0x46, 0x02, 0x19, 0x01, 0x80, 0x19,
-	0x5E, 0x02, 0x19, 0x01, 0x39, 0x11, 0x70, 0x02, 0x91, 0x00, 0xDC, 0x0C,
-	0x7B, 0x02, 0x2C, 0x00, 0xD7, 0x10, 0xE9, 0x01, 0x19, 0x01, 0x87, 0x19,
-	0x81, 0x02, 0x11, 0x01, 0xC6, 0x00, 0x8B, 0x02, 0x11, 0x01, 0x08, 0x01,
-	0x90, 0x02, 0x11, 0x01, 0xC6, 0x00, 0x96, 0x02, 0x11, 0x01, 0x07, 0x10,
-	0x9C, 0x02, 0x08, 0x00, 0x14, 0x00, 0xAF, 0x02, 0x09, 0x00, 0x18, 0x00,
-	0xB4, 0x02, 0x09, 0x00, 0x1C, 0x00, 0xB9, 0x02, 0x09, 0x00, 0x20, 0x00,
-	0xBE, 0x02, 0x09, 0x00, 0x24, 0x00, 0xC3, 0x02, 0x09, 0x00, 0x28, 0x00,
-	0xC8, 0x02, 0x09, 0x00, 0x2C, 0x00, 0xBE, 0x02, 0x09, 0x00, 0x30, 0x00,
-	0xC3, 0x02, 0x09, 0x00, 0x34, 0x00, 0xCD, 0x02, 0x09, 0x00, 0x38, 0x00,
-	0xD2, 0x02, 0x09, 0x00, 0x3C, 0x00, 0xD7, 0x02, 0x09, 0x00, 0x40, 0x00,
-	0xDC, 0x02, 0x09, 0x00, 0x44, 0x00, 0xE1, 0x02, 0x09, 0x00, 0x48, 0x00,
-	0xE6, 0x02, 0x09, 0x00, 0x4C, 0x00, 0xEB, 0x02, 0x09, 0x00, 0x50, 0x00,
-	0xF0, 0x02, 0x09, 0x00, 0x54, 0x00, 0xBE, 0x02, 0x09, 0x00, 0x58, 0x00,
-	0xF5, 0x02, 0x09, 0x00, 0x5C, 0x00, 0xE6, 0x02, 0x09, 0x00, 0x60, 0x00,
-	0xCD, 0x02, 0x09, 0x00, 0x64, 0x00, 0xFA, 0x02, 0x09, 0x00, 0x68, 0x00,
-	0xFA, 0x02, 0x09, 0x00, 0x6C, 0x00, 0xBE, 0x02, 0x09, 0x00, 0x70, 0x00,
-	0xC3, 0x02, 0x09, 0x00, 0x74, 0x00, 0xD2, 0x02, 0x09, 0x00, 0x78, 0x00,
-	0xC8, 0x02, 0x09, 0x00, 0x7C, 0x00, 0xFF, 0x02, 0x09, 0x00, 0x80, 0x00,
-	0xF5, 0x02, 0x09, 0x00, 0x84, 0x00, 0x04, 0x03, 0x09, 0x00, 0x88, 0x00,
-	0x09, 0x03, 0x09, 0x00, 0x8C, 0x00, 0x0E, 0x03, 0x09, 0x00, 0x90, 0x00,
-	0x13, 0x03, 0x09, 0x00, 0x94, 0x00, 0x18, 0x03, 0x09, 0x00, 0x98, 0x00,
-	0xF0, 0x02, 0x09, 0x00, 0x9C, 0x00, 0xEB, 0x02, 0x09, 0x00, 0xA0, 0x00,
-	0x1D, 0x03, 0x09, 0x00, 0xA4, 0x00, 0x22, 0x03, 0x09, 0x00, 0xA8, 0x00,
-	0x27, 0x03, 0x09, 0x00, 0xAC, 0x00, 0x2C, 0x03, 0x09, 0x00, 0xB0, 0x00,
-	0x31, 0x03, 0x09, 0x00, 0xB4, 0x00, 0x36, 0x03, 0x09, 0x00, 0xB8, 0x00,
-	0x3B, 0x03, 0x09, 0x00, 0xBC, 0x00, 0xB4, 0x02, 0x09, 0x00, 0xCC, 0x00,
-	0x40, 0x03, 0x09, 0x00, 0xD0, 0x00, 0x45, 0x03, 0x09, 0x00, 0xD4, 0x00,
-	0x4A, 0x03, 0x09, 0x00, 0xD8, 0x00, 0x4F, 0x03, 0x09, 0x00, 0xDC, 0x00,
-	0x54, 0x03, 0x09, 0x00, 0xE0, 0x00, 0x59, 0x03, 0x08, 0x00, 0xE8, 0x00,
-	0xAF, 0x02, 0x08, 0x00, 0xEC, 0x00, 0xFA, 0x02, 0x08, 0x00, 0xF0, 0x00,
-	0xBE, 0x02, 0x08, 0x00, 0xF4, 0x00, 0xC3, 0x02, 0x08, 0x00, 0xF8, 0x00,
-	0xCD, 0x02, 0x08, 0x00, 0xFC, 0x00, 0xD2, 0x02, 0x08, 0x00, 0x00, 0x01,
-	0xD7, 0x02, 0x08, 0x00, 0x04, 0x01, 0x5E, 0x03, 0x08, 0x00, 0x08, 0x01,
-	0x63, 0x03, 0x08, 0x00, 0x0C, 0x01, 0x68, 0x03, 0x08, 0x00, 0x10, 0x01,
-	0x6D, 0x03, 0x08, 0x00, 0x14, 0x01, 0x72, 0x03, 0x08, 0x00, 0x18, 0x01,
-	0x77, 0x03, 0x08, 0x00, 0x1C, 0x01, 0x7C, 0x03, 0x08, 0x00, 0x20, 0x01,
-	0x81, 0x03, 0x08, 0x00, 0x24, 0x01, 0x86, 0x03, 0x08, 0x00, 0x28, 0x01,
-	0x8B, 0x03, 0x08, 0x00, 0x2C, 0x01, 0x90, 0x03, 0x08, 0x00, 0x30, 0x01,
-	0x95, 0x03, 0x08, 0x00, 0x34, 0x01, 0x9A, 0x03, 0x08, 0x00, 0x5C, 0x01,
-	0xAF, 0x02, 0x08, 0x00, 0x60, 0x01, 0xFA, 0x02, 0x08, 0x00, 0x64, 0x01,
-	0xBE, 0x02, 0x08, 0x00, 0x68, 0x01, 0xC3, 0x02, 0x08, 0x00, 0x6C, 0x01,
-	0xCD, 0x02, 0x08, 0x00, 0x70, 0x01, 0xD2, 0x02, 0x08, 0x00, 0x74, 0x01,
-	0xD7, 0x02, 0x08, 0x00, 0x78, 0x01, 0x5E, 0x03, 0x08, 0x00, 0x7C, 0x01,
-	0x63, 0x03, 0x08, 0x00, 0x80, 0x01, 0x68, 0x03, 0x08, 0x00, 0x84, 0x01,
-	0x6D, 0x03, 0x08, 0x00, 0x88, 0x01, 0x72, 0x03, 0x08, 0x00, 0x8C, 0x01,
-	0x77, 0x03, 0x08, 0x00, 0x90, 0x01, 0x7C, 0x03, 0x08, 0x00, 0x94, 0x01,
-	0x81, 0x03, 0x08, 0x00, 0x98, 0x01, 0x86, 0x03, 0x08, 0x00, 0xA0, 0x01,
-	0xBE, 0x02, 0x08, 0x00, 0xA4, 0x01, 0xC3, 0x02, 0x08, 0x00, 0xA8, 0x01,
-	0xCD, 0x02, 0x08, 0x00, 0xAC, 0x01, 0xD2, 0x02, 0x08, 0x00, 0xB0, 0x01,
-	0xD7, 0x02, 0x08, 0x00, 0xB4, 0x01, 0x5E, 0x03, 0x08, 0x00, 0xB8, 0x01,
-	0x9F, 0x03, 0x08, 0x00, 0xBC, 0x01, 0xA4, 0x03, 0x08, 0x00, 0xC0, 0x01,
-	0xE6, 0x02, 0x08, 0x00, 0xC4, 0x01, 0xA9, 0x03, 0x08, 0x00, 0xC8, 0x01,
-	0xAE, 0x03, 0x08, 0x00, 0xCC, 0x01, 0xB3, 0x03, 0x08, 0x00, 0xD0, 0x01,
-	0x63, 0x03, 0x08, 0x00, 0xD4, 0x01, 0xB8, 0x03, 0x08, 0x00, 0xD8, 0x01,
-	0xBD, 0x03, 0x08, 0x00, 0xDC, 0x01, 0xC8, 0x02, 0x08, 0x00, 0xE0, 0x01,
-	0xC2, 0x03, 0x08, 0x00, 0xE4, 0x01, 0xC7, 0x03, 0x08, 0x00, 0xE8, 0x01,
-	0xCC, 0x03, 0x08, 0x00, 0xEC, 0x01, 0xD1, 0x03, 0x08, 0x00, 0xF0, 0x01,
-	0xD6, 0x03, 0x08, 0x00, 0xF4, 0x01, 0xDB, 0x03, 0x08, 0x00, 0xF8, 0x01,
-	0xE0, 0x03, 0x08, 0x00, 0xFC, 0x01, 0xE5, 0x03, 0x08, 0x00, 0x00, 0x02,
-	0xEA, 0x03, 0x08, 0x00, 0x04, 0x02, 0xEF, 0x03, 0x08, 0x00, 0x08, 0x02,
-	0xF4, 0x03, 0x08, 0x00, 0x0C, 0x02, 0xF9, 0x03, 0x08, 0x00, 0x10, 0x02,
-	0xFE, 0x03, 0x08, 0x00, 0x14, 0x02, 0x03, 0x04, 0x08, 0x00, 0x18, 0x02,
-	0x08, 0x04, 0x08, 0x00, 0x1C, 0x02, 0xFF, 0x02, 0x08, 0x00, 0x20, 0x02,
-	0x0D, 0x04, 0x08, 0x00, 0x24, 0x02, 0x12, 0x04, 0x08, 0x00, 0x28, 0x02,
-	0x17, 0x04, 0x08, 0x00, 0x2C, 0x02, 0x1C, 0x04, 0x08, 0x00, 0x30, 0x02,
-	0x21, 0x04, 0x08, 0x00, 0x34, 0x02, 0x68, 0x03, 0x08, 0x00, 0x38, 0x02,
-	0x26, 0x04, 0x08, 0x00, 0x3C, 0x02, 0x2B, 0x04, 0x08, 0x00, 0x40, 0x02,
-	0x30, 0x04, 0x08, 0x00, 0x88, 0x02, 0xA4, 0x03, 0x08, 0x00, 0x8C, 0x02,
-	0xA4, 0x03, 0x08, 0x00, 0x90, 0x02, 0xA4, 0x03, 0x08, 0x00, 0x94, 0x02,
-	0xD2, 0x02, 0x08, 0x00, 0x98, 0x02, 0xC3, 0x02, 0x08, 0x00, 0x9C, 0x02,
-	0xFA, 0x02, 0x08, 0x00, 0xA0, 0x02, 0xD2, 0x02, 0x08, 0x00, 0xA4, 0x02,
-	0x5E, 0x03, 0x08, 0x00, 0xA8, 0x02, 0xA4, 0x03, 0x08, 0x00, 0xAC, 0x02,
-	0xC8, 0x02, 0x08, 0x00, 0xB0, 0x02, 0xE5, 0x03, 0x08, 0x00, 0xB4, 0x02,
-	0xFF, 0x02, 0x08, 0x00, 0xB8, 0x02, 0x2B, 0x04, 0x08, 0x00, 0xBC, 0x02,
-	0x35, 0x04, 0x08, 0x00, 0xC0, 0x02, 0x3A, 0x04, 0x08, 0x00, 0xC4, 0x02,
-	0x3F, 0x04, 0x08, 0x00, 0xC8, 0x02, 0x44, 0x04, 0x08, 0x00, 0xCC, 0x02,
-	0x49, 0x04, 0x2E, 0x00, 0x0B, 0x00, 0xEC, 0x05, 0x2E, 0x00, 0x13, 0x00,
-	0xF5, 0x05, 0x2E, 0x00, 0x1B, 0x00, 0x14, 0x06, 0x2E, 0x00, 0x23, 0x00,
-	0x1D, 0x06, 0x2E, 0x00, 0x2B, 0x00, 0x2F, 0x06, 0x2E, 0x00, 0x33, 0x00,
-	0x2F, 0x06, 0x2E, 0x00, 0x3B, 0x00, 0x2F, 0x06, 0x2E, 0x00, 0x43, 0x00,
-	0x1D, 0x06, 0x2E, 0x00, 0x4B, 0x00, 0x35, 0x06, 0x2E, 0x00, 0x53, 0x00,
-	0x2F, 0x06, 0x2E, 0x00, 0x5B, 0x00, 0x2F, 0x06, 0x2E, 0x00, 0x63, 0x00,
-	0x4D, 0x06, 0x2E, 0x00, 0x6B, 0x00, 0x77, 0x06, 0x2E, 0x00, 0x73, 0x00,
-	0x84, 0x06, 0xC3, 0x00, 0x7B, 0x00, 0xBE, 0x02, 0xE3, 0x00, 0x7B, 0x00,
-	0xBE, 0x02, 0xA0, 0x05, 0x7B, 0x00, 0xBE, 0x02, 0xC0, 0x05, 0x7B, 0x00,
-	0xBE, 0x02, 0xE0, 0x05, 0x7B, 0x00, 0xBE, 0x02, 0x00, 0x06, 0x7B, 0x00,
-	0xBE, 0x02, 0x20, 0x06, 0x7B, 0x00, 0xBE, 0x02, 0x40, 0x06, 0x7B, 0x00,
-	0xBE, 0x02, 0x60, 0x06, 0x7B, 0x00, 0xBE, 0x02, 0x80, 0x06, 0x7B, 0x00,
-	0xBE, 0x02, 0xA0, 0x06, 0x7B, 0x00, 0xBE, 0x02, 0xC0, 0x06, 0x7B, 0x00,
-	0xBE, 0x02, 0xE0, 0x06, 0x7B, 0x00, 0xBE, 0x02, 0x00, 0x07, 0x7B, 0x00,
-	0xBE, 0x02, 0x81, 0x16, 0x7B, 0x00, 0xBE, 0x02, 0xA1, 0x16, 0x7B, 0x00,
-	0xBE, 0x02, 0xC1, 0x16, 0x7B, 0x00, 0xBE, 0x02, 0xE1, 0x16, 0x7B, 0x00,
-	0xBE, 0x02, 0x01, 0x17, 0x7B, 0x00, 0xBE, 0x02, 0x21, 0x17, 0x7B, 0x00,
-	0xBE, 0x02, 0x41, 0x17, 0x7B, 0x00, 0xBE, 0x02, 0x61, 0x17, 0x7B, 0x00,
-	0xBE, 0x02, 0x81, 0x17, 0x7B, 0x00, 0xBE, 0x02, 0xA1, 0x17, 0x7B, 0x00,
-	0xBE, 0x02, 0xC1, 0x17, 0x7B, 0x00, 0xBE, 0x02, 0xE1, 0x17, 0x7B, 0x00,
-	0xBE, 0x02, 0x5F, 0x00, 0x4E, 0x04, 0x63, 0x00, 0x4E, 0x04, 0x69, 0x00,
-	0x4E, 0x04, 0x6D, 0x00, 0x4E, 0x04, 0x79, 0x00, 0x4E, 0x04, 0x85, 0x00,
-	0x4E, 0x04, 0x97, 0x00, 0x4E, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x0A, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x01, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x0E, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x01, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1A, 0x00, 0x23, 0x00, 0x2C, 0x00,
-	0x85, 0x00, 0x97, 0x00, 0xA3, 0x00, 0xAF, 0x00, 0x37, 0x01, 0x7B, 0x01,
-	0xD6, 0x01, 0xEF, 0x01, 0x2A, 0x02, 0x33, 0x02, 0x59, 0x02, 0x67, 0x02,
-	0x86, 0x02, 0xA2, 0x02, 0x0C, 0x00, 0x01, 0x00, 0x00, 0x00, 0xE5, 0x0F,
-	0xD4, 0x05, 0x00, 0x00, 0x42, 0x11, 0xD8, 0x05, 0x00, 0x00, 0x53, 0x11,
-	0xD8, 0x05, 0x00, 0x00, 0xC4, 0x16, 0xDC, 0x05, 0x00, 0x00, 0xBE, 0x16,
-	0xDC, 0x05, 0x00, 0x00, 0x60, 0x06, 0xE0, 0x05, 0x00, 0x00, 0x82, 0x16,
-	0xE0, 0x05, 0x00, 0x00, 0xD2, 0x15, 0xD4, 0x05, 0x00, 0x00, 0x59, 0x16,
-	0xD4, 0x05, 0x00, 0x00, 0xFA, 0x08, 0xD4, 0x05, 0x00, 0x00, 0x19, 0x19,
-	0xD4, 0x05, 0x00, 0x00, 0x5A, 0x0C, 0xE4, 0x05, 0x00, 0x00, 0x0D, 0x17,
-	0xE8, 0x05, 0x00, 0x00, 0x11, 0x0C, 0xE8, 0x05, 0x02, 0x00, 0x2D, 0x00,
-	0x03, 0x00, 0x02, 0x00, 0x2E, 0x00, 0x05, 0x00, 0x02, 0x00, 0x2F, 0x00,
-	0x07, 0x00, 0x02, 0x00, 0x30, 0x00, 0x09, 0x00, 0x02, 0x00, 0x31, 0x00,
-	0x0B, 0x00, 0x02, 0x00, 0x32, 0x00, 0x0D, 0x00, 0x02, 0x00, 0x33, 0x00,
-	0x0F, 0x00, 0x02, 0x00, 0x34, 0x00, 0x11, 0x00, 0x02, 0x00, 0x35, 0x00,
-	0x13, 0x00, 0x02, 0x00, 0x36, 0x00, 0x15, 0x00, 0x02, 0x00, 0x37, 0x00,
-	0x17, 0x00, 0x02, 0x00, 0x38, 0x00, 0x19, 0x00, 0x02, 0x00, 0x39, 0x00,
-	0x1B, 0x00, 0x02, 0x00, 0x3A, 0x00, 0x1D, 0x00, 0xA8, 0x10, 0xB5, 0x10,
-	0x44, 0x00, 0xCD, 0x00, 0xF9, 0x00, 0x0A, 0x01, 0x60, 0x01, 0xAE, 0x01,
-	0xE6, 0x01, 0x02, 0x02, 0x3F, 0x02, 0x40, 0x01, 0x2F, 0x00, 0xC2, 0x0B,
-	0x01, 0x00, 0x40, 0x01, 0x31, 0x00, 0x5A, 0x0B, 0x01, 0x00, 0x40, 0x01,
-	0x33, 0x00, 0x95, 0x0B, 0x01, 0x00, 0x40, 0x01, 0x35, 0x00, 0xDB, 0x0B,
-	0x01, 0x00, 0x00, 0x01, 0x37, 0x00, 0xB7, 0x0B, 0x01, 0x00, 0x44, 0x01,
-	0x39, 0x00, 0xE6, 0x0B, 0x01, 0x00, 0x47, 0x01, 0x3B, 0x00, 0xBF, 0x10,
-	0x01, 0x00, 0x47, 0x01, 0x3D, 0x00, 0xBF, 0x10, 0x01, 0x00, 0x00, 0x01,
-	0x3F, 0x00, 0xE5, 0x1A, 0x01, 0x00, 0x41, 0x01, 0x41, 0x00, 0xC0, 0x0B,
-	0x02, 0x00, 0x41, 0x01, 0x43, 0x00, 0xF6, 0x0B, 0x02, 0x00, 0x04, 0x80,
-	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0x02, 0xC1, 0x08,
-	0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xA6, 0x02, 0xE0, 0x10, 0x00, 0x00, 0x00, 0x00,
-	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xA6, 0x02, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x02, 0x00,
-	0x06, 0x00, 0x03, 0x00, 0x07, 0x00, 0x03, 0x00, 0x08, 0x00, 0x04, 0x00,
-	0x09, 0x00, 0x04, 0x00, 0x0A, 0x00, 0x04, 0x00, 0x0B, 0x00, 0x04, 0x00,
-	0x0C, 0x00, 0x04, 0x00, 0x0D, 0x00, 0x04, 0x00, 0x0E, 0x00, 0x04, 0x00,
-	0x0F, 0x00, 0x04, 0x00, 0x10, 0x00, 0x04, 0x00, 0x2F, 0x00, 0x57, 0x00,
-	0x31, 0x00, 0x57, 0x00, 0x2F, 0x00, 0xAA, 0x00, 0x4F, 0x00, 0xF4, 0x00,
-	0x71, 0x00, 0x56, 0x01, 0x71, 0x00, 0x9D, 0x01, 0x7F, 0x00, 0x9D, 0x01,
-	0x83, 0x00, 0x9D, 0x01, 0x87, 0x00, 0x9D, 0x01, 0x95, 0x00, 0x24, 0x02,
-	0x9B, 0x00, 0x56, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x3E, 0x39,
-	0x5F, 0x5F, 0x30, 0x5F, 0x30, 0x00, 0x3C, 0x4D, 0x61, 0x69, 0x6E, 0x3E,
-	0x62, 0x5F, 0x5F, 0x30, 0x5F, 0x30, 0x00, 0x3C, 0x3E, 0x39, 0x5F, 0x5F,
-	0x33, 0x5F, 0x30, 0x00, 0x3C, 0x53, 0x63, 0x61, 0x6E, 0x44, 0x72, 0x69,
-	0x76, 0x65, 0x3E, 0x62, 0x5F, 0x5F, 0x33, 0x5F, 0x30, 0x00, 0x3C, 0x3E,
-	0x39, 0x5F, 0x5F, 0x37, 0x5F, 0x30, 0x00, 0x3C, 0x44, 0x65, 0x74, 0x65,
-	0x63, 0x74, 0x43, 0x6F, 0x70, 0x79, 0x52, 0x65, 0x70, 0x6C, 0x61, 0x63,
-	0x65, 0x6D, 0x65, 0x6E, 0x74, 0x3E, 0x62, 0x5F, 0x5F, 0x37, 0x5F, 0x30,
-	0x00, 0x3C, 0x3E, 0x63, 0x5F, 0x5F, 0x44, 0x69, 0x73, 0x70, 0x6C, 0x61,
-	0x79, 0x43, 0x6C, 0x61, 0x73, 0x73, 0x39, 0x5F, 0x30, 0x00, 0x3C, 0x3E,
-	0x39, 0x5F, 0x5F, 0x30, 0x00, 0x3C, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x50,
-	0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x3E, 0x62, 0x5F, 0x5F, 0x30, 0x00,
-	0x3C, 0x3E, 0x39, 0x5F, 0x5F, 0x33, 0x5F, 0x31, 0x00, 0x3C, 0x53, 0x63,
-	0x61, 0x6E, 0x44, 0x72, 0x69, 0x76, 0x65, 0x3E, 0x62, 0x5F, 0x5F, 0x33,
-	0x5F, 0x31, 0x00, 0x49, 0x45, 0x6E, 0x75, 0x6D, 0x65, 0x72, 0x61, 0x62,
-	0x6C, 0x65, 0x60, 0x31, 0x00, 0x49, 0x45, 0x6E, 0x75, 0x6D, 0x65, 0x72,
-	0x61, 0x74, 0x6F, 0x72, 0x60, 0x31, 0x00, 0x4C, 0x69, 0x73, 0x74, 0x60,
-	0x31, 0x00, 0x52, 0x65, 0x61, 0x64, 0x49, 0x6E, 0x74, 0x33, 0x32, 0x00,
-	0x54, 0x6F, 0x49, 0x6E, 0x74, 0x33, 0x32, 0x00, 0x46, 0x75, 0x6E, 0x63,
-	0x60, 0x32, 0x00, 0x43, 0x6F, 0x6E, 0x73, 0x6F, 0x6C, 0x65, 0x41, 0x70,
-	0x70, 0x31, 0x34, 0x00, 0x55, 0x49, 0x6E, 0x74, 0x36, 0x34, 0x00, 0x52,
-	0x65, 0x61, 0x64, 0x49, 0x6E, 0x74, 0x36, 0x34, 0x00, 0x57, 0x72, 0x69,
-	0x74, 0x65, 0x49, 0x6E, 0x74, 0x36, 0x34, 0x00, 0x52, 0x65, 0x61, 0x64,
-	0x49, 0x6E, 0x74, 0x31, 0x36, 0x00, 0x3C, 0x3E, 0x39, 0x00, 0x3C, 0x4D,
-	0x6F, 0x64, 0x75, 0x6C, 0x65, 0x3E, 0x00, 0x45, 0x52, 0x52, 0x4F, 0x52,
-	0x5F, 0x49, 0x4E, 0x56, 0x41, 0x4C, 0x49, 0x44, 0x5F, 0x44, 0x41, 0x54,
-	0x41, 0x00, 0x52, 0x45, 0x41, 0x44, 0x5F, 0x55, 0x53, 0x4E, 0x5F, 0x4A,
-	0x4F, 0x55, 0x52, 0x4E, 0x41, 0x4C, 0x5F, 0x44, 0x41, 0x54, 0x41, 0x00,
-	0x46, 0x53, 0x43, 0x54, 0x4C, 0x5F, 0x45, 0x4E, 0x55, 0x4D, 0x5F, 0x55,
-	0x53, 0x4E, 0x5F, 0x44, 0x41, 0x54, 0x41, 0x00, 0x47, 0x45, 0x4E, 0x45,
-	0x52, 0x49, 0x43, 0x5F, 0x52, 0x45, 0x41, 0x44, 0x00, 0x46, 0x49, 0x4C,
-	0x45, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x5F, 0x52, 0x45, 0x41, 0x44,
-	0x00, 0x45, 0x52, 0x52, 0x4F, 0x52, 0x5F, 0x41, 0x43, 0x43, 0x45, 0x53,
-	0x53, 0x5F, 0x44, 0x45, 0x4E, 0x49, 0x45, 0x44, 0x00, 0x4D, 0x45, 0x54,
-	0x48, 0x4F, 0x44, 0x5F, 0x42, 0x55, 0x46, 0x46, 0x45, 0x52, 0x45, 0x44,
-	0x00, 0x57, 0x53, 0x5F, 0x45, 0x58, 0x5F, 0x4C, 0x41, 0x59, 0x45, 0x52,
-	0x45, 0x44, 0x00, 0x45, 0x52, 0x52, 0x4F, 0x52, 0x5F, 0x4A, 0x4F, 0x55,
-	0x52, 0x4E, 0x41, 0x4C, 0x5F, 0x45, 0x4E, 0x54, 0x52, 0x59, 0x5F, 0x44,
-	0x45, 0x4C, 0x45, 0x54, 0x45, 0x44, 0x00, 0x45, 0x52, 0x52, 0x4F, 0x52,
-	0x5F, 0x4E, 0x4F, 0x54, 0x5F, 0x53, 0x55, 0x50, 0x50, 0x4F, 0x52, 0x54,
-	0x45, 0x44, 0x00, 0x55, 0x53, 0x4E, 0x5F, 0x4A, 0x4F, 0x55, 0x52, 0x4E,
-	0x41, 0x4C, 0x5F, 0x49, 0x4E, 0x56, 0x41, 0x4C, 0x49, 0x44, 0x00, 0x46,
-	0x49, 0x4C, 0x45, 0x5F, 0x4F, 0x50, 0x45, 0x4E, 0x5F, 0x42, 0x59, 0x5F,
-	0x46, 0x49, 0x4C, 0x45, 0x5F, 0x49, 0x44, 0x00, 0x46, 0x53, 0x43, 0x54,
-	0x4C, 0x5F, 0x47, 0x45, 0x54, 0x5F, 0x4F, 0x42, 0x4A, 0x45, 0x43, 0x54,
-	0x5F, 0x49, 0x44, 0x00, 0x55, 0x73, 0x6E, 0x4A, 0x6F, 0x75, 0x72, 0x6E,
-	0x61, 0x6C, 0x49, 0x44, 0x00, 0x55, 0x53, 0x4E, 0x5F, 0x52, 0x45, 0x41,
-	0x53, 0x4F, 0x4E, 0x5F, 0x4E, 0x41, 0x4D, 0x45, 0x44, 0x5F, 0x44, 0x41,
-	0x54, 0x41, 0x5F, 0x45, 0x58, 0x54, 0x45, 0x4E, 0x44, 0x00, 0x55, 0x53,
-	0x4E, 0x5F, 0x52, 0x45, 0x41, 0x53, 0x4F, 0x4E, 0x5F, 0x44, 0x41, 0x54,
-	0x41, 0x5F, 0x45, 0x58, 0x54, 0x45, 0x4E, 0x44, 0x00, 0x45, 0x52, 0x52,
-	0x4F, 0x52, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x5F, 0x4E, 0x4F, 0x54, 0x5F,
-	0x46, 0x4F, 0x55, 0x4E, 0x44, 0x00, 0x45, 0x52, 0x52, 0x4F, 0x52, 0x5F,
-	0x50, 0x41, 0x54, 0x48, 0x5F, 0x4E, 0x4F, 0x54, 0x5F, 0x46, 0x4F, 0x55,
-	0x4E, 0x44, 0x00, 0x44, 0x57, 0x4F, 0x52, 0x44, 0x00, 0x55, 0x53, 0x4E,
-	0x5F, 0x52, 0x45, 0x41, 0x53, 0x4F, 0x4E, 0x5F, 0x45, 0x41, 0x5F, 0x43,
-	0x48, 0x41, 0x4E, 0x47, 0x45, 0x00, 0x55, 0x53, 0x4E, 0x5F, 0x52, 0x45,
-	0x41, 0x53, 0x4F, 0x4E, 0x5F, 0x4F, 0x42, 0x4A, 0x45, 0x43, 0x54, 0x5F,
-	0x49, 0x44, 0x5F, 0x43, 0x48, 0x41, 0x4E, 0x47, 0x45, 0x00, 0x55, 0x53,
-	0x4E, 0x5F, 0x52, 0x45, 0x41, 0x53, 0x4F, 0x4E, 0x5F, 0x49, 0x4E, 0x44,
-	0x45, 0x58, 0x41, 0x42, 0x4C, 0x45, 0x5F, 0x43, 0x48, 0x41, 0x4E, 0x47,
-	0x45, 0x00, 0x55, 0x53, 0x4E, 0x5F, 0x52, 0x45, 0x41, 0x53, 0x4F, 0x4E,
-	0x5F, 0x48, 0x41, 0x52, 0x44, 0x5F, 0x4C, 0x49, 0x4E, 0x4B, 0x5F, 0x43,
-	0x48, 0x41, 0x4E, 0x47, 0x45, 0x00, 0x55, 0x53, 0x4E, 0x5F, 0x52, 0x45,
-	0x41, 0x53, 0x4F, 0x4E, 0x5F, 0x53, 0x54, 0x52, 0x45, 0x41, 0x4D, 0x5F,
-	0x43, 0x48, 0x41, 0x4E, 0x47, 0x45, 0x00, 0x55, 0x53, 0x4E, 0x5F, 0x52,
-	0x45, 0x41, 0x53, 0x4F, 0x4E, 0x5F, 0x43, 0x4F, 0x4D, 0x50, 0x52, 0x45,
-	0x53, 0x53, 0x49, 0x4F, 0x4E, 0x5F, 0x43, 0x48, 0x41, 0x4E, 0x47, 0x45,
-	0x00, 0x55, 0x53, 0x4E, 0x5F, 0x52, 0x45, 0x41, 0x53, 0x4F, 0x4E, 0x5F,
-	0x45, 0x4E, 0x43, 0x52, 0x59, 0x50, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x43,
-	0x48, 0x41, 0x4E, 0x47, 0x45, 0x00, 0x55, 0x53, 0x4E, 0x5F, 0x52, 0x45,
-	0x41, 0x53, 0x4F, 0x4E, 0x5F, 0x42, 0x41, 0x53, 0x49, 0x43, 0x5F, 0x49,
-	0x4E, 0x46, 0x4F, 0x5F, 0x43, 0x48, 0x41, 0x4E, 0x47, 0x45, 0x00, 0x55,
-	0x53, 0x4E, 0x5F, 0x52, 0x45, 0x41, 0x53, 0x4F, 0x4E, 0x5F, 0x52, 0x45,
-	0x50, 0x41, 0x52, 0x53, 0x45, 0x5F, 0x50, 0x4F, 0x49, 0x4E, 0x54, 0x5F,
-	0x43, 0x48, 0x41, 0x4E, 0x47, 0x45, 0x00, 0x55, 0x53, 0x4E, 0x5F, 0x52,
-	0x45, 0x41, 0x53, 0x4F, 0x4E, 0x5F, 0x53, 0x45, 0x43, 0x55, 0x52, 0x49,
-	0x54, 0x59, 0x5F, 0x43, 0x48, 0x41, 0x4E, 0x47, 0x45, 0x00, 0x45, 0x52,
-	0x52, 0x4F, 0x52, 0x5F, 0x49, 0x4E, 0x56, 0x41, 0x4C, 0x49, 0x44, 0x5F,
-	0x48, 0x41, 0x4E, 0x44, 0x4C, 0x45, 0x00, 0x47, 0x57, 0x4C, 0x5F, 0x45,
-	0x58, 0x53, 0x54, 0x59, 0x4C, 0x45, 0x00, 0x55, 0x53, 0x4E, 0x5F, 0x52,
-	0x45, 0x41, 0x53, 0x4F, 0x4E, 0x5F, 0x52, 0x45, 0x4E, 0x41, 0x4D, 0x45,
-	0x5F, 0x4F, 0x4C, 0x44, 0x5F, 0x4E, 0x41, 0x4D, 0x45, 0x00, 0x55, 0x53,
-	0x4E, 0x5F, 0x52, 0x45, 0x41, 0x53, 0x4F, 0x4E, 0x5F, 0x52, 0x45, 0x4E,
-	0x41, 0x4D, 0x45, 0x5F, 0x4E, 0x45, 0x57, 0x5F, 0x4E, 0x41, 0x4D, 0x45,
-	0x00, 0x46, 0x49, 0x4C, 0x45, 0x54, 0x49, 0x4D, 0x45, 0x00, 0x55, 0x53,
-	0x4E, 0x5F, 0x52, 0x45, 0x41, 0x53, 0x4F, 0x4E, 0x5F, 0x43, 0x4C, 0x4F,
-	0x53, 0x45, 0x00, 0x55, 0x53, 0x4E, 0x5F, 0x52, 0x45, 0x41, 0x53, 0x4F,
-	0x4E, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x5F, 0x43, 0x52, 0x45, 0x41, 0x54,
-	0x45, 0x00, 0x55, 0x53, 0x4E, 0x5F, 0x52, 0x45, 0x41, 0x53, 0x4F, 0x4E,
-	0x5F, 0x46, 0x49, 0x4C, 0x45, 0x5F, 0x44, 0x45, 0x4C, 0x45, 0x54, 0x45,
-	0x00, 0x55, 0x53, 0x4E, 0x5F, 0x52, 0x45, 0x41, 0x53, 0x4F, 0x4E, 0x5F,
-	0x4E, 0x41, 0x4D, 0x45, 0x44, 0x5F, 0x44, 0x41, 0x54, 0x41, 0x5F, 0x4F,
-	0x56, 0x45, 0x52, 0x57, 0x52, 0x49, 0x54, 0x45, 0x00, 0x55, 0x53, 0x4E,
-	0x5F, 0x52, 0x45, 0x41, 0x53, 0x4F, 0x4E, 0x5F, 0x44, 0x41, 0x54, 0x41,
-	0x5F, 0x4F, 0x56, 0x45, 0x52, 0x57, 0x52, 0x49, 0x54, 0x45, 0x00, 0x47,
-	0x45, 0x4E, 0x45, 0x52, 0x49, 0x43, 0x5F, 0x57, 0x52, 0x49, 0x54, 0x45,
-	0x00, 0x46, 0x49, 0x4C, 0x45, 0x5F, 0x53, 0x48, 0x41, 0x52, 0x45, 0x5F,
-	0x57, 0x52, 0x49, 0x54, 0x45, 0x00, 0x49, 0x4E, 0x56, 0x41, 0x4C, 0x49,
-	0x44, 0x5F, 0x48, 0x41, 0x4E, 0x44, 0x4C, 0x45, 0x5F, 0x56, 0x41, 0x4C,
-	0x55, 0x45, 0x00, 0x55, 0x53, 0x4E, 0x5F, 0x4A, 0x4F, 0x55, 0x52, 0x4E,
-	0x41, 0x4C, 0x5F, 0x4E, 0x4F, 0x54, 0x5F, 0x41, 0x43, 0x54, 0x49, 0x56,
-	0x45, 0x00, 0x45, 0x52, 0x52, 0x4F, 0x52, 0x5F, 0x4A, 0x4F, 0x55, 0x52,
-	0x4E, 0x41, 0x4C, 0x5F, 0x4E, 0x4F, 0x54, 0x5F, 0x41, 0x43, 0x54, 0x49,
-	0x56, 0x45, 0x00, 0x4F, 0x42, 0x4A, 0x5F, 0x43, 0x41, 0x53, 0x45, 0x5F,
-	0x49, 0x4E, 0x53, 0x45, 0x4E, 0x53, 0x49, 0x54, 0x49, 0x56, 0x45, 0x00,
-	0x45, 0x52, 0x52, 0x4F, 0x52, 0x5F, 0x48, 0x41, 0x4E, 0x44, 0x4C, 0x45,
-	0x5F, 0x45, 0x4F, 0x46, 0x00, 0x55, 0x4E, 0x49, 0x43, 0x4F, 0x44, 0x45,
-	0x5F, 0x53, 0x54, 0x52, 0x49, 0x4E, 0x47, 0x00, 0x54, 0x52, 0x55, 0x4E,
-	0x43, 0x41, 0x54, 0x45, 0x5F, 0x45, 0x58, 0x49, 0x53, 0x54, 0x49, 0x4E,
-	0x47, 0x00, 0x4F, 0x50, 0x45, 0x4E, 0x5F, 0x45, 0x58, 0x49, 0x53, 0x54,
-	0x49, 0x4E, 0x47, 0x00, 0x44, 0x57, 0x4F, 0x52, 0x44, 0x4C, 0x4F, 0x4E,
-	0x47, 0x00, 0x55, 0x53, 0x4E, 0x5F, 0x4C, 0x45, 0x4E, 0x47, 0x54, 0x48,
-	0x00, 0x49, 0x4F, 0x5F, 0x53, 0x54, 0x41, 0x54, 0x55, 0x53, 0x5F, 0x42,
-	0x4C, 0x4F, 0x43, 0x4B, 0x00, 0x46, 0x49, 0x4C, 0x45, 0x5F, 0x41, 0x54,
-	0x54, 0x52, 0x49, 0x42, 0x55, 0x54, 0x45, 0x5F, 0x4E, 0x4F, 0x52, 0x4D,
-	0x41, 0x4C, 0x00, 0x46, 0x53, 0x43, 0x54, 0x4C, 0x5F, 0x52, 0x45, 0x41,
-	0x44, 0x5F, 0x55, 0x53, 0x4E, 0x5F, 0x4A, 0x4F, 0x55, 0x52, 0x4E, 0x41,
-	0x4C, 0x00, 0x46, 0x53, 0x43, 0x54, 0x4C, 0x5F, 0x43, 0x52, 0x45, 0x41,
-	0x54, 0x45, 0x5F, 0x55, 0x53, 0x4E, 0x5F, 0x4A, 0x4F, 0x55, 0x52, 0x4E,
-	0x41, 0x4C, 0x00, 0x46, 0x53, 0x43, 0x54, 0x4C, 0x5F, 0x44, 0x45, 0x4C,
-	0x45, 0x54, 0x45, 0x5F, 0x55, 0x53, 0x4E, 0x5F, 0x4A, 0x4F, 0x55, 0x52,
-	0x4E, 0x41, 0x4C, 0x00, 0x46, 0x53, 0x43, 0x54, 0x4C, 0x5F, 0x51, 0x55,
-	0x45, 0x52, 0x59, 0x5F, 0x55, 0x53, 0x4E, 0x5F, 0x4A, 0x4F, 0x55, 0x52,
-	0x4E, 0x41, 0x4C, 0x00, 0x46, 0x49, 0x4C, 0x45, 0x5F, 0x44, 0x45, 0x56,
-	0x49, 0x43, 0x45, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x5F, 0x53, 0x59, 0x53,
-	0x54, 0x45, 0x4D, 0x00, 0x46, 0x49, 0x4C, 0x45, 0x5F, 0x4F, 0x50, 0x45,
-	0x4E, 0x00, 0x55, 0x53, 0x4E, 0x5F, 0x52, 0x45, 0x41, 0x53, 0x4F, 0x4E,
-	0x5F, 0x4E, 0x41, 0x4D, 0x45, 0x44, 0x5F, 0x44, 0x41, 0x54, 0x41, 0x5F,
-	0x54, 0x52, 0x55, 0x4E, 0x43, 0x41, 0x54, 0x49, 0x4F, 0x4E, 0x00, 0x55,
-	0x53, 0x4E, 0x5F, 0x52, 0x45, 0x41, 0x53, 0x4F, 0x4E, 0x5F, 0x44, 0x41,
-	0x54, 0x41, 0x5F, 0x54, 0x52, 0x55, 0x4E, 0x43, 0x41, 0x54, 0x49, 0x4F,
-	0x4E, 0x00, 0x42, 0x59, 0x5F, 0x48, 0x41, 0x4E, 0x44, 0x4C, 0x45, 0x5F,
-	0x46, 0x49, 0x4C, 0x45, 0x5F, 0x49, 0x4E, 0x46, 0x4F, 0x52, 0x4D, 0x41,
-	0x54, 0x49, 0x4F, 0x4E, 0x00, 0x45, 0x52, 0x52, 0x4F, 0x52, 0x5F, 0x49,
-	0x4E, 0x56, 0x41, 0x4C, 0x49, 0x44, 0x5F, 0x46, 0x55, 0x4E, 0x43, 0x54,
-	0x49, 0x4F, 0x4E, 0x00, 0x67, 0x65, 0x74, 0x5F, 0x55, 0x53, 0x4E, 0x00,
-	0x53, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x2E, 0x49, 0x4F, 0x00, 0x49, 0x4E,
-	0x56, 0x41, 0x4C, 0x49, 0x44, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x5F, 0x52,
-	0x45, 0x46, 0x45, 0x52, 0x45, 0x4E, 0x43, 0x45, 0x5F, 0x4E, 0x55, 0x4D,
-	0x42, 0x45, 0x52, 0x00, 0x45, 0x52, 0x52, 0x4F, 0x52, 0x5F, 0x49, 0x4E,
-	0x56, 0x41, 0x4C, 0x49, 0x44, 0x5F, 0x55, 0x53, 0x45, 0x52, 0x5F, 0x42,
-	0x55, 0x46, 0x46, 0x45, 0x52, 0x00, 0x4C, 0x41, 0x52, 0x47, 0x45, 0x5F,
-	0x49, 0x4E, 0x54, 0x45, 0x47, 0x45, 0x52, 0x00, 0x4D, 0x45, 0x54, 0x48,
-	0x4F, 0x44, 0x5F, 0x4E, 0x45, 0x49, 0x54, 0x48, 0x45, 0x52, 0x00, 0x45,
-	0x52, 0x52, 0x4F, 0x52, 0x5F, 0x49, 0x4E, 0x56, 0x41, 0x4C, 0x49, 0x44,
-	0x5F, 0x50, 0x41, 0x52, 0x41, 0x4D, 0x45, 0x54, 0x45, 0x52, 0x00, 0x55,
-	0x53, 0x4E, 0x5F, 0x4A, 0x4F, 0x55, 0x52, 0x4E, 0x41, 0x4C, 0x5F, 0x45,
-	0x52, 0x52, 0x4F, 0x52, 0x00, 0x46, 0x49, 0x4C, 0x45, 0x5F, 0x46, 0x4C,
-	0x41, 0x47, 0x5F, 0x42, 0x41, 0x43, 0x4B, 0x55, 0x50, 0x5F, 0x53, 0x45,
-	0x4D, 0x41, 0x4E, 0x54, 0x49, 0x43, 0x53, 0x00, 0x45, 0x52, 0x52, 0x4F,
-	0x52, 0x5F, 0x54, 0x4F, 0x4F, 0x5F, 0x4D, 0x41, 0x4E, 0x59, 0x5F, 0x4F,
-	0x50, 0x45, 0x4E, 0x5F, 0x46, 0x49, 0x4C, 0x45, 0x53, 0x00, 0x4F, 0x42,
-	0x4A, 0x45, 0x43, 0x54, 0x5F, 0x41, 0x54, 0x54, 0x52, 0x49, 0x42, 0x55,
-	0x54, 0x45, 0x53, 0x00, 0x56, 0x4F, 0x4C, 0x55, 0x4D, 0x45, 0x5F, 0x4E,
-	0x4F, 0x54, 0x5F, 0x4E, 0x54, 0x46, 0x53, 0x00, 0x46, 0x49, 0x4C, 0x45,
-	0x5F, 0x49, 0x4E, 0x46, 0x4F, 0x52, 0x4D, 0x41, 0x54, 0x49, 0x4F, 0x4E,
-	0x5F, 0x43, 0x4C, 0x41, 0x53, 0x53, 0x00, 0x46, 0x49, 0x4C, 0x45, 0x5F,
-	0x41, 0x4E, 0x59, 0x5F, 0x41, 0x43, 0x43, 0x45, 0x53, 0x53, 0x00, 0x55,
-	0x53, 0x4E, 0x5F, 0x4A, 0x4F, 0x55, 0x52, 0x4E, 0x41, 0x4C, 0x5F, 0x53,
-	0x55, 0x43, 0x43, 0x45, 0x53, 0x53, 0x00, 0x45, 0x52, 0x52, 0x4F, 0x52,
-	0x5F, 0x53, 0x55, 0x43, 0x43, 0x45, 0x53, 0x53, 0x00, 0x45, 0x52, 0x52,
-	0x4F, 0x52, 0x5F, 0x4A, 0x4F, 0x55, 0x52, 0x4E, 0x41, 0x4C, 0x5F, 0x44,
-	0x45, 0x4C, 0x45, 0x54, 0x45, 0x5F, 0x49, 0x4E, 0x5F, 0x50, 0x52, 0x4F,
-	0x47, 0x52, 0x45, 0x53, 0x53, 0x00, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45,
-	0x5F, 0x41, 0x4C, 0x57, 0x41, 0x59, 0x53, 0x00, 0x4F, 0x50, 0x45, 0x4E,
-	0x5F, 0x41, 0x4C, 0x57, 0x41, 0x59, 0x53, 0x00, 0x46, 0x41, 0x5F, 0x4F,
-	0x46, 0x46, 0x53, 0x45, 0x54, 0x00, 0x52, 0x45, 0x43, 0x5F, 0x4F, 0x46,
-	0x46, 0x53, 0x45, 0x54, 0x00, 0x53, 0x45, 0x43, 0x49, 0x44, 0x5F, 0x4F,
-	0x46, 0x46, 0x53, 0x45, 0x54, 0x00, 0x54, 0x49, 0x4D, 0x45, 0x5F, 0x4F,
-	0x46, 0x46, 0x53, 0x45, 0x54, 0x00, 0x46, 0x4E, 0x4C, 0x5F, 0x4F, 0x46,
-	0x46, 0x53, 0x45, 0x54, 0x00, 0x52, 0x45, 0x41, 0x53, 0x4F, 0x4E, 0x5F,
-	0x4F, 0x46, 0x46, 0x53, 0x45, 0x54, 0x00, 0x55, 0x53, 0x4E, 0x5F, 0x4F,
-	0x46, 0x46, 0x53, 0x45, 0x54, 0x00, 0x53, 0x52, 0x43, 0x49, 0x4E, 0x46,
-	0x4F, 0x5F, 0x4F, 0x46, 0x46, 0x53, 0x45, 0x54, 0x00, 0x46, 0x4E, 0x4F,
-	0x5F, 0x4F, 0x46, 0x46, 0x53, 0x45, 0x54, 0x00, 0x50, 0x46, 0x52, 0x5F,
-	0x4F, 0x46, 0x46, 0x53, 0x45, 0x54, 0x00, 0x4D, 0x41, 0x4A, 0x56, 0x5F,
-	0x4F, 0x46, 0x46, 0x53, 0x45, 0x54, 0x00, 0x4D, 0x49, 0x4E, 0x56, 0x5F,
-	0x4F, 0x46, 0x46, 0x53, 0x45, 0x54, 0x00, 0x57, 0x53, 0x5F, 0x45, 0x58,
-	0x5F, 0x54, 0x52, 0x41, 0x4E, 0x53, 0x50, 0x41, 0x52, 0x45, 0x4E, 0x54,
-	0x00, 0x46, 0x49, 0x4C, 0x45, 0x5F, 0x4F, 0x50, 0x45, 0x4E, 0x5F, 0x46,
-	0x4F, 0x52, 0x5F, 0x42, 0x41, 0x43, 0x4B, 0x55, 0x50, 0x5F, 0x49, 0x4E,
-	0x54, 0x45, 0x4E, 0x54, 0x00, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x5F,
-	0x4E, 0x45, 0x57, 0x00, 0x46, 0x49, 0x4C, 0x45, 0x5F, 0x41, 0x54, 0x54,
-	0x52, 0x49, 0x42, 0x55, 0x54, 0x45, 0x5F, 0x44, 0x49, 0x52, 0x45, 0x43,
-	0x54, 0x4F, 0x52, 0x59, 0x00, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x5F, 0x5F,
-	0x00, 0x41, 0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x44,
-	0x65, 0x6C, 0x74, 0x61, 0x00, 0x6D, 0x73, 0x63, 0x6F, 0x72, 0x6C, 0x69,
-	0x62, 0x00, 0x3C, 0x3E, 0x63, 0x00, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6D,
-	0x2E, 0x43, 0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73,
-	0x2E, 0x47, 0x65, 0x6E, 0x65, 0x72, 0x69, 0x63, 0x00, 0x55, 0x73, 0x6E,
-	0x4A, 0x6F, 0x75, 0x72, 0x6E, 0x61, 0x6C, 0x49, 0x64, 0x00, 0x67, 0x65,
-	0x74, 0x5F, 0x53, 0x65, 0x63, 0x75, 0x72, 0x69, 0x74, 0x79, 0x49, 0x64,
-	0x00, 0x6E, 0x4E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x4F, 0x66, 0x42, 0x79,
-	0x74, 0x65, 0x73, 0x54, 0x6F, 0x52, 0x65, 0x61, 0x64, 0x00, 0x6C, 0x70,
-	0x4E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x4F, 0x66, 0x42, 0x79, 0x74, 0x65,
-	0x73, 0x52, 0x65, 0x61, 0x64, 0x00, 0x41, 0x64, 0x64, 0x00, 0x6C, 0x70,
-	0x42, 0x79, 0x74, 0x65, 0x73, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x65,
-	0x64, 0x00, 0x6C, 0x70, 0x4F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x70, 0x70,
-	0x65, 0x64, 0x00, 0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x70, 0x70, 0x65,
-	0x64, 0x00, 0x3C, 0x55, 0x53, 0x4E, 0x3E, 0x6B, 0x5F, 0x5F, 0x42, 0x61,
-	0x63, 0x6B, 0x69, 0x6E, 0x67, 0x46, 0x69, 0x65, 0x6C, 0x64, 0x00, 0x3C,
-	0x53, 0x65, 0x63, 0x75, 0x72, 0x69, 0x74, 0x79, 0x49, 0x64, 0x3E, 0x6B,
-	0x5F, 0x5F, 0x42, 0x61, 0x63, 0x6B, 0x69, 0x6E, 0x67, 0x46, 0x69, 0x65,
-	0x6C, 0x64, 0x00, 0x3C, 0x4E, 0x61, 0x6D, 0x65, 0x3E, 0x6B, 0x5F, 0x5F,
-	0x42, 0x61, 0x63, 0x6B, 0x69, 0x6E, 0x67, 0x46, 0x69, 0x65, 0x6C, 0x64,
-	0x00, 0x3C, 0x52, 0x65, 0x63, 0x6F, 0x72, 0x64, 0x4C, 0x65, 0x6E, 0x67,
-	0x74, 0x68, 0x3E, 0x6B, 0x5F, 0x5F, 0x42, 0x61, 0x63, 0x6B, 0x69, 0x6E,
-	0x67, 0x46, 0x69, 0x65, 0x6C, 0x64, 0x00, 0x3C, 0x4D, 0x61, 0x6A, 0x6F,
-	0x72, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x3E, 0x6B, 0x5F, 0x5F,
-	0x42, 0x61, 0x63, 0x6B, 0x69, 0x6E, 0x67, 0x46, 0x69, 0x65, 0x6C, 0x64,
-	0x00, 0x3C, 0x4D, 0x69, 0x6E, 0x6F, 0x72, 0x56, 0x65, 0x72, 0x73, 0x69,
-	0x6F, 0x6E, 0x3E, 0x6B, 0x5F, 0x5F, 0x42, 0x61, 0x63, 0x6B, 0x69, 0x6E,
-	0x67, 0x46, 0x69, 0x65, 0x6C, 0x64, 0x00, 0x3C, 0x52, 0x65, 0x61, 0x73,
-	0x6F, 0x6E, 0x3E, 0x6B, 0x5F, 0x5F, 0x42, 0x61, 0x63, 0x6B, 0x69, 0x6E,
-	0x67, 0x46, 0x69, 0x65, 0x6C, 0x64, 0x00, 0x3C, 0x53, 0x6F, 0x75, 0x72,
-	0x63, 0x65, 0x49, 0x6E, 0x66, 0x6F, 0x3E, 0x6B, 0x5F, 0x5F, 0x42, 0x61,
-	0x63, 0x6B, 0x69, 0x6E, 0x67, 0x46, 0x69, 0x65, 0x6C, 0x64, 0x00, 0x3C,
-	0x54, 0x69, 0x6D, 0x65, 0x53, 0x74, 0x61, 0x6D, 0x70, 0x3E, 0x6B, 0x5F,
-	0x5F, 0x42, 0x61, 0x63, 0x6B, 0x69, 0x6E, 0x67, 0x46, 0x69, 0x65, 0x6C,
-	0x64, 0x00, 0x3C, 0x46, 0x69, 0x6C, 0x65, 0x52, 0x65, 0x66, 0x65, 0x72,
-	0x65, 0x6E, 0x63, 0x65, 0x4E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x3E, 0x6B,
-	0x5F, 0x5F, 0x42, 0x61, 0x63, 0x6B, 0x69, 0x6E, 0x67, 0x46, 0x69, 0x65,
-	0x6C, 0x64, 0x00, 0x3C, 0x50, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x46, 0x69,
-	0x6C, 0x65, 0x52, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6E, 0x63, 0x65, 0x4E,
-	0x75, 0x6D, 0x62, 0x65, 0x72, 0x3E, 0x6B, 0x5F, 0x5F, 0x42, 0x61, 0x63,
-	0x6B, 0x69, 0x6E, 0x67, 0x46, 0x69, 0x65, 0x6C, 0x64, 0x00, 0x3C, 0x46,
-	0x69, 0x6C, 0x65, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
-	0x73, 0x3E, 0x6B, 0x5F, 0x5F, 0x42, 0x61, 0x63, 0x6B, 0x69, 0x6E, 0x67,
-	0x46, 0x69, 0x65, 0x6C, 0x64, 0x00, 0x54, 0x72, 0x69, 0x6D, 0x45, 0x6E,
-	0x64, 0x00, 0x70, 0x74, 0x72, 0x54, 0x6F, 0x55, 0x73, 0x6E, 0x52, 0x65,
-	0x63, 0x6F, 0x72, 0x64, 0x00, 0x68, 0x44, 0x65, 0x76, 0x69, 0x63, 0x65,
-	0x00, 0x53, 0x65, 0x63, 0x75, 0x72, 0x69, 0x74, 0x79, 0x51, 0x75, 0x61,
-	0x6C, 0x69, 0x74, 0x79, 0x4F, 0x66, 0x53, 0x65, 0x72, 0x76, 0x69, 0x63,
-	0x65, 0x00, 0x64, 0x77, 0x49, 0x6F, 0x43, 0x6F, 0x6E, 0x74, 0x72, 0x6F,
-	0x6C, 0x43, 0x6F, 0x64, 0x65, 0x00, 0x55, 0x73, 0x6E, 0x4A, 0x6F, 0x75,
-	0x72, 0x6E, 0x61, 0x6C, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x43, 0x6F,
-	0x64, 0x65, 0x00, 0x64, 0x77, 0x53, 0x68, 0x61, 0x72, 0x65, 0x4D, 0x6F,
-	0x64, 0x65, 0x00, 0x67, 0x65, 0x74, 0x5F, 0x4D, 0x65, 0x73, 0x73, 0x61,
-	0x67, 0x65, 0x00, 0x47, 0x65, 0x74, 0x52, 0x61, 0x6E, 0x67, 0x65, 0x00,
-	0x45, 0x6E, 0x75, 0x6D, 0x65, 0x72, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x49,
-	0x44, 0x69, 0x73, 0x70, 0x6F, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x66,
-	0x69, 0x6C, 0x65, 0x48, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x00, 0x43, 0x6C,
-	0x6F, 0x73, 0x65, 0x48, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x00, 0x5F, 0x75,
-	0x73, 0x6E, 0x4A, 0x6F, 0x75, 0x72, 0x6E, 0x61, 0x6C, 0x52, 0x6F, 0x6F,
-	0x74, 0x48, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x00, 0x47, 0x65, 0x74, 0x52,
-	0x6F, 0x6F, 0x74, 0x48, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x00, 0x72, 0x6F,
-	0x6F, 0x74, 0x48, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x00, 0x47, 0x65, 0x74,
-	0x46, 0x69, 0x6C, 0x65, 0x49, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74,
-	0x69, 0x6F, 0x6E, 0x42, 0x79, 0x48, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x00,
-	0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x00, 0x52, 0x65, 0x61, 0x64, 0x46,
-	0x69, 0x6C, 0x65, 0x00, 0x4E, 0x74, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65,
-	0x46, 0x69, 0x6C, 0x65, 0x00, 0x68, 0x54, 0x65, 0x6D, 0x70, 0x6C, 0x61,
-	0x74, 0x65, 0x46, 0x69, 0x6C, 0x65, 0x00, 0x44, 0x65, 0x6C, 0x65, 0x74,
-	0x65, 0x46, 0x69, 0x6C, 0x65, 0x00, 0x57, 0x72, 0x69, 0x74, 0x65, 0x46,
-	0x69, 0x6C, 0x65, 0x00, 0x68, 0x46, 0x69, 0x6C, 0x65, 0x00, 0x4E, 0x74,
-	0x51, 0x75, 0x65, 0x72, 0x79, 0x49, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61,
-	0x74, 0x69, 0x6F, 0x6E, 0x46, 0x69, 0x6C, 0x65, 0x00, 0x67, 0x65, 0x74,
-	0x5F, 0x49, 0x73, 0x46, 0x69, 0x6C, 0x65, 0x00, 0x6F, 0x75, 0x74, 0x70,
-	0x75, 0x74, 0x46, 0x69, 0x6C, 0x65, 0x00, 0x43, 0x6F, 0x6E, 0x73, 0x6F,
-	0x6C, 0x65, 0x00, 0x67, 0x65, 0x74, 0x5F, 0x4E, 0x61, 0x6D, 0x65, 0x00,
-	0x6C, 0x70, 0x46, 0x69, 0x6C, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x00, 0x66,
-	0x69, 0x6C, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x00, 0x41, 0x6C, 0x6C, 0x53,
-	0x61, 0x6D, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x00, 0x4F, 0x62, 0x6A, 0x65,
-	0x63, 0x74, 0x4E, 0x61, 0x6D, 0x65, 0x00, 0x46, 0x72, 0x6F, 0x6D, 0x46,
-	0x69, 0x6C, 0x65, 0x54, 0x69, 0x6D, 0x65, 0x00, 0x44, 0x61, 0x74, 0x65,
-	0x54, 0x69, 0x6D, 0x65, 0x00, 0x4C, 0x61, 0x73, 0x74, 0x57, 0x72, 0x69,
-	0x74, 0x65, 0x54, 0x69, 0x6D, 0x65, 0x00, 0x43, 0x72, 0x65, 0x61, 0x74,
-	0x69, 0x6F, 0x6E, 0x54, 0x69, 0x6D, 0x65, 0x00, 0x50, 0x72, 0x65, 0x70,
-	0x65, 0x6E, 0x64, 0x45, 0x78, 0x65, 0x63, 0x75, 0x74, 0x69, 0x6F, 0x6E,
-	0x54, 0x69, 0x6D, 0x65, 0x00, 0x4C, 0x61, 0x73, 0x74, 0x41, 0x63, 0x63,
-	0x65, 0x73, 0x73, 0x54, 0x69, 0x6D, 0x65, 0x00, 0x62, 0x4E, 0x74, 0x66,
-	0x73, 0x56, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x00, 0x57, 0x72, 0x69, 0x74,
-	0x65, 0x4C, 0x69, 0x6E, 0x65, 0x00, 0x43, 0x6F, 0x6D, 0x62, 0x69, 0x6E,
-	0x65, 0x00, 0x56, 0x61, 0x6C, 0x75, 0x65, 0x54, 0x79, 0x70, 0x65, 0x00,
-	0x67, 0x65, 0x74, 0x5F, 0x44, 0x72, 0x69, 0x76, 0x65, 0x54, 0x79, 0x70,
-	0x65, 0x00, 0x46, 0x69, 0x6C, 0x65, 0x53, 0x68, 0x61, 0x72, 0x65, 0x00,
-	0x73, 0x68, 0x61, 0x72, 0x65, 0x00, 0x57, 0x68, 0x65, 0x72, 0x65, 0x00,
-	0x53, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x2E, 0x43, 0x6F, 0x72, 0x65, 0x00,
-	0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x4F, 0x6E, 0x6C, 0x79, 0x4F, 0x6E,
-	0x43, 0x6C, 0x6F, 0x73, 0x65, 0x00, 0x44, 0x69, 0x73, 0x70, 0x6F, 0x73,
-	0x65, 0x00, 0x57, 0x72, 0x69, 0x74, 0x65, 0x55, 0x73, 0x6E, 0x4A, 0x6F,
-	0x75, 0x72, 0x6E, 0x61, 0x6C, 0x53, 0x74, 0x61, 0x74, 0x65, 0x00, 0x47,
-	0x65, 0x74, 0x55, 0x73, 0x6E, 0x4A, 0x6F, 0x75, 0x72, 0x6E, 0x61, 0x6C,
-	0x53, 0x74, 0x61, 0x74, 0x65, 0x00, 0x75, 0x73, 0x6E, 0x4A, 0x6F, 0x75,
-	0x72, 0x6E, 0x61, 0x6C, 0x53, 0x74, 0x61, 0x74, 0x65, 0x00, 0x6A, 0x6F,
-	0x75, 0x72, 0x6E, 0x61, 0x6C, 0x53, 0x74, 0x61, 0x74, 0x65, 0x00, 0x70,
-	0x72, 0x65, 0x76, 0x69, 0x6F, 0x75, 0x73, 0x55, 0x73, 0x6E, 0x53, 0x74,
-	0x61, 0x74, 0x65, 0x00, 0x6E, 0x65, 0x77, 0x55, 0x73, 0x6E, 0x53, 0x74,
-	0x61, 0x74, 0x65, 0x00, 0x6E, 0x4E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x4F,
-	0x66, 0x42, 0x79, 0x74, 0x65, 0x73, 0x54, 0x6F, 0x57, 0x72, 0x69, 0x74,
-	0x65, 0x00, 0x43, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x47, 0x65,
-	0x6E, 0x65, 0x72, 0x61, 0x74, 0x65, 0x64, 0x41, 0x74, 0x74, 0x72, 0x69,
-	0x62, 0x75, 0x74, 0x65, 0x00, 0x47, 0x75, 0x69, 0x64, 0x41, 0x74, 0x74,
-	0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x00, 0x44, 0x65, 0x62, 0x75, 0x67,
-	0x67, 0x61, 0x62, 0x6C, 0x65, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
-	0x74, 0x65, 0x00, 0x43, 0x6F, 0x6D, 0x56, 0x69, 0x73, 0x69, 0x62, 0x6C,
-	0x65, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x00, 0x41,
-	0x73, 0x73, 0x65, 0x6D, 0x62, 0x6C, 0x79, 0x54, 0x69, 0x74, 0x6C, 0x65,
-	0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x00, 0x41, 0x73,
-	0x73, 0x65, 0x6D, 0x62, 0x6C, 0x79, 0x54, 0x72, 0x61, 0x64, 0x65, 0x6D,
-	0x61, 0x72, 0x6B, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65,
-	0x00, 0x54, 0x61, 0x72, 0x67, 0x65, 0x74, 0x46, 0x72, 0x61, 0x6D, 0x65,
-	0x77, 0x6F, 0x72, 0x6B, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
-	0x65, 0x00, 0x41, 0x73, 0x73, 0x65, 0x6D, 0x62, 0x6C, 0x79, 0x46, 0x69,
-	0x6C, 0x65, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x41, 0x74, 0x74,
-	0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x00, 0x41, 0x73, 0x73, 0x65, 0x6D,
-	0x62, 0x6C, 0x79, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x75, 0x72, 0x61,
-	0x74, 0x69, 0x6F, 0x6E, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
-	0x65, 0x00, 0x41, 0x73, 0x73, 0x65, 0x6D, 0x62, 0x6C, 0x79, 0x44, 0x65,
-	0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x41, 0x74, 0x74,
-	0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x00, 0x43, 0x6F, 0x6D, 0x70, 0x69,
-	0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x52, 0x65, 0x6C, 0x61, 0x78, 0x61,
-	0x74, 0x69, 0x6F, 0x6E, 0x73, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
-	0x74, 0x65, 0x00, 0x41, 0x73, 0x73, 0x65, 0x6D, 0x62, 0x6C, 0x79, 0x50,
-	0x72, 0x6F, 0x64, 0x75, 0x63, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62,
-	0x75, 0x74, 0x65, 0x00, 0x41, 0x73, 0x73, 0x65, 0x6D, 0x62, 0x6C, 0x79,
-	0x43, 0x6F, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x41, 0x74, 0x74,
-	0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x00, 0x41, 0x73, 0x73, 0x65, 0x6D,
-	0x62, 0x6C, 0x79, 0x43, 0x6F, 0x6D, 0x70, 0x61, 0x6E, 0x79, 0x41, 0x74,
-	0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x00, 0x52, 0x75, 0x6E, 0x74,
-	0x69, 0x6D, 0x65, 0x43, 0x6F, 0x6D, 0x70, 0x61, 0x74, 0x69, 0x62, 0x69,
-	0x6C, 0x69, 0x74, 0x79, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
-	0x65, 0x00, 0x53, 0x63, 0x61, 0x6E, 0x44, 0x72, 0x69, 0x76, 0x65, 0x00,
-	0x64, 0x72, 0x69, 0x76, 0x65, 0x00, 0x43, 0x6F, 0x6E, 0x73, 0x6F, 0x6C,
-	0x65, 0x41, 0x70, 0x70, 0x31, 0x34, 0x2E, 0x65, 0x78, 0x65, 0x00, 0x61,
-	0x6C, 0x6C, 0x6F, 0x63, 0x53, 0x69, 0x7A, 0x65, 0x00, 0x4D, 0x61, 0x78,
-	0x69, 0x6D, 0x75, 0x6D, 0x53, 0x69, 0x7A, 0x65, 0x00, 0x6E, 0x49, 0x6E,
-	0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x53, 0x69, 0x7A, 0x65, 0x00, 0x6E,
-	0x4F, 0x75, 0x74, 0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x53, 0x69, 0x7A,
-	0x65, 0x00, 0x73, 0x69, 0x7A, 0x65, 0x00, 0x53, 0x69, 0x7A, 0x65, 0x4F,
-	0x66, 0x00, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x2E, 0x52, 0x75, 0x6E,
-	0x74, 0x69, 0x6D, 0x65, 0x2E, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E,
-	0x69, 0x6E, 0x67, 0x00, 0x54, 0x6F, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67,
-	0x00, 0x53, 0x74, 0x6F, 0x70, 0x77, 0x61, 0x74, 0x63, 0x68, 0x00, 0x46,
-	0x69, 0x6C, 0x65, 0x53, 0x69, 0x7A, 0x65, 0x48, 0x69, 0x67, 0x68, 0x00,
-	0x46, 0x69, 0x6C, 0x65, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x48, 0x69, 0x67,
-	0x68, 0x00, 0x47, 0x65, 0x74, 0x4F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x46,
-	0x69, 0x6C, 0x65, 0x50, 0x61, 0x74, 0x68, 0x00, 0x65, 0x61, 0x4C, 0x65,
-	0x6E, 0x67, 0x74, 0x68, 0x00, 0x67, 0x65, 0x74, 0x5F, 0x52, 0x65, 0x63,
-	0x6F, 0x72, 0x64, 0x4C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x00, 0x4D, 0x61,
-	0x78, 0x69, 0x6D, 0x75, 0x6D, 0x4C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x00,
-	0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x00, 0x50, 0x74, 0x72, 0x54, 0x6F,
-	0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x55, 0x6E, 0x69, 0x00, 0x57, 0x69,
-	0x6E, 0x33, 0x32, 0x41, 0x70, 0x69, 0x00, 0x70, 0x49, 0x6E, 0x66, 0x6F,
-	0x42, 0x6C, 0x6F, 0x63, 0x6B, 0x00, 0x49, 0x6F, 0x53, 0x74, 0x61, 0x74,
-	0x75, 0x73, 0x42, 0x6C, 0x6F, 0x63, 0x6B, 0x00, 0x52, 0x65, 0x61, 0x73,
-	0x6F, 0x6E, 0x4D, 0x61, 0x73, 0x6B, 0x00, 0x72, 0x65, 0x61, 0x73, 0x6F,
-	0x6E, 0x4D, 0x61, 0x73, 0x6B, 0x00, 0x41, 0x6C, 0x6C, 0x6F, 0x63, 0x48,
-	0x47, 0x6C, 0x6F, 0x62, 0x61, 0x6C, 0x00, 0x46, 0x72, 0x65, 0x65, 0x48,
-	0x47, 0x6C, 0x6F, 0x62, 0x61, 0x6C, 0x00, 0x4D, 0x61, 0x72, 0x73, 0x68,
-	0x61, 0x6C, 0x00, 0x4E, 0x74, 0x66, 0x73, 0x55, 0x73, 0x6E, 0x4A, 0x6F,
-	0x75, 0x72, 0x6E, 0x61, 0x6C, 0x00, 0x51, 0x75, 0x65, 0x72, 0x79, 0x55,
-	0x73, 0x6E, 0x4A, 0x6F, 0x75, 0x72, 0x6E, 0x61, 0x6C, 0x00, 0x53, 0x79,
-	0x73, 0x74, 0x65, 0x6D, 0x2E, 0x43, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65,
-	0x6E, 0x74, 0x4D, 0x6F, 0x64, 0x65, 0x6C, 0x00, 0x41, 0x6C, 0x6C, 0x00,
-	0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x33, 0x32, 0x2E, 0x64, 0x6C, 0x6C,
-	0x00, 0x6E, 0x74, 0x64, 0x6C, 0x6C, 0x2E, 0x64, 0x6C, 0x6C, 0x00, 0x44,
-	0x65, 0x76, 0x69, 0x63, 0x65, 0x49, 0x6F, 0x43, 0x6F, 0x6E, 0x74, 0x72,
-	0x6F, 0x6C, 0x00, 0x50, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x00, 0x67,
-	0x65, 0x74, 0x5F, 0x49, 0x74, 0x65, 0x6D, 0x00, 0x53, 0x79, 0x73, 0x74,
-	0x65, 0x6D, 0x00, 0x74, 0x65, 0x72, 0x6D, 0x00, 0x47, 0x65, 0x74, 0x4C,
-	0x61, 0x73, 0x74, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x45, 0x6E, 0x75, 0x6D,
-	0x00, 0x6C, 0x70, 0x4E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x4F, 0x66, 0x42,
-	0x79, 0x74, 0x65, 0x73, 0x57, 0x72, 0x69, 0x74, 0x74, 0x65, 0x6E, 0x00,
-	0x4D, 0x69, 0x6E, 0x00, 0x4D, 0x61, 0x69, 0x6E, 0x00, 0x41, 0x70, 0x70,
-	0x44, 0x6F, 0x6D, 0x61, 0x69, 0x6E, 0x00, 0x67, 0x65, 0x74, 0x5F, 0x43,
-	0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x44, 0x6F, 0x6D, 0x61, 0x69, 0x6E,
-	0x00, 0x4A, 0x6F, 0x69, 0x6E, 0x00, 0x67, 0x65, 0x74, 0x5F, 0x4D, 0x61,
-	0x6A, 0x6F, 0x72, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x00, 0x67,
-	0x65, 0x74, 0x5F, 0x4D, 0x69, 0x6E, 0x6F, 0x72, 0x56, 0x65, 0x72, 0x73,
-	0x69, 0x6F, 0x6E, 0x00, 0x46, 0x69, 0x6C, 0x65, 0x45, 0x61, 0x49, 0x6E,
-	0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x46, 0x69,
-	0x6C, 0x65, 0x46, 0x75, 0x6C, 0x6C, 0x45, 0x61, 0x49, 0x6E, 0x66, 0x6F,
-	0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x46, 0x69, 0x6C, 0x65,
-	0x51, 0x75, 0x6F, 0x74, 0x61, 0x49, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61,
-	0x74, 0x69, 0x6F, 0x6E, 0x00, 0x46, 0x69, 0x6C, 0x65, 0x42, 0x61, 0x73,
-	0x69, 0x63, 0x49, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F,
-	0x6E, 0x00, 0x46, 0x69, 0x6C, 0x65, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74,
-	0x49, 0x64, 0x49, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F,
-	0x6E, 0x00, 0x46, 0x69, 0x6C, 0x65, 0x53, 0x74, 0x61, 0x6E, 0x64, 0x61,
-	0x72, 0x64, 0x49, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F,
-	0x6E, 0x00, 0x46, 0x69, 0x6C, 0x65, 0x4D, 0x6F, 0x64, 0x65, 0x49, 0x6E,
-	0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x46, 0x69,
-	0x6C, 0x65, 0x45, 0x6E, 0x64, 0x4F, 0x66, 0x46, 0x69, 0x6C, 0x65, 0x49,
-	0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x6C,
-	0x70, 0x46, 0x69, 0x6C, 0x65, 0x49, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61,
-	0x74, 0x69, 0x6F, 0x6E, 0x00, 0x66, 0x69, 0x6C, 0x65, 0x49, 0x6E, 0x66,
-	0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x46, 0x69, 0x6C,
-	0x65, 0x4E, 0x61, 0x6D, 0x65, 0x49, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61,
-	0x74, 0x69, 0x6F, 0x6E, 0x00, 0x46, 0x69, 0x6C, 0x65, 0x41, 0x6C, 0x74,
-	0x65, 0x72, 0x6E, 0x61, 0x74, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x49, 0x6E,
-	0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x46, 0x69,
-	0x6C, 0x65, 0x53, 0x68, 0x6F, 0x72, 0x74, 0x4E, 0x61, 0x6D, 0x65, 0x49,
-	0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x46,
-	0x69, 0x6C, 0x65, 0x52, 0x65, 0x6E, 0x61, 0x6D, 0x65, 0x49, 0x6E, 0x66,
-	0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x46, 0x69, 0x6C,
-	0x65, 0x50, 0x69, 0x70, 0x65, 0x49, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61,
-	0x74, 0x69, 0x6F, 0x6E, 0x00, 0x46, 0x69, 0x6C, 0x65, 0x50, 0x69, 0x70,
-	0x65, 0x52, 0x65, 0x6D, 0x6F, 0x74, 0x65, 0x49, 0x6E, 0x66, 0x6F, 0x72,
-	0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x46, 0x69, 0x6C, 0x65, 0x41,
-	0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x54, 0x61, 0x67, 0x49,
-	0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x46,
-	0x69, 0x6C, 0x65, 0x54, 0x72, 0x61, 0x63, 0x6B, 0x69, 0x6E, 0x67, 0x49,
-	0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x46,
-	0x69, 0x6C, 0x65, 0x56, 0x61, 0x6C, 0x69, 0x64, 0x44, 0x61, 0x74, 0x61,
-	0x4C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x49, 0x6E, 0x66, 0x6F, 0x72, 0x6D,
-	0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x46, 0x69, 0x6C, 0x65, 0x48, 0x61,
-	0x72, 0x64, 0x4C, 0x69, 0x6E, 0x6B, 0x49, 0x6E, 0x66, 0x6F, 0x72, 0x6D,
-	0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x46, 0x69, 0x6C, 0x65, 0x4C, 0x69,
-	0x6E, 0x6B, 0x49, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F,
-	0x6E, 0x00, 0x46, 0x69, 0x6C, 0x65, 0x50, 0x69, 0x70, 0x65, 0x4C, 0x6F,
-	0x63, 0x61, 0x6C, 0x49, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69,
-	0x6F, 0x6E, 0x00, 0x46, 0x69, 0x6C, 0x65, 0x49, 0x6E, 0x74, 0x65, 0x72,
-	0x6E, 0x61, 0x6C, 0x49, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69,
-	0x6F, 0x6E, 0x00, 0x46, 0x69, 0x6C, 0x65, 0x41, 0x6C, 0x6C, 0x49, 0x6E,
-	0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x46, 0x69,
-	0x6C, 0x65, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x49, 0x6E, 0x66, 0x6F,
-	0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x46, 0x69, 0x6C, 0x65,
-	0x4E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x4F, 0x70, 0x65, 0x6E, 0x49,
-	0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x46,
-	0x69, 0x6C, 0x65, 0x43, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69,
-	0x6F, 0x6E, 0x49, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F,
-	0x6E, 0x00, 0x46, 0x69, 0x6C, 0x65, 0x41, 0x6C, 0x6C, 0x6F, 0x63, 0x61,
-	0x74, 0x69, 0x6F, 0x6E, 0x49, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74,
-	0x69, 0x6F, 0x6E, 0x00, 0x46, 0x69, 0x6C, 0x65, 0x43, 0x6F, 0x6D, 0x70,
-	0x6C, 0x65, 0x74, 0x69, 0x6F, 0x6E, 0x49, 0x6E, 0x66, 0x6F, 0x72, 0x6D,
-	0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x46, 0x69, 0x6C, 0x65, 0x50, 0x6F,
-	0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x49, 0x6E, 0x66, 0x6F, 0x72, 0x6D,
-	0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x46, 0x69, 0x6C, 0x65, 0x44, 0x69,
-	0x73, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x49, 0x6E, 0x66,
-	0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x46, 0x69, 0x6C,
-	0x65, 0x4D, 0x6F, 0x76, 0x65, 0x43, 0x6C, 0x75, 0x73, 0x74, 0x65, 0x72,
-	0x49, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00,
-	0x46, 0x69, 0x6C, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x73, 0x49, 0x6E, 0x66,
-	0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x46, 0x69, 0x6C,
-	0x65, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x49, 0x6E, 0x66, 0x6F, 0x72,
-	0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x46, 0x69, 0x6C, 0x65, 0x4D,
-	0x61, 0x69, 0x6C, 0x73, 0x6C, 0x6F, 0x74, 0x53, 0x65, 0x74, 0x49, 0x6E,
-	0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x46, 0x69,
-	0x6C, 0x65, 0x41, 0x6C, 0x69, 0x67, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x49,
-	0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x46,
-	0x69, 0x6C, 0x65, 0x52, 0x65, 0x70, 0x61, 0x72, 0x73, 0x65, 0x50, 0x6F,
-	0x69, 0x6E, 0x74, 0x49, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69,
-	0x6F, 0x6E, 0x00, 0x46, 0x69, 0x6C, 0x65, 0x4D, 0x61, 0x69, 0x6C, 0x73,
-	0x6C, 0x6F, 0x74, 0x51, 0x75, 0x65, 0x72, 0x79, 0x49, 0x6E, 0x66, 0x6F,
-	0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x46, 0x69, 0x6C, 0x65,
-	0x44, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x49, 0x6E, 0x66,
-	0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x46, 0x69, 0x6C,
-	0x65, 0x49, 0x64, 0x42, 0x6F, 0x74, 0x68, 0x44, 0x69, 0x72, 0x65, 0x63,
-	0x74, 0x6F, 0x72, 0x79, 0x49, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74,
-	0x69, 0x6F, 0x6E, 0x00, 0x46, 0x69, 0x6C, 0x65, 0x42, 0x6F, 0x74, 0x68,
-	0x44, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x49, 0x6E, 0x66,
-	0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x46, 0x69, 0x6C,
-	0x65, 0x49, 0x64, 0x46, 0x75, 0x6C, 0x6C, 0x44, 0x69, 0x72, 0x65, 0x63,
-	0x74, 0x6F, 0x72, 0x79, 0x49, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74,
-	0x69, 0x6F, 0x6E, 0x00, 0x46, 0x69, 0x6C, 0x65, 0x46, 0x75, 0x6C, 0x6C,
-	0x44, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x49, 0x6E, 0x66,
-	0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x69, 0x6E, 0x66,
-	0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x53, 0x79, 0x73,
-	0x74, 0x65, 0x6D, 0x2E, 0x52, 0x65, 0x66, 0x6C, 0x65, 0x63, 0x74, 0x69,
-	0x6F, 0x6E, 0x00, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x44, 0x69, 0x73,
-	0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x64, 0x77, 0x43,
-	0x72, 0x65, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x44, 0x69, 0x73, 0x70, 0x6F,
-	0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x57, 0x69, 0x6E, 0x33, 0x32,
-	0x45, 0x78, 0x63, 0x65, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x67, 0x65,
-	0x74, 0x5F, 0x52, 0x65, 0x61, 0x73, 0x6F, 0x6E, 0x00, 0x72, 0x65, 0x61,
-	0x73, 0x6F, 0x6E, 0x00, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x43, 0x6F,
-	0x6D, 0x70, 0x61, 0x72, 0x69, 0x73, 0x6F, 0x6E, 0x00, 0x44, 0x65, 0x74,
-	0x65, 0x63, 0x74, 0x54, 0x79, 0x70, 0x65, 0x50, 0x61, 0x74, 0x74, 0x65,
-	0x72, 0x6E, 0x00, 0x57, 0x72, 0x69, 0x74, 0x65, 0x50, 0x61, 0x74, 0x74,
-	0x65, 0x72, 0x6E, 0x00, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x50, 0x61, 0x74,
-	0x74, 0x65, 0x72, 0x6E, 0x00, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E,
-	0x00, 0x4C, 0x6F, 0x77, 0x65, 0x73, 0x74, 0x56, 0x61, 0x6C, 0x69, 0x64,
-	0x55, 0x73, 0x6E, 0x00, 0x53, 0x74, 0x61, 0x72, 0x74, 0x55, 0x73, 0x6E,
-	0x00, 0x46, 0x69, 0x72, 0x73, 0x74, 0x55, 0x73, 0x6E, 0x00, 0x4E, 0x65,
-	0x78, 0x74, 0x55, 0x73, 0x6E, 0x00, 0x4D, 0x61, 0x78, 0x55, 0x73, 0x6E,
-	0x00, 0x67, 0x65, 0x74, 0x5F, 0x53, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x49,
-	0x6E, 0x66, 0x6F, 0x00, 0x44, 0x72, 0x69, 0x76, 0x65, 0x49, 0x6E, 0x66,
-	0x6F, 0x00, 0x5F, 0x64, 0x72, 0x69, 0x76, 0x65, 0x49, 0x6E, 0x66, 0x6F,
-	0x00, 0x5A, 0x65, 0x72, 0x6F, 0x00, 0x67, 0x65, 0x74, 0x5F, 0x54, 0x69,
-	0x6D, 0x65, 0x53, 0x74, 0x61, 0x6D, 0x70, 0x00, 0x53, 0x74, 0x6F, 0x70,
-	0x00, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x2E, 0x4C, 0x69, 0x6E, 0x71,
-	0x00, 0x43, 0x68, 0x61, 0x72, 0x00, 0x67, 0x65, 0x74, 0x5F, 0x46, 0x69,
-	0x6C, 0x65, 0x52, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6E, 0x63, 0x65, 0x4E,
-	0x75, 0x6D, 0x62, 0x65, 0x72, 0x00, 0x67, 0x65, 0x74, 0x5F, 0x50, 0x61,
-	0x72, 0x65, 0x6E, 0x74, 0x46, 0x69, 0x6C, 0x65, 0x52, 0x65, 0x66, 0x65,
-	0x72, 0x65, 0x6E, 0x63, 0x65, 0x4E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x00,
-	0x47, 0x65, 0x74, 0x56, 0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x53, 0x65, 0x72,
-	0x69, 0x61, 0x6C, 0x4E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x00, 0x5F, 0x76,
-	0x6F, 0x6C, 0x75, 0x6D, 0x65, 0x53, 0x65, 0x72, 0x69, 0x61, 0x6C, 0x4E,
-	0x75, 0x6D, 0x62, 0x65, 0x72, 0x00, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72,
-	0x00, 0x67, 0x65, 0x74, 0x5F, 0x49, 0x73, 0x46, 0x6F, 0x6C, 0x64, 0x65,
-	0x72, 0x00, 0x65, 0x61, 0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x00, 0x6C,
-	0x70, 0x49, 0x6E, 0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x00, 0x6C, 0x70,
-	0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x00, 0x6C, 0x70, 0x4F, 0x75, 0x74,
-	0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x00, 0x53, 0x74, 0x72, 0x65, 0x61,
-	0x6D, 0x57, 0x72, 0x69, 0x74, 0x65, 0x72, 0x00, 0x54, 0x65, 0x78, 0x74,
-	0x57, 0x72, 0x69, 0x74, 0x65, 0x72, 0x00, 0x77, 0x72, 0x69, 0x74, 0x65,
-	0x72, 0x00, 0x62, 0x79, 0x74, 0x65, 0x73, 0x54, 0x6F, 0x57, 0x61, 0x69,
-	0x74, 0x46, 0x6F, 0x72, 0x00, 0x47, 0x65, 0x74, 0x4C, 0x61, 0x73, 0x74,
-	0x57, 0x69, 0x6E, 0x33, 0x32, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x00, 0x43,
-	0x6F, 0x6E, 0x76, 0x65, 0x72, 0x74, 0x57, 0x69, 0x6E, 0x33, 0x32, 0x45,
-	0x72, 0x72, 0x6F, 0x72, 0x54, 0x6F, 0x55, 0x73, 0x6E, 0x45, 0x72, 0x72,
-	0x6F, 0x72, 0x00, 0x57, 0x69, 0x6E, 0x33, 0x32, 0x4C, 0x61, 0x73, 0x74,
-	0x45, 0x72, 0x72, 0x6F, 0x72, 0x00, 0x49, 0x45, 0x6E, 0x75, 0x6D, 0x65,
-	0x72, 0x61, 0x74, 0x6F, 0x72, 0x00, 0x47, 0x65, 0x74, 0x45, 0x6E, 0x75,
-	0x6D, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x00, 0x2E, 0x63, 0x74, 0x6F,
-	0x72, 0x00, 0x2E, 0x63, 0x63, 0x74, 0x6F, 0x72, 0x00, 0x53, 0x65, 0x63,
-	0x75, 0x72, 0x69, 0x74, 0x79, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
-	0x74, 0x6F, 0x72, 0x00, 0x53, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72,
-	0x65, 0x54, 0x6F, 0x50, 0x74, 0x72, 0x00, 0x49, 0x6E, 0x74, 0x50, 0x74,
-	0x72, 0x00, 0x70, 0x74, 0x72, 0x00, 0x65, 0x6C, 0x61, 0x70, 0x73, 0x65,
-	0x64, 0x4D, 0x73, 0x00, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x2E, 0x44,
-	0x69, 0x61, 0x67, 0x6E, 0x6F, 0x73, 0x74, 0x69, 0x63, 0x73, 0x00, 0x67,
-	0x65, 0x74, 0x5F, 0x45, 0x6C, 0x61, 0x70, 0x73, 0x65, 0x64, 0x4D, 0x69,
-	0x6C, 0x6C, 0x69, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x73, 0x00, 0x53,
-	0x79, 0x73, 0x74, 0x65, 0x6D, 0x2E, 0x52, 0x75, 0x6E, 0x74, 0x69, 0x6D,
-	0x65, 0x2E, 0x49, 0x6E, 0x74, 0x65, 0x72, 0x6F, 0x70, 0x53, 0x65, 0x72,
-	0x76, 0x69, 0x63, 0x65, 0x73, 0x00, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6D,
-	0x2E, 0x52, 0x75, 0x6E, 0x74, 0x69, 0x6D, 0x65, 0x2E, 0x43, 0x6F, 0x6D,
-	0x70, 0x69, 0x6C, 0x65, 0x72, 0x53, 0x65, 0x72, 0x76, 0x69, 0x63, 0x65,
-	0x73, 0x00, 0x44, 0x65, 0x62, 0x75, 0x67, 0x67, 0x69, 0x6E, 0x67, 0x4D,
-	0x6F, 0x64, 0x65, 0x73, 0x00, 0x44, 0x65, 0x74, 0x65, 0x63, 0x74, 0x44,
-	0x65, 0x6C, 0x65, 0x74, 0x65, 0x45, 0x6E, 0x74, 0x72, 0x69, 0x65, 0x73,
-	0x00, 0x47, 0x65, 0x74, 0x55, 0x73, 0x6E, 0x4A, 0x6F, 0x75, 0x72, 0x6E,
-	0x61, 0x6C, 0x45, 0x6E, 0x74, 0x72, 0x69, 0x65, 0x73, 0x00, 0x75, 0x73,
-	0x6E, 0x45, 0x6E, 0x74, 0x72, 0x69, 0x65, 0x73, 0x00, 0x65, 0x6E, 0x74,
-	0x72, 0x69, 0x65, 0x73, 0x00, 0x52, 0x65, 0x61, 0x64, 0x41, 0x6C, 0x6C,
-	0x4C, 0x69, 0x6E, 0x65, 0x73, 0x00, 0x57, 0x72, 0x69, 0x74, 0x65, 0x41,
-	0x6C, 0x6C, 0x4C, 0x69, 0x6E, 0x65, 0x73, 0x00, 0x53, 0x79, 0x73, 0x74,
-	0x65, 0x6D, 0x2E, 0x52, 0x75, 0x6E, 0x74, 0x69, 0x6D, 0x65, 0x2E, 0x49,
-	0x6E, 0x74, 0x65, 0x72, 0x6F, 0x70, 0x53, 0x65, 0x72, 0x76, 0x69, 0x63,
-	0x65, 0x73, 0x2E, 0x43, 0x6F, 0x6D, 0x54, 0x79, 0x70, 0x65, 0x73, 0x00,
-	0x64, 0x77, 0x46, 0x6C, 0x61, 0x67, 0x73, 0x41, 0x6E, 0x64, 0x41, 0x74,
-	0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x73, 0x00, 0x67, 0x65, 0x74,
-	0x5F, 0x46, 0x69, 0x6C, 0x65, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75,
-	0x74, 0x65, 0x73, 0x00, 0x66, 0x69, 0x6C, 0x65, 0x41, 0x74, 0x74, 0x72,
-	0x69, 0x62, 0x75, 0x74, 0x65, 0x73, 0x00, 0x6F, 0x62, 0x6A, 0x65, 0x63,
-	0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x73, 0x00,
-	0x6C, 0x70, 0x53, 0x65, 0x63, 0x75, 0x72, 0x69, 0x74, 0x79, 0x41, 0x74,
-	0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x73, 0x00, 0x62, 0x79, 0x74,
-	0x65, 0x73, 0x00, 0x47, 0x65, 0x74, 0x44, 0x72, 0x69, 0x76, 0x65, 0x73,
-	0x00, 0x61, 0x72, 0x67, 0x73, 0x00, 0x4E, 0x75, 0x6D, 0x62, 0x65, 0x72,
-	0x4F, 0x66, 0x4C, 0x69, 0x6E, 0x6B, 0x73, 0x00, 0x45, 0x71, 0x75, 0x61,
-	0x6C, 0x73, 0x00, 0x43, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x73, 0x00,
-	0x53, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x2E, 0x43, 0x6F, 0x6C, 0x6C, 0x65,
-	0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x00, 0x63, 0x72, 0x65, 0x61, 0x74,
-	0x65, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x00, 0x72, 0x65, 0x61,
-	0x73, 0x6F, 0x6E, 0x73, 0x00, 0x46, 0x69, 0x6C, 0x65, 0x4E, 0x61, 0x6D,
-	0x65, 0x49, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E,
-	0x43, 0x6C, 0x61, 0x73, 0x73, 0x00, 0x64, 0x77, 0x44, 0x65, 0x73, 0x69,
-	0x72, 0x65, 0x64, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x00, 0x46, 0x69,
-	0x6C, 0x65, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x00, 0x61, 0x63, 0x63,
-	0x65, 0x73, 0x73, 0x00, 0x50, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x00,
-	0x69, 0x6F, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x00, 0x73, 0x74, 0x61,
-	0x74, 0x75, 0x73, 0x00, 0x43, 0x6F, 0x6E, 0x63, 0x61, 0x74, 0x00, 0x46,
-	0x6F, 0x72, 0x6D, 0x61, 0x74, 0x00, 0x68, 0x4F, 0x62, 0x6A, 0x65, 0x63,
-	0x74, 0x00, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x00, 0x44, 0x65, 0x74,
-	0x65, 0x63, 0x74, 0x45, 0x78, 0x70, 0x6C, 0x6F, 0x72, 0x65, 0x72, 0x52,
-	0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x44,
-	0x65, 0x74, 0x65, 0x63, 0x74, 0x43, 0x6F, 0x70, 0x79, 0x52, 0x65, 0x70,
-	0x6C, 0x61, 0x63, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x00, 0x67, 0x65, 0x74,
-	0x5F, 0x43, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x00, 0x67, 0x65, 0x74,
-	0x5F, 0x43, 0x6F, 0x75, 0x6E, 0x74, 0x00, 0x63, 0x6F, 0x75, 0x6E, 0x74,
-	0x00, 0x53, 0x74, 0x61, 0x72, 0x74, 0x00, 0x49, 0x6E, 0x73, 0x65, 0x72,
-	0x74, 0x00, 0x54, 0x6F, 0x4C, 0x69, 0x73, 0x74, 0x00, 0x54, 0x69, 0x6D,
-	0x65, 0x6F, 0x75, 0x74, 0x00, 0x4D, 0x6F, 0x76, 0x65, 0x4E, 0x65, 0x78,
-	0x74, 0x00, 0x47, 0x65, 0x74, 0x52, 0x65, 0x61, 0x73, 0x6F, 0x6E, 0x54,
-	0x65, 0x78, 0x74, 0x00, 0x53, 0x74, 0x61, 0x72, 0x74, 0x4E, 0x65, 0x77,
-	0x00, 0x46, 0x69, 0x6C, 0x65, 0x53, 0x69, 0x7A, 0x65, 0x4C, 0x6F, 0x77,
-	0x00, 0x46, 0x69, 0x6C, 0x65, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x4C, 0x6F,
-	0x77, 0x00, 0x67, 0x65, 0x74, 0x5F, 0x4E, 0x6F, 0x77, 0x00, 0x4D, 0x61,
-	0x78, 0x00, 0x73, 0x74, 0x61, 0x72, 0x74, 0x49, 0x6E, 0x64, 0x65, 0x78,
-	0x00, 0x41, 0x6E, 0x79, 0x00, 0x5A, 0x65, 0x72, 0x6F, 0x4D, 0x65, 0x6D,
-	0x6F, 0x72, 0x79, 0x00, 0x67, 0x65, 0x74, 0x5F, 0x42, 0x61, 0x73, 0x65,
-	0x44, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x00, 0x52, 0x6F,
-	0x6F, 0x74, 0x44, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x00,
-	0x55, 0x73, 0x6E, 0x45, 0x6E, 0x74, 0x72, 0x79, 0x00, 0x45, 0x6D, 0x70,
-	0x74, 0x79, 0x00, 0x00, 0x00, 0x09, 0x5C, 0x00, 0x5C, 0x00, 0x2E, 0x00,
-	0x5C, 0x00, 0x00, 0x21, 0x53, 0x00, 0x63, 0x00, 0x61, 0x00, 0x6E, 0x00,
-	0x6E, 0x00, 0x69, 0x00, 0x6E, 0x00, 0x67, 0x00, 0x20, 0x00, 0x64, 0x00,
-	0x72, 0x00, 0x69, 0x00, 0x76, 0x00, 0x65, 0x00, 0x3A, 0x00, 0x20, 0x00,
-	0x00, 0x33, 0x44, 0x00, 0x61, 0x00, 0x74, 0x00, 0x61, 0x00, 0x20, 0x00,
-	0x68, 0x00, 0x61, 0x00, 0x73, 0x00, 0x20, 0x00, 0x62, 0x00, 0x65, 0x00,
-	0x65, 0x00, 0x6E, 0x00, 0x20, 0x00, 0x77, 0x00, 0x72, 0x00, 0x69, 0x00,
-	0x74, 0x00, 0x74, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x20, 0x00, 0x74, 0x00,
-	0x6F, 0x00, 0x20, 0x00, 0x00, 0x17, 0x6E, 0x00, 0x6F, 0x00, 0x74, 0x00,
-	0x65, 0x00, 0x70, 0x00, 0x61, 0x00, 0x64, 0x00, 0x2E, 0x00, 0x65, 0x00,
-	0x78, 0x00, 0x65, 0x00, 0x00, 0x27, 0x41, 0x00, 0x6E, 0x00, 0x20, 0x00,
-	0x65, 0x00, 0x72, 0x00, 0x72, 0x00, 0x6F, 0x00, 0x72, 0x00, 0x20, 0x00,
-	0x6F, 0x00, 0x63, 0x00, 0x63, 0x00, 0x75, 0x00, 0x72, 0x00, 0x72, 0x00,
-	0x65, 0x00, 0x64, 0x00, 0x3A, 0x00, 0x20, 0x00, 0x00, 0x1D, 0x75, 0x00,
-	0x73, 0x00, 0x6E, 0x00, 0x6A, 0x00, 0x6F, 0x00, 0x75, 0x00, 0x72, 0x00,
-	0x6E, 0x00, 0x61, 0x00, 0x6C, 0x00, 0x2E, 0x00, 0x74, 0x00, 0x78, 0x00,
-	0x74, 0x00, 0x00, 0x2D, 0x45, 0x00, 0x78, 0x00, 0x65, 0x00, 0x63, 0x00,
-	0x75, 0x00, 0x74, 0x00, 0x69, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x20, 0x00,
-	0x74, 0x00, 0x69, 0x00, 0x6D, 0x00, 0x65, 0x00, 0x3A, 0x00, 0x20, 0x00,
-	0x7B, 0x00, 0x30, 0x00, 0x7D, 0x00, 0x20, 0x00, 0x6D, 0x00, 0x73, 0x00,
-	0x00, 0x80, 0x95, 0x46, 0x00, 0x61, 0x00, 0x69, 0x00, 0x6C, 0x00, 0x65,
-	0x00, 0x64, 0x00, 0x20, 0x00, 0x74, 0x00, 0x6F, 0x00, 0x20, 0x00, 0x67,
-	0x00, 0x65, 0x00, 0x74, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65,
-	0x00, 0x20, 0x00, 0x73, 0x00, 0x74, 0x00, 0x61, 0x00, 0x74, 0x00, 0x65,
-	0x00, 0x20, 0x00, 0x6F, 0x00, 0x66, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68,
-	0x00, 0x65, 0x00, 0x20, 0x00, 0x55, 0x00, 0x53, 0x00, 0x4E, 0x00, 0x20,
-	0x00, 0x4A, 0x00, 0x6F, 0x00, 0x75, 0x00, 0x72, 0x00, 0x6E, 0x00, 0x61,
-	0x00, 0x6C, 0x00, 0x20, 0x00, 0x66, 0x00, 0x6F, 0x00, 0x72, 0x00, 0x20,
-	0x00, 0x64, 0x00, 0x72, 0x00, 0x69, 0x00, 0x76, 0x00, 0x65, 0x00, 0x20,
-	0x00, 0x7B, 0x00, 0x30, 0x00, 0x7D, 0x00, 0x2E, 0x00, 0x20, 0x00, 0x52,
-	0x00, 0x65, 0x00, 0x74, 0x00, 0x75, 0x00, 0x72, 0x00, 0x6E, 0x00, 0x20,
-	0x00, 0x63, 0x00, 0x6F, 0x00, 0x64, 0x00, 0x65, 0x00, 0x3A, 0x00, 0x20,
-	0x00, 0x7B, 0x00, 0x31, 0x00, 0x7D, 0x00, 0x00, 0x4F, 0x46, 0x00, 0x61,
-	0x00, 0x69, 0x00, 0x6C, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x74,
-	0x00, 0x6F, 0x00, 0x20, 0x00, 0x72, 0x00, 0x65, 0x00, 0x74, 0x00, 0x72,
-	0x00, 0x69, 0x00, 0x65, 0x00, 0x76, 0x00, 0x65, 0x00, 0x20, 0x00, 0x55,
-	0x00, 0x53, 0x00, 0x4E, 0x00, 0x20, 0x00, 0x4A, 0x00, 0x6F, 0x00, 0x75,
-	0x00, 0x72, 0x00, 0x6E, 0x00, 0x61, 0x00, 0x6C, 0x00, 0x20, 0x00, 0x65,
-	0x00, 0x6E, 0x00, 0x74, 0x00, 0x72, 0x00, 0x69, 0x00, 0x65, 0x00, 0x73,
-	0x00, 0x2E, 0x00, 0x00, 0x4B, 0x54, 0x00, 0x6F, 0x00, 0x74, 0x00, 0x61,
-	0x00, 0x6C, 0x00, 0x20, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x74, 0x00, 0x72,
-	0x00, 0x69, 0x00, 0x65, 0x00, 0x73, 0x00, 0x20, 0x00, 0x69, 0x00, 0x6E,
-	0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x55,
-	0x00, 0x53, 0x00, 0x4E, 0x00, 0x20, 0x00, 0x4A, 0x00, 0x6F, 0x00, 0x75,
-	0x00, 0x72, 0x00, 0x6E, 0x00, 0x61, 0x00, 0x6C, 0x00, 0x3A, 0x00, 0x20,
-	0x00, 0x7B, 0x00, 0x30, 0x00, 0x7D, 0x00, 0x00, 0x37, 0x4F, 0x00, 0x6C,
-	0x00, 0x64, 0x00, 0x65, 0x00, 0x73, 0x00, 0x74, 0x00, 0x20, 0x00, 0x65,
-	0x00, 0x6E, 0x00, 0x74, 0x00, 0x72, 0x00, 0x79, 0x00, 0x20, 0x00, 0x74,
-	0x00, 0x69, 0x00, 0x6D, 0x00, 0x65, 0x00, 0x73, 0x00, 0x74, 0x00, 0x61,
-	0x00, 0x6D, 0x00, 0x70, 0x00, 0x3A, 0x00, 0x20, 0x00, 0x7B, 0x00, 0x30,
-	0x00, 0x7D, 0x00, 0x00, 0x37, 0x4E, 0x00, 0x65, 0x00, 0x77, 0x00, 0x65,
-	0x00, 0x73, 0x00, 0x74, 0x00, 0x20, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x74,
-	0x00, 0x72, 0x00, 0x79, 0x00, 0x20, 0x00, 0x74, 0x00, 0x69, 0x00, 0x6D,
-	0x00, 0x65, 0x00, 0x73, 0x00, 0x74, 0x00, 0x61, 0x00, 0x6D, 0x00, 0x70,
-	0x00, 0x3A, 0x00, 0x20, 0x00, 0x7B, 0x00, 0x30, 0x00, 0x7D, 0x00, 0x00,
-	0x49, 0x4E, 0x00, 0x6F, 0x00, 0x20, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x74,
-	0x00, 0x72, 0x00, 0x69, 0x00, 0x65, 0x00, 0x73, 0x00, 0x20, 0x00, 0x66,
-	0x00, 0x6F, 0x00, 0x75, 0x00, 0x6E, 0x00, 0x64, 0x00, 0x20, 0x00, 0x69,
-	0x00, 0x6E, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20,
-	0x00, 0x55, 0x00, 0x53, 0x00, 0x4E, 0x00, 0x20, 0x00, 0x4A, 0x00, 0x6F,
-	0x00, 0x75, 0x00, 0x72, 0x00, 0x6E, 0x00, 0x61, 0x00, 0x6C, 0x00, 0x2E,
-	0x00, 0x00, 0x39, 0x55, 0x00, 0x53, 0x00, 0x4E, 0x00, 0x20, 0x00, 0x4A,
-	0x00, 0x6F, 0x00, 0x75, 0x00, 0x72, 0x00, 0x6E, 0x00, 0x61, 0x00, 0x6C,
-	0x00, 0x20, 0x00, 0x53, 0x00, 0x74, 0x00, 0x61, 0x00, 0x74, 0x00, 0x65,
-	0x00, 0x20, 0x00, 0x66, 0x00, 0x6F, 0x00, 0x72, 0x00, 0x20, 0x00, 0x64,
-	0x00, 0x72, 0x00, 0x69, 0x00, 0x76, 0x00, 0x65, 0x00, 0x20, 0x00, 0x00,
-	0x03, 0x3A, 0x00, 0x00, 0x1F, 0x4A, 0x00, 0x6F, 0x00, 0x75, 0x00, 0x72,
-	0x00, 0x6E, 0x00, 0x61, 0x00, 0x6C, 0x00, 0x20, 0x00, 0x49, 0x00, 0x44,
-	0x00, 0x3A, 0x00, 0x20, 0x00, 0x7B, 0x00, 0x30, 0x00, 0x7D, 0x00, 0x00,
-	0x1D, 0x46, 0x00, 0x69, 0x00, 0x72, 0x00, 0x73, 0x00, 0x74, 0x00, 0x20,
-	0x00, 0x55, 0x00, 0x53, 0x00, 0x4E, 0x00, 0x3A, 0x00, 0x20, 0x00, 0x7B,
-	0x00, 0x30, 0x00, 0x7D, 0x00, 0x00, 0x1B, 0x4E, 0x00, 0x65, 0x00, 0x78,
-	0x00, 0x74, 0x00, 0x20, 0x00, 0x55, 0x00, 0x53, 0x00, 0x4E, 0x00, 0x3A,
-	0x00, 0x20, 0x00, 0x7B, 0x00, 0x30, 0x00, 0x7D, 0x00, 0x00, 0x2B, 0x4C,
-	0x00, 0x6F, 0x00, 0x77, 0x00, 0x65, 0x00, 0x73, 0x00, 0x74, 0x00, 0x20,
-	0x00, 0x56, 0x00, 0x61, 0x00, 0x6C, 0x00, 0x69, 0x00, 0x64, 0x00, 0x20,
-	0x00, 0x55, 0x00, 0x53, 0x00, 0x4E, 0x00, 0x3A, 0x00, 0x20, 0x00, 0x7B,
-	0x00, 0x30, 0x00, 0x7D, 0x00, 0x00, 0x19, 0x4D, 0x00, 0x61, 0x00, 0x78,
-	0x00, 0x20, 0x00, 0x55, 0x00, 0x53, 0x00, 0x4E, 0x00, 0x3A, 0x00, 0x20,
-	0x00, 0x7B, 0x00, 0x30, 0x00, 0x7D, 0x00, 0x00, 0x23, 0x4D, 0x00, 0x61,
-	0x00, 0x78, 0x00, 0x69, 0x00, 0x6D, 0x00, 0x75, 0x00, 0x6D, 0x00, 0x20,
-	0x00, 0x53, 0x00, 0x69, 0x00, 0x7A, 0x00, 0x65, 0x00, 0x3A, 0x00, 0x20,
-	0x00, 0x7B, 0x00, 0x30, 0x00, 0x7D, 0x00, 0x00, 0x2B, 0x41, 0x00, 0x6C,
-	0x00, 0x6C, 0x00, 0x6F, 0x00, 0x63, 0x00, 0x61, 0x00, 0x74, 0x00, 0x69,
-	0x00, 0x6F, 0x00, 0x6E, 0x00, 0x20, 0x00, 0x44, 0x00, 0x65, 0x00, 0x6C,
-	0x00, 0x74, 0x00, 0x61, 0x00, 0x3A, 0x00, 0x20, 0x00, 0x7B, 0x00, 0x30,
-	0x00, 0x7D, 0x00, 0x00, 0x17, 0x44, 0x00, 0x61, 0x00, 0x74, 0x00, 0x61,
-	0x00, 0x20, 0x00, 0x65, 0x00, 0x78, 0x00, 0x74, 0x00, 0x65, 0x00, 0x6E,
-	0x00, 0x64, 0x00, 0x00, 0x1F, 0x44, 0x00, 0x61, 0x00, 0x74, 0x00, 0x61,
-	0x00, 0x20, 0x00, 0x74, 0x00, 0x72, 0x00, 0x75, 0x00, 0x6E, 0x00, 0x63,
-	0x00, 0x61, 0x00, 0x74, 0x00, 0x69, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x00,
-	0x0B, 0x43, 0x00, 0x6C, 0x00, 0x6F, 0x00, 0x73, 0x00, 0x65, 0x00, 0x00,
-	0x39, 0x54, 0x00, 0x79, 0x00, 0x70, 0x00, 0x65, 0x00, 0x20, 0x00, 0x70,
-	0x00, 0x61, 0x00, 0x74, 0x00, 0x74, 0x00, 0x65, 0x00, 0x72, 0x00, 0x6E,
-	0x00, 0x20, 0x00, 0x66, 0x00, 0x6F, 0x00, 0x75, 0x00, 0x6E, 0x00, 0x64,
-	0x00, 0x20, 0x00, 0x69, 0x00, 0x6E, 0x00, 0x20, 0x00, 0x66, 0x00, 0x69,
-	0x00, 0x6C, 0x00, 0x65, 0x00, 0x3A, 0x00, 0x20, 0x00, 0x00, 0x03, 0x7B,
-	0x00, 0x00, 0x03, 0x7D, 0x00, 0x00, 0x53, 0x4E, 0x00, 0x6F, 0x00, 0x20,
-	0x00, 0x70, 0x00, 0x61, 0x00, 0x74, 0x00, 0x74, 0x00, 0x65, 0x00, 0x72,
-	0x00, 0x6E, 0x00, 0x73, 0x00, 0x20, 0x00, 0x64, 0x00, 0x65, 0x00, 0x74,
-	0x00, 0x65, 0x00, 0x63, 0x00, 0x74, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20,
-	0x00, 0x69, 0x00, 0x6E, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65,
-	0x00, 0x20, 0x00, 0x6C, 0x00, 0x61, 0x00, 0x73, 0x00, 0x74, 0x00, 0x20,
-	0x00, 0x33, 0x00, 0x20, 0x00, 0x68, 0x00, 0x6F, 0x00, 0x75, 0x00, 0x72,
-	0x00, 0x73, 0x00, 0x2E, 0x00, 0x00, 0x17, 0x46, 0x00, 0x69, 0x00, 0x6C,
-	0x00, 0x65, 0x00, 0x20, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6C, 0x00, 0x65,
-	0x00, 0x74, 0x00, 0x65, 0x00, 0x00, 0x21, 0x52, 0x00, 0x65, 0x00, 0x6E,
-	0x00, 0x61, 0x00, 0x6D, 0x00, 0x65, 0x00, 0x3A, 0x00, 0x20, 0x00, 0x6F,
-	0x00, 0x6C, 0x00, 0x64, 0x00, 0x20, 0x00, 0x6E, 0x00, 0x61, 0x00, 0x6D,
-	0x00, 0x65, 0x00, 0x00, 0x21, 0x52, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x61,
-	0x00, 0x6D, 0x00, 0x65, 0x00, 0x3A, 0x00, 0x20, 0x00, 0x6E, 0x00, 0x65,
-	0x00, 0x77, 0x00, 0x20, 0x00, 0x6E, 0x00, 0x61, 0x00, 0x6D, 0x00, 0x65,
-	0x00, 0x00, 0x49, 0x45, 0x00, 0x78, 0x00, 0x70, 0x00, 0x6C, 0x00, 0x6F,
-	0x00, 0x72, 0x00, 0x65, 0x00, 0x72, 0x00, 0x20, 0x00, 0x72, 0x00, 0x65,
-	0x00, 0x70, 0x00, 0x6C, 0x00, 0x61, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6D,
-	0x00, 0x65, 0x00, 0x6E, 0x00, 0x74, 0x00, 0x20, 0x00, 0x66, 0x00, 0x6F,
-	0x00, 0x75, 0x00, 0x6E, 0x00, 0x64, 0x00, 0x20, 0x00, 0x69, 0x00, 0x6E,
-	0x00, 0x20, 0x00, 0x66, 0x00, 0x69, 0x00, 0x6C, 0x00, 0x65, 0x00, 0x3A,
-	0x00, 0x20, 0x00, 0x00, 0x80, 0x87, 0x4E, 0x00, 0x6F, 0x00, 0x20, 0x00,
-	0x45, 0x00, 0x78, 0x00, 0x70, 0x00, 0x6C, 0x00, 0x6F, 0x00, 0x72, 0x00,
-	0x65, 0x00, 0x72, 0x00, 0x20, 0x00, 0x66, 0x00, 0x69, 0x00, 0x6C, 0x00,
-	0x65, 0x00, 0x20, 0x00, 0x72, 0x00, 0x65, 0x00, 0x70, 0x00, 0x6C, 0x00,
-	0x61, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6D, 0x00, 0x65, 0x00, 0x6E, 0x00,
-	0x74, 0x00, 0x20, 0x00, 0x70, 0x00, 0x61, 0x00, 0x74, 0x00, 0x74, 0x00,
-	0x65, 0x00, 0x72, 0x00, 0x6E, 0x00, 0x73, 0x00, 0x20, 0x00, 0x64, 0x00,
-	0x65, 0x00, 0x74, 0x00, 0x65, 0x00, 0x63, 0x00, 0x74, 0x00, 0x65, 0x00,
-	0x64, 0x00, 0x20, 0x00, 0x69, 0x00, 0x6E, 0x00, 0x20, 0x00, 0x74, 0x00,
-	0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x6C, 0x00, 0x61, 0x00, 0x73, 0x00,
-	0x74, 0x00, 0x20, 0x00, 0x33, 0x00, 0x20, 0x00, 0x68, 0x00, 0x6F, 0x00,
-	0x75, 0x00, 0x72, 0x00, 0x73, 0x00, 0x2E, 0x00, 0x00, 0x1F, 0x53, 0x00,
-	0x65, 0x00, 0x63, 0x00, 0x75, 0x00, 0x72, 0x00, 0x69, 0x00, 0x74, 0x00,
-	0x79, 0x00, 0x20, 0x00, 0x63, 0x00, 0x68, 0x00, 0x61, 0x00, 0x6E, 0x00,
-	0x67, 0x00, 0x65, 0x00, 0x00, 0x1D, 0x44, 0x00, 0x61, 0x00, 0x74, 0x00,
-	0x61, 0x00, 0x20, 0x00, 0x6F, 0x00, 0x76, 0x00, 0x65, 0x00, 0x72, 0x00,
-	0x77, 0x00, 0x72, 0x00, 0x69, 0x00, 0x74, 0x00, 0x65, 0x00, 0x00, 0x23,
-	0x42, 0x00, 0x61, 0x00, 0x73, 0x00, 0x69, 0x00, 0x63, 0x00, 0x20, 0x00,
-	0x69, 0x00, 0x6E, 0x00, 0x66, 0x00, 0x6F, 0x00, 0x20, 0x00, 0x63, 0x00,
-	0x68, 0x00, 0x61, 0x00, 0x6E, 0x00, 0x67, 0x00, 0x65, 0x00, 0x00, 0x41,
-	0x43, 0x00, 0x6F, 0x00, 0x70, 0x00, 0x79, 0x00, 0x20, 0x00, 0x72, 0x00,
-	0x65, 0x00, 0x70, 0x00, 0x6C, 0x00, 0x61, 0x00, 0x63, 0x00, 0x65, 0x00,
-	0x6D, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x74, 0x00, 0x20, 0x00, 0x66, 0x00,
-	0x6F, 0x00, 0x75, 0x00, 0x6E, 0x00, 0x64, 0x00, 0x20, 0x00, 0x69, 0x00,
-	0x6E, 0x00, 0x20, 0x00, 0x66, 0x00, 0x69, 0x00, 0x6C, 0x00, 0x65, 0x00,
-	0x3A, 0x00, 0x20, 0x00, 0x00, 0x7F, 0x4E, 0x00, 0x6F, 0x00, 0x20, 0x00,
-	0x43, 0x00, 0x6F, 0x00, 0x70, 0x00, 0x79, 0x00, 0x20, 0x00, 0x66, 0x00,
-	0x69, 0x00, 0x6C, 0x00, 0x65, 0x00, 0x20, 0x00, 0x72, 0x00, 0x65, 0x00,
-	0x70, 0x00, 0x6C, 0x00, 0x61, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6D, 0x00,
-	0x65, 0x00, 0x6E, 0x00, 0x74, 0x00, 0x20, 0x00, 0x70, 0x00, 0x61, 0x00,
-	0x74, 0x00, 0x74, 0x00, 0x65, 0x00, 0x72, 0x00, 0x6E, 0x00, 0x73, 0x00,
-	0x20, 0x00, 0x64, 0x00, 0x65, 0x00, 0x74, 0x00, 0x65, 0x00, 0x63, 0x00,
-	0x74, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x69, 0x00, 0x6E, 0x00,
-	0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x6C, 0x00,
-	0x61, 0x00, 0x73, 0x00, 0x74, 0x00, 0x20, 0x00, 0x33, 0x00, 0x20, 0x00,
-	0x68, 0x00, 0x6F, 0x00, 0x75, 0x00, 0x72, 0x00, 0x73, 0x00, 0x2E, 0x00,
-	0x00, 0x3D, 0x44, 0x00, 0x65, 0x00, 0x6C, 0x00, 0x65, 0x00, 0x74, 0x00,
-	0x65, 0x00, 0x20, 0x00, 0x70, 0x00, 0x61, 0x00, 0x74, 0x00, 0x74, 0x00,
-	0x65, 0x00, 0x72, 0x00, 0x6E, 0x00, 0x20, 0x00, 0x66, 0x00, 0x6F, 0x00,
-	0x75, 0x00, 0x6E, 0x00, 0x64, 0x00, 0x20, 0x00, 0x69, 0x00, 0x6E, 0x00,
-	0x20, 0x00, 0x66, 0x00, 0x69, 0x00, 0x6C, 0x00, 0x65, 0x00, 0x3A, 0x00,
-	0x20, 0x00, 0x00, 0x33, 0x4E, 0x00, 0x6F, 0x00, 0x20, 0x00, 0x44, 0x00,
-	0x65, 0x00, 0x6C, 0x00, 0x65, 0x00, 0x74, 0x00, 0x65, 0x00, 0x20, 0x00,
-	0x70, 0x00, 0x61, 0x00, 0x74, 0x00, 0x74, 0x00, 0x65, 0x00, 0x72, 0x00,
-	0x6E, 0x00, 0x73, 0x00, 0x20, 0x00, 0x66, 0x00, 0x6F, 0x00, 0x75, 0x00,
-	0x6E, 0x00, 0x64, 0x00, 0x2E, 0x00, 0x00, 0x11, 0x55, 0x00, 0x53, 0x00,
-	0x4E, 0x00, 0x3A, 0x00, 0x20, 0x00, 0x7B, 0x00, 0x30, 0x00, 0x7D, 0x00,
-	0x00, 0x0D, 0x6E, 0x00, 0x61, 0x00, 0x6D, 0x00, 0x65, 0x00, 0x3A, 0x00,
-	0x20, 0x00, 0x00, 0x3B, 0x74, 0x00, 0x69, 0x00, 0x6D, 0x00, 0x65, 0x00,
-	0x3A, 0x00, 0x20, 0x00, 0x7B, 0x00, 0x30, 0x00, 0x3A, 0x00, 0x64, 0x00,
-	0x64, 0x00, 0x2F, 0x00, 0x4D, 0x00, 0x4D, 0x00, 0x2F, 0x00, 0x79, 0x00,
-	0x79, 0x00, 0x79, 0x00, 0x79, 0x00, 0x20, 0x00, 0x48, 0x00, 0x48, 0x00,
-	0x3A, 0x00, 0x6D, 0x00, 0x6D, 0x00, 0x3A, 0x00, 0x73, 0x00, 0x73, 0x00,
-	0x7D, 0x00, 0x00, 0x11, 0x72, 0x00, 0x65, 0x00, 0x61, 0x00, 0x73, 0x00,
-	0x6F, 0x00, 0x6E, 0x00, 0x3A, 0x00, 0x20, 0x00, 0x00, 0x29, 0x4E, 0x00,
-	0x61, 0x00, 0x6D, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x64, 0x00,
-	0x61, 0x00, 0x74, 0x00, 0x61, 0x00, 0x20, 0x00, 0x6F, 0x00, 0x76, 0x00,
-	0x65, 0x00, 0x72, 0x00, 0x77, 0x00, 0x72, 0x00, 0x69, 0x00, 0x74, 0x00,
-	0x65, 0x00, 0x00, 0x23, 0x4E, 0x00, 0x61, 0x00, 0x6D, 0x00, 0x65, 0x00,
-	0x64, 0x00, 0x20, 0x00, 0x64, 0x00, 0x61, 0x00, 0x74, 0x00, 0x61, 0x00,
-	0x20, 0x00, 0x65, 0x00, 0x78, 0x00, 0x74, 0x00, 0x65, 0x00, 0x6E, 0x00,
-	0x64, 0x00, 0x00, 0x2B, 0x4E, 0x00, 0x61, 0x00, 0x6D, 0x00, 0x65, 0x00,
-	0x64, 0x00, 0x20, 0x00, 0x64, 0x00, 0x61, 0x00, 0x74, 0x00, 0x61, 0x00,
-	0x20, 0x00, 0x74, 0x00, 0x72, 0x00, 0x75, 0x00, 0x6E, 0x00, 0x63, 0x00,
-	0x61, 0x00, 0x74, 0x00, 0x69, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x00, 0x17,
-	0x46, 0x00, 0x69, 0x00, 0x6C, 0x00, 0x65, 0x00, 0x20, 0x00, 0x63, 0x00,
-	0x72, 0x00, 0x65, 0x00, 0x61, 0x00, 0x74, 0x00, 0x65, 0x00, 0x00, 0x33,
-	0x45, 0x00, 0x78, 0x00, 0x74, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x64, 0x00,
-	0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x61, 0x00, 0x74, 0x00, 0x74, 0x00,
-	0x72, 0x00, 0x69, 0x00, 0x62, 0x00, 0x75, 0x00, 0x74, 0x00, 0x65, 0x00,
-	0x20, 0x00, 0x63, 0x00, 0x68, 0x00, 0x61, 0x00, 0x6E, 0x00, 0x67, 0x00,
-	0x65, 0x00, 0x00, 0x21, 0x49, 0x00, 0x6E, 0x00, 0x64, 0x00, 0x65, 0x00,
-	0x78, 0x00, 0x61, 0x00, 0x62, 0x00, 0x6C, 0x00, 0x65, 0x00, 0x20, 0x00,
-	0x63, 0x00, 0x68, 0x00, 0x61, 0x00, 0x6E, 0x00, 0x67, 0x00, 0x65, 0x00,
-	0x00, 0x21, 0x48, 0x00, 0x61, 0x00, 0x72, 0x00, 0x64, 0x00, 0x20, 0x00,
-	0x6C, 0x00, 0x69, 0x00, 0x6E, 0x00, 0x6B, 0x00, 0x20, 0x00, 0x63, 0x00,
-	0x68, 0x00, 0x61, 0x00, 0x6E, 0x00, 0x67, 0x00, 0x65, 0x00, 0x00, 0x25,
-	0x43, 0x00, 0x6F, 0x00, 0x6D, 0x00, 0x70, 0x00, 0x72, 0x00, 0x65, 0x00,
-	0x73, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x20, 0x00,
-	0x63, 0x00, 0x68, 0x00, 0x61, 0x00, 0x6E, 0x00, 0x67, 0x00, 0x65, 0x00,
-	0x00, 0x23, 0x45, 0x00, 0x6E, 0x00, 0x63, 0x00, 0x72, 0x00, 0x79, 0x00,
-	0x70, 0x00, 0x74, 0x00, 0x69, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x20, 0x00,
-	0x63, 0x00, 0x68, 0x00, 0x61, 0x00, 0x6E, 0x00, 0x67, 0x00, 0x65, 0x00,
-	0x00, 0x21, 0x4F, 0x00, 0x62, 0x00, 0x6A, 0x00, 0x65, 0x00, 0x63, 0x00,
-	0x74, 0x00, 0x20, 0x00, 0x49, 0x00, 0x44, 0x00, 0x20, 0x00, 0x63, 0x00,
-	0x68, 0x00, 0x61, 0x00, 0x6E, 0x00, 0x67, 0x00, 0x65, 0x00, 0x00, 0x29,
-	0x52, 0x00, 0x65, 0x00, 0x70, 0x00, 0x61, 0x00, 0x72, 0x00, 0x73, 0x00,
-	0x65, 0x00, 0x20, 0x00, 0x70, 0x00, 0x6F, 0x00, 0x69, 0x00, 0x6E, 0x00,
-	0x74, 0x00, 0x20, 0x00, 0x63, 0x00, 0x68, 0x00, 0x61, 0x00, 0x6E, 0x00,
-	0x67, 0x00, 0x65, 0x00, 0x00, 0x1B, 0x53, 0x00, 0x74, 0x00, 0x72, 0x00,
-	0x65, 0x00, 0x61, 0x00, 0x6D, 0x00, 0x20, 0x00, 0x63, 0x00, 0x68, 0x00,
-	0x61, 0x00, 0x6E, 0x00, 0x67, 0x00, 0x65, 0x00, 0x00, 0x07, 0x20, 0x00,
-	0x7C, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0x79, 0x7C, 0x90,
-	0xC3, 0xC4, 0xD3, 0x44, 0x8C, 0xD8, 0xE1, 0x96, 0x7F, 0xFA, 0x95, 0x34,
-	0x00, 0x04, 0x20, 0x01, 0x01, 0x08, 0x03, 0x20, 0x00, 0x01, 0x05, 0x20,
-	0x01, 0x01, 0x11, 0x11, 0x04, 0x20, 0x01, 0x01, 0x0E, 0x04, 0x20, 0x01,
-	0x01, 0x02, 0x05, 0x07, 0x02, 0x18, 0x11, 0x14, 0x02, 0x06, 0x18, 0x04,
-	0x07, 0x01, 0x11, 0x14, 0x03, 0x20, 0x00, 0x08, 0x12, 0x07, 0x0C, 0x11,
-	0x14, 0x02, 0x08, 0x18, 0x09, 0x11, 0x34, 0x08, 0x18, 0x12, 0x30, 0x0A,
-	0x18, 0x11, 0x20, 0x04, 0x00, 0x00, 0x11, 0x65, 0x06, 0x15, 0x12, 0x4D,
-	0x01, 0x12, 0x30, 0x04, 0x00, 0x01, 0x18, 0x08, 0x06, 0x10, 0x01, 0x01,
-	0x08, 0x1E, 0x00, 0x04, 0x0A, 0x01, 0x11, 0x34, 0x08, 0x10, 0x01, 0x03,
-	0x01, 0x1E, 0x00, 0x18, 0x02, 0x05, 0x20, 0x01, 0x01, 0x13, 0x00, 0x04,
-	0x20, 0x01, 0x01, 0x0A, 0x03, 0x00, 0x00, 0x08, 0x05, 0x00, 0x02, 0x0A,
-	0x18, 0x08, 0x05, 0x00, 0x02, 0x01, 0x18, 0x0A, 0x04, 0x00, 0x01, 0x01,
-	0x18, 0x07, 0x07, 0x03, 0x11, 0x14, 0x18, 0x11, 0x28, 0x03, 0x20, 0x00,
-	0x0E, 0x05, 0x00, 0x02, 0x0E, 0x0E, 0x0E, 0x05, 0x07, 0x02, 0x11, 0x14,
-	0x0E, 0x05, 0x20, 0x01, 0x0E, 0x1D, 0x03, 0x06, 0x07, 0x03, 0x11, 0x14,
-	0x08, 0x09, 0x04, 0x0A, 0x01, 0x11, 0x2C, 0x12, 0x07, 0x07, 0x0E, 0x12,
-	0x55, 0x0A, 0x12, 0x59, 0x15, 0x12, 0x5D, 0x01, 0x12, 0x49, 0x12, 0x49,
-	0x12, 0x61, 0x04, 0x00, 0x00, 0x12, 0x55, 0x05, 0x00, 0x00, 0x1D, 0x12,
-	0x49, 0x07, 0x15, 0x12, 0x69, 0x02, 0x12, 0x49, 0x02, 0x05, 0x20, 0x02,
-	0x01, 0x1C, 0x18, 0x18, 0x10, 0x01, 0x02, 0x15, 0x12, 0x80, 0x99, 0x01,
-	0x1E, 0x00, 0x15, 0x12, 0x80, 0x99, 0x01, 0x1E, 0x00, 0x15, 0x12, 0x69,
-	0x02, 0x1E, 0x00, 0x02, 0x04, 0x0A, 0x01, 0x12, 0x49, 0x07, 0x15, 0x12,
-	0x80, 0x99, 0x01, 0x12, 0x49, 0x08, 0x20, 0x00, 0x15, 0x12, 0x5D, 0x01,
-	0x13, 0x00, 0x06, 0x15, 0x12, 0x5D, 0x01, 0x12, 0x49, 0x04, 0x20, 0x00,
-	0x13, 0x00, 0x05, 0x20, 0x02, 0x01, 0x03, 0x08, 0x03, 0x20, 0x00, 0x02,
-	0x03, 0x20, 0x00, 0x0A, 0x04, 0x00, 0x01, 0x01, 0x0E, 0x07, 0x00, 0x02,
-	0x12, 0x80, 0xA9, 0x0E, 0x0E, 0x05, 0x00, 0x00, 0x12, 0x80, 0xAD, 0x07,
-	0x07, 0x01, 0x15, 0x12, 0x4D, 0x01, 0x0E, 0x05, 0x00, 0x01, 0x1D, 0x0E,
-	0x0E, 0x10, 0x10, 0x01, 0x01, 0x15, 0x12, 0x4D, 0x01, 0x1E, 0x00, 0x15,
-	0x12, 0x80, 0x99, 0x01, 0x1E, 0x00, 0x03, 0x0A, 0x01, 0x0E, 0x05, 0x00,
-	0x02, 0x0E, 0x0E, 0x1C, 0x05, 0x15, 0x12, 0x4D, 0x01, 0x0E, 0x06, 0x20,
-	0x02, 0x01, 0x08, 0x13, 0x00, 0x02, 0x06, 0x0E, 0x0A, 0x00, 0x02, 0x01,
-	0x0E, 0x15, 0x12, 0x80, 0x99, 0x01, 0x0E, 0x1A, 0x07, 0x08, 0x12, 0x08,
-	0x11, 0x2C, 0x11, 0x14, 0x15, 0x12, 0x4D, 0x01, 0x12, 0x30, 0x15, 0x12,
-	0x4D, 0x01, 0x12, 0x30, 0x11, 0x2C, 0x11, 0x65, 0x11, 0x65, 0x06, 0x00,
-	0x03, 0x0E, 0x0E, 0x1C, 0x1C, 0x04, 0x0A, 0x01, 0x12, 0x30, 0x0B, 0x10,
-	0x01, 0x01, 0x02, 0x15, 0x12, 0x80, 0x99, 0x01, 0x1E, 0x00, 0x07, 0x15,
-	0x12, 0x69, 0x02, 0x12, 0x30, 0x0A, 0x12, 0x10, 0x01, 0x02, 0x0A, 0x15,
-	0x12, 0x80, 0x99, 0x01, 0x1E, 0x00, 0x15, 0x12, 0x69, 0x02, 0x1E, 0x00,
-	0x0A, 0x05, 0x00, 0x01, 0x11, 0x65, 0x0A, 0x06, 0x00, 0x03, 0x0E, 0x0E,
-	0x0E, 0x0E, 0x0F, 0x07, 0x05, 0x1D, 0x1D, 0x0E, 0x1D, 0x1D, 0x0E, 0x02,
-	0x08, 0x15, 0x12, 0x4D, 0x01, 0x0E, 0x02, 0x1D, 0x0E, 0x05, 0x20, 0x01,
-	0x13, 0x00, 0x08, 0x07, 0x07, 0x03, 0x1D, 0x1D, 0x0E, 0x02, 0x08, 0x0A,
-	0x20, 0x02, 0x15, 0x12, 0x4D, 0x01, 0x13, 0x00, 0x08, 0x08, 0x07, 0x15,
-	0x12, 0x69, 0x02, 0x12, 0x30, 0x0E, 0x19, 0x10, 0x02, 0x02, 0x15, 0x12,
-	0x80, 0x99, 0x01, 0x1E, 0x01, 0x15, 0x12, 0x80, 0x99, 0x01, 0x1E, 0x00,
-	0x15, 0x12, 0x69, 0x02, 0x1E, 0x00, 0x1E, 0x01, 0x05, 0x0A, 0x02, 0x12,
-	0x30, 0x0E, 0x08, 0x07, 0x04, 0x1D, 0x1D, 0x0E, 0x02, 0x08, 0x0E, 0x0B,
-	0x07, 0x03, 0x12, 0x1C, 0x15, 0x12, 0x69, 0x02, 0x0E, 0x02, 0x08, 0x06,
-	0x15, 0x12, 0x69, 0x02, 0x0E, 0x02, 0x12, 0x10, 0x01, 0x02, 0x02, 0x15,
-	0x12, 0x80, 0x99, 0x01, 0x1E, 0x00, 0x15, 0x12, 0x69, 0x02, 0x1E, 0x00,
-	0x02, 0x04, 0x07, 0x02, 0x0E, 0x08, 0x08, 0x00, 0x03, 0x02, 0x0E, 0x0E,
-	0x11, 0x80, 0xC5, 0x08, 0x07, 0x04, 0x08, 0x12, 0x30, 0x11, 0x65, 0x0E,
-	0x0A, 0x00, 0x02, 0x0E, 0x0E, 0x15, 0x12, 0x80, 0x99, 0x01, 0x0E, 0x05,
-	0x20, 0x00, 0x11, 0x80, 0xC9, 0x04, 0x20, 0x01, 0x02, 0x0E, 0x04, 0x07,
-	0x02, 0x06, 0x06, 0x04, 0x00, 0x01, 0x08, 0x18, 0x05, 0x00, 0x02, 0x06,
-	0x18, 0x08, 0x05, 0x00, 0x02, 0x08, 0x18, 0x08, 0x05, 0x00, 0x02, 0x0E,
-	0x18, 0x08, 0x03, 0x07, 0x01, 0x02, 0x08, 0xB7, 0x7A, 0x5C, 0x56, 0x19,
-	0x34, 0xE0, 0x89, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00,
-	0x80, 0x04, 0x00, 0x00, 0x00, 0x40, 0x04, 0x01, 0x00, 0x00, 0x00, 0x04,
-	0x02, 0x00, 0x00, 0x00, 0x04, 0x10, 0x00, 0x00, 0x00, 0x04, 0x03, 0x00,
-	0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00,
-	0x04, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x04, 0x09,
-	0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0x04, 0x00, 0x20, 0x00,
-	0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04,
-	0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x02,
-	0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00,
-	0x04, 0x00, 0x10, 0x00, 0x00, 0x04, 0x00, 0x80, 0x00, 0x00, 0x04, 0x00,
-	0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00, 0x04,
-	0x00, 0x04, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x10, 0x00, 0x04,
-	0x00, 0x00, 0x20, 0x00, 0x04, 0x9C, 0x00, 0x09, 0x00, 0x04, 0xB3, 0x00,
-	0x09, 0x00, 0x04, 0xBB, 0x00, 0x09, 0x00, 0x04, 0xE7, 0x00, 0x09, 0x00,
-	0x04, 0xF4, 0x00, 0x09, 0x00, 0x04, 0xF8, 0x00, 0x09, 0x00, 0x04, 0x06,
-	0x00, 0x00, 0x00, 0x04, 0x0D, 0x00, 0x00, 0x00, 0x04, 0x26, 0x00, 0x00,
-	0x00, 0x04, 0x32, 0x00, 0x00, 0x00, 0x04, 0x57, 0x00, 0x00, 0x00, 0x04,
-	0x9A, 0x04, 0x00, 0x00, 0x04, 0x9B, 0x04, 0x00, 0x00, 0x04, 0x9D, 0x04,
-	0x00, 0x00, 0x04, 0xF8, 0x06, 0x00, 0x00, 0x04, 0x69, 0x42, 0x00, 0x00,
-	0x04, 0x6B, 0x42, 0x00, 0x00, 0x04, 0x6C, 0x42, 0x00, 0x00, 0x04, 0x6D,
-	0x42, 0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00,
-	0x00, 0x04, 0x0A, 0x00, 0x00, 0x00, 0x04, 0x0B, 0x00, 0x00, 0x00, 0x04,
-	0x0C, 0x00, 0x00, 0x00, 0x04, 0x0E, 0x00, 0x00, 0x00, 0x04, 0x0F, 0x00,
-	0x00, 0x00, 0x04, 0x11, 0x00, 0x00, 0x00, 0x04, 0x12, 0x00, 0x00, 0x00,
-	0x04, 0x13, 0x00, 0x00, 0x00, 0x04, 0x14, 0x00, 0x00, 0x00, 0x04, 0x15,
-	0x00, 0x00, 0x00, 0x04, 0x16, 0x00, 0x00, 0x00, 0x04, 0x17, 0x00, 0x00,
-	0x00, 0x04, 0x18, 0x00, 0x00, 0x00, 0x04, 0x19, 0x00, 0x00, 0x00, 0x04,
-	0x1A, 0x00, 0x00, 0x00, 0x04, 0x1B, 0x00, 0x00, 0x00, 0x04, 0x1C, 0x00,
-	0x00, 0x00, 0x04, 0x1D, 0x00, 0x00, 0x00, 0x04, 0x1E, 0x00, 0x00, 0x00,
-	0x04, 0x1F, 0x00, 0x00, 0x00, 0x04, 0x21, 0x00, 0x00, 0x00, 0x04, 0x22,
-	0x00, 0x00, 0x00, 0x04, 0x23, 0x00, 0x00, 0x00, 0x04, 0x24, 0x00, 0x00,
-	0x00, 0x04, 0x25, 0x00, 0x00, 0x00, 0x04, 0x27, 0x00, 0x00, 0x00, 0x04,
-	0x28, 0x00, 0x00, 0x00, 0x04, 0x2E, 0x00, 0x00, 0x00, 0x04, 0x2C, 0x00,
-	0x00, 0x00, 0x04, 0x30, 0x00, 0x00, 0x00, 0x04, 0x34, 0x00, 0x00, 0x00,
-	0x04, 0x38, 0x00, 0x00, 0x00, 0x04, 0x3A, 0x00, 0x00, 0x00, 0x01, 0x02,
-	0x03, 0x06, 0x12, 0x49, 0x02, 0x06, 0x09, 0x02, 0x06, 0x02, 0x02, 0x06,
-	0x08, 0x03, 0x06, 0x11, 0x14, 0x03, 0x06, 0x12, 0x18, 0x08, 0x06, 0x15,
-	0x12, 0x69, 0x02, 0x12, 0x49, 0x02, 0x08, 0x06, 0x15, 0x12, 0x69, 0x02,
-	0x12, 0x30, 0x0A, 0x08, 0x06, 0x15, 0x12, 0x69, 0x02, 0x12, 0x30, 0x0E,
-	0x06, 0x06, 0x15, 0x12, 0x4D, 0x01, 0x0E, 0x07, 0x06, 0x15, 0x12, 0x69,
-	0x02, 0x0E, 0x02, 0x03, 0x06, 0x11, 0x20, 0x03, 0x06, 0x11, 0x24, 0x03,
-	0x06, 0x11, 0x7D, 0x02, 0x06, 0x0B, 0x02, 0x06, 0x0A, 0x02, 0x06, 0x06,
-	0x05, 0x20, 0x01, 0x01, 0x12, 0x49, 0x07, 0x20, 0x01, 0x11, 0x14, 0x10,
-	0x11, 0x2C, 0x11, 0x20, 0x04, 0x11, 0x14, 0x11, 0x2C, 0x09, 0x10, 0x15,
-	0x12, 0x4D, 0x01, 0x12, 0x30, 0x10, 0x11, 0x2C, 0x06, 0x20, 0x01, 0x11,
-	0x14, 0x11, 0x20, 0x08, 0x20, 0x02, 0x11, 0x14, 0x12, 0x49, 0x10, 0x09,
-	0x06, 0x20, 0x01, 0x11, 0x14, 0x10, 0x18, 0x05, 0x00, 0x01, 0x01, 0x1D,
-	0x0E, 0x05, 0x00, 0x01, 0x0E, 0x1D, 0x0E, 0x05, 0x00, 0x02, 0x01, 0x0E,
-	0x0A, 0x07, 0x00, 0x02, 0x01, 0x12, 0x49, 0x12, 0x59, 0x09, 0x00, 0x03,
-	0x01, 0x12, 0x49, 0x12, 0x59, 0x11, 0x2C, 0x0B, 0x00, 0x02, 0x01, 0x15,
-	0x12, 0x4D, 0x01, 0x12, 0x30, 0x12, 0x59, 0x0B, 0x00, 0x02, 0x02, 0x15,
-	0x12, 0x4D, 0x01, 0x0E, 0x1D, 0x1D, 0x0E, 0x0B, 0x00, 0x03, 0x02, 0x15,
-	0x12, 0x4D, 0x01, 0x12, 0x30, 0x08, 0x08, 0x0E, 0x00, 0x05, 0x01, 0x15,
-	0x12, 0x4D, 0x01, 0x12, 0x30, 0x12, 0x59, 0x08, 0x08, 0x0E, 0x04, 0x00,
-	0x01, 0x0E, 0x09, 0x0A, 0x00, 0x07, 0x18, 0x0E, 0x09, 0x09, 0x18, 0x09,
-	0x09, 0x18, 0x04, 0x00, 0x01, 0x02, 0x18, 0x07, 0x00, 0x02, 0x02, 0x18,
-	0x10, 0x11, 0x28, 0x04, 0x00, 0x01, 0x02, 0x0E, 0x09, 0x00, 0x05, 0x02,
-	0x18, 0x18, 0x09, 0x10, 0x09, 0x18, 0x09, 0x00, 0x05, 0x02, 0x18, 0x18,
-	0x09, 0x10, 0x09, 0x08, 0x0E, 0x00, 0x08, 0x02, 0x18, 0x09, 0x18, 0x08,
-	0x10, 0x11, 0x2C, 0x08, 0x10, 0x09, 0x18, 0x0C, 0x00, 0x08, 0x02, 0x18,
-	0x09, 0x18, 0x08, 0x18, 0x08, 0x10, 0x09, 0x18, 0x05, 0x00, 0x02, 0x01,
-	0x18, 0x08, 0x16, 0x00, 0x0B, 0x08, 0x10, 0x18, 0x11, 0x71, 0x10, 0x11,
-	0x3C, 0x10, 0x11, 0x38, 0x10, 0x0A, 0x09, 0x11, 0x75, 0x09, 0x09, 0x18,
-	0x09, 0x0B, 0x00, 0x05, 0x08, 0x18, 0x10, 0x11, 0x38, 0x18, 0x09, 0x11,
-	0x24, 0x03, 0x00, 0x00, 0x01, 0x05, 0x20, 0x01, 0x02, 0x12, 0x49, 0x05,
-	0x20, 0x01, 0x0A, 0x12, 0x30, 0x05, 0x20, 0x01, 0x0E, 0x12, 0x30, 0x04,
-	0x20, 0x01, 0x01, 0x18, 0x03, 0x20, 0x00, 0x09, 0x03, 0x20, 0x00, 0x06,
-	0x03, 0x20, 0x00, 0x0B, 0x03, 0x28, 0x00, 0x09, 0x03, 0x28, 0x00, 0x06,
-	0x03, 0x28, 0x00, 0x0B, 0x03, 0x28, 0x00, 0x0A, 0x03, 0x28, 0x00, 0x0E,
-	0x03, 0x28, 0x00, 0x02, 0x08, 0x01, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x1E, 0x01, 0x00, 0x01, 0x00, 0x54, 0x02, 0x16, 0x57, 0x72, 0x61,
-	0x70, 0x4E, 0x6F, 0x6E, 0x45, 0x78, 0x63, 0x65, 0x70, 0x74, 0x69, 0x6F,
-	0x6E, 0x54, 0x68, 0x72, 0x6F, 0x77, 0x73, 0x01, 0x08, 0x01, 0x00, 0x02,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0x00, 0x0C, 0x43, 0x6F, 0x6E,
-	0x73, 0x6F, 0x6C, 0x65, 0x41, 0x70, 0x70, 0x31, 0x34, 0x00, 0x00, 0x05,
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x17, 0x01, 0x00, 0x12, 0x43, 0x6F, 0x70,
-	0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0xC2, 0xA9, 0x20, 0x20, 0x32,
-	0x30, 0x32, 0x33, 0x00, 0x00, 0x29, 0x01, 0x00, 0x24, 0x38, 0x65, 0x31,
-	0x31, 0x38, 0x32, 0x63, 0x63, 0x2D, 0x31, 0x36, 0x63, 0x31, 0x2D, 0x34,
-	0x31, 0x61, 0x37, 0x2D, 0x61, 0x35, 0x66, 0x30, 0x2D, 0x63, 0x66, 0x31,
-	0x61, 0x32, 0x61, 0x39, 0x34, 0x65, 0x39, 0x39, 0x35, 0x00, 0x00, 0x0C,
-	0x01, 0x00, 0x07, 0x31, 0x2E, 0x30, 0x2E, 0x30, 0x2E, 0x30, 0x00, 0x00,
-	0x4D, 0x01, 0x00, 0x1C, 0x2E, 0x4E, 0x45, 0x54, 0x46, 0x72, 0x61, 0x6D,
-	0x65, 0x77, 0x6F, 0x72, 0x6B, 0x2C, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6F,
-	0x6E, 0x3D, 0x76, 0x34, 0x2E, 0x37, 0x2E, 0x32, 0x01, 0x00, 0x54, 0x0E,
-	0x14, 0x46, 0x72, 0x61, 0x6D, 0x65, 0x77, 0x6F, 0x72, 0x6B, 0x44, 0x69,
-	0x73, 0x70, 0x6C, 0x61, 0x79, 0x4E, 0x61, 0x6D, 0x65, 0x14, 0x2E, 0x4E,
-	0x45, 0x54, 0x20, 0x46, 0x72, 0x61, 0x6D, 0x65, 0x77, 0x6F, 0x72, 0x6B,
-	0x20, 0x34, 0x2E, 0x37, 0x2E, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xF8, 0xF2, 0x60, 0xD7, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-	0x51, 0x00, 0x00, 0x00, 0xC8, 0x74, 0x00, 0x00, 0xC8, 0x56, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x52, 0x53, 0x44, 0x53, 0xEC, 0x5F, 0xC6, 0xDC,
-	0x6A, 0x75, 0x97, 0x4A, 0xB2, 0xF7, 0x0A, 0x93, 0xE0, 0xA1, 0x28, 0x88,
-	0x01, 0x00, 0x00, 0x00, 0x45, 0x3A, 0x5C, 0x55, 0x73, 0x65, 0x72, 0x73,
-	0x5C, 0x4A, 0x6F, 0x75, 0x72, 0x6E, 0x61, 0x6C, 0x50, 0x61, 0x72, 0x73,
-	0x65, 0x72, 0x2D, 0x6D, 0x61, 0x69, 0x6E, 0x5C, 0x6F, 0x62, 0x6A, 0x5C,
-	0x52, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x5C, 0x43, 0x6F, 0x6E, 0x73,
-	0x6F, 0x6C, 0x65, 0x41, 0x70, 0x70, 0x31, 0x34, 0x2E, 0x70, 0x64, 0x62,
-	0x00, 0x41, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x5B, 0x75, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x43, 0x6F, 0x72, 0x45,
-	0x78, 0x65, 0x4D, 0x61, 0x69, 0x6E, 0x00, 0x6D, 0x73, 0x63, 0x6F, 0x72,
-	0x65, 0x65, 0x2E, 0x64, 0x6C, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xFF, 0x25, 0x00, 0x20, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x10, 0x00, 0x00, 0x00,
-	0x20, 0x00, 0x00, 0x80, 0x18, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x80,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x80,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x80,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0x03, 0x00, 0x00,
-	0x90, 0x80, 0x00, 0x00, 0x3C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x3C, 0x03, 0x34, 0x00, 0x00, 0x00, 0x56, 0x00,
-	0x53, 0x00, 0x5F, 0x00, 0x56, 0x00, 0x45, 0x00, 0x52, 0x00, 0x53, 0x00,
-	0x49, 0x00, 0x4F, 0x00, 0x4E, 0x00, 0x5F, 0x00, 0x49, 0x00, 0x4E, 0x00,
-	0x46, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x04, 0xEF, 0xFE,
-	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x44, 0x00, 0x00, 0x00, 0x01, 0x00, 0x56, 0x00, 0x61, 0x00, 0x72, 0x00,
-	0x46, 0x00, 0x69, 0x00, 0x6C, 0x00, 0x65, 0x00, 0x49, 0x00, 0x6E, 0x00,
-	0x66, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x04, 0x00,
-	0x00, 0x00, 0x54, 0x00, 0x72, 0x00, 0x61, 0x00, 0x6E, 0x00, 0x73, 0x00,
-	0x6C, 0x00, 0x61, 0x00, 0x74, 0x00, 0x69, 0x00, 0x6F, 0x00, 0x6E, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x04, 0x9C, 0x02, 0x00, 0x00,
-	0x01, 0x00, 0x53, 0x00, 0x74, 0x00, 0x72, 0x00, 0x69, 0x00, 0x6E, 0x00,
-	0x67, 0x00, 0x46, 0x00, 0x69, 0x00, 0x6C, 0x00, 0x65, 0x00, 0x49, 0x00,
-	0x6E, 0x00, 0x66, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x78, 0x02, 0x00, 0x00,
-	0x01, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,
-	0x34, 0x00, 0x62, 0x00, 0x30, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x01, 0x00,
-	0x01, 0x00, 0x43, 0x00, 0x6F, 0x00, 0x6D, 0x00, 0x6D, 0x00, 0x65, 0x00,
-	0x6E, 0x00, 0x74, 0x00, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x22, 0x00, 0x01, 0x00, 0x01, 0x00, 0x43, 0x00, 0x6F, 0x00, 0x6D, 0x00,
-	0x70, 0x00, 0x61, 0x00, 0x6E, 0x00, 0x79, 0x00, 0x4E, 0x00, 0x61, 0x00,
-	0x6D, 0x00, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x42, 0x00, 0x0D, 0x00, 0x01, 0x00, 0x46, 0x00, 0x69, 0x00, 0x6C, 0x00,
-	0x65, 0x00, 0x44, 0x00, 0x65, 0x00, 0x73, 0x00, 0x63, 0x00, 0x72, 0x00,
-	0x69, 0x00, 0x70, 0x00, 0x74, 0x00, 0x69, 0x00, 0x6F, 0x00, 0x6E, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x73, 0x00,
-	0x6F, 0x00, 0x6C, 0x00, 0x65, 0x00, 0x41, 0x00, 0x70, 0x00, 0x70, 0x00,
-	0x31, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x08, 0x00,
-	0x01, 0x00, 0x46, 0x00, 0x69, 0x00, 0x6C, 0x00, 0x65, 0x00, 0x56, 0x00,
-	0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6F, 0x00, 0x6E, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x2E, 0x00, 0x30, 0x00, 0x2E, 0x00,
-	0x30, 0x00, 0x2E, 0x00, 0x30, 0x00, 0x00, 0x00, 0x42, 0x00, 0x11, 0x00,
-	0x01, 0x00, 0x49, 0x00, 0x6E, 0x00, 0x74, 0x00, 0x65, 0x00, 0x72, 0x00,
-	0x6E, 0x00, 0x61, 0x00, 0x6C, 0x00, 0x4E, 0x00, 0x61, 0x00, 0x6D, 0x00,
-	0x65, 0x00, 0x00, 0x00, 0x43, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x73, 0x00,
-	0x6F, 0x00, 0x6C, 0x00, 0x65, 0x00, 0x41, 0x00, 0x70, 0x00, 0x70, 0x00,
-	0x31, 0x00, 0x34, 0x00, 0x2E, 0x00, 0x65, 0x00, 0x78, 0x00, 0x65, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x12, 0x00, 0x01, 0x00, 0x4C, 0x00,
-	0x65, 0x00, 0x67, 0x00, 0x61, 0x00, 0x6C, 0x00, 0x43, 0x00, 0x6F, 0x00,
-	0x70, 0x00, 0x79, 0x00, 0x72, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00,
-	0x74, 0x00, 0x00, 0x00, 0x43, 0x00, 0x6F, 0x00, 0x70, 0x00, 0x79, 0x00,
-	0x72, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x20, 0x00,
-	0xA9, 0x00, 0x20, 0x00, 0x20, 0x00, 0x32, 0x00, 0x30, 0x00, 0x32, 0x00,
-	0x33, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4C, 0x00,
-	0x65, 0x00, 0x67, 0x00, 0x61, 0x00, 0x6C, 0x00, 0x54, 0x00, 0x72, 0x00,
-	0x61, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6D, 0x00, 0x61, 0x00, 0x72, 0x00,
-	0x6B, 0x00, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x4A, 0x00, 0x11, 0x00, 0x01, 0x00, 0x4F, 0x00, 0x72, 0x00, 0x69, 0x00,
-	0x67, 0x00, 0x69, 0x00, 0x6E, 0x00, 0x61, 0x00, 0x6C, 0x00, 0x46, 0x00,
-	0x69, 0x00, 0x6C, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x61, 0x00, 0x6D, 0x00,
-	0x65, 0x00, 0x00, 0x00, 0x43, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x73, 0x00,
-	0x6F, 0x00, 0x6C, 0x00, 0x65, 0x00, 0x41, 0x00, 0x70, 0x00, 0x70, 0x00,
-	0x31, 0x00, 0x34, 0x00, 0x2E, 0x00, 0x65, 0x00, 0x78, 0x00, 0x65, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x3A, 0x00, 0x0D, 0x00, 0x01, 0x00, 0x50, 0x00,
-	0x72, 0x00, 0x6F, 0x00, 0x64, 0x00, 0x75, 0x00, 0x63, 0x00, 0x74, 0x00,
-	0x4E, 0x00, 0x61, 0x00, 0x6D, 0x00, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x43, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x73, 0x00, 0x6F, 0x00, 0x6C, 0x00,
-	0x65, 0x00, 0x41, 0x00, 0x70, 0x00, 0x70, 0x00, 0x31, 0x00, 0x34, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x08, 0x00, 0x01, 0x00, 0x50, 0x00,
-	0x72, 0x00, 0x6F, 0x00, 0x64, 0x00, 0x75, 0x00, 0x63, 0x00, 0x74, 0x00,
-	0x56, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6F, 0x00,
-	0x6E, 0x00, 0x00, 0x00, 0x31, 0x00, 0x2E, 0x00, 0x30, 0x00, 0x2E, 0x00,
-	0x30, 0x00, 0x2E, 0x00, 0x30, 0x00, 0x00, 0x00, 0x38, 0x00, 0x08, 0x00,
-	0x01, 0x00, 0x41, 0x00, 0x73, 0x00, 0x73, 0x00, 0x65, 0x00, 0x6D, 0x00,
-	0x62, 0x00, 0x6C, 0x00, 0x79, 0x00, 0x20, 0x00, 0x56, 0x00, 0x65, 0x00,
-	0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x00, 0x00,
-	0x31, 0x00, 0x2E, 0x00, 0x30, 0x00, 0x2E, 0x00, 0x30, 0x00, 0x2E, 0x00,
-	0x30, 0x00, 0x00, 0x00, 0xDC, 0x83, 0x00, 0x00, 0xEA, 0x01, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xBB, 0xBF, 0x3C,
-	0x3F, 0x78, 0x6D, 0x6C, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E,
-	0x3D, 0x22, 0x31, 0x2E, 0x30, 0x22, 0x20, 0x65, 0x6E, 0x63, 0x6F, 0x64,
-	0x69, 0x6E, 0x67, 0x3D, 0x22, 0x55, 0x54, 0x46, 0x2D, 0x38, 0x22, 0x20,
-	0x73, 0x74, 0x61, 0x6E, 0x64, 0x61, 0x6C, 0x6F, 0x6E, 0x65, 0x3D, 0x22,
-	0x79, 0x65, 0x73, 0x22, 0x3F, 0x3E, 0x0D, 0x0A, 0x0D, 0x0A, 0x3C, 0x61,
-	0x73, 0x73, 0x65, 0x6D, 0x62, 0x6C, 0x79, 0x20, 0x78, 0x6D, 0x6C, 0x6E,
-	0x73, 0x3D, 0x22, 0x75, 0x72, 0x6E, 0x3A, 0x73, 0x63, 0x68, 0x65, 0x6D,
-	0x61, 0x73, 0x2D, 0x6D, 0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F, 0x66, 0x74,
-	0x2D, 0x63, 0x6F, 0x6D, 0x3A, 0x61, 0x73, 0x6D, 0x2E, 0x76, 0x31, 0x22,
-	0x20, 0x6D, 0x61, 0x6E, 0x69, 0x66, 0x65, 0x73, 0x74, 0x56, 0x65, 0x72,
-	0x73, 0x69, 0x6F, 0x6E, 0x3D, 0x22, 0x31, 0x2E, 0x30, 0x22, 0x3E, 0x0D,
-	0x0A, 0x20, 0x20, 0x3C, 0x61, 0x73, 0x73, 0x65, 0x6D, 0x62, 0x6C, 0x79,
-	0x49, 0x64, 0x65, 0x6E, 0x74, 0x69, 0x74, 0x79, 0x20, 0x76, 0x65, 0x72,
-	0x73, 0x69, 0x6F, 0x6E, 0x3D, 0x22, 0x31, 0x2E, 0x30, 0x2E, 0x30, 0x2E,
-	0x30, 0x22, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x3D, 0x22, 0x4D, 0x79, 0x41,
-	0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x61,
-	0x70, 0x70, 0x22, 0x2F, 0x3E, 0x0D, 0x0A, 0x20, 0x20, 0x3C, 0x74, 0x72,
-	0x75, 0x73, 0x74, 0x49, 0x6E, 0x66, 0x6F, 0x20, 0x78, 0x6D, 0x6C, 0x6E,
-	0x73, 0x3D, 0x22, 0x75, 0x72, 0x6E, 0x3A, 0x73, 0x63, 0x68, 0x65, 0x6D,
-	0x61, 0x73, 0x2D, 0x6D, 0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F, 0x66, 0x74,
-	0x2D, 0x63, 0x6F, 0x6D, 0x3A, 0x61, 0x73, 0x6D, 0x2E, 0x76, 0x32, 0x22,
-	0x3E, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x65, 0x63, 0x75,
-	0x72, 0x69, 0x74, 0x79, 0x3E, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
-	0x20, 0x3C, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x65, 0x64, 0x50,
-	0x72, 0x69, 0x76, 0x69, 0x6C, 0x65, 0x67, 0x65, 0x73, 0x20, 0x78, 0x6D,
-	0x6C, 0x6E, 0x73, 0x3D, 0x22, 0x75, 0x72, 0x6E, 0x3A, 0x73, 0x63, 0x68,
-	0x65, 0x6D, 0x61, 0x73, 0x2D, 0x6D, 0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F,
-	0x66, 0x74, 0x2D, 0x63, 0x6F, 0x6D, 0x3A, 0x61, 0x73, 0x6D, 0x2E, 0x76,
-	0x33, 0x22, 0x3E, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-	0x20, 0x3C, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x65, 0x64, 0x45,
-	0x78, 0x65, 0x63, 0x75, 0x74, 0x69, 0x6F, 0x6E, 0x4C, 0x65, 0x76, 0x65,
-	0x6C, 0x20, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x3D, 0x22, 0x61, 0x73, 0x49,
-	0x6E, 0x76, 0x6F, 0x6B, 0x65, 0x72, 0x22, 0x20, 0x75, 0x69, 0x41, 0x63,
-	0x63, 0x65, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x22,
-	0x2F, 0x3E, 0x0D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F,
-	0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x65, 0x64, 0x50, 0x72, 0x69,
-	0x76, 0x69, 0x6C, 0x65, 0x67, 0x65, 0x73, 0x3E, 0x0D, 0x0A, 0x20, 0x20,
-	0x20, 0x20, 0x3C, 0x2F, 0x73, 0x65, 0x63, 0x75, 0x72, 0x69, 0x74, 0x79,
-	0x3E, 0x0D, 0x0A, 0x20, 0x20, 0x3C, 0x2F, 0x74, 0x72, 0x75, 0x73, 0x74,
-	0x49, 0x6E, 0x66, 0x6F, 0x3E, 0x0D, 0x0A, 0x3C, 0x2F, 0x61, 0x73, 0x73,
-	0x65, 0x6D, 0x62, 0x6C, 0x79, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00,
-	0x70, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
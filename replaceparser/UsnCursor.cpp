@@ -0,0 +1,148 @@
+#include "UsnCursor.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <system_error>
+#include "../util/MappedFile.h"
+
+namespace {
+    constexpr char Magic[8] = { 'B', 'A', 'M', 'U', 'S', 'N', 'C', 'R' };
+    constexpr size_t MinMatchSize = 40;
+
+    // a rescan and the watcher share a volume's cursor file (and its .tmp), one of them touches it at a time
+    std::mutex fileMutex;
+}
+
+std::filesystem::path UsnCursor::PathFor(const std::filesystem::path& directory, uint32_t volumeSerial) {
+    char name[32];
+    std::snprintf(name, sizeof(name), "usn-%08x.cursor", volumeSerial);
+    return directory / name;
+}
+
+bool UsnCursor::Load(const std::filesystem::path& path, uint32_t serial, UsnPatternMatcher& matcher) {
+    *this = UsnCursor();
+    matcher.Clear();
+    std::lock_guard<std::mutex> lock(fileMutex);
+    MappedFile file;
+    if (!file.Open(path) || file.Size() < sizeof(Magic) || std::memcmp(file.Data(), Magic, sizeof(Magic)) != 0) {
+        return false;
+    }
+    UsnStateReader in(file.Data() + sizeof(Magic), file.Size() - sizeof(Magic));
+
+    UsnCursor loaded;
+    uint32_t version = 0;
+    uint64_t digest = 0;
+    if (!in.U32(version) || version != Version || !in.U32(loaded.volumeSerial) || loaded.volumeSerial != serial ||
+        !in.U64(loaded.journalId) || !in.I64(loaded.nextUsn) || !in.U64(digest) || digest != matcher.Set().Digest()) {
+        return false;
+    }
+    if (!loaded.chain.Load(in)) {
+        return false;
+    }
+
+    size_t count = 0;
+    if (!in.Count(MinMatchSize, count)) {
+        return false;
+    }
+    loaded.matches.resize(count);
+    for (auto& match : loaded.matches) {
+        uint32_t pattern = 0;
+        ReplaceFileStruct& result = match.result;
+        if (!in.U32(pattern) || pattern >= matcher.Set().Patterns().size() || !in.I64(match.timestamp) ||
+            !in.String(result.filename) || !in.String(result.replaceType) || !in.String(result.details) ||
+            !in.U64(result.fileReference) || !in.U64(result.parentReference)) {
+            return false;
+        }
+        match.pattern = pattern;
+    }
+
+    // last, the matcher only takes the open matches once the whole file checked out
+    if (!matcher.Load(in) || !in.AtEnd()) {
+        matcher.Clear();
+        return false;
+    }
+    *this = std::move(loaded);
+    return true;
+}
+
+bool UsnCursor::Save(const std::filesystem::path& path, const UsnPatternMatcher& matcher) const {
+    UsnStateWriter out;
+    out.U32(Version);
+    out.U32(volumeSerial);
+    out.U64(journalId);
+    out.I64(nextUsn);
+    out.U64(matcher.Set().Digest());
+    chain.Save(out);
+    out.U32((uint32_t)matches.size());
+    for (const auto& match : matches) {
+        out.U32((uint32_t)match.pattern);
+        out.I64(match.timestamp);
+        out.String(match.result.filename);
+        out.String(match.result.replaceType);
+        out.String(match.result.details);
+        out.U64(match.result.fileReference);
+        out.U64(match.result.parentReference);
+    }
+    matcher.Save(out);
+
+    // written next to the target and renamed over it, a crash never leaves half a cursor
+    std::lock_guard<std::mutex> lock(fileMutex);
+    std::filesystem::path temp = path;
+    temp += ".tmp";
+#ifdef _WIN32
+    std::FILE* file = _wfopen(temp.c_str(), L"wb");
+#else
+    std::FILE* file = std::fopen(temp.c_str(), "wb");
+#endif
+    if (!file) {
+        return false;
+    }
+    const std::string& bytes = out.Bytes();
+    bool written = std::fwrite(Magic, 1, sizeof(Magic), file) == sizeof(Magic) &&
+        std::fwrite(bytes.data(), 1, bytes.size(), file) == bytes.size();
+    written = std::fclose(file) == 0 && written;
+    if (!written) {
+        std::filesystem::remove(temp);
+        return false;
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temp, path, error);
+    if (error) {
+        std::filesystem::remove(temp);
+        return false;
+    }
+    return true;
+}
+
+bool UsnCursor::Resumable(uint64_t currentJournalId, int64_t firstUsn, int64_t lowestValidUsn, int64_t journalNextUsn) const {
+    return journalId == currentJournalId && nextUsn >= lowestValidUsn && nextUsn >= firstUsn && nextUsn <= journalNextUsn;
+}
+
+void UsnCursor::Prune(int64_t windowStart, UsnPatternMatcher& matcher) {
+    // journal order is time order up to a little reordering, a tail prunes after every read and mostly has nothing to drop
+    if (!matches.empty() && matches.front().timestamp < windowStart) {
+        matches.erase(std::remove_if(matches.begin(), matches.end(), [windowStart](const UsnMatch& match) {
+            return match.timestamp < windowStart;
+        }), matches.end());
+    }
+    matcher.DropStartedBefore(windowStart);
+}
+
+std::vector<ReplaceFileStruct> UsnCursor::Results() const {
+    std::vector<const UsnMatch*> ordered;
+    ordered.reserve(matches.size());
+    for (const auto& match : matches) {
+        ordered.push_back(&match);
+    }
+    std::stable_sort(ordered.begin(), ordered.end(), [](const UsnMatch* a, const UsnMatch* b) {
+        return a->pattern < b->pattern;
+    });
+    std::vector<ReplaceFileStruct> out;
+    out.reserve(ordered.size());
+    for (const UsnMatch* match : ordered) {
+        out.push_back(match->result);
+    }
+    return out;
+}
@@ -0,0 +1,43 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+#include "ReplaceIndex.h"
+#include "ReplaceScanner.hh"
+#include "UsnPattern.h"
+
+// where the journal scan of one volume stopped and what it had built by then, so the next run only reads the
+// records written since. no windows headers so it also builds on linux
+//
+//   header   "BAMUSNCR", version, volume serial, journal id, next usn, pattern set digest
+//   chain    DirectoryChain::Save
+//   matches  the finished ones still inside the window
+//   partials UsnPatternMatcher::Save
+class UsnCursor {
+public:
+    static constexpr uint32_t Version = 1;
+
+    // "usn-<serial>.cursor" in the directory, keyed by serial so a drive that moved to another letter keeps its cursor
+    static std::filesystem::path PathFor(const std::filesystem::path& directory, uint32_t volumeSerial);
+
+    uint32_t volumeSerial = 0;
+    uint64_t journalId = 0;
+    int64_t nextUsn = 0;
+    DirectoryChain chain;
+    std::vector<UsnMatch> matches;     // journal order
+
+    // false, with the cursor left empty and the matcher without open matches, when the file is missing, damaged or
+    // was written for another volume or pattern set
+    bool Load(const std::filesystem::path& path, uint32_t serial, UsnPatternMatcher& matcher);
+    bool Save(const std::filesystem::path& path, const UsnPatternMatcher& matcher) const;
+
+    // whether reading on at nextUsn misses nothing: same journal instance (a deleted and recreated journal gets a new
+    // id) and no record after the cursor purged yet
+    bool Resumable(uint64_t currentJournalId, int64_t firstUsn, int64_t lowestValidUsn, int64_t journalNextUsn) const;
+
+    // matches and open matches that fell out of the window since they were found
+    void Prune(int64_t windowStart, UsnPatternMatcher& matcher);
+
+    // grouped by pattern in set order like UsnPatternMatcher::Finish, the cursor keeps its copy
+    std::vector<ReplaceFileStruct> Results() const;
+};
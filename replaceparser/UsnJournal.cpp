@@ -0,0 +1,175 @@
+#include "UsnJournal.h"
+#include <iostream>
+#include "../util/Utf8.h"
+
+UsnJournalReader::~UsnJournalReader() {
+    Close();
+}
+
+bool UsnJournalReader::Open(wchar_t letter) {
+    Close();
+    driveLetter = letter;
+
+    wchar_t volumePath[] = L"\\\\.\\ :";
+    volumePath[4] = letter;
+
+    volume = CreateFileW(volumePath, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, 0, NULL);
+    if (volume == INVALID_HANDLE_VALUE) {
+        lastError = GetLastError();
+        return false;
+    }
+
+    wchar_t root[] = L" :\\";
+    root[0] = letter;
+    DWORD serial = 0;
+    if (GetVolumeInformationW(root, NULL, 0, &serial, NULL, NULL, NULL, 0)) {
+        volumeSerial = serial;
+    }
+    return Query(journal);
+}
+
+void UsnJournalReader::Close() {
+    if (volume != INVALID_HANDLE_VALUE) {
+        CloseHandle(volume);
+        volume = INVALID_HANDLE_VALUE;
+    }
+}
+
+bool UsnJournalReader::Query(JournalInfo& info) {
+    USN_JOURNAL_DATA_V1 data = {};
+    DWORD bytesReturned = 0;
+    if (!DeviceIoControl(volume, FSCTL_QUERY_USN_JOURNAL, NULL, 0, &data, sizeof(data), &bytesReturned, NULL)) {
+        lastError = GetLastError();
+        return false;
+    }
+
+    info.journalId = data.UsnJournalID;
+    info.firstUsn = data.FirstUsn;
+    info.nextUsn = data.NextUsn;
+    info.lowestValidUsn = data.LowestValidUsn;
+    return true;
+}
+
+bool UsnJournalReader::ReadChunk(int64_t startUsn, uint64_t bytesToWaitFor, uint64_t timeout, const std::function<void(const UsnRecord&)>& onRecord, int64_t& nextUsn) {
+    READ_USN_JOURNAL_DATA_V1 readData = {};
+    readData.StartUsn = startUsn;
+    readData.ReasonMask = 0xFFFFFFFF;
+    readData.ReturnOnlyOnClose = FALSE;
+    readData.Timeout = timeout;
+    readData.BytesToWaitFor = bytesToWaitFor;
+    readData.UsnJournalID = journal.journalId;
+    readData.MinMajorVersion = 2;
+    readData.MaxMajorVersion = 3;
+
+    DWORD bytesReturned = 0;
+    if (!DeviceIoControl(volume, FSCTL_READ_USN_JOURNAL, &readData, sizeof(readData), buffer.data(), (DWORD)buffer.size(), &bytesReturned, NULL)) {
+        lastError = GetLastError();
+        return false;
+    }
+    if (bytesReturned < sizeof(USN)) {
+        nextUsn = startUsn;
+        return true;
+    }
+
+    nextUsn = *reinterpret_cast<USN*>(buffer.data());
+    ForEachUsnRecord(buffer.data() + sizeof(USN), bytesReturned - sizeof(USN), onRecord);
+    return true;
+}
+
+bool UsnJournalReader::ReadAll(int64_t startUsn, const std::function<void(const UsnRecord&)>& onRecord, int64_t& nextUsn,
+    std::chrono::steady_clock::time_point deadline) {
+    int64_t current = startUsn;
+    while (current < journal.nextUsn) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            lastError = ERROR_TIMEOUT;
+            nextUsn = current;
+            return false;
+        }
+        int64_t next = current;
+        if (!ReadChunk(current, 0, 0, onRecord, next)) {
+            nextUsn = current;
+            return false;
+        }
+        if (next <= current) {
+            break;
+        }
+        current = next;
+    }
+    nextUsn = current;
+    return true;
+}
+
+bool UsnJournalReader::FirstRecordAt(int64_t usn, UsnRecord& record) {
+    READ_USN_JOURNAL_DATA_V1 readData = {};
+    readData.StartUsn = usn;
+    readData.ReasonMask = 0xFFFFFFFF;
+    readData.UsnJournalID = journal.journalId;
+    readData.MinMajorVersion = 2;
+    readData.MaxMajorVersion = 3;
+
+    // a record never crosses a page, so one page always holds a whole one
+    std::vector<uint8_t> page(sizeof(USN) + UsnPageSize);
+    DWORD bytesReturned = 0;
+    if (!DeviceIoControl(volume, FSCTL_READ_USN_JOURNAL, &readData, sizeof(readData), page.data(), (DWORD)page.size(), &bytesReturned, NULL)) {
+        lastError = GetLastError();
+        return false;
+    }
+    if (bytesReturned <= sizeof(USN)) {
+        return false;
+    }
+
+    bool found = false;
+    ForEachUsnRecord(page.data() + sizeof(USN), bytesReturned - sizeof(USN), [&record, &found](const UsnRecord& decoded) {
+        if (!found) {
+            record = decoded;
+            found = true;
+        }
+    });
+    return found;
+}
+
+bool UsnJournalReader::DirectoryPath(uint64_t reference, std::string& path) {
+    FILE_ID_DESCRIPTOR id = {};
+    id.dwSize = sizeof(id);
+    id.Type = FileIdType;
+    id.FileId.QuadPart = (LONGLONG)reference;
+    HANDLE directory = OpenFileById(volume, &id, FILE_READ_ATTRIBUTES, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+        NULL, FILE_FLAG_BACKUP_SEMANTICS);
+    if (directory == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    std::vector<wchar_t> name(32768);
+    DWORD length = GetFinalPathNameByHandleW(directory, name.data(), (DWORD)name.size(), FILE_NAME_NORMALIZED | VOLUME_NAME_NONE);
+    CloseHandle(directory);
+    if (length == 0 || length >= name.size()) {
+        return false;
+    }
+
+    // the root comes back as "\", everything else without a trailing slash
+    path = WideToUtf8(std::wstring(name.data(), length));
+    if (path == "\\") {
+        path.clear();
+    }
+    return true;
+}
+
+std::vector<wchar_t> UsnJournalReader::GetNtfsVolumes() {
+    std::vector<wchar_t> volumes;
+    wchar_t drives[MAX_PATH];
+    if (!GetLogicalDriveStringsW(MAX_PATH, drives)) {
+        return volumes;
+    }
+
+    for (wchar_t* drive = drives; *drive; drive += wcslen(drive) + 1) {
+        UINT type = GetDriveTypeW(drive);
+        if (type != DRIVE_FIXED && type != DRIVE_REMOVABLE) {
+            continue;
+        }
+        wchar_t fileSystem[MAX_PATH] = {};
+        if (GetVolumeInformationW(drive, NULL, 0, NULL, NULL, NULL, fileSystem, MAX_PATH) && wcscmp(fileSystem, L"NTFS") == 0) {
+            volumes.push_back(drive[0]);
+        }
+    }
+    return volumes;
+}
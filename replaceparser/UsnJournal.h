@@ -0,0 +1,58 @@
+#pragma once
+#include <windows.h>
+#include <winioctl.h>
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+#include "UsnRecord.h"
+
+// thin FSCTL_READ_USN_JOURNAL adapter, all the decoding happens in UsnRecord.cpp
+class UsnJournalReader {
+public:
+    struct JournalInfo {
+        uint64_t journalId = 0;
+        int64_t firstUsn = 0;
+        int64_t nextUsn = 0;
+        int64_t lowestValidUsn = 0;
+    };
+
+    UsnJournalReader() = default;
+    ~UsnJournalReader();
+    UsnJournalReader(const UsnJournalReader&) = delete;
+    UsnJournalReader& operator=(const UsnJournalReader&) = delete;
+
+    bool Open(wchar_t driveLetter);
+    void Close();
+    bool Query(JournalInfo& info);
+
+    // reads from startUsn until the end of the journal, returns the usn to continue from in nextUsn
+    // past the deadline it stops between two reads with ERROR_TIMEOUT; stopped for any reason nextUsn is the usn
+    // after the last record handed out, so a later read from there misses nothing
+    bool ReadAll(int64_t startUsn, const std::function<void(const UsnRecord&)>& onRecord, int64_t& nextUsn,
+        std::chrono::steady_clock::time_point deadline = (std::chrono::steady_clock::time_point::max)());
+
+    // first record at or after usn, for seeking by time (FindUsnByTime); reads one page, not a whole chunk
+    bool FirstRecordAt(int64_t usn, UsnRecord& record);
+
+    // one FSCTL_READ_USN_JOURNAL call, with bytesToWaitFor > 0 it blocks until that much data arrives or timeout (100ns units) hits
+    bool ReadChunk(int64_t startUsn, uint64_t bytesToWaitFor, uint64_t timeout, const std::function<void(const UsnRecord&)>& onRecord, int64_t& nextUsn);
+
+    DWORD LastError() const { return lastError; }
+    wchar_t DriveLetter() const { return driveLetter; }
+    // same value as the low half of FILE_ID_INFO::VolumeSerialNumber of any file on the volume
+    uint32_t VolumeSerial() const { return volumeSerial; }
+
+    // "\dir\sub" of a directory by its file reference, for parents the journal never mentioned
+    bool DirectoryPath(uint64_t reference, std::string& path);
+
+    static std::vector<wchar_t> GetNtfsVolumes();
+
+private:
+    HANDLE volume = INVALID_HANDLE_VALUE;
+    JournalInfo journal;
+    wchar_t driveLetter = 0;
+    uint32_t volumeSerial = 0;
+    DWORD lastError = ERROR_SUCCESS;
+    std::vector<uint8_t> buffer = std::vector<uint8_t>(1 << 20);
+};
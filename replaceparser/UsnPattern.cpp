@@ -0,0 +1,422 @@
+#include "UsnPattern.h"
+#include "ReplaceDetector.h"
+#include "../util/Utf8.h"
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <sstream>
+
+namespace {
+    bool ParseDuration(const std::string& text, int64_t& out) {
+        size_t digits = 0;
+        while (digits < text.size() && isdigit((unsigned char)text[digits])) {
+            digits++;
+        }
+        if (digits == 0 || digits > 9) {
+            return false;
+        }
+        int64_t value = std::stoll(text.substr(0, digits));
+        std::string unit = text.substr(digits);
+        if (unit == "ms") out = value * 10000;
+        else if (unit == "s") out = value * 10000000;
+        else if (unit == "m") out = value * 60 * 10000000;
+        else if (unit == "h") out = value * 60 * 60 * 10000000;
+        else return false;
+        return true;
+    }
+
+    std::string LowerAscii(const std::string& text) {
+        std::string result = text;
+        for (auto& c : result) {
+            if (c >= 'A' && c <= 'Z') {
+                c = (char)(c - 'A' + 'a');
+            }
+        }
+        return result;
+    }
+
+    uint64_t NameKey(uint64_t parent, const std::string& lowerName) {
+        uint64_t hash = 14695981039346656037ULL ^ parent;
+        for (unsigned char c : lowerName) {
+            hash = (hash ^ c) * 1099511628211ULL;
+        }
+        return hash;
+    }
+}
+
+bool UsnPatternStep::Matches(uint32_t reason) const {
+    if ((reason & all) != all || (reason & none)) {
+        return false;
+    }
+    for (uint32_t alternatives : any) {
+        if (!(reason & alternatives)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool UsnPatternSet::Parse(const std::string& text, const std::string& source, std::string& error) {
+    std::vector<UsnPattern> parsed;
+    int64_t parsedWindow = window;
+    UsnPattern current;
+    bool inPattern = false;
+
+    std::istringstream lines(text);
+    std::string line;
+    size_t lineNumber = 0;
+    auto fail = [&](const std::string& message) {
+        error = source + ":" + std::to_string(lineNumber) + ": " + message;
+        return false;
+    };
+
+    while (std::getline(lines, line)) {
+        lineNumber++;
+        size_t comment = line.find('#');
+        if (comment != std::string::npos) {
+            line.resize(comment);
+        }
+        std::istringstream words(line);
+        std::vector<std::string> tokens;
+        for (std::string word; words >> word;) {
+            tokens.push_back(word);
+        }
+        if (tokens.empty()) {
+            continue;
+        }
+
+        if (!inPattern) {
+            if (tokens[0] == "window") {
+                if (tokens.size() != 2 || !ParseDuration(tokens[1], parsedWindow)) {
+                    return fail("expected window <n>ms|s|m|h");
+                }
+            }
+            else if (tokens[0] == "pattern") {
+                bool byClause = tokens.size() == 4 && tokens[2] == "by" && (tokens[3] == "file" || tokens[3] == "name");
+                if (tokens.size() != 2 && !byClause) {
+                    return fail("expected pattern <type> [by file|name]");
+                }
+                current = UsnPattern();
+                current.type = tokens[1];
+                current.byName = byClause && tokens[3] == "name";
+                inPattern = true;
+            }
+            else {
+                return fail("expected pattern or window, got " + tokens[0]);
+            }
+            continue;
+        }
+
+        if (tokens[0] == "end") {
+            if (tokens.size() != 1 || current.steps.empty()) {
+                return fail("pattern " + current.type + " has no steps");
+            }
+            parsed.push_back(std::move(current));
+            inPattern = false;
+            continue;
+        }
+
+        UsnPatternStep step;
+        size_t t = 0;
+        if (tokens[0].size() > 1 && tokens[0].back() == ':') {
+            step.label = tokens[0].substr(0, tokens[0].size() - 1);
+            t = 1;
+        }
+        for (; t < tokens.size(); t++) {
+            const std::string& token = tokens[t];
+            if (token == "within") {
+                if (t + 1 >= tokens.size() || !ParseDuration(tokens[t + 1], step.within)) {
+                    return fail("expected within <n>ms|s|m|h");
+                }
+                t++;
+                continue;
+            }
+            if (token == "same_file" || token == "new_file") {
+                step.file = token == "same_file" ? UsnPatternStep::File::Same : UsnPatternStep::File::New;
+                continue;
+            }
+
+            bool negate = token[0] == '!';
+            uint32_t mask = 0;
+            size_t alternatives = 0;
+            std::istringstream names(token.substr(negate ? 1 : 0));
+            for (std::string name; std::getline(names, name, '|');) {
+                uint32_t flag = 0;
+                if (!UsnReasonFromString(name, flag)) {
+                    return fail("unknown reason " + name);
+                }
+                mask |= flag;
+                alternatives++;
+            }
+            if (alternatives == 0) {
+                return fail("empty term");
+            }
+            if (negate) step.none |= mask;
+            else if (alternatives == 1) step.all |= mask;
+            else step.any.push_back(mask);
+        }
+        if (step.all == 0 && step.none == 0 && step.any.empty()) {
+            return fail("step without reasons");
+        }
+        if (current.steps.empty() && (step.within || step.file != UsnPatternStep::File::Any)) {
+            return fail("within / same_file / new_file need a previous step");
+        }
+        current.steps.push_back(std::move(step));
+    }
+    if (inPattern) {
+        return fail("pattern " + current.type + " is missing its end");
+    }
+
+    std::move(parsed.begin(), parsed.end(), std::back_inserter(patterns));
+    window = parsedWindow;
+    return true;
+}
+
+bool UsnPatternSet::Load(const std::filesystem::path& path, std::string& error) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        error = WideToUtf8(path.wstring()) + ": can't be opened";
+        return false;
+    }
+    std::ostringstream text;
+    text << in.rdbuf();
+    return Parse(text.str(), WideToUtf8(path.wstring()), error);
+}
+
+uint64_t UsnPatternSet::Digest() const {
+    UsnStateWriter out;
+    out.I64(window);
+    for (const auto& pattern : patterns) {
+        out.String(pattern.type);
+        out.U8(pattern.byName);
+        out.U32((uint32_t)pattern.steps.size());
+        for (const auto& step : pattern.steps) {
+            out.String(step.label);
+            out.U32(step.all);
+            out.U32(step.none);
+            out.U32((uint32_t)step.any.size());
+            for (uint32_t alternatives : step.any) {
+                out.U32(alternatives);
+            }
+            out.I64(step.within);
+            out.U8((uint8_t)step.file);
+        }
+    }
+    return UsnStateHash(out.Bytes());
+}
+
+UsnPatternMatcher::UsnPatternMatcher(const UsnPatternSet& set) : set(set), partials(set.Patterns().size()) {
+    commonMask = (std::numeric_limits<uint32_t>::max)();
+    for (const auto& pattern : set.Patterns()) {
+        for (const auto& step : pattern.steps) {
+            commonMask &= step.all;
+        }
+    }
+    if (set.Patterns().empty()) {
+        commonMask = 0;
+    }
+}
+
+void UsnPatternMatcher::Feed(const UsnRecord& record) {
+    records++;
+    if ((record.reason & commonMask) != commonMask) {
+        return;
+    }
+
+    // the name key is only worked out when a by name pattern needs it, once per record
+    std::string lowerName;
+    uint64_t nameKey = 0;
+    bool nameKeyReady = false;
+
+    const auto& patterns = set.Patterns();
+    for (size_t i = 0; i < patterns.size(); i++) {
+        const UsnPattern& pattern = patterns[i];
+        if (pattern.steps.size() == 1) {
+            // stateless, no map traffic for the single record patterns
+            if (pattern.steps[0].Matches(record.reason)) {
+                Emit(i, { record });
+            }
+            continue;
+        }
+
+        uint64_t key = record.fileReference;
+        if (pattern.byName) {
+            if (!nameKeyReady) {
+                lowerName = LowerAscii(record.fileName);
+                nameKey = NameKey(record.parentReference, lowerName);
+                nameKeyReady = true;
+            }
+            key = nameKey;
+        }
+
+        PartialMap& map = partials[i];
+        auto it = map.find(key);
+        if (it != map.end() && (!pattern.byName || (it->second.parent == record.parentReference && it->second.name == lowerName))) {
+            Partial& partial = it->second;
+            const UsnPatternStep& step = pattern.steps[partial.next];
+            const UsnRecord& previous = partial.captured.back();
+            bool inTime = step.within == 0 || record.timestamp - previous.timestamp <= step.within;
+            bool sameFile = record.fileReference == previous.fileReference;
+            bool fileOk = step.file == UsnPatternStep::File::Any || (step.file == UsnPatternStep::File::Same) == sameFile;
+            if (inTime && fileOk && step.Matches(record.reason)) {
+                partial.captured.push_back(record);
+                if (++partial.next == pattern.steps.size()) {
+                    Emit(i, partial.captured);
+                    map.erase(it);
+                }
+                continue;
+            }
+        }
+        if (pattern.steps[0].Matches(record.reason)) {
+            // a new start replaces an unfinished match of the same file, the latest one is the one that counts
+            Partial& partial = map[key];
+            partial.next = 1;
+            partial.parent = record.parentReference;
+            partial.name = lowerName;
+            partial.captured.assign(1, record);
+        }
+    }
+
+    if (PendingCount() > sweepAt) {
+        Sweep(record.timestamp);
+    }
+}
+
+void UsnPatternMatcher::Emit(size_t pattern, const std::vector<UsnRecord>& captured) {
+    const UsnPattern& source = set.Patterns()[pattern];
+    const UsnRecord& last = captured.back();
+    ReplaceFileStruct result;
+    result.filename = last.fileName;
+    result.replaceType = source.type;
+    for (size_t i = 0; i < captured.size(); i++) {
+        const std::string& label = source.steps[i].label;
+        if (!label.empty()) {
+            result.details += label + ":\n";
+        }
+        result.details += ReplaceDetector::DescribeRecord(captured[i]);
+    }
+    result.fileReference = last.fileReference;
+    result.parentReference = last.parentReference;
+    results.push_back(UsnMatch{ pattern, last.timestamp, std::move(result) });
+}
+
+// partials waiting on a "within" step that can't be met any more are dropped, keeps the state of
+// multi-million record journals down to the matches that are still open
+void UsnPatternMatcher::Sweep(int64_t now) {
+    const auto& patterns = set.Patterns();
+    for (size_t i = 0; i < patterns.size(); i++) {
+        for (auto it = partials[i].begin(); it != partials[i].end();) {
+            int64_t within = patterns[i].steps[it->second.next].within;
+            if (within && now - it->second.captured.back().timestamp > within) {
+                it = partials[i].erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+    }
+    sweepAt = (std::max)((size_t)4096, PendingCount() * 2);
+}
+
+size_t UsnPatternMatcher::PendingCount() const {
+    size_t count = 0;
+    for (const auto& map : partials) {
+        count += map.size();
+    }
+    return count;
+}
+
+std::vector<ReplaceFileStruct> UsnPatternMatcher::Finish() {
+    std::stable_sort(results.begin(), results.end(), [](const auto& a, const auto& b) {
+        return a.pattern < b.pattern;
+    });
+    std::vector<ReplaceFileStruct> out;
+    out.reserve(results.size());
+    for (auto& match : results) {
+        out.push_back(std::move(match.result));
+    }
+    Clear();
+    return out;
+}
+
+void UsnPatternMatcher::Clear() {
+    results.clear();
+    for (auto& map : partials) {
+        map.clear();
+    }
+}
+
+void UsnPatternMatcher::Drain(std::vector<UsnMatch>& out) {
+    std::move(results.begin(), results.end(), std::back_inserter(out));
+    results.clear();
+}
+
+void UsnPatternMatcher::DropStartedBefore(int64_t windowStart) {
+    for (auto& map : partials) {
+        for (auto it = map.begin(); it != map.end();) {
+            if (it->second.captured.front().timestamp < windowStart) {
+                it = map.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+    }
+}
+
+void UsnPatternMatcher::Save(UsnStateWriter& out) const {
+    for (const auto& map : partials) {
+        out.U32((uint32_t)map.size());
+        for (const auto& entry : map) {
+            const Partial& partial = entry.second;
+            out.U64(entry.first);
+            out.U32((uint32_t)partial.next);
+            out.U64(partial.parent);
+            out.String(partial.name);
+            out.U32((uint32_t)partial.captured.size());
+            for (const auto& record : partial.captured) {
+                out.Record(record);
+            }
+        }
+    }
+}
+
+bool UsnPatternMatcher::Load(UsnStateReader& in) {
+    constexpr size_t MinPartialSize = 28;
+    constexpr size_t MinRecordSize = 68;
+    const auto& patterns = set.Patterns();
+    std::vector<PartialMap> loaded(patterns.size());
+    for (size_t i = 0; i < patterns.size(); i++) {
+        size_t count = 0;
+        if (!in.Count(MinPartialSize, count)) {
+            return false;
+        }
+        for (size_t p = 0; p < count; p++) {
+            uint64_t key = 0;
+            uint32_t next = 0;
+            Partial partial;
+            size_t captured = 0;
+            if (!in.U64(key) || !in.U32(next) || !in.U64(partial.parent) || !in.String(partial.name) ||
+                !in.Count(MinRecordSize, captured)) {
+                return false;
+            }
+            // an open match has taken at least its first step and not its last one
+            if (next == 0 || next >= patterns[i].steps.size() || captured != next) {
+                return false;
+            }
+            partial.next = next;
+            partial.captured.resize(captured);
+            for (auto& record : partial.captured) {
+                if (!in.Record(record)) {
+                    return false;
+                }
+            }
+            loaded[i][key] = std::move(partial);
+        }
+    }
+    partials = std::move(loaded);
+    sweepAt = (std::max)((size_t)4096, PendingCount() * 2);
+    return true;
+}
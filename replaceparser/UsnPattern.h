@@ -0,0 +1,108 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "ReplaceScanner.hh"
+#include "UsnRecord.h"
+#include "UsnState.h"
+
+// replace heuristics as data: each pattern is a sequence of usn records of one file, compiled to a small automaton
+// (reason bit masks per step) and all of them run together in one streaming pass with per-file state.
+// no windows headers so it also builds on linux
+//
+//   window 3h                         records older than this before the scan are ignored (default 3h)
+//   pattern Explorer by name          result type; "by name" follows parent directory + name instead of the file reference
+//       Deleted: close file_delete    optional label, then reason names as UsnReasonToString prints them (any case)
+//       Recreated: close file_create new_file within 5s
+//   end
+//
+// a step is every term at once: "name" has to be set, "!name" must not be, "a|b" needs at least one of them.
+// later steps can add "within <n>ms|s|m|h" (since the previous step) and "same_file" / "new_file" (file reference
+// equal to / different from the previous step's). records of a file in between steps are skipped, a record that
+// matches the first step again restarts the match from it. "#" starts a comment
+
+struct UsnPatternStep {
+    std::string label;
+    uint32_t all = 0;
+    uint32_t none = 0;
+    std::vector<uint32_t> any;
+    int64_t within = 0;       // 100ns units, 0 = no limit
+    enum class File : uint8_t { Any, Same, New } file = File::Any;
+
+    bool Matches(uint32_t reason) const;
+};
+
+struct UsnPattern {
+    std::string type;
+    bool byName = false;
+    std::vector<UsnPatternStep> steps;
+};
+
+class UsnPatternSet {
+public:
+    // source names the text in error messages ("builtin", a file path), error is "source:line: message"
+    bool Parse(const std::string& text, const std::string& source, std::string& error);
+    bool Load(const std::filesystem::path& path, std::string& error);
+
+    const std::vector<UsnPattern>& Patterns() const { return patterns; }
+    int64_t Window() const { return window; }
+    // changes with anything that changes what the patterns match, saved matcher state is only valid for the same digest
+    uint64_t Digest() const;
+
+private:
+    std::vector<UsnPattern> patterns;
+    int64_t window = 3LL * 60 * 60 * 10000000;
+};
+
+// a finished match, timestamp is the one of its last record
+struct UsnMatch {
+    size_t pattern = 0;
+    int64_t timestamp = 0;
+    ReplaceFileStruct result;
+};
+
+// one journal, fed in usn order
+class UsnPatternMatcher {
+public:
+    explicit UsnPatternMatcher(const UsnPatternSet& set);
+
+    void Feed(const UsnRecord& record);
+    // results grouped by pattern in set order, in journal order within a pattern
+    std::vector<ReplaceFileStruct> Finish();
+
+    // incremental use across runs: the finished matches are moved out (journal order) while the open ones stay
+    void Drain(std::vector<UsnMatch>& out);
+    // open matches that started before windowStart, what a fresh read of the window would never have begun
+    void DropStartedBefore(int64_t windowStart);
+    // the open matches, only loadable into a matcher of a set with the same Digest()
+    void Save(UsnStateWriter& out) const;
+    bool Load(UsnStateReader& in);
+    // forgets finished and open matches
+    void Clear();
+    const UsnPatternSet& Set() const { return set; }
+
+    size_t RecordCount() const { return records; }
+    size_t PendingCount() const;
+
+private:
+    struct Partial {
+        size_t next = 0;
+        uint64_t parent = 0;        // by name keys are hashes, parent + name catch the rare collision
+        std::string name;
+        std::vector<UsnRecord> captured;
+    };
+    using PartialMap = std::unordered_map<uint64_t, Partial>;
+
+    void Emit(size_t pattern, const std::vector<UsnRecord>& captured);
+    void Sweep(int64_t now);
+
+    const UsnPatternSet& set;
+    std::vector<PartialMap> partials;       // per pattern, only for multi step ones
+    std::vector<UsnMatch> results;
+    uint32_t commonMask = 0;                // bits every step needs (close for all the builtins), anything without them is skipped
+    size_t records = 0;
+    size_t sweepAt = 4096;
+};
@@ -0,0 +1,228 @@
+#include "UsnRecord.h"
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+    template <typename T>
+    T readLe(const uint8_t* p) {
+        T value = 0;
+        for (size_t i = 0; i < sizeof(T); i++) {
+            value |= (T)((uint64_t)p[i] << (8 * i));
+        }
+        return value;
+    }
+
+    constexpr size_t V2HeaderSize = 60;
+    constexpr size_t V3HeaderSize = 76;
+
+    const struct { uint32_t flag; const char* name; } ReasonNames[] = {
+        { UsnReason::DataOverwrite, "DATA_OVERWRITE" },
+        { UsnReason::DataExtend, "DATA_EXTEND" },
+        { UsnReason::DataTruncation, "DATA_TRUNCATION" },
+        { UsnReason::NamedDataOverwrite, "NAMED_DATA_OVERWRITE" },
+        { UsnReason::NamedDataExtend, "NAMED_DATA_EXTEND" },
+        { UsnReason::NamedDataTruncation, "NAMED_DATA_TRUNCATION" },
+        { UsnReason::FileCreate, "FILE_CREATE" },
+        { UsnReason::FileDelete, "FILE_DELETE" },
+        { UsnReason::EaChange, "EA_CHANGE" },
+        { UsnReason::SecurityChange, "SECURITY_CHANGE" },
+        { UsnReason::RenameOldName, "RENAME_OLD_NAME" },
+        { UsnReason::RenameNewName, "RENAME_NEW_NAME" },
+        { UsnReason::IndexableChange, "INDEXABLE_CHANGE" },
+        { UsnReason::BasicInfoChange, "BASIC_INFO_CHANGE" },
+        { UsnReason::HardLinkChange, "HARD_LINK_CHANGE" },
+        { UsnReason::CompressionChange, "COMPRESSION_CHANGE" },
+        { UsnReason::EncryptionChange, "ENCRYPTION_CHANGE" },
+        { UsnReason::ObjectIdChange, "OBJECT_ID_CHANGE" },
+        { UsnReason::ReparsePointChange, "REPARSE_POINT_CHANGE" },
+        { UsnReason::StreamChange, "STREAM_CHANGE" },
+        { UsnReason::TransactedChange, "TRANSACTED_CHANGE" },
+        { UsnReason::IntegrityChange, "INTEGRITY_CHANGE" },
+        { UsnReason::Close, "CLOSE" },
+    };
+}
+
+std::string Utf16LeToUtf8(const uint8_t* data, size_t bytes) {
+    std::string out;
+    out.reserve(bytes / 2);
+    size_t count = bytes / 2;
+    for (size_t i = 0; i < count; i++) {
+        uint32_t cp = readLe<uint16_t>(data + i * 2);
+        if (cp >= 0xD800 && cp <= 0xDBFF && i + 1 < count) {
+            uint32_t low = readLe<uint16_t>(data + (i + 1) * 2);
+            if (low >= 0xDC00 && low <= 0xDFFF) {
+                cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+                i++;
+            }
+        }
+        if (cp < 0x80) {
+            out += (char)cp;
+        }
+        else if (cp < 0x800) {
+            out += (char)(0xC0 | (cp >> 6));
+            out += (char)(0x80 | (cp & 0x3F));
+        }
+        else if (cp < 0x10000) {
+            out += (char)(0xE0 | (cp >> 12));
+            out += (char)(0x80 | ((cp >> 6) & 0x3F));
+            out += (char)(0x80 | (cp & 0x3F));
+        }
+        else {
+            out += (char)(0xF0 | (cp >> 18));
+            out += (char)(0x80 | ((cp >> 12) & 0x3F));
+            out += (char)(0x80 | ((cp >> 6) & 0x3F));
+            out += (char)(0x80 | (cp & 0x3F));
+        }
+    }
+    return out;
+}
+
+size_t ForEachUsnRecord(const uint8_t* data, size_t size, const std::function<void(const UsnRecord&)>& onRecord) {
+    size_t offset = 0;
+    UsnRecord record;
+
+    while (offset + 8 <= size) {
+        uint32_t recordLength = readLe<uint32_t>(data + offset);
+
+        // $J dumps are sparse, the freed part of the journal reads back as zeros
+        if (recordLength == 0) {
+            offset += 8;
+            continue;
+        }
+
+        uint16_t major = readLe<uint16_t>(data + offset + 4);
+        size_t headerSize = major == 2 ? V2HeaderSize : major == 3 ? V3HeaderSize : 0;
+        if (recordLength < 8 || (recordLength & 7) != 0 || headerSize == 0 || recordLength < headerSize) {
+            // not a record we understand (v4 range records or garbage), realign and keep going
+            offset += 8;
+            continue;
+        }
+        if (offset + recordLength > size) {
+            break;
+        }
+
+        const uint8_t* p = data + offset;
+        record.majorVersion = major;
+        size_t cursor = 8;
+        if (major == 2) {
+            record.fileReference = readLe<uint64_t>(p + 8);
+            record.fileReferenceHigh = 0;
+            record.parentReference = readLe<uint64_t>(p + 16);
+            record.parentReferenceHigh = 0;
+            cursor = 24;
+        }
+        else {
+            record.fileReference = readLe<uint64_t>(p + 8);
+            record.fileReferenceHigh = readLe<uint64_t>(p + 16);
+            record.parentReference = readLe<uint64_t>(p + 24);
+            record.parentReferenceHigh = readLe<uint64_t>(p + 32);
+            cursor = 40;
+        }
+        record.usn = readLe<int64_t>(p + cursor);
+        record.timestamp = readLe<int64_t>(p + cursor + 8);
+        record.reason = readLe<uint32_t>(p + cursor + 16);
+        record.sourceInfo = readLe<uint32_t>(p + cursor + 20);
+        record.fileAttributes = readLe<uint32_t>(p + cursor + 28);
+        uint16_t nameLength = readLe<uint16_t>(p + cursor + 32);
+        uint16_t nameOffset = readLe<uint16_t>(p + cursor + 34);
+
+        if ((size_t)nameOffset + nameLength > recordLength) {
+            offset += 8;
+            continue;
+        }
+
+        record.fileName = Utf16LeToUtf8(p + nameOffset, nameLength);
+        onRecord(record);
+        offset += recordLength;
+    }
+
+    return offset;
+}
+
+size_t DecodeUsnRecords(const uint8_t* data, size_t size, std::vector<UsnRecord>& out) {
+    return ForEachUsnRecord(data, size, [&out](const UsnRecord& record) {
+        out.push_back(record);
+    });
+}
+
+int64_t FindUsnByTime(int64_t firstUsn, int64_t endUsn, int64_t timestamp,
+    const std::function<bool(int64_t usn, UsnRecord& record)>& firstRecordAt) {
+    int64_t safe = firstUsn;
+    int64_t low = firstUsn / UsnPageSize + 1;   // the page of firstUsn itself is where safe already points
+    int64_t high = (endUsn - 1) / UsnPageSize;
+    UsnRecord record;
+    while (low <= high) {
+        int64_t page = low + (high - low) / 2;
+        if (!firstRecordAt(page * UsnPageSize, record) || record.usn >= endUsn) {
+            // past the last record, or a read that failed
+            high = page - 1;
+            continue;
+        }
+        if (record.timestamp < timestamp) {
+            safe = record.usn;
+            low = page + 1;
+        }
+        else {
+            high = page - 1;
+        }
+    }
+    return safe;
+}
+
+std::string UsnReasonToString(uint32_t reason) {
+    std::string result;
+    for (const auto& entry : ReasonNames) {
+        if (reason & entry.flag) {
+            if (!result.empty()) result += " | ";
+            result += entry.name;
+        }
+    }
+    return result.empty() ? "NONE" : result;
+}
+
+bool UsnReasonFromString(const std::string& name, uint32_t& flag) {
+    for (const auto& entry : ReasonNames) {
+        size_t length = strlen(entry.name);
+        if (name.size() != length) {
+            continue;
+        }
+        bool same = true;
+        for (size_t i = 0; i < length && same; i++) {
+            same = toupper((unsigned char)name[i]) == entry.name[i];
+        }
+        if (same) {
+            flag = entry.flag;
+            return true;
+        }
+    }
+    return false;
+}
+
+std::string FileTimeToUtcString(int64_t fileTime) {
+    int64_t seconds = fileTime / 10000000 - 11644473600LL;
+    int64_t days = seconds / 86400;
+    int64_t secondsOfDay = seconds % 86400;
+    if (secondsOfDay < 0) {
+        secondsOfDay += 86400;
+        days--;
+    }
+
+    // civil from days, howard hinnant
+    days += 719468;
+    int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+    int64_t doe = days - era * 146097;
+    int64_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    int64_t year = yoe + era * 400;
+    int64_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    int64_t mp = (5 * doy + 2) / 153;
+    int64_t day = doy - (153 * mp + 2) / 5 + 1;
+    int64_t month = mp < 10 ? mp + 3 : mp - 9;
+    if (month <= 2) year++;
+
+    char buffer[48];
+    snprintf(buffer, sizeof(buffer), "%04lld-%02lld-%02lld %02lld:%02lld:%02lld",
+        (long long)year, (long long)month, (long long)day,
+        (long long)(secondsOfDay / 3600), (long long)((secondsOfDay / 60) % 60), (long long)(secondsOfDay % 60));
+    return buffer;
+}
@@ -0,0 +1,74 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// portable decoder for USN_RECORD_V2 / USN_RECORD_V3 buffers, no windows headers so it also builds on linux
+// works on FSCTL_READ_USN_JOURNAL output (after the leading next-usn qword) and on raw $UsnJrnl:$J dumps
+
+namespace UsnReason {
+    constexpr uint32_t DataOverwrite = 0x00000001;
+    constexpr uint32_t DataExtend = 0x00000002;
+    constexpr uint32_t DataTruncation = 0x00000004;
+    constexpr uint32_t NamedDataOverwrite = 0x00000010;
+    constexpr uint32_t NamedDataExtend = 0x00000020;
+    constexpr uint32_t NamedDataTruncation = 0x00000040;
+    constexpr uint32_t FileCreate = 0x00000100;
+    constexpr uint32_t FileDelete = 0x00000200;
+    constexpr uint32_t EaChange = 0x00000400;
+    constexpr uint32_t SecurityChange = 0x00000800;
+    constexpr uint32_t RenameOldName = 0x00001000;
+    constexpr uint32_t RenameNewName = 0x00002000;
+    constexpr uint32_t IndexableChange = 0x00004000;
+    constexpr uint32_t BasicInfoChange = 0x00008000;
+    constexpr uint32_t HardLinkChange = 0x00010000;
+    constexpr uint32_t CompressionChange = 0x00020000;
+    constexpr uint32_t EncryptionChange = 0x00040000;
+    constexpr uint32_t ObjectIdChange = 0x00080000;
+    constexpr uint32_t ReparsePointChange = 0x00100000;
+    constexpr uint32_t StreamChange = 0x00200000;
+    constexpr uint32_t TransactedChange = 0x00400000;
+    constexpr uint32_t IntegrityChange = 0x00800000;
+    constexpr uint32_t Close = 0x80000000;
+}
+
+struct UsnRecord {
+    uint16_t majorVersion = 0;
+    // v2 references only use the low half, v3 ones are 128 bit but ntfs never sets the high half
+    uint64_t fileReference = 0;
+    uint64_t fileReferenceHigh = 0;
+    uint64_t parentReference = 0;
+    uint64_t parentReferenceHigh = 0;
+    int64_t usn = 0;
+    int64_t timestamp = 0; // FILETIME, UTC
+    uint32_t reason = 0;
+    uint32_t sourceInfo = 0;
+    uint32_t fileAttributes = 0;
+    std::string fileName; // utf-8
+};
+
+// calls onRecord for every valid record in the buffer, skips zeroed gaps of sparse journal dumps
+// returns the amount of bytes consumed, a truncated record at the end is left for the next buffer
+size_t ForEachUsnRecord(const uint8_t* data, size_t size, const std::function<void(const UsnRecord&)>& onRecord);
+
+size_t DecodeUsnRecords(const uint8_t* data, size_t size, std::vector<UsnRecord>& out);
+
+// ntfs fills the journal page by page, a record never crosses into the next page so every page starts with one
+constexpr int64_t UsnPageSize = 4096;
+
+// where to start reading so that every record stamped timestamp or later is read: the first record of the newest
+// page that is still older, found by bisecting the pages between firstUsn and endUsn. firstRecordAt reads the first
+// record at or after a usn; a probe that fails counts as too new, which only moves the answer earlier (at worst firstUsn)
+int64_t FindUsnByTime(int64_t firstUsn, int64_t endUsn, int64_t timestamp,
+    const std::function<bool(int64_t usn, UsnRecord& record)>& firstRecordAt);
+
+std::string Utf16LeToUtf8(const uint8_t* data, size_t bytes);
+
+std::string UsnReasonToString(uint32_t reason);
+// one reason name as UsnReasonToString prints it, any case ("file_create")
+bool UsnReasonFromString(const std::string& name, uint32_t& flag);
+
+// "YYYY-MM-DD HH:MM:SS" in UTC
+std::string FileTimeToUtcString(int64_t fileTime);
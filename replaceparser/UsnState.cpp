@@ -0,0 +1,111 @@
+#include "UsnState.h"
+
+void UsnStateWriter::U32(uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        bytes.push_back((char)(value >> (i * 8)));
+    }
+}
+
+void UsnStateWriter::U64(uint64_t value) {
+    for (int i = 0; i < 8; i++) {
+        bytes.push_back((char)(value >> (i * 8)));
+    }
+}
+
+void UsnStateWriter::String(const std::string& value) {
+    U32((uint32_t)value.size());
+    bytes += value;
+}
+
+void UsnStateWriter::Record(const UsnRecord& record) {
+    U32(record.majorVersion);
+    U64(record.fileReference);
+    U64(record.fileReferenceHigh);
+    U64(record.parentReference);
+    U64(record.parentReferenceHigh);
+    I64(record.usn);
+    I64(record.timestamp);
+    U32(record.reason);
+    U32(record.sourceInfo);
+    U32(record.fileAttributes);
+    String(record.fileName);
+}
+
+bool UsnStateReader::U8(uint8_t& value) {
+    if (size - offset < 1) {
+        return false;
+    }
+    value = data[offset++];
+    return true;
+}
+
+bool UsnStateReader::U32(uint32_t& value) {
+    if (size - offset < 4) {
+        return false;
+    }
+    value = 0;
+    for (int i = 0; i < 4; i++) {
+        value |= (uint32_t)data[offset + i] << (i * 8);
+    }
+    offset += 4;
+    return true;
+}
+
+bool UsnStateReader::U64(uint64_t& value) {
+    if (size - offset < 8) {
+        return false;
+    }
+    value = 0;
+    for (int i = 0; i < 8; i++) {
+        value |= (uint64_t)data[offset + i] << (i * 8);
+    }
+    offset += 8;
+    return true;
+}
+
+bool UsnStateReader::I64(int64_t& value) {
+    uint64_t raw = 0;
+    if (!U64(raw)) {
+        return false;
+    }
+    value = (int64_t)raw;
+    return true;
+}
+
+bool UsnStateReader::String(std::string& value) {
+    uint32_t length = 0;
+    if (!U32(length) || size - offset < length) {
+        return false;
+    }
+    value.assign((const char*)data + offset, length);
+    offset += length;
+    return true;
+}
+
+bool UsnStateReader::Record(UsnRecord& record) {
+    uint32_t majorVersion = 0;
+    if (!U32(majorVersion)) {
+        return false;
+    }
+    record.majorVersion = (uint16_t)majorVersion;
+    return U64(record.fileReference) && U64(record.fileReferenceHigh) && U64(record.parentReference) &&
+        U64(record.parentReferenceHigh) && I64(record.usn) && I64(record.timestamp) && U32(record.reason) &&
+        U32(record.sourceInfo) && U32(record.fileAttributes) && String(record.fileName);
+}
+
+bool UsnStateReader::Count(size_t minItemSize, size_t& count) {
+    uint32_t raw = 0;
+    if (!U32(raw) || (uint64_t)raw * minItemSize > size - offset) {
+        return false;
+    }
+    count = raw;
+    return true;
+}
+
+uint64_t UsnStateHash(const std::string& bytes) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (unsigned char c : bytes) {
+        hash = (hash ^ c) * 1099511628211ULL;
+    }
+    return hash;
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "UsnRecord.h"
+
+// little endian encoding of the journal scan state that outlives a run (UsnCursor.h), no windows headers so it
+// also builds on linux. the reader never trusts a length, everything is checked against what is left
+class UsnStateWriter {
+public:
+    void U8(uint8_t value) { bytes.push_back((char)value); }
+    void U32(uint32_t value);
+    void U64(uint64_t value);
+    void I64(int64_t value) { U64((uint64_t)value); }
+    void String(const std::string& value);
+    void Record(const UsnRecord& record);
+
+    const std::string& Bytes() const { return bytes; }
+
+private:
+    std::string bytes;
+};
+
+class UsnStateReader {
+public:
+    UsnStateReader(const uint8_t* data, size_t size) : data(data), size(size) {}
+
+    bool U8(uint8_t& value);
+    bool U32(uint32_t& value);
+    bool U64(uint64_t& value);
+    bool I64(int64_t& value);
+    bool String(std::string& value);
+    bool Record(UsnRecord& record);
+    // a count of items at least minItemSize bytes each that fit in the rest, stops a damaged count from allocating
+    bool Count(size_t minItemSize, size_t& count);
+
+    bool AtEnd() const { return offset == size; }
+
+private:
+    const uint8_t* data;
+    size_t size;
+    size_t offset = 0;
+};
+
+uint64_t UsnStateHash(const std::string& bytes);
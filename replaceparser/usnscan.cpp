@@ -0,0 +1,169 @@
+// usnscan, runs the replace patterns over a raw $UsnJrnl:$J dump (or FSCTL_READ_USN_JOURNAL output saved to a file)
+// and measures the decoder and the pattern engine. --replay plays the dump back like a live journal through the same
+// streaming path as the watch mode (ReplaceTail) and measures how late alerts come. only needs the portable
+// replaceparser files, util/Utf8.cpp and util/MappedFile.cpp, builds on windows and linux alike
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <string>
+#include "ReplaceDetector.h"
+#include "ReplaceTail.h"
+#include "UsnPattern.h"
+#include "UsnRecord.h"
+#include "../util/MappedFile.h"
+
+static void PrintUsage() {
+    std::cerr << "Usage: usnscan <journal dump> [--patterns <file>] [--window] [--list] [--replay <speed>] [--chunk <KB>]\n"
+        << "  --patterns  extra patterns on top of the builtin ones\n"
+        << "  --window    only the pattern window before the newest record, like a live scan (default: whole dump)\n"
+        << "  --list      print every result\n"
+        << "  --replay    play the dump back like a live journal, speed 1 at the pace it was written, 0 as fast as possible\n"
+        << "  --chunk     bytes per replayed read, like the FSCTL_READ_USN_JOURNAL buffer (default 64)" << std::endl;
+}
+
+static int Replay(const char* path, const UsnPatternSet& patterns, double speed, size_t chunkSize, bool list) {
+    UsnReplaySource source;
+    if (!source.Open(path)) {
+        std::cerr << "Failed to map " << path << std::endl;
+        return 1;
+    }
+    source.SetSpeed(speed);
+    source.SetChunkSize(chunkSize);
+
+    ReplaceTail tail(patterns);
+    tail.Start(0, 0, 0);
+    int64_t journalTime = 0;
+    auto feed = [&tail, &journalTime](const UsnRecord& record) {
+        tail.Feed(record);
+        journalTime = (std::max)(journalTime, record.timestamp);
+    };
+
+    // latency is from the moment the chunk's first record was due (written, for a live journal) to its alerts being out
+    std::vector<ReplaceAlert> alerts;
+    std::map<std::string, size_t> byType;
+    size_t reads = 0;
+    double latencySum = 0;
+    double latencyMax = 0;
+    int64_t nextUsn = 0;
+    auto start = std::chrono::steady_clock::now();
+    while (source.Read(feed, nextUsn)) {
+        reads++;
+        alerts.clear();
+        tail.Collect(nextUsn, journalTime, "", DirectoryChain::Resolver(), alerts);
+        if (alerts.empty()) {
+            continue;
+        }
+        double latencyMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - source.DueTime()).count();
+        latencySum += latencyMs * alerts.size();
+        latencyMax = (std::max)(latencyMax, latencyMs);
+        for (const auto& alert : alerts) {
+            byType[alert.result.replaceType]++;
+            if (list) {
+                std::cout << "\n[" << alert.result.replaceType << "] " << alert.path << "\n" << alert.result.details;
+            }
+        }
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    size_t alertCount = tail.AlertCount();
+    std::cout << std::fixed << std::setprecision(2)
+        << "replay: " << tail.RecordCount() << " records, " << source.Size() / (1024.0 * 1024.0) << " MB in " << reads << " reads, "
+        << seconds * 1000 << " ms, " << tail.RecordCount() / seconds / 1e6 << " M records/s\n"
+        << "alerts: " << alertCount << ", latency avg " << (alertCount ? latencySum / alertCount : 0.0) << " ms, max "
+        << latencyMax << " ms, " << tail.PendingCount() << " matches still open at the end" << std::endl;
+    for (const auto& type : byType) {
+        std::cout << type.first << ": " << type.second << std::endl;
+    }
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        PrintUsage();
+        return 1;
+    }
+    std::string patternsPath;
+    bool useWindow = false;
+    bool list = false;
+    bool replay = false;
+    double speed = 0;
+    size_t chunkSize = 1 << 16;
+    for (int i = 2; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--patterns" && i + 1 < argc) patternsPath = argv[++i];
+        else if (arg == "--replay" && i + 1 < argc) {
+            replay = true;
+            speed = std::atof(argv[++i]);
+        }
+        else if (arg == "--chunk" && i + 1 < argc) chunkSize = (size_t)std::atoi(argv[++i]) * 1024;
+        else if (arg == "--window") useWindow = true;
+        else if (arg == "--list") list = true;
+        else {
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    UsnPatternSet patterns = ReplaceDetector::Builtin();
+    std::string error;
+    if (!patternsPath.empty() && !patterns.Load(patternsPath, error)) {
+        std::cerr << error << std::endl;
+        return 1;
+    }
+    if (replay) {
+        return Replay(argv[1], patterns, speed, chunkSize, list);
+    }
+
+    MappedFile dump;
+    if (!dump.Open(argv[1])) {
+        std::cerr << "Failed to map " << argv[1] << std::endl;
+        return 1;
+    }
+    double mb = dump.Size() / (1024.0 * 1024.0);
+
+    // decoding alone first, the difference to the second pass is what the patterns cost
+    size_t decoded = 0;
+    int64_t newest = (std::numeric_limits<int64_t>::min)();
+    auto start = std::chrono::steady_clock::now();
+    ForEachUsnRecord(dump.Data(), dump.Size(), [&decoded, &newest](const UsnRecord& record) {
+        decoded++;
+        newest = (std::max)(newest, record.timestamp);
+    });
+    double decodeSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    int64_t windowStart = useWindow ? newest - patterns.Window() : (std::numeric_limits<int64_t>::min)();
+    UsnPatternMatcher matcher(patterns);
+    size_t fed = 0;
+    start = std::chrono::steady_clock::now();
+    ForEachUsnRecord(dump.Data(), dump.Size(), [&matcher, &fed, windowStart](const UsnRecord& record) {
+        if (record.timestamp >= windowStart && ReplaceDetector::IsInterestingFile(record.fileName)) {
+            matcher.Feed(record);
+            fed++;
+        }
+    });
+    size_t pending = matcher.PendingCount();
+    std::vector<ReplaceFileStruct> results = matcher.Finish();
+    double matchSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << std::fixed << std::setprecision(2)
+        << decoded << " records, " << mb << " MB, " << patterns.Patterns().size() << " patterns\n"
+        << "decode only:       " << decodeSeconds * 1000 << " ms, " << decoded / decodeSeconds / 1e6 << " M records/s, "
+        << mb / decodeSeconds << " MB/s\n"
+        << "decode + patterns: " << matchSeconds * 1000 << " ms, " << decoded / matchSeconds / 1e6 << " M records/s, "
+        << fed << " records matched against the patterns, " << pending << " matches still open at the end" << std::endl;
+
+    std::map<std::string, size_t> byType;
+    for (const auto& result : results) {
+        byType[result.replaceType]++;
+        if (list) {
+            std::cout << "\n[" << result.replaceType << "] " << result.filename << "\n" << result.details;
+        }
+    }
+    for (const auto& type : byType) {
+        std::cout << type.first << ": " << type.second << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,221 @@
+#include "AuthenticodeEngine.h"
+#include <yara/authenticode-parser/authenticode.h>
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+
+static std::atomic<long long> imagesChecked{ 0 };
+static std::atomic<long long> validImages{ 0 };
+static std::atomic<long long> invalidImages{ 0 };
+static std::atomic<long long> unsignedImages{ 0 };
+static std::atomic<long long> notImages{ 0 };
+static std::atomic<long long> verifyMicroseconds{ 0 };
+
+namespace {
+    constexpr uint16_t DosMagic = 0x5A4D;        // "MZ"
+    constexpr uint32_t NtSignature = 0x00004550; // "PE\0\0"
+    constexpr uint16_t Pe32Magic = 0x10B;
+    constexpr uint16_t Pe32PlusMagic = 0x20B;
+    constexpr uint32_t SecurityDirectory = 4;
+
+    template <typename T>
+    bool ReadAt(const uint8_t* data, size_t size, uint64_t offset, T& value) {
+        if (offset > size || sizeof(T) > size - offset) {
+            return false;
+        }
+        memcpy(&value, data + offset, sizeof(T));
+        return true;
+    }
+
+    std::string Bytes(const ByteArray& bytes) {
+        if (!bytes.data || bytes.len <= 0) {
+            return std::string();
+        }
+        return std::string(reinterpret_cast<const char*>(bytes.data), (size_t)bytes.len);
+    }
+
+    // just enough of the headers to tell a pe image from anything else
+    bool IsImage(const uint8_t* data, size_t size) {
+        uint16_t dosMagic = 0, optionalMagic = 0;
+        uint32_t ntOffset = 0, signature = 0;
+        return ReadAt(data, size, 0, dosMagic) && dosMagic == DosMagic &&
+            ReadAt(data, size, 0x3C, ntOffset) &&
+            ReadAt(data, size, ntOffset, signature) && signature == NtSignature &&
+            ReadAt(data, size, (uint64_t)ntOffset + 24, optionalMagic) &&
+            (optionalMagic == Pe32Magic || optionalMagic == Pe32PlusMagic);
+    }
+}
+
+void AuthenticodeEngine::Initialize() {
+    static std::once_flag once;
+    std::call_once(once, []() {
+        initialize_authenticode_parser();
+    });
+}
+
+// headers come from the first bytes of the file, the table itself is only checked against the file size
+static bool LocateSecurityDirectory(const uint8_t* headers, size_t headersSize, uint64_t fileSize,
+    uint64_t& checksumOffset, uint64_t& entryOffset, uint32_t& tableOffset, uint32_t& tableLength) {
+    if (!IsImage(headers, headersSize)) {
+        return false;
+    }
+    uint32_t ntOffset = 0;
+    uint16_t optionalMagic = 0;
+    ReadAt(headers, headersSize, 0x3C, ntOffset);
+    uint64_t optionalHeader = (uint64_t)ntOffset + 24;
+    ReadAt(headers, headersSize, optionalHeader, optionalMagic);
+    checksumOffset = optionalHeader + 64;
+
+    // NumberOfRvaAndSizes sits right before the data directories, 16 bytes further out on pe32+
+    uint64_t directoryCountOffset = optionalHeader + (optionalMagic == Pe32PlusMagic ? 108 : 92);
+    uint32_t directoryCount = 0;
+    tableOffset = 0;
+    tableLength = 0;
+    if (!ReadAt(headers, headersSize, directoryCountOffset, directoryCount) || directoryCount <= SecurityDirectory) {
+        entryOffset = 0;
+        return true;
+    }
+
+    // the security entry holds a file offset, not an rva
+    entryOffset = directoryCountOffset + 4 + SecurityDirectory * 8;
+    uint32_t offset = 0, length = 0;
+    if (!ReadAt(headers, headersSize, entryOffset, offset) || !ReadAt(headers, headersSize, entryOffset + 4, length)) {
+        entryOffset = 0;
+        return true;
+    }
+    // a WIN_CERTIFICATE header alone is 8 bytes
+    if (offset != 0 && length >= 8 && offset <= fileSize && length <= fileSize - offset) {
+        tableOffset = offset;
+        tableLength = length;
+    }
+    return true;
+}
+
+bool AuthenticodeEngine::LocateCertificateTable(const uint8_t* data, size_t size, uint32_t& offset, uint32_t& length) {
+    uint64_t checksumOffset = 0, entryOffset = 0;
+    if (!LocateSecurityDirectory(data, size, size, checksumOffset, entryOffset, offset, length)) {
+        return false;
+    }
+    return length != 0;
+}
+
+bool AuthenticodeEngine::DigestHoles(const uint8_t* headers, size_t headersSize, uint64_t fileSize, std::vector<ImageHole>& holes) {
+    holes.clear();
+    uint64_t checksumOffset = 0, entryOffset = 0;
+    uint32_t tableOffset = 0, tableLength = 0;
+    if (!LocateSecurityDirectory(headers, headersSize, fileSize, checksumOffset, entryOffset, tableOffset, tableLength)) {
+        return false;
+    }
+    holes.push_back({ checksumOffset, 4 });
+    if (entryOffset) {
+        holes.push_back({ entryOffset, 8 });
+    }
+    if (tableLength) {
+        holes.push_back({ tableOffset, tableLength });
+    }
+    std::sort(holes.begin(), holes.end(), [](const ImageHole& a, const ImageHole& b) { return a.offset < b.offset; });
+    return true;
+}
+
+bool AuthenticodeEngine::Verify(const uint8_t* data, size_t size, AuthenticodeResult& out) {
+    out = AuthenticodeResult();
+    if (!data || !IsImage(data, size)) {
+        notImages++;
+        return false;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    imagesChecked++;
+
+    uint32_t tableOffset = 0, tableLength = 0;
+    if (!LocateCertificateTable(data, size, tableOffset, tableLength)) {
+        out.status = AuthenticodeStatus::NoSignature;
+        unsignedImages++;
+        verifyMicroseconds += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+        return true;
+    }
+
+    // the parser hashes the image itself, skipping the checksum, the security directory entry and the table
+    out.status = AuthenticodeStatus::Invalid;
+    AuthenticodeArray* signatures = parse_authenticode(data, size);
+    if (signatures && signatures->count > 0 && signatures->signatures[0]) {
+        // only the primary signature counts, WinVerifyTrust doesn't look at nested ones either
+        const Authenticode* auth = signatures->signatures[0];
+        out.verifyFlags = auth->verify_flags;
+        out.digestAlgorithm = auth->digest_alg ? auth->digest_alg : "";
+        out.signedDigest = Bytes(auth->digest);
+        out.imageDigest = Bytes(auth->file_digest);
+
+        if (auth->signer) {
+            out.programName = auth->signer->program_name ? auth->signer->program_name : "";
+            if (auth->signer->chain) {
+                for (size_t i = 0; i < auth->signer->chain->count; i++) {
+                    const Certificate* cert = auth->signer->chain->certs[i];
+                    if (!cert) continue;
+                    out.chain.push_back({ cert->subject ? cert->subject : "", cert->issuer ? cert->issuer : "",
+                        Bytes(cert->sha1), Bytes(cert->sha256) });
+                }
+            }
+        }
+
+        bool digestMatches = !out.signedDigest.empty() && out.signedDigest == out.imageDigest;
+        if (auth->verify_flags == AUTHENTICODE_VFY_VALID && digestMatches && !out.chain.empty()) {
+            out.status = AuthenticodeStatus::Valid;
+        }
+    }
+    if (signatures) {
+        authenticode_array_free(signatures);
+    }
+
+    if (out.status == AuthenticodeStatus::Valid) {
+        validImages++;
+    }
+    else {
+        invalidImages++;
+    }
+    verifyMicroseconds += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    return true;
+}
+
+bool AuthenticodeEngine::IsCheatSubject(std::string subject) {
+    static const char* cheats[] = { "manthe industries, llc", "slinkware", "amstion limited", "newfakeco", "faked signatures inc" };
+    std::transform(subject.begin(), subject.end(), subject.begin(), [](unsigned char c) { return (char)std::tolower(c); });
+    for (auto c : cheats) {
+        if (subject.find(c) != std::string::npos) {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::wstring AuthenticodeEngine::Verdict(const AuthenticodeResult& result) {
+    if (result.status != AuthenticodeStatus::Valid) {
+        return L"Not signed";
+    }
+    if (IsCheatSubject(result.chain.front().subject)) {
+        return L"Cheat Signature";
+    }
+    return L"Signed";
+}
+
+void AuthenticodeEngine::ResetStats() {
+    imagesChecked = 0;
+    validImages = 0;
+    invalidImages = 0;
+    unsignedImages = 0;
+    notImages = 0;
+    verifyMicroseconds = 0;
+}
+
+void AuthenticodeEngine::ReportStats() {
+    long long checked = imagesChecked.load();
+    double ms = verifyMicroseconds.load() / 1000.0;
+    std::cout << "Authenticode: " << checked << " images checked in " << std::fixed << std::setprecision(2) << ms << " ms (avg "
+        << (checked ? ms / checked : 0.0) << " ms), " << validImages.load() << " valid, " << invalidImages.load() << " invalid, "
+        << unsignedImages.load() << " without signature, " << notImages.load() << " non-pe files skipped" << std::endl;
+}
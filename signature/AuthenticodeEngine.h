@@ -0,0 +1,62 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// embedded authenticode check on bytes that are already in memory, built on the authenticode-parser that ships with libyara
+// no windows headers so it also builds on linux; chain trust is not decided here, that needs a root store
+
+enum class AuthenticodeStatus {
+    NoSignature,   // valid pe without a certificate table
+    Invalid,       // a signature is there but doesn't parse, doesn't verify or doesn't cover this image
+    Valid,         // pkcs#7 verifies and the signed digest equals the image digest
+};
+
+// a byte range of the image the authenticode digest leaves out
+struct ImageHole {
+    uint64_t offset;
+    uint64_t length;
+};
+
+struct AuthenticodeCertificate {
+    std::string subject;  // openssl oneline form, "/C=US/O=.../CN=..."
+    std::string issuer;
+    std::string sha1;     // raw thumbprints, same form as the CertStoreIndex keys
+    std::string sha256;
+};
+
+struct AuthenticodeResult {
+    AuthenticodeStatus status = AuthenticodeStatus::NoSignature;
+    int verifyFlags = 0;                         // AUTHENTICODE_VFY_* of the primary signature
+    std::string digestAlgorithm;
+    std::string signedDigest;                    // digest stored in the signature
+    std::string imageDigest;                     // digest of the image without checksum and certificate table
+    std::string programName;
+    std::vector<AuthenticodeCertificate> chain;  // signer first
+};
+
+class AuthenticodeEngine {
+public:
+    // registers the authenticode oids with openssl, cheap to call again, do it before the workers start
+    static void Initialize();
+
+    // false when the bytes are not a pe image at all (scripts, msi, ...), those need another verifier
+    // thread safe, nothing is shared between calls
+    static bool Verify(const uint8_t* data, size_t size, AuthenticodeResult& out);
+
+    // file offset and size of the certificate table, false if the image has none
+    static bool LocateCertificateTable(const uint8_t* data, size_t size, uint32_t& offset, uint32_t& length);
+
+    // checksum, security directory entry and certificate table, sorted by offset; the headers are enough,
+    // so a file that is only streamed can still be hashed the authenticode way. false if it isn't a pe image
+    static bool DigestHoles(const uint8_t* headers, size_t headersSize, uint64_t fileSize, std::vector<ImageHole>& holes);
+
+    // "Signed", "Not signed" or "Cheat Signature", the same strings CheckDigitalSignature produces
+    static std::wstring Verdict(const AuthenticodeResult& result);
+    // signer subjects of known cheat providers, case insensitive
+    static bool IsCheatSubject(std::string subject);
+
+    static void ResetStats();
+    static void ReportStats();
+};
@@ -0,0 +1,610 @@
+#include "CatalogIndex.h"
+#include "../util/Utf8.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <cctype>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <thread>
+
+namespace {
+    constexpr size_t BucketCount = 65536;
+
+    const uint8_t SignedDataOid[] = { 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x07, 0x02 };           // 1.2.840.113549.1.7.2
+    const uint8_t CtlOid[] = { 0x2B, 0x06, 0x01, 0x04, 0x01, 0x82, 0x37, 0x0A, 0x01 };                  // 1.3.6.1.4.1.311.10.1
+    const uint8_t IndirectDataOid[] = { 0x2B, 0x06, 0x01, 0x04, 0x01, 0x82, 0x37, 0x02, 0x01, 0x04 };   // 1.3.6.1.4.1.311.2.1.4
+
+    constexpr uint8_t TagInteger = 0x02;
+    constexpr uint8_t TagOctetString = 0x04;
+    constexpr uint8_t TagOid = 0x06;
+    constexpr uint8_t TagSequence = 0x30;
+    constexpr uint8_t TagSet = 0x31;
+    constexpr uint8_t TagExplicit0 = 0xA0;
+
+    // just the definite length DER catalogs are written in, anything else fails the parse
+    struct Der {
+        const uint8_t* data = nullptr;
+        size_t size = 0;
+
+        bool Next(uint8_t& tag, Der& value) {
+            if (size < 2) {
+                return false;
+            }
+            tag = data[0];
+            size_t length = data[1];
+            size_t header = 2;
+            if (length & 0x80) {
+                size_t bytes = length & 0x7F;
+                if (bytes == 0 || bytes > 4 || size < 2 + bytes) {
+                    return false;
+                }
+                length = 0;
+                for (size_t i = 0; i < bytes; i++) {
+                    length = (length << 8) | data[2 + i];
+                }
+                header += bytes;
+            }
+            if (length > size - header) {
+                return false;
+            }
+            value = { data + header, length };
+            data += header + length;
+            size -= header + length;
+            return true;
+        }
+
+        bool Expect(uint8_t wanted, Der& value) {
+            uint8_t tag = 0;
+            return Next(tag, value) && tag == wanted;
+        }
+
+        template <size_t N>
+        bool Is(const uint8_t (&oid)[N]) const {
+            return size == N && memcmp(data, oid, N) == 0;
+        }
+    };
+
+    int HexValue(uint16_t c) {
+        if (c >= '0' && c <= '9') return c - '0';
+        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+        return -1;
+    }
+
+    // member tags of hash catalogs are the hash as utf-16le hex, possibly null terminated
+    bool HashFromTag(const Der& tag, std::string& hash) {
+        size_t chars = tag.size / 2;
+        while (chars && tag.data[(chars - 1) * 2] == 0 && tag.data[(chars - 1) * 2 + 1] == 0) {
+            chars--;
+        }
+        if (chars != Sha1::DigestSize * 2 && chars != Sha256::DigestSize * 2) {
+            return false;
+        }
+        hash.clear();
+        for (size_t i = 0; i < chars; i += 2) {
+            int high = HexValue(tag.data[i * 2] | (tag.data[i * 2 + 1] << 8));
+            int low = HexValue(tag.data[i * 2 + 2] | (tag.data[i * 2 + 3] << 8));
+            if (high < 0 || low < 0) {
+                return false;
+            }
+            hash += (char)((high << 4) | low);
+        }
+        return true;
+    }
+
+    // SpcIndirectDataContent ::= SEQUENCE { data SpcAttributeTypeAndOptionalValue, messageDigest DigestInfo }
+    bool HashFromIndirectData(Der values, std::string& hash) {
+        Der content, data, digestInfo, algorithm, digest;
+        if (!values.Expect(TagSequence, content) || !content.Expect(TagSequence, data) || !content.Expect(TagSequence, digestInfo)) {
+            return false;
+        }
+        if (!digestInfo.Expect(TagSequence, algorithm) || !digestInfo.Expect(TagOctetString, digest)) {
+            return false;
+        }
+        if (digest.size != Sha1::DigestSize && digest.size != Sha256::DigestSize) {
+            return false;
+        }
+        hash.assign((const char*)digest.data, digest.size);
+        return true;
+    }
+
+    // TrustedSubject ::= SEQUENCE { subjectIdentifier OCTET STRING, subjectAttributes SET OF Attribute OPTIONAL }
+    void ParseSubject(Der subject, std::vector<std::string>& hashes) {
+        Der tag, attributes;
+        if (!subject.Expect(TagOctetString, tag)) {
+            return;
+        }
+        std::string hash;
+        bool found = false;
+        if (subject.Expect(TagSet, attributes)) {
+            Der attribute;
+            while (!found && attributes.Expect(TagSequence, attribute)) {
+                Der oid, values;
+                if (attribute.Expect(TagOid, oid) && attribute.Expect(TagSet, values) && oid.Is(IndirectDataOid)) {
+                    found = HashFromIndirectData(values, hash);
+                }
+            }
+        }
+        if (found || HashFromTag(tag, hash)) {
+            hashes.push_back(std::move(hash));
+        }
+    }
+
+    // trustedSubjects is the only sequence in the CTL whose items start with an octet string
+    bool IsSubjectList(Der list) {
+        Der first, identifier;
+        return list.Expect(TagSequence, first) && first.Expect(TagOctetString, identifier);
+    }
+
+    template <typename Entry>
+    bool EntryLess(const Entry& a, const Entry& b) {
+        int order = memcmp(a.hash, b.hash, sizeof(a.hash));
+        return order < 0 || (order == 0 && a.catalog < b.catalog);
+    }
+
+    template <typename Entry>
+    bool EntryEqual(const Entry& a, const Entry& b) {
+        return a.catalog == b.catalog && memcmp(a.hash, b.hash, sizeof(a.hash)) == 0;
+    }
+
+    template <typename Entry>
+    void BuildBucketTable(const Entry* entries, size_t count, std::vector<uint32_t>& buckets) {
+        buckets.assign(BucketCount + 1, (uint32_t)count);
+        size_t index = 0;
+        for (size_t bucket = 0; bucket < BucketCount; bucket++) {
+            buckets[bucket] = (uint32_t)index;
+            while (index < count && (size_t)((entries[index].hash[0] << 8) | entries[index].hash[1]) == bucket) {
+                index++;
+            }
+        }
+    }
+
+    template <typename Entry>
+    size_t FindEntries(const Entry* entries, const std::vector<uint32_t>& buckets, const std::string& hash, std::vector<uint32_t>& catalogs) {
+        size_t bucket = ((uint8_t)hash[0] << 8) | (uint8_t)hash[1];
+        const Entry* first = entries + buckets[bucket];
+        const Entry* last = entries + buckets[bucket + 1];
+        auto it = std::lower_bound(first, last, hash, [](const Entry& entry, const std::string& wanted) {
+            return memcmp(entry.hash, wanted.data(), sizeof(entry.hash)) < 0;
+        });
+        size_t found = 0;
+        for (; it != last && memcmp(it->hash, hash.data(), sizeof(it->hash)) == 0; ++it) {
+            catalogs.push_back(it->catalog);
+            found++;
+        }
+        return found;
+    }
+
+    // names are kept as utf-8, which already is the native narrow form everywhere but windows
+    std::string PathToUtf8(const std::filesystem::path& path) {
+#ifdef _WIN32
+        return WideToUtf8(path.wstring());
+#else
+        return path.string();
+#endif
+    }
+
+    std::filesystem::path Utf8ToPath(std::string_view text) {
+#ifdef _WIN32
+        return std::filesystem::path(Utf8ToWide(text));
+#else
+        return std::filesystem::path(std::string(text));
+#endif
+    }
+
+    template <typename T>
+    void Append(std::vector<uint8_t>& out, const T* items, size_t count) {
+        if (count) {
+            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(items);
+            out.insert(out.end(), bytes, bytes + count * sizeof(T));
+        }
+    }
+}
+
+void CatalogMemberHasher::Hash(const uint8_t* data, size_t length) {
+    sha1.Update(data, length);
+    sha256.Update(data, length);
+}
+
+void CatalogMemberHasher::Update(const uint8_t* chunk, size_t length) {
+    if (!started) {
+        started = true;
+        // not a pe image, no holes and the plain digest it is
+        AuthenticodeEngine::DigestHoles(chunk, length, fileSize, holes);
+    }
+
+    uint64_t begin = position;
+    uint64_t end = position + length;
+    uint64_t cursor = begin;
+    for (const ImageHole& hole : holes) {
+        uint64_t holeEnd = hole.offset + hole.length;
+        if (holeEnd <= cursor) continue;
+        if (hole.offset >= end) break;
+        if (hole.offset > cursor) {
+            Hash(chunk + (cursor - begin), (size_t)(hole.offset - cursor));
+        }
+        cursor = (std::min)(end, holeEnd);
+    }
+    if (cursor < end) {
+        Hash(chunk + (cursor - begin), (size_t)(end - cursor));
+    }
+    position = end;
+}
+
+void CatalogMemberHasher::Final(std::string& sha1Out, std::string& sha256Out) {
+    sha1Out = sha1.Final();
+    sha256Out = sha256.Final();
+}
+
+CatalogIndex& CatalogIndex::Instance() {
+    static CatalogIndex index;
+    return index;
+}
+
+bool CatalogIndex::ParseCatalog(const uint8_t* data, size_t size, std::vector<std::string>& hashes) {
+    // ContentInfo { signedData, [0] SignedData { version, digestAlgorithms, encapContentInfo { ctl, [0] CTL }, ... } }
+    Der input{ data, size };
+    Der contentInfo, oid, wrapper, signedData, version, algorithms, encapsulated, ctl;
+    if (!input.Expect(TagSequence, contentInfo) || !contentInfo.Expect(TagOid, oid) || !oid.Is(SignedDataOid)) {
+        return false;
+    }
+    if (!contentInfo.Expect(TagExplicit0, wrapper) || !wrapper.Expect(TagSequence, signedData)) {
+        return false;
+    }
+    if (!signedData.Expect(TagInteger, version) || !signedData.Expect(TagSet, algorithms) || !signedData.Expect(TagSequence, encapsulated)) {
+        return false;
+    }
+    if (!encapsulated.Expect(TagOid, oid) || !oid.Is(CtlOid) || !encapsulated.Expect(TagExplicit0, wrapper) || !wrapper.Expect(TagSequence, ctl)) {
+        return false;
+    }
+
+    // an unsigned CTL dropped into a catroot would list whatever it likes, a catalog needs a signer to be indexed.
+    // whether that signature holds up is the caller's check, this is only the structure:
+    // [0] certificates and [1] crls are optional, signerInfos is the SET after them
+    uint8_t tag = 0;
+    Der field, signerInfo;
+    bool hasSigner = false;
+    while (signedData.Next(tag, field)) {
+        if (tag == TagSet) {
+            hasSigner = field.Expect(TagSequence, signerInfo);
+        }
+    }
+    if (!hasSigner) {
+        return false;
+    }
+
+    while (ctl.Next(tag, field)) {
+        if (tag != TagSequence || !IsSubjectList(field)) {
+            continue;
+        }
+        Der subject;
+        while (field.Expect(TagSequence, subject)) {
+            ParseSubject(subject, hashes);
+        }
+        return true;
+    }
+    // a valid catalog without members
+    return true;
+}
+
+bool CatalogIndex::ListCatalogs(const std::filesystem::path& catroot, std::vector<CatalogFile>& files, uint64_t& fingerprint) {
+    std::error_code error;
+    if (!std::filesystem::is_directory(catroot, error)) {
+        return false;
+    }
+
+    auto options = std::filesystem::directory_options::skip_permission_denied;
+    for (std::filesystem::recursive_directory_iterator it(catroot, options, error), end; !error && it != end; it.increment(error)) {
+        // a file that can't be looked at is skipped, it must not end the walk
+        std::error_code entryError;
+        if (!it->is_regular_file(entryError)) continue;
+        std::string extension = PathToUtf8(it->path().extension());
+        std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return (char)std::tolower(c); });
+        if (extension != ".cat") continue;
+
+        CatalogFile file;
+        file.path = it->path();
+        file.name = PathToUtf8(it->path().lexically_relative(catroot));
+        file.size = it->file_size(entryError);
+        file.lastWrite = (int64_t)it->last_write_time(entryError).time_since_epoch().count();
+        if (entryError) continue;
+        files.push_back(std::move(file));
+    }
+
+    // directory order differs between file systems, the fingerprint must not
+    std::sort(files.begin(), files.end(), [](const CatalogFile& a, const CatalogFile& b) { return a.name < b.name; });
+    fingerprint = 14695981039346656037ULL;
+    auto mix = [&fingerprint](const void* bytes, size_t length) {
+        for (size_t i = 0; i < length; i++) {
+            fingerprint = (fingerprint ^ ((const uint8_t*)bytes)[i]) * 1099511628211ULL;
+        }
+    };
+    for (const auto& file : files) {
+        mix(file.name.data(), file.name.size() + 1);
+        mix(&file.size, sizeof(file.size));
+        mix(&file.lastWrite, sizeof(file.lastWrite));
+    }
+    return files.size() <= (std::numeric_limits<uint32_t>::max)();
+}
+
+bool CatalogIndex::Build(const std::vector<CatalogFile>& files, uint64_t fingerprint, std::vector<uint8_t>& out) {
+    // reading thousands of small files is what takes the time, so the catalogs are spread over a few threads
+    struct Partial {
+        std::vector<CatalogSha1Entry> sha1;
+        std::vector<CatalogSha256Entry> sha256;
+        size_t parsed = 0;
+        size_t rejected = 0;
+    };
+    unsigned workerCount = (std::max)(1u, (std::min)(8u, std::thread::hardware_concurrency()));
+    std::vector<Partial> partials(workerCount);
+    std::atomic<size_t> next{ 0 };
+    std::vector<std::thread> workers;
+    for (unsigned w = 0; w < workerCount; w++) {
+        workers.emplace_back([&files, &next, &partial = partials[w]]() {
+            std::vector<std::string> hashes;
+            for (size_t i = next++; i < files.size(); i = next++) {
+                MappedFile catalog;
+                hashes.clear();
+                if (!catalog.Open(files[i].path) || !ParseCatalog(catalog.Data(), catalog.Size(), hashes)) {
+                    partial.rejected++;
+                    continue;
+                }
+                partial.parsed++;
+                for (const auto& hash : hashes) {
+                    if (hash.size() == Sha1::DigestSize) {
+                        CatalogSha1Entry entry;
+                        memcpy(entry.hash, hash.data(), sizeof(entry.hash));
+                        entry.catalog = (uint32_t)i;
+                        partial.sha1.push_back(entry);
+                    }
+                    else {
+                        CatalogSha256Entry entry;
+                        memcpy(entry.hash, hash.data(), sizeof(entry.hash));
+                        entry.catalog = (uint32_t)i;
+                        partial.sha256.push_back(entry);
+                    }
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    std::vector<CatalogSha1Entry> sha1;
+    std::vector<CatalogSha256Entry> sha256;
+    catalogsParsed = 0;
+    catalogsRejected = 0;
+    for (auto& partial : partials) {
+        sha1.insert(sha1.end(), partial.sha1.begin(), partial.sha1.end());
+        sha256.insert(sha256.end(), partial.sha256.begin(), partial.sha256.end());
+        catalogsParsed += partial.parsed;
+        catalogsRejected += partial.rejected;
+    }
+    std::sort(sha1.begin(), sha1.end(), EntryLess<CatalogSha1Entry>);
+    sha1.erase(std::unique(sha1.begin(), sha1.end(), EntryEqual<CatalogSha1Entry>), sha1.end());
+    std::sort(sha256.begin(), sha256.end(), EntryLess<CatalogSha256Entry>);
+    sha256.erase(std::unique(sha256.begin(), sha256.end(), EntryEqual<CatalogSha256Entry>), sha256.end());
+
+    std::string names;
+    std::vector<CatalogNameRef> refs;
+    refs.reserve(files.size());
+    for (const auto& file : files) {
+        if (names.size() + file.name.size() > (std::numeric_limits<uint32_t>::max)()) {
+            return false;
+        }
+        refs.push_back({ (uint32_t)names.size(), (uint32_t)file.name.size() });
+        names += file.name;
+    }
+
+    CatalogIndexHeader header = {};
+    memcpy(header.magic, CatalogIndexFormat::Magic, sizeof(header.magic));
+    header.version = CatalogIndexFormat::Version;
+    header.catalogCount = (uint32_t)files.size();
+    header.fingerprint = fingerprint;
+    header.sha1Count = sha1.size();
+    header.sha256Count = sha256.size();
+    header.heapSize = names.size();
+
+    out.clear();
+    Append(out, &header, 1);
+    Append(out, refs.data(), refs.size());
+    Append(out, sha1.data(), sha1.size());
+    Append(out, sha256.data(), sha256.size());
+    Append(out, names.data(), names.size());
+    return true;
+}
+
+// every lookup and name access is bounds checked here once
+bool CatalogIndex::Attach(const uint8_t* data, size_t size, uint64_t fingerprint) {
+    if (size < sizeof(CatalogIndexHeader)) {
+        return false;
+    }
+    CatalogIndexHeader header;
+    memcpy(&header, data, sizeof(header));
+    if (memcmp(header.magic, CatalogIndexFormat::Magic, sizeof(header.magic)) != 0 || header.version != CatalogIndexFormat::Version ||
+        header.fingerprint != fingerprint) {
+        return false;
+    }
+
+    // counts are bounded by the size before they are multiplied, so nothing below can overflow
+    uint64_t remaining = size - sizeof(CatalogIndexHeader);
+    if (header.catalogCount > remaining / sizeof(CatalogNameRef)) return false;
+    remaining -= (uint64_t)header.catalogCount * sizeof(CatalogNameRef);
+    if (header.sha1Count > remaining / sizeof(CatalogSha1Entry)) return false;
+    remaining -= header.sha1Count * sizeof(CatalogSha1Entry);
+    if (header.sha256Count > remaining / sizeof(CatalogSha256Entry)) return false;
+    remaining -= header.sha256Count * sizeof(CatalogSha256Entry);
+    if (header.heapSize != remaining) return false;
+    if (header.sha1Count > (std::numeric_limits<uint32_t>::max)() || header.sha256Count > (std::numeric_limits<uint32_t>::max)()) return false;
+
+    const uint8_t* cursor = data + sizeof(CatalogIndexHeader);
+    names = reinterpret_cast<const CatalogNameRef*>(cursor);
+    cursor += (size_t)header.catalogCount * sizeof(CatalogNameRef);
+    sha1Entries = reinterpret_cast<const CatalogSha1Entry*>(cursor);
+    cursor += (size_t)header.sha1Count * sizeof(CatalogSha1Entry);
+    sha256Entries = reinterpret_cast<const CatalogSha256Entry*>(cursor);
+    cursor += (size_t)header.sha256Count * sizeof(CatalogSha256Entry);
+    heap = reinterpret_cast<const char*>(cursor);
+    heapSize = header.heapSize;
+
+    for (uint32_t i = 0; i < header.catalogCount; i++) {
+        if ((uint64_t)names[i].offset + names[i].length > heapSize) return false;
+    }
+    for (uint64_t i = 0; i < header.sha1Count; i++) {
+        if (sha1Entries[i].catalog >= header.catalogCount) return false;
+    }
+    for (uint64_t i = 0; i < header.sha256Count; i++) {
+        if (sha256Entries[i].catalog >= header.catalogCount) return false;
+    }
+
+    catalogCount = header.catalogCount;
+    sha1Count = (size_t)header.sha1Count;
+    sha256Count = (size_t)header.sha256Count;
+    BuildBuckets();
+    return true;
+}
+
+void CatalogIndex::BuildBuckets() {
+    BuildBucketTable(sha1Entries, sha1Count, sha1Buckets);
+    BuildBucketTable(sha256Entries, sha256Count, sha256Buckets);
+}
+
+bool CatalogIndex::Open(const std::filesystem::path& catroot, const std::filesystem::path& indexPath) {
+    auto start = std::chrono::steady_clock::now();
+    Close();
+
+    std::vector<CatalogFile> files;
+    uint64_t fingerprint = 0;
+    if (!ListCatalogs(catroot, files, fingerprint)) {
+        return false;
+    }
+
+    if (!indexPath.empty() && file.Open(indexPath) && Attach(file.Data(), file.Size(), fingerprint)) {
+        loadedFromDisk = true;
+    }
+    else {
+        file.Close();
+        if (!Build(files, fingerprint, memory) || !Attach(memory.data(), memory.size(), fingerprint)) {
+            Close();
+            return false;
+        }
+
+        // written next to the target and renamed over it, a crash never leaves half an index
+        if (!indexPath.empty()) {
+            std::filesystem::path temp = indexPath;
+            temp += ".tmp";
+#ifdef _WIN32
+            std::FILE* out = _wfopen(temp.c_str(), L"wb");
+#else
+            std::FILE* out = std::fopen(temp.c_str(), "wb");
+#endif
+            bool written = out && std::fwrite(memory.data(), 1, memory.size(), out) == memory.size();
+            written = out && std::fclose(out) == 0 && written;
+            std::error_code error;
+            if (written) {
+                std::filesystem::rename(temp, indexPath, error);
+            }
+            if (!written || error) {
+                std::filesystem::remove(temp, error);
+            }
+        }
+    }
+
+    root = catroot;
+    trust.reset(new std::atomic<uint8_t>[catalogCount ? catalogCount : 1]);
+    ResetTrust();
+    opened = true;
+    openMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return true;
+}
+
+void CatalogIndex::Close() {
+    file.Close();
+    memory.clear();
+    memory.shrink_to_fit();
+    root.clear();
+    opened = false;
+    loadedFromDisk = false;
+    catalogCount = 0;
+    names = nullptr;
+    sha1Entries = nullptr;
+    sha256Entries = nullptr;
+    sha1Count = 0;
+    sha256Count = 0;
+    heap = nullptr;
+    heapSize = 0;
+    sha1Buckets.clear();
+    sha256Buckets.clear();
+    trust.reset();
+}
+
+size_t CatalogIndex::Find(const std::string& hash, std::vector<uint32_t>& catalogs) const {
+    if (!opened) {
+        return 0;
+    }
+    lookups++;
+    size_t found = 0;
+    if (hash.size() == Sha1::DigestSize) {
+        found = FindEntries(sha1Entries, sha1Buckets, hash, catalogs);
+    }
+    else if (hash.size() == Sha256::DigestSize) {
+        found = FindEntries(sha256Entries, sha256Buckets, hash, catalogs);
+    }
+    if (found) {
+        lookupHits++;
+    }
+    return found;
+}
+
+std::filesystem::path CatalogIndex::CatalogPath(uint32_t catalog) const {
+    if (catalog >= catalogCount) {
+        return std::filesystem::path();
+    }
+    return root / Utf8ToPath(std::string_view(heap + names[catalog].offset, names[catalog].length));
+}
+
+CatalogIndex::Trust CatalogIndex::CatalogTrust(uint32_t catalog) const {
+    if (catalog >= catalogCount) {
+        return Trust::Unknown;
+    }
+    return (Trust)trust[catalog].load();
+}
+
+void CatalogIndex::SetCatalogTrust(uint32_t catalog, Trust value) {
+    if (catalog < catalogCount) {
+        trust[catalog] = (uint8_t)value;
+        trustChecks++;
+    }
+}
+
+void CatalogIndex::ResetTrust() {
+    for (uint32_t i = 0; i < catalogCount; i++) {
+        trust[i] = (uint8_t)Trust::Unknown;
+    }
+}
+
+void CatalogIndex::ResetStats() {
+    lookups = 0;
+    lookupHits = 0;
+    trustChecks = 0;
+}
+
+void CatalogIndex::ReportStats() {
+    if (!opened) {
+        std::cout << "Catalog index: not available" << std::endl;
+        return;
+    }
+    std::cout << "Catalog index: " << catalogCount << " catalogs, " << sha1Count << " sha-1 / " << sha256Count << " sha-256 members, ";
+    if (loadedFromDisk) {
+        std::cout << "loaded";
+    }
+    else {
+        std::cout << "built (" << catalogsParsed << " parsed, " << catalogsRejected << " rejected)";
+    }
+    std::cout << " in " << std::fixed << std::setprecision(2) << openMilliseconds << " ms, " << lookups.load() << " lookups, "
+        << lookupHits.load() << " hits, " << trustChecks.load() << " catalog trust checks" << std::endl;
+}
@@ -0,0 +1,150 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+#include "AuthenticodeEngine.h"
+#include "../util/Digest.h"
+#include "../util/MappedFile.h"
+
+// member hash -> catalog map over a catroot directory (the live one or one copied off another machine)
+// the .cat files (pkcs#7 signed CTLs) are parsed once and the result is kept in an index file next to the analysis cache,
+// it is rebuilt when a catalog is added, removed or rewritten. no windows headers so it also builds on linux
+//
+// index file: CatalogIndexHeader, catalog name refs, sha-1 entries, sha-256 entries (both sorted), then the name heap
+
+namespace CatalogIndexFormat {
+    constexpr char Magic[8] = { 'B', 'A', 'M', 'C', 'A', 'T', 'I', 'X' };
+    constexpr uint32_t Version = 2;   // 2: catalogs without a signer are no longer indexed
+}
+
+struct CatalogIndexHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t catalogCount;
+    uint64_t fingerprint;    // names, sizes and write times of every .cat under the catroot
+    uint64_t sha1Count;
+    uint64_t sha256Count;
+    uint64_t heapSize;
+};
+
+struct CatalogNameRef {
+    uint32_t offset;
+    uint32_t length;
+};
+
+struct CatalogSha1Entry {
+    uint8_t hash[20];
+    uint32_t catalog;
+};
+
+struct CatalogSha256Entry {
+    uint8_t hash[32];
+    uint32_t catalog;
+};
+
+static_assert(sizeof(CatalogIndexHeader) == 48, "catalog index header layout");
+static_assert(sizeof(CatalogSha1Entry) == 24, "catalog sha-1 entry layout");
+static_assert(sizeof(CatalogSha256Entry) == 36, "catalog sha-256 entry layout");
+
+// hashes a file the way CryptCATAdminCalcHashFromFileHandle does: the authenticode digest for pe images,
+// the plain digest for everything else. sha-1 and sha-256 in the same pass, fed in order chunk by chunk
+class CatalogMemberHasher {
+public:
+    explicit CatalogMemberHasher(uint64_t fileSize) : fileSize(fileSize) {}
+    // the first chunk has to contain the pe headers, FileView chunks always do
+    void Update(const uint8_t* chunk, size_t length);
+    void Final(std::string& sha1Out, std::string& sha256Out);
+
+private:
+    void Hash(const uint8_t* data, size_t length);
+
+    uint64_t fileSize;
+    uint64_t position = 0;
+    bool started = false;
+    std::vector<ImageHole> holes;
+    Sha1 sha1;
+    Sha256 sha256;
+};
+
+class CatalogIndex {
+public:
+    enum class Trust : uint8_t {
+        Unknown,
+        Trusted,
+        Untrusted,
+    };
+
+    static CatalogIndex& Instance();
+
+    // loads indexPath when it still matches the catroot, otherwise parses every catalog and rewrites it
+    // an empty indexPath builds in memory only
+    bool Open(const std::filesystem::path& catroot, const std::filesystem::path& indexPath);
+    void Close();
+    bool IsOpen() const { return opened; }
+    const std::filesystem::path& Catroot() const { return root; }
+
+    // catalogs listing the hash (20 or 32 bytes), usually one; lock free, the index is immutable once open
+    size_t Find(const std::string& hash, std::vector<uint32_t>& catalogs) const;
+    std::filesystem::path CatalogPath(uint32_t catalog) const;
+    size_t CatalogCount() const { return catalogCount; }
+
+    // one trust check per catalog and scan instead of one per member file, filled in by the caller
+    Trust CatalogTrust(uint32_t catalog) const;
+    void SetCatalogTrust(uint32_t catalog, Trust trust);
+    void ResetTrust();
+
+    // member hashes of a single .cat, exposed for the index build and for debugging a catalog
+    // false for anything but a pkcs#7 signed CTL with at least one signer; the signature itself isn't verified here
+    static bool ParseCatalog(const uint8_t* data, size_t size, std::vector<std::string>& hashes);
+
+    void ResetStats();
+    void ReportStats();
+
+private:
+    CatalogIndex() = default;
+    CatalogIndex(const CatalogIndex&) = delete;
+    CatalogIndex& operator=(const CatalogIndex&) = delete;
+
+    struct CatalogFile {
+        std::filesystem::path path;
+        std::string name;     // utf-8, relative to the catroot
+        uint64_t size;
+        int64_t lastWrite;
+    };
+
+    static bool ListCatalogs(const std::filesystem::path& catroot, std::vector<CatalogFile>& files, uint64_t& fingerprint);
+    bool Build(const std::vector<CatalogFile>& files, uint64_t fingerprint, std::vector<uint8_t>& out);
+    bool Attach(const uint8_t* data, size_t size, uint64_t fingerprint);
+    void BuildBuckets();
+
+    std::filesystem::path root;
+    MappedFile file;
+    std::vector<uint8_t> memory;  // the index bytes when they aren't mapped from disk
+    bool opened = false;
+
+    uint32_t catalogCount = 0;
+    const CatalogNameRef* names = nullptr;
+    const CatalogSha1Entry* sha1Entries = nullptr;
+    const CatalogSha256Entry* sha256Entries = nullptr;
+    size_t sha1Count = 0;
+    size_t sha256Count = 0;
+    const char* heap = nullptr;
+    uint64_t heapSize = 0;
+
+    // first two hash bytes -> first entry, makes a lookup one bucket scan instead of a binary search over everything
+    std::vector<uint32_t> sha1Buckets;
+    std::vector<uint32_t> sha256Buckets;
+    std::unique_ptr<std::atomic<uint8_t>[]> trust;
+
+    bool loadedFromDisk = false;
+    size_t catalogsParsed = 0;
+    size_t catalogsRejected = 0;
+    double openMilliseconds = 0.0;
+    mutable std::atomic<long long> lookups{ 0 };
+    mutable std::atomic<long long> lookupHits{ 0 };
+    std::atomic<long long> trustChecks{ 0 };
+};
@@ -0,0 +1,293 @@
+#include "ScanSnapshot.h"
+#include "../util/Digest.h"
+#include "../util/Utf8.h"
+#include <cstdio>
+#include <cstring>
+#include <limits>
+
+SnapshotString SnapshotWriter::Intern(const std::string& text) {
+    auto it = interned.find(text);
+    if (it != interned.end()) {
+        return it->second;
+    }
+    if (heap.size() + text.size() > (std::numeric_limits<uint32_t>::max)()) {
+        overflow = true;
+        return SnapshotString{ 0, 0 };
+    }
+    SnapshotString ref{ (uint32_t)heap.size(), (uint32_t)text.size() };
+    heap += text;
+    interned.emplace(text, ref);
+    return ref;
+}
+
+void SnapshotWriter::Add(const ExportRecord& record, const std::wstring& host) {
+    static const std::wstring empty;
+
+    executionTimes.push_back(record.executionFileTime);
+
+    std::string signature = WideToUtf8(record.signatureStatus ? *record.signatureStatus : empty);
+    auto sig = signatureIndex.find(signature);
+    if (sig == signatureIndex.end()) {
+        if (signatureNames.size() > (std::numeric_limits<uint16_t>::max)()) {
+            overflow = true;
+        }
+        sig = signatureIndex.emplace(signature, (uint16_t)signatureNames.size()).first;
+        signatureNames.push_back(Intern(signature));
+    }
+    signatures.push_back(sig->second);
+
+    uint8_t rowFlags = 0;
+    if (record.isInCurrentInstance) rowFlags |= Snapshot::FlagInstance;
+    if (record.isInInteractiveSession) rowFlags |= Snapshot::FlagInteractiveSession;
+    flags.push_back(rowFlags);
+
+    paths.push_back(Intern(WideToUtf8(record.path ? *record.path : empty)));
+    localTimes.push_back(Intern(WideToUtf8(record.executionTime ? *record.executionTime : empty)));
+    hosts.push_back(Intern(WideToUtf8(host)));
+    sidRefs.push_back(Intern(WideToUtf8(record.sid ? *record.sid : empty)));
+
+    // a digest that isn't there (or isn't valid hex) stays zero
+    SnapshotHashes rowHashes = {};
+    if (record.md5 && !HexToDigest(*record.md5, rowHashes.md5, sizeof(rowHashes.md5))) memset(rowHashes.md5, 0, sizeof(rowHashes.md5));
+    if (record.sha1 && !HexToDigest(*record.sha1, rowHashes.sha1, sizeof(rowHashes.sha1))) memset(rowHashes.sha1, 0, sizeof(rowHashes.sha1));
+    if (record.sha256 && !HexToDigest(*record.sha256, rowHashes.sha256, sizeof(rowHashes.sha256))) memset(rowHashes.sha256, 0, sizeof(rowHashes.sha256));
+    hashes.push_back(rowHashes);
+
+    SnapshotRange rules{ (uint32_t)rowRules.size(), 0 };
+    if (record.matchedRules) {
+        for (const auto& name : *record.matchedRules) {
+            auto rule = ruleIndex.find(name);
+            if (rule == ruleIndex.end()) {
+                rule = ruleIndex.emplace(name, (uint32_t)ruleNames.size()).first;
+                ruleNames.push_back(Intern(name));
+            }
+            rowRules.push_back(rule->second);
+            rules.count++;
+        }
+    }
+    rowRuleRanges.push_back(rules);
+
+    SnapshotRange range{ (uint32_t)replaces.size(), 0 };
+    if (record.replaceResults) {
+        for (const auto& replace : *record.replaceResults) {
+            replaces.push_back({ Intern(replace.replaceType), Intern(replace.filename), Intern(replace.details) });
+            range.count++;
+        }
+    }
+    replaceRanges.push_back(range);
+}
+
+template <typename T>
+static void AppendSection(std::vector<uint8_t>& out, SnapshotSection& section, const T* items, size_t count) {
+    while (out.size() % 8) {
+        out.push_back(0);
+    }
+    section.offset = out.size();
+    section.size = count * sizeof(T);
+    if (count) {
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(items);
+        out.insert(out.end(), bytes, bytes + section.size);
+    }
+}
+
+bool SnapshotWriter::Serialize(std::vector<uint8_t>& out) const {
+    if (overflow || replaces.size() > (std::numeric_limits<uint32_t>::max)()) {
+        return false;
+    }
+
+    size_t rowCount = executionTimes.size();
+    size_t ruleWords = (ruleNames.size() + 63) / 64;
+    std::vector<uint64_t> bits(rowCount * ruleWords, 0);
+    for (size_t row = 0; row < rowCount; row++) {
+        const SnapshotRange& range = rowRuleRanges[row];
+        for (uint32_t i = 0; i < range.count; i++) {
+            uint32_t rule = rowRules[range.first + i];
+            bits[row * ruleWords + rule / 64] |= 1ull << (rule % 64);
+        }
+    }
+
+    SnapshotHeader header = {};
+    memcpy(header.magic, Snapshot::Magic, sizeof(header.magic));
+    header.version = Snapshot::Version;
+    header.sectionCount = Snapshot::SectionCount;
+    header.rowCount = rowCount;
+    header.ruleWords = (uint32_t)ruleWords;
+
+    SnapshotSection sections[Snapshot::SectionCount] = {};
+    out.clear();
+    out.resize(sizeof(header) + sizeof(sections));
+
+    AppendSection(out, sections[Snapshot::ExecutionTime], executionTimes.data(), executionTimes.size());
+    AppendSection(out, sections[Snapshot::Signature], signatures.data(), signatures.size());
+    AppendSection(out, sections[Snapshot::Flags], flags.data(), flags.size());
+    AppendSection(out, sections[Snapshot::RuleBits], bits.data(), bits.size());
+    AppendSection(out, sections[Snapshot::Path], paths.data(), paths.size());
+    AppendSection(out, sections[Snapshot::LocalTime], localTimes.data(), localTimes.size());
+    AppendSection(out, sections[Snapshot::Host], hosts.data(), hosts.size());
+    AppendSection(out, sections[Snapshot::ReplaceRange], replaceRanges.data(), replaceRanges.size());
+    AppendSection(out, sections[Snapshot::Replaces], replaces.data(), replaces.size());
+    AppendSection(out, sections[Snapshot::SignatureNames], signatureNames.data(), signatureNames.size());
+    AppendSection(out, sections[Snapshot::RuleNames], ruleNames.data(), ruleNames.size());
+    AppendSection(out, sections[Snapshot::Heap], heap.data(), heap.size());
+    AppendSection(out, sections[Snapshot::Sid], sidRefs.data(), sidRefs.size());
+    AppendSection(out, sections[Snapshot::Hashes], hashes.data(), hashes.size());
+
+    memcpy(out.data(), &header, sizeof(header));
+    memcpy(out.data() + sizeof(header), sections, sizeof(sections));
+    return true;
+}
+
+bool SnapshotWriter::Save(const std::filesystem::path& path) const {
+    std::vector<uint8_t> bytes;
+    if (!Serialize(bytes)) {
+        return false;
+    }
+
+    // written next to the target and renamed over it, a crash never leaves half a snapshot
+    std::filesystem::path temp = path;
+    temp += ".tmp";
+#ifdef _WIN32
+    std::FILE* out = _wfopen(temp.c_str(), L"wb");
+#else
+    std::FILE* out = std::fopen(temp.c_str(), "wb");
+#endif
+    if (!out) {
+        return false;
+    }
+    bool written = std::fwrite(bytes.data(), 1, bytes.size(), out) == bytes.size();
+    written = std::fclose(out) == 0 && written;
+    if (!written) {
+        std::filesystem::remove(temp);
+        return false;
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temp, path, error);
+    if (error) {
+        std::filesystem::remove(temp);
+        return false;
+    }
+    return true;
+}
+
+bool ScanSnapshot::Open(const std::filesystem::path& path) {
+    if (!file.Open(path)) {
+        return false;
+    }
+    if (!OpenBuffer(file.Data(), file.Size())) {
+        file.Close();
+        return false;
+    }
+    return true;
+}
+
+template <typename T>
+bool ScanSnapshot::Column(const SnapshotSection* sections, uint32_t index, const T*& column, uint64_t& count) const {
+    const SnapshotSection& section = sections[index];
+    if (section.offset > size || section.size > size - section.offset || section.size % sizeof(T)) {
+        return false;
+    }
+    if (section.offset % alignof(T)) {
+        return false;
+    }
+    column = reinterpret_cast<const T*>(data + section.offset);
+    count = section.size / sizeof(T);
+    return true;
+}
+
+// everything a row accessor can touch is bounds checked here once, the accessors themselves don't check
+bool ScanSnapshot::OpenBuffer(const uint8_t* buffer, size_t length) {
+    data = buffer;
+    size = length;
+    rowCount = 0;
+
+    if (size < sizeof(SnapshotHeader)) {
+        return false;
+    }
+    SnapshotHeader header;
+    memcpy(&header, data, sizeof(header));
+    if (memcmp(header.magic, Snapshot::Magic, sizeof(header.magic)) != 0 || header.version != Snapshot::Version) {
+        return false;
+    }
+    if (header.sectionCount < Snapshot::RequiredSections ||
+        header.sectionCount > (size - sizeof(SnapshotHeader)) / sizeof(SnapshotSection)) {
+        return false;
+    }
+    const SnapshotSection* sections = reinterpret_cast<const SnapshotSection*>(data + sizeof(SnapshotHeader));
+
+    uint64_t rows = header.rowCount;
+    if (header.ruleWords && rows > (std::numeric_limits<uint64_t>::max)() / header.ruleWords) {
+        return false;
+    }
+    uint64_t count = 0;
+    uint64_t replaceTotal = 0, signatureCount = 0;
+    if (!Column(sections, Snapshot::ExecutionTime, executionTimes, count) || count != rows) return false;
+    if (!Column(sections, Snapshot::Signature, signatures, count) || count != rows) return false;
+    if (!Column(sections, Snapshot::Flags, flags, count) || count != rows) return false;
+    if (!Column(sections, Snapshot::RuleBits, ruleBits, count) || count != rows * header.ruleWords) return false;
+    if (!Column(sections, Snapshot::Path, paths, count) || count != rows) return false;
+    if (!Column(sections, Snapshot::LocalTime, localTimes, count) || count != rows) return false;
+    if (!Column(sections, Snapshot::Host, hosts, count) || count != rows) return false;
+    if (!Column(sections, Snapshot::ReplaceRange, replaceRanges, count) || count != rows) return false;
+    if (!Column(sections, Snapshot::Replaces, replaces, replaceTotal)) return false;
+    if (!Column(sections, Snapshot::SignatureNames, signatureNames, signatureCount)) return false;
+
+    uint64_t rules = 0;
+    if (!Column(sections, Snapshot::RuleNames, ruleNames, rules) || rules > (uint64_t)header.ruleWords * 64) return false;
+    const uint8_t* heapBytes = nullptr;
+    if (!Column(sections, Snapshot::Heap, heapBytes, heapSize)) return false;
+    heap = reinterpret_cast<const char*>(heapBytes);
+
+    // snapshots written before the sid column existed simply don't have it
+    sids = nullptr;
+    if (header.sectionCount > Snapshot::Sid) {
+        if (!Column(sections, Snapshot::Sid, sids, count) || count != rows) return false;
+    }
+    hashes = nullptr;
+    if (header.sectionCount > Snapshot::Hashes) {
+        if (!Column(sections, Snapshot::Hashes, hashes, count) || count != rows) return false;
+    }
+
+    for (uint64_t i = 0; i < signatureCount; i++) {
+        if (!ValidString(signatureNames[i])) return false;
+    }
+    for (uint64_t i = 0; i < rules; i++) {
+        if (!ValidString(ruleNames[i])) return false;
+    }
+    for (uint64_t i = 0; i < replaceTotal; i++) {
+        if (!ValidString(replaces[i].type) || !ValidString(replaces[i].filename) || !ValidString(replaces[i].details)) return false;
+    }
+    for (uint64_t row = 0; row < rows; row++) {
+        if (signatures[row] >= signatureCount) return false;
+        if (!ValidString(paths[row]) || !ValidString(localTimes[row]) || !ValidString(hosts[row])) return false;
+        if (sids && !ValidString(sids[row])) return false;
+        if ((uint64_t)replaceRanges[row].first + replaceRanges[row].count > replaceTotal) return false;
+    }
+
+    rowCount = (size_t)rows;
+    ruleWords = header.ruleWords;
+    ruleCount = (size_t)rules;
+    return true;
+}
+
+bool ScanSnapshot::HasAnyRule(size_t row) const {
+    for (size_t w = 0; w < ruleWords; w++) {
+        if (ruleBits[row * ruleWords + w]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+const SnapshotHashes* ScanSnapshot::Hashes(size_t row) const {
+    if (!hashes) {
+        return nullptr;
+    }
+    static const SnapshotHashes none = {};
+    return memcmp(&hashes[row], &none, sizeof(none)) != 0 ? &hashes[row] : nullptr;
+}
+
+SnapshotReplaceView ScanSnapshot::Replace(size_t row, size_t index) const {
+    const SnapshotReplace& replace = replaces[replaceRanges[row].first + index];
+    return { String(replace.type), String(replace.filename), String(replace.details) };
+}
@@ -0,0 +1,183 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "../export/ResultExporter.h"
+#include "../util/MappedFile.h"
+
+// columnar scan snapshot, read straight out of a mapping without deserializing anything
+// little endian, no windows headers so it also builds on linux
+//
+// layout: SnapshotHeader, SnapshotSection[sectionCount], then the sections (8 byte aligned)
+// strings are SnapshotString refs into one utf-8 heap; identical strings are stored once
+
+namespace Snapshot {
+    constexpr char Magic[8] = { 'B', 'A', 'M', 'S', 'N', 'A', 'P', '\0' };
+    constexpr uint32_t Version = 1;
+
+    constexpr uint8_t FlagInstance = 0x01;
+    constexpr uint8_t FlagInteractiveSession = 0x02;
+
+    // newer writers may append sections, readers ignore the ones they don't know
+    enum Section : uint32_t {
+        ExecutionTime,   // uint64_t FILETIME per row
+        Signature,       // uint16_t index into SignatureNames per row
+        Flags,           // uint8_t Flag* bits per row
+        RuleBits,        // uint64_t[ruleWords] per row, bit n = RuleNames[n] matched
+        Path,            // SnapshotString per row
+        LocalTime,       // SnapshotString per row
+        Host,            // SnapshotString per row
+        ReplaceRange,    // SnapshotRange per row into Replaces
+        Replaces,        // SnapshotReplace
+        SignatureNames,  // SnapshotString
+        RuleNames,       // SnapshotString
+        Heap,            // utf-8 bytes
+        RequiredSections,
+        Sid = RequiredSections, // SnapshotString per row, optional
+        Hashes,          // SnapshotHashes per row, optional, all zero = not hashed
+        SectionCount
+    };
+}
+
+struct SnapshotHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t sectionCount;
+    uint64_t rowCount;
+    uint32_t ruleWords;
+    uint32_t reserved;
+};
+
+struct SnapshotSection {
+    uint64_t offset;
+    uint64_t size;
+};
+
+struct SnapshotString {
+    uint32_t offset;
+    uint32_t length;
+};
+
+struct SnapshotRange {
+    uint32_t first;
+    uint32_t count;
+};
+
+struct SnapshotReplace {
+    SnapshotString type;
+    SnapshotString filename;
+    SnapshotString details;
+};
+
+struct SnapshotHashes {
+    uint8_t md5[16];
+    uint8_t sha1[20];
+    uint8_t sha256[32];
+};
+
+static_assert(sizeof(SnapshotHeader) == 32, "snapshot header layout");
+static_assert(sizeof(SnapshotSection) == 16, "snapshot section layout");
+static_assert(sizeof(SnapshotReplace) == 24, "snapshot replace layout");
+static_assert(sizeof(SnapshotHashes) == 68, "snapshot hashes layout");
+
+struct SnapshotReplaceView {
+    std::string_view type;
+    std::string_view filename;
+    std::string_view details;
+};
+
+class SnapshotWriter {
+public:
+    // host tags the row so snapshots from several machines can be merged
+    void Add(const ExportRecord& record, const std::wstring& host);
+    size_t RowCount() const { return executionTimes.size(); }
+
+    bool Serialize(std::vector<uint8_t>& out) const;
+    bool Save(const std::filesystem::path& path) const;
+
+private:
+    SnapshotString Intern(const std::string& text);
+
+    std::unordered_map<std::string, SnapshotString> interned;
+    std::string heap;
+    std::unordered_map<std::string, uint16_t> signatureIndex;
+    std::vector<SnapshotString> signatureNames;
+    std::unordered_map<std::string, uint32_t> ruleIndex;
+    std::vector<SnapshotString> ruleNames;
+
+    std::vector<uint64_t> executionTimes;
+    std::vector<uint16_t> signatures;
+    std::vector<uint8_t> flags;
+    std::vector<SnapshotString> paths;
+    std::vector<SnapshotString> localTimes;
+    std::vector<SnapshotString> hosts;
+    std::vector<SnapshotString> sidRefs;
+    std::vector<SnapshotHashes> hashes;
+    std::vector<SnapshotRange> replaceRanges;
+    std::vector<SnapshotReplace> replaces;
+    // rule indices per row, flattened; the bitsets are sized once every name is known
+    std::vector<uint32_t> rowRules;
+    std::vector<SnapshotRange> rowRuleRanges;
+    bool overflow = false;
+};
+
+class ScanSnapshot {
+public:
+    bool Open(const std::filesystem::path& path);
+    // the buffer has to outlive the snapshot
+    bool OpenBuffer(const uint8_t* data, size_t size);
+
+    size_t RowCount() const { return rowCount; }
+    uint64_t ExecutionFileTime(size_t row) const { return executionTimes[row]; }
+    std::string_view Signature(size_t row) const { return String(signatureNames[signatures[row]]); }
+    bool InCurrentInstance(size_t row) const { return (flags[row] & Snapshot::FlagInstance) != 0; }
+    bool InInteractiveSession(size_t row) const { return (flags[row] & Snapshot::FlagInteractiveSession) != 0; }
+    std::string_view Path(size_t row) const { return String(paths[row]); }
+    std::string_view LocalTime(size_t row) const { return String(localTimes[row]); }
+    std::string_view Host(size_t row) const { return String(hosts[row]); }
+    std::string_view Sid(size_t row) const { return sids ? String(sids[row]) : std::string_view(); }
+    // nullptr when the row wasn't hashed or the snapshot predates the hashes column
+    const SnapshotHashes* Hashes(size_t row) const;
+
+    size_t RuleCount() const { return ruleCount; }
+    std::string_view RuleName(size_t rule) const { return String(ruleNames[rule]); }
+    bool HasRule(size_t row, size_t rule) const { return (ruleBits[row * ruleWords + rule / 64] >> (rule % 64)) & 1; }
+    bool HasAnyRule(size_t row) const;
+
+    size_t ReplaceCount(size_t row) const { return replaceRanges[row].count; }
+    SnapshotReplaceView Replace(size_t row, size_t index) const;
+
+private:
+    std::string_view String(SnapshotString ref) const { return std::string_view(heap + ref.offset, ref.length); }
+    bool ValidString(SnapshotString ref) const { return (uint64_t)ref.offset + ref.length <= heapSize; }
+
+    template <typename T>
+    bool Column(const SnapshotSection* sections, uint32_t index, const T*& column, uint64_t& count) const;
+
+    MappedFile file;
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+
+    size_t rowCount = 0;
+    size_t ruleWords = 0;
+    size_t ruleCount = 0;
+    const uint64_t* executionTimes = nullptr;
+    const uint16_t* signatures = nullptr;
+    const uint8_t* flags = nullptr;
+    const uint64_t* ruleBits = nullptr;
+    const SnapshotString* paths = nullptr;
+    const SnapshotString* localTimes = nullptr;
+    const SnapshotString* hosts = nullptr;
+    const SnapshotString* sids = nullptr;
+    const SnapshotHashes* hashes = nullptr;
+    const SnapshotRange* replaceRanges = nullptr;
+    const SnapshotReplace* replaces = nullptr;
+    const SnapshotString* signatureNames = nullptr;
+    const SnapshotString* ruleNames = nullptr;
+    const char* heap = nullptr;
+    uint64_t heapSize = 0;
+};
@@ -0,0 +1,91 @@
+#include "SnapshotEntries.h"
+#include "../export/EntryExport.h"
+#include "../util/Digest.h"
+#include "../util/Utf8.h"
+#include <unordered_map>
+
+// straight into the row's string, one allocation and no intermediate copy
+static void SnapshotDigest(const uint8_t* digest, size_t size, std::string& out) {
+    static const char digits[] = "0123456789abcdef";
+    for (size_t i = 0; i < size; i++) {
+        if (digest[i]) {
+            out.resize(size * 2);
+            for (size_t j = 0; j < size; j++) {
+                out[2 * j] = digits[digest[j] >> 4];
+                out[2 * j + 1] = digits[digest[j] & 15];
+            }
+            return;
+        }
+    }
+}
+
+std::wstring LocalHostName() {
+    wchar_t computerName[MAX_COMPUTERNAME_LENGTH + 1] = L"";
+    DWORD nameLength = MAX_COMPUTERNAME_LENGTH + 1;
+    GetComputerNameW(computerName, &nameLength);
+    return computerName;
+}
+
+bool SaveSnapshot(const std::wstring& path, const std::vector<BAMEntry>& entries) {
+    std::wstring localHost = LocalHostName();
+
+    SnapshotWriter writer;
+    for (const auto& entry : entries) {
+        writer.Add(MakeExportRecord(entry), entry.host.empty() ? localHost : entry.host);
+    }
+    return writer.Save(std::filesystem::path(path));
+}
+
+bool LoadSnapshot(const std::wstring& path, std::vector<BAMEntry>& entries) {
+    ScanSnapshot snapshot;
+    if (!snapshot.Open(std::filesystem::path(path))) {
+        return false;
+    }
+
+    // sids, hosts and signatures repeat on nearly every row of a (merged) snapshot, each distinct one is decoded once
+    std::unordered_map<std::string_view, std::wstring> decoded;
+    auto wide = [&decoded](std::string_view text) -> const std::wstring& {
+        auto it = decoded.find(text);
+        if (it == decoded.end()) {
+            it = decoded.emplace(text, Utf8ToWide(text)).first;
+        }
+        return it->second;
+    };
+    std::vector<std::string> ruleNames;
+    ruleNames.reserve(snapshot.RuleCount());
+    for (size_t rule = 0; rule < snapshot.RuleCount(); rule++) {
+        ruleNames.emplace_back(snapshot.RuleName(rule));
+    }
+
+    entries.reserve(entries.size() + snapshot.RowCount());
+    for (size_t row = 0; row < snapshot.RowCount(); row++) {
+        BAMEntry& entry = entries.emplace_back();
+        entry.path = Utf8ToWide(snapshot.Path(row));
+        entry.sid = wide(snapshot.Sid(row));
+        entry.executionFileTime = snapshot.ExecutionFileTime(row);
+        entry.executionTime = Utf8ToWide(snapshot.LocalTime(row));
+        entry.signatureStatus = wide(snapshot.Signature(row));
+        entry.isInCurrentInstance = snapshot.InCurrentInstance(row);
+        entry.isInInteractiveSession = snapshot.InInteractiveSession(row);
+        entry.host = wide(snapshot.Host(row));
+        if (const SnapshotHashes* hashes = snapshot.Hashes(row)) {
+            SnapshotDigest(hashes->md5, sizeof(hashes->md5), entry.md5);
+            SnapshotDigest(hashes->sha1, sizeof(hashes->sha1), entry.sha1);
+            SnapshotDigest(hashes->sha256, sizeof(hashes->sha256), entry.sha256);
+        }
+        if (snapshot.HasAnyRule(row)) {
+            for (size_t rule = 0; rule < ruleNames.size(); rule++) {
+                if (snapshot.HasRule(row, rule)) {
+                    entry.matched_rules.push_back(ruleNames[rule]);
+                }
+            }
+        }
+        size_t replaceCount = snapshot.ReplaceCount(row);
+        entry.replace_results.reserve(replaceCount);
+        for (size_t i = 0; i < replaceCount; i++) {
+            SnapshotReplaceView replace = snapshot.Replace(row, i);
+            entry.replace_results.push_back({ std::string(replace.filename), std::string(replace.type), std::string(replace.details) });
+        }
+    }
+    return true;
+}
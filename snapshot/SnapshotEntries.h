@@ -0,0 +1,13 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "ScanSnapshot.h"
+#include "../BAM/BAM.h"
+
+// BAMEntry <-> snapshot glue shared by the UI and the console front end
+// name rows without a host get, in a snapshot and in a diff against one
+std::wstring LocalHostName();
+// rows without a host are tagged with this machine's name
+bool SaveSnapshot(const std::wstring& path, const std::vector<BAMEntry>& entries);
+// appends the snapshot's rows, so several calls merge snapshots
+bool LoadSnapshot(const std::wstring& path, std::vector<BAMEntry>& entries);
@@ -0,0 +1,114 @@
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+#include "../signature/CatalogIndex.h"
+#include "../util/Digest.h"
+#include "../util/MappedFile.h"
+
+// parses tests/fixtures/catroot (make_catalogs.py) with the catalog DER parser and builds an index over it: members of
+// the signed catalog are found, the one of the catalog without a signer isn't. then every truncation of the signed
+// catalog and every single byte flipped, which have to fail or parse without reading outside the buffer
+// g++ -std=c++17 -fsanitize=address,undefined -Iext/Include -Iext/Include/yara tests/CatalogIndexTest.cpp signature/CatalogIndex.cpp
+//     signature/AuthenticodeEngine.cpp util/Digest.cpp util/MappedFile.cpp util/Utf8.cpp -lyara -lcrypto
+
+namespace {
+    int failures = 0;
+
+    void check(bool condition, const char* what) {
+        if (!condition) {
+            std::printf("FAILED: %s\n", what);
+            failures++;
+        }
+    }
+
+    template <typename Hash>
+    std::string digestOf(const char* text) {
+        Hash hash;
+        hash.Update((const uint8_t*)text, strlen(text));
+        return hash.Final();
+    }
+
+    bool contains(const std::vector<std::string>& hashes, const std::string& hash) {
+        for (const auto& item : hashes) {
+            if (item == hash) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::vector<uint8_t> readFile(const std::filesystem::path& path) {
+        MappedFile file;
+        if (!file.Open(path)) {
+            return {};
+        }
+        return std::vector<uint8_t>(file.Data(), file.Data() + file.Size());
+    }
+}
+
+int main(int argc, char** argv) {
+    std::filesystem::path catroot = argc > 1 ? argv[1] : "tests/fixtures/catroot";
+    std::string taggedSha1 = digestOf<Sha1>("tagged sha-1 member");
+    std::string taggedSha256 = digestOf<Sha256>("tagged sha-256 member");
+    std::string indirectSha256 = digestOf<Sha256>("indirect sha-256 member");
+    std::string unsignedSha256 = digestOf<Sha256>("unsigned member");
+
+    std::vector<uint8_t> signedCatalog = readFile(catroot / "signed.cat");
+    std::vector<uint8_t> unsignedCatalog = readFile(catroot / "unsigned.cat");
+    if (signedCatalog.empty() || unsignedCatalog.empty()) {
+        std::printf("FAILED: can't read the catalogs in %s\n", catroot.string().c_str());
+        return 1;
+    }
+
+    std::vector<std::string> hashes;
+    check(CatalogIndex::ParseCatalog(signedCatalog.data(), signedCatalog.size(), hashes), "signed catalog parses");
+    check(hashes.size() == 3, "three members, the tag that isn't a hash is skipped");
+    check(contains(hashes, taggedSha1), "sha-1 member tag");
+    check(contains(hashes, taggedSha256), "sha-256 member tag");
+    check(contains(hashes, indirectSha256), "sha-256 from the indirect data attribute");
+
+    hashes.clear();
+    check(!CatalogIndex::ParseCatalog(unsignedCatalog.data(), unsignedCatalog.size(), hashes), "catalog without a signer is rejected");
+
+    // built in memory, then written to an index file and loaded back from it
+    std::filesystem::path indexPath = std::filesystem::temp_directory_path() / "CatalogIndexTest.index";
+    std::error_code error;
+    std::filesystem::remove(indexPath, error);
+    CatalogIndex& index = CatalogIndex::Instance();
+    for (int pass = 0; pass < 3; pass++) {
+        if (pass == 2) {
+            // a damaged index file is rebuilt, not trusted
+            std::filesystem::resize_file(indexPath, std::filesystem::file_size(indexPath) - 3, error);
+        }
+        check(index.Open(catroot, indexPath), "index opens");
+        check(index.CatalogCount() == 2, "both catalogs are listed");
+        std::vector<uint32_t> catalogs;
+        check(index.Find(taggedSha1, catalogs) == 1 && index.CatalogPath(catalogs[0]).filename() == "signed.cat", "sha-1 member found");
+        catalogs.clear();
+        check(index.Find(indirectSha256, catalogs) == 1, "sha-256 member found");
+        catalogs.clear();
+        check(index.Find(unsignedSha256, catalogs) == 0, "member of the unsigned catalog not found");
+        catalogs.clear();
+        check(index.Find(digestOf<Sha256>("not listed"), catalogs) == 0, "hash nobody lists");
+        index.Close();
+    }
+    std::filesystem::remove(indexPath, error);
+
+    // a copy per length so the sanitizer sees the end of every shortened buffer
+    for (size_t length = 0; length < signedCatalog.size(); length++) {
+        std::vector<uint8_t> truncated(signedCatalog.begin(), signedCatalog.begin() + length);
+        hashes.clear();
+        CatalogIndex::ParseCatalog(truncated.data(), truncated.size(), hashes);
+    }
+    for (size_t i = 0; i < signedCatalog.size(); i++) {
+        std::vector<uint8_t> corrupted = signedCatalog;
+        corrupted[i] ^= 0xFF;
+        hashes.clear();
+        CatalogIndex::ParseCatalog(corrupted.data(), corrupted.size(), hashes);
+    }
+
+    std::printf(failures ? "CatalogIndexTest: %d failed\n" : "CatalogIndexTest: ok\n", failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,137 @@
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "../hive/RegfHive.h"
+#include "../util/MappedFile.h"
+
+// reads tests/fixtures/SYSTEM (make_system_hive.py) the way the hive mode does, then the same bytes truncated and
+// damaged: those have to fail or come back short, never read past the buffer
+// g++ -std=c++17 -fsanitize=address,undefined tests/RegfHiveTest.cpp hive/RegfHive.cpp util/MappedFile.cpp
+
+namespace {
+    int failures = 0;
+
+    void check(bool condition, const char* what) {
+        if (!condition) {
+            std::printf("FAILED: %s\n", what);
+            failures++;
+        }
+    }
+
+    struct BamRow {
+        std::wstring sid;
+        std::wstring path;
+        int64_t lastExecution;
+    };
+
+    // the lookups of BAMParser::EnumerateHiveRecords
+    std::vector<BamRow> bamRows(const RegfHive& hive) {
+        std::vector<BamRow> rows;
+        RegfKey controlSet = hive.CurrentControlSet();
+        RegfKey userSettings = hive.FindSubKey(hive.FindSubKey(hive.FindSubKey(hive.FindSubKey(controlSet, "Services"), "bam"), "State"), "UserSettings");
+        hive.ForEachSubKey(userSettings, [&hive, &rows](RegfKey sidKey) {
+            std::wstring sid = hive.KeyName(sidKey).ToWide();
+            hive.ForEachValue(sidKey, [&rows, &sid](const RegfValue& value) {
+                std::wstring path = value.name.ToWide();
+                if (value.type != RegfBinary || value.size < 8 || path.find(L'\\') == std::wstring::npos) {
+                    return true;
+                }
+                int64_t lastExecution = 0;
+                std::memcpy(&lastExecution, value.data, sizeof(lastExecution));
+                rows.push_back({ sid, path, lastExecution });
+                return true;
+            });
+            return true;
+        });
+        return rows;
+    }
+
+    std::wstring computerName(const RegfHive& hive) {
+        RegfValue value;
+        RegfKey key = hive.FindSubKey(hive.FindSubKey(hive.FindSubKey(hive.CurrentControlSet(), "Control"), "ComputerName"), "ComputerName");
+        if (!hive.FindValue(key, "ComputerName", value) || value.type != RegfSz || !value.data) {
+            return std::wstring();
+        }
+        std::wstring name;
+        for (uint32_t i = 0; i + 1 < value.size && (value.data[i] || value.data[i + 1]); i += 2) {
+            name += (wchar_t)(value.data[i] | (value.data[i + 1] << 8));
+        }
+        return name;
+    }
+
+    void testFixture(const RegfHive& hive) {
+        check(hive.KeyName(hive.CurrentControlSet()).EqualsIgnoreCase("controlset002"), "Select\\Current picks ControlSet002");
+        check(computerName(hive) == L"EVIDENCE-PC", "computer name of the current control set");
+
+        std::vector<BamRow> rows = bamRows(hive);
+        check(rows.size() == 2, "two BAM rows, non-path and non-binary values skipped");
+        if (rows.size() == 2) {
+            check(rows[0].sid == L"S-1-5-21-1000", "sid of the first row");
+            check(rows[0].path == L"\\Device\\HarddiskVolume3\\Windows\\System32\\cmd.exe", "path of the first row");
+            check(rows[0].lastExecution == 133000000000000000, "execution time of the first row");
+            check(rows[1].sid == L"S-1-5-21-1001", "sid of the second row");
+            check(rows[1].path == L"\\Device\\HarddiskVolume4\\Tools\\\x00e9t\x00e9.exe", "utf-16 value name");
+        }
+
+        size_t mounted = 0;
+        hive.ForEachValue(hive.OpenPath("MountedDevices"), [&mounted](const RegfValue& value) {
+            mounted += value.size == 12 ? 1 : 0;
+            return true;
+        });
+        check(mounted == 2, "MountedDevices values");
+
+        RegfValue missing;
+        check(!hive.FindValue(hive.OpenPath("Select"), "Default", missing), "missing value");
+        check(!hive.OpenPath("ControlSet002\\Services\\nothing").IsValid(), "missing key");
+    }
+
+    // every walk the hive mode does, on whatever the damaged hive still hands out
+    void walkAll(const RegfHive& hive) {
+        bamRows(hive);
+        computerName(hive);
+        hive.ForEachValue(hive.OpenPath("MountedDevices"), [](const RegfValue& value) {
+            value.name.ToUtf8();
+            return true;
+        });
+    }
+}
+
+int main(int argc, char** argv) {
+    const char* fixture = argc > 1 ? argv[1] : "tests/fixtures/SYSTEM";
+    MappedFile file;
+    if (!file.Open(fixture)) {
+        std::printf("FAILED: can't open %s\n", fixture);
+        return 1;
+    }
+    std::vector<uint8_t> bytes(file.Data(), file.Data() + file.Size());
+
+    RegfHive hive;
+    check(hive.Open(fixture), "open the fixture");
+    testFixture(hive);
+
+    // a copy so the sanitizer sees the end of every shortened buffer
+    for (size_t length = 0; length < bytes.size(); length++) {
+        std::vector<uint8_t> truncated(bytes.begin(), bytes.begin() + length);
+        RegfHive damaged;
+        if (damaged.OpenBuffer(truncated.data(), truncated.size())) {
+            walkAll(damaged);
+        }
+    }
+    for (size_t i = 0; i < bytes.size(); i++) {
+        std::vector<uint8_t> corrupted = bytes;
+        corrupted[i] ^= 0xFF;
+        RegfHive damaged;
+        if (damaged.OpenBuffer(corrupted.data(), corrupted.size())) {
+            walkAll(damaged);
+        }
+    }
+
+    std::vector<uint8_t> notHive = bytes;
+    notHive[0] = 'x';
+    RegfHive rejected;
+    check(!rejected.OpenBuffer(notHive.data(), notHive.size()), "a buffer without the regf signature is rejected");
+
+    std::printf(failures ? "RegfHiveTest: %d failed\n" : "RegfHiveTest: ok\n", failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,143 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <vector>
+#include "../export/ResultExporter.h"
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// exports 1M results as NDJSON and CSV and writes the same number of bytes with plain fwrite to the same directory,
+// both timed until the file is on disk: the exporter keeps up with the disk when its MB/s is close to the raw write
+// g++ -std=c++17 -O2 -o ResultExporterBench tests/ResultExporterBench.cpp export/ResultExporter.cpp && ./ResultExporterBench [dir] [records]
+
+namespace {
+    struct Rows {
+        std::vector<std::wstring> paths;
+        std::vector<std::wstring> times;
+        std::vector<std::string> hashes;
+        std::wstring sids[2] = { L"S-1-5-21-3623811015-3361044348-30300820-1001", L"S-1-5-18" };
+        std::wstring signatures[3] = { L"Signed", L"Not signed", L"Deleted" };
+        std::wstring host = L"WORKSTATION-7";
+        std::vector<std::string> rules = { "Generic_Injector", "Generic_Cheat" };
+        std::vector<ReplaceFileStruct> replaces = { { "tool.exe", "Explorer", "renamed from \"old.exe\"" } };
+    };
+
+    // every string is built up front, the timed loop only runs the exporter
+    ExportRecord MakeRecord(const Rows& rows, size_t i) {
+        ExportRecord record;
+        record.path = &rows.paths[i];
+        record.sid = &rows.sids[i % 2];
+        record.host = &rows.host;
+        record.executionFileTime = 133500000000000000ull + i * 10000000ull;
+        record.executionTime = &rows.times[i];
+        record.signatureStatus = &rows.signatures[i % 3];
+        record.md5 = &rows.hashes[i * 3];
+        record.sha1 = &rows.hashes[i * 3 + 1];
+        record.sha256 = &rows.hashes[i * 3 + 2];
+        record.matchedRules = i % 20 == 0 ? &rows.rules : nullptr;
+        record.replaceResults = i % 50 == 0 ? &rows.replaces : nullptr;
+        record.isInCurrentInstance = i % 2 == 0;
+        record.isInInteractiveSession = i % 3 == 0;
+        return record;
+    }
+
+    // the page cache takes a few hundred MB far faster than any disk, the time that counts ends once it is written back
+    bool SyncFile(const std::filesystem::path& path) {
+#ifdef _WIN32
+        int fd = _wopen(path.c_str(), _O_WRONLY | _O_BINARY);
+        bool ok = fd >= 0 && _commit(fd) == 0;
+        if (fd >= 0) _close(fd);
+#else
+        int fd = open(path.c_str(), O_WRONLY);
+        bool ok = fd >= 0 && fsync(fd) == 0;
+        if (fd >= 0) close(fd);
+#endif
+        return ok;
+    }
+
+    double Seconds(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // the same bytes in BufferSize blocks, what the disk (or the page cache in front of it) takes without any formatting
+    bool RawWrite(const std::filesystem::path& path, uint64_t bytes, double& seconds) {
+        std::vector<char> block(ResultExporter::BufferSize, 'x');
+        auto start = std::chrono::steady_clock::now();
+        std::FILE* file = std::fopen(path.string().c_str(), "wb");
+        if (!file) {
+            return false;
+        }
+        bool ok = true;
+        for (uint64_t written = 0; written < bytes && ok; written += block.size()) {
+            size_t length = (size_t)std::min<uint64_t>(block.size(), bytes - written);
+            ok = std::fwrite(block.data(), 1, length, file) == length;
+        }
+        ok = std::fclose(file) == 0 && SyncFile(path) && ok;
+        seconds = Seconds(start);
+        return ok;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    std::filesystem::path dir = argc > 1 ? argv[1] : std::filesystem::temp_directory_path().string();
+    size_t count = argc > 2 ? (size_t)std::strtoull(argv[2], nullptr, 10) : 1000000;
+
+    static const char digits[] = "0123456789abcdef";
+    Rows rows;
+    rows.paths.reserve(count);
+    rows.times.reserve(count);
+    rows.hashes.reserve(count * 3);
+    for (size_t i = 0; i < count; i++) {
+        rows.paths.push_back(L"C:\\Users\\player\\AppData\\Local\\Programs\\Vendor" + std::to_wstring(i % 5000) +
+            L"\\bin\\tool" + std::to_wstring(i) + L".exe");
+        rows.times.push_back(L"2024-03-" + std::to_wstring(10 + i % 18) + L" 1" + std::to_wstring(i % 10) + L":" +
+            std::to_wstring(10 + i % 50) + L":" + std::to_wstring(10 + (i * 7) % 50));
+        for (size_t length : { 32, 40, 64 }) {
+            std::string hash(length, '0');
+            for (size_t j = 0; j < length; j++) {
+                hash[j] = digits[(i * 2654435761u + j * 40503u) >> 7 & 15];
+            }
+            rows.hashes.push_back(std::move(hash));
+        }
+    }
+
+    int failures = 0;
+    for (ExportFormat format : { ExportFormat::Ndjson, ExportFormat::Csv }) {
+        const char* name = format == ExportFormat::Csv ? "csv" : "ndjson";
+        std::filesystem::path exportPath = dir / (std::string("ResultExporterBench.") + name);
+        std::filesystem::path rawPath = dir / "ResultExporterBench.raw";
+
+        ResultExporter exporter;
+        auto start = std::chrono::steady_clock::now();
+        bool ok = exporter.Open(exportPath, format);
+        for (size_t i = 0; i < count && ok; i++) {
+            exporter.Write(MakeRecord(rows, i));
+        }
+        ok = exporter.Close() && SyncFile(exportPath) && ok;
+        double exportSeconds = Seconds(start);
+        uint64_t bytes = exporter.BytesWritten();
+
+        double rawSeconds = 0.0;
+        if (!ok || !RawWrite(rawPath, bytes, rawSeconds)) {
+            std::printf("FAILED: writing %s to %s\n", name, dir.string().c_str());
+            failures++;
+            continue;
+        }
+
+        double mb = bytes / (1024.0 * 1024.0);
+        std::printf("%s: %zu records, %.1f MB in %.3f s (%.0f MB/s), raw fwrite of the same size %.3f s (%.0f MB/s), exporter at %.0f%% of it\n",
+            name, count, mb, exportSeconds, mb / exportSeconds, rawSeconds, mb / rawSeconds, 100.0 * rawSeconds / exportSeconds);
+
+        std::error_code error;
+        std::filesystem::remove(exportPath, error);
+        std::filesystem::remove(rawPath, error);
+    }
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,156 @@
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "../snapshot/ScanSnapshot.h"
+#include "../util/Digest.h"
+#include "../util/Utf8.h"
+
+// writes a snapshot, saves it and reads it back, then reads every truncation of it and every single byte flipped:
+// those have to be rejected or come back with rows that stay inside the file
+// g++ -std=c++17 -fsanitize=address,undefined tests/ScanSnapshotTest.cpp snapshot/ScanSnapshot.cpp util/Digest.cpp util/MappedFile.cpp util/Utf8.cpp
+
+namespace {
+    int failures = 0;
+
+    void check(bool condition, const char* what) {
+        if (!condition) {
+            std::printf("FAILED: %s\n", what);
+            failures++;
+        }
+    }
+
+    // every accessor of every row, the sanitizer catches what reads outside the buffer
+    size_t readAll(const ScanSnapshot& snapshot) {
+        size_t total = 0;
+        for (size_t row = 0; row < snapshot.RowCount(); row++) {
+            total += snapshot.ExecutionFileTime(row) & 1;
+            total += snapshot.Signature(row).size() + snapshot.Path(row).size() + snapshot.LocalTime(row).size();
+            total += snapshot.Host(row).size() + snapshot.Sid(row).size();
+            total += snapshot.InCurrentInstance(row) + snapshot.InInteractiveSession(row) + snapshot.HasAnyRule(row);
+            total += snapshot.Hashes(row) ? 1 : 0;
+            for (size_t rule = 0; rule < snapshot.RuleCount(); rule++) {
+                total += snapshot.HasRule(row, rule) ? snapshot.RuleName(rule).size() : 0;
+            }
+            for (size_t i = 0; i < snapshot.ReplaceCount(row); i++) {
+                SnapshotReplaceView replace = snapshot.Replace(row, i);
+                total += replace.type.size() + replace.filename.size() + replace.details.size();
+            }
+        }
+        return total;
+    }
+}
+
+int main() {
+    // a path outside the bmp, more rules than one bitset word, replaces on one row only
+    std::wstring path = L"C:\\Tools\\\x00e9t\x00e9\\\U0001F600.exe", other = L"C:\\Windows\\System32\\cmd.exe";
+    std::wstring sid = L"S-1-5-21-1000", time = L"2024-01-01 10:00:00", notSigned = L"Not signed", signedStatus = L"Signed";
+    std::string md5 = "0123456789abcdef0123456789abcdef", sha1(40, 'a'), sha256(64, 'b');
+    std::vector<std::string> rules;
+    for (int i = 0; i < 70; i++) {
+        rules.push_back("Rule" + std::to_string(i));
+    }
+    std::vector<ReplaceFileStruct> replaces = { { "tool.exe", "Explorer", "renamed from old.exe" } };
+
+    ExportRecord first;
+    first.path = &path;
+    first.sid = &sid;
+    first.executionFileTime = 133000000000000000;
+    first.executionTime = &time;
+    first.signatureStatus = &notSigned;
+    first.md5 = &md5;
+    first.sha1 = &sha1;
+    first.sha256 = &sha256;
+    first.matchedRules = &rules;
+    first.replaceResults = &replaces;
+    first.isInCurrentInstance = true;
+
+    ExportRecord second;
+    second.path = &other;
+    second.sid = &sid;
+    second.executionFileTime = 133000000000000001;
+    second.executionTime = &time;
+    second.signatureStatus = &signedStatus;
+    second.isInInteractiveSession = true;
+
+    SnapshotWriter writer;
+    writer.Add(first, L"HOST-A");
+    writer.Add(second, L"HOST-B");
+    writer.Add(first, L"HOST-B");
+    check(writer.RowCount() == 3, "rows added");
+
+    std::filesystem::path file = std::filesystem::temp_directory_path() / "ScanSnapshotTest.bamsnap";
+    check(writer.Save(file), "save");
+    ScanSnapshot snapshot;
+    check(snapshot.Open(file), "open what was saved");
+    check(snapshot.RowCount() == 3, "row count");
+    if (snapshot.RowCount() == 3) {
+        check(snapshot.Path(0) == "C:\\Tools\\\xC3\xA9t\xC3\xA9\\\xF0\x9F\x98\x80.exe", "path outside the bmp stored as utf-8");
+        check(Utf8ToWide(snapshot.Path(0)) == path, "path outside the bmp read back");
+        check(snapshot.Sid(0) == "S-1-5-21-1000", "sid");
+        check(snapshot.Host(0) == "HOST-A" && snapshot.Host(1) == "HOST-B", "hosts");
+        check(snapshot.ExecutionFileTime(0) == 133000000000000000 && snapshot.ExecutionFileTime(1) == 133000000000000001, "execution times");
+        check(snapshot.LocalTime(1) == "2024-01-01 10:00:00", "local time");
+        check(snapshot.Signature(0) == "Not signed" && snapshot.Signature(1) == "Signed", "signatures");
+        check(snapshot.InCurrentInstance(0) && !snapshot.InInteractiveSession(0), "flags of the first row");
+        check(!snapshot.InCurrentInstance(1) && snapshot.InInteractiveSession(1), "flags of the second row");
+
+        check(snapshot.RuleCount() == 70, "rule names");
+        check(snapshot.HasRule(0, 0) && snapshot.HasRule(0, 69) && snapshot.RuleName(69) == "Rule69", "rules past the first word");
+        check(!snapshot.HasAnyRule(1), "row without rules");
+
+        check(snapshot.ReplaceCount(0) == 1 && snapshot.ReplaceCount(1) == 0 && snapshot.ReplaceCount(2) == 1, "replace counts");
+        if (snapshot.ReplaceCount(0) == 1) {
+            SnapshotReplaceView replace = snapshot.Replace(0, 0);
+            check(replace.type == "Explorer" && replace.filename == "tool.exe" && replace.details == "renamed from old.exe", "replace");
+        }
+
+        const SnapshotHashes* hashes = snapshot.Hashes(0);
+        check(hashes && DigestToHex(std::string((const char*)hashes->md5, sizeof(hashes->md5))) == md5, "md5");
+        check(hashes && DigestToHex(std::string((const char*)hashes->sha256, sizeof(hashes->sha256))) == sha256, "sha256");
+        check(!snapshot.Hashes(1), "row that wasn't hashed");
+    }
+
+    std::vector<uint8_t> bytes;
+    check(writer.Serialize(bytes) && bytes.size() == std::filesystem::file_size(file), "serialize matches what was saved");
+
+    // a snapshot written before the sid and hashes columns: same bytes, fewer sections in the header
+    std::vector<uint8_t> old = bytes;
+    uint32_t requiredSections = Snapshot::RequiredSections;
+    memcpy(old.data() + offsetof(SnapshotHeader, sectionCount), &requiredSections, sizeof(requiredSections));
+    ScanSnapshot oldSnapshot;
+    check(oldSnapshot.OpenBuffer(old.data(), old.size()), "snapshot without the optional sections");
+    check(oldSnapshot.RowCount() == 3 && oldSnapshot.Sid(0).empty() && !oldSnapshot.Hashes(0), "optional sections missing");
+
+    // cut off on disk, the way an interrupted save leaves it
+    std::filesystem::resize_file(file, bytes.size() / 2);
+    ScanSnapshot truncatedFile;
+    check(!truncatedFile.Open(file), "a truncated file is rejected");
+    std::filesystem::remove(file);
+    ScanSnapshot missing;
+    check(!missing.Open(file), "a missing file is rejected");
+
+    // a copy per length so the sanitizer sees the end of every shortened buffer
+    for (size_t length = 0; length < bytes.size(); length++) {
+        std::vector<uint8_t> truncated(bytes.begin(), bytes.begin() + length);
+        ScanSnapshot damaged;
+        if (damaged.OpenBuffer(truncated.data(), truncated.size())) {
+            std::printf("FAILED: snapshot cut at %zu of %zu bytes was accepted\n", length, bytes.size());
+            failures++;
+        }
+    }
+    for (size_t i = 0; i < bytes.size(); i++) {
+        std::vector<uint8_t> corrupted = bytes;
+        corrupted[i] ^= 0xFF;
+        ScanSnapshot damaged;
+        if (damaged.OpenBuffer(corrupted.data(), corrupted.size())) {
+            readAll(damaged);
+        }
+    }
+
+    std::printf(failures ? "ScanSnapshotTest: %d failed\n" : "ScanSnapshotTest: ok\n", failures);
+    return failures ? 1 : 0;
+}
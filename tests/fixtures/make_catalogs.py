@@ -0,0 +1,84 @@
+# writes tests/fixtures/catroot: signed.cat, a hash catalog with a signer (structure only, the signature bytes are made up)
+# and unsigned.cat, the same kind of CTL with an empty signerInfos set, which the index must not take
+# member hashes are digests of fixed strings, CatalogIndexTest.cpp knows them by those strings
+import hashlib
+import os
+
+
+def tlv(tag, body):
+    if len(body) < 0x80:
+        length = bytes([len(body)])
+    else:
+        raw = len(body).to_bytes((len(body).bit_length() + 7) // 8, 'big')
+        length = bytes([0x80 | len(raw)]) + raw
+    return bytes([tag]) + length + body
+
+
+def seq(*items):
+    return tlv(0x30, b''.join(items))
+
+
+def set_of(*items):
+    return tlv(0x31, b''.join(items))
+
+
+def oid(dotted):
+    parts = [int(p) for p in dotted.split('.')]
+    out = bytes([parts[0] * 40 + parts[1]])
+    for value in parts[2:]:
+        encoded = [value & 0x7F]
+        value >>= 7
+        while value:
+            encoded.insert(0, 0x80 | (value & 0x7F))
+            value >>= 7
+        out += bytes(encoded)
+    return tlv(0x06, out)
+
+
+def octets(data):
+    return tlv(0x04, data)
+
+
+NULL = b'\x05\x00'
+SHA1 = '1.3.14.3.2.26'
+SHA256 = '2.16.840.1.101.3.4.2.1'
+
+
+def hex_tag(digest):
+    return (digest.hex().upper() + '\0').encode('utf-16-le')
+
+
+# member tag is the hash itself
+def tag_member(digest):
+    return seq(octets(hex_tag(digest)))
+
+
+# member tag is a file name, the hash sits in an SpcIndirectDataContent attribute
+def indirect_member(name, digest, algorithm):
+    content = seq(seq(oid('1.3.6.1.4.1.311.2.1.15'), seq()), seq(seq(oid(algorithm), NULL), octets(digest)))
+    attribute = seq(oid('1.3.6.1.4.1.311.2.1.4'), set_of(content))
+    return seq(octets((name + '\0').encode('utf-16-le')), set_of(attribute))
+
+
+def catalog(members, signed):
+    ctl = seq(seq(oid('1.3.6.1.4.1.311.12.1.1')), octets(b'\x01\x02'), tlv(0x17, b'250101000000Z'),
+        seq(oid('1.3.6.1.4.1.311.12.1.2'), NULL), seq(*members), tlv(0xA0, seq()))
+    signers = set_of()
+    if signed:
+        issuer = seq(set_of(seq(oid('2.5.4.3'), tlv(0x0C, b'Fixture CA'))))
+        signers = set_of(seq(tlv(0x02, b'\x01'), seq(issuer, tlv(0x02, b'\x2A')), seq(oid(SHA256), NULL),
+            seq(oid('1.2.840.113549.1.1.1'), NULL), octets(b'\x00' * 64)))
+    signed_data = seq(tlv(0x02, b'\x01'), set_of(seq(oid(SHA256), NULL)), seq(oid('1.3.6.1.4.1.311.10.1'), tlv(0xA0, ctl)), signers)
+    return seq(oid('1.2.840.113549.1.7.2'), tlv(0xA0, signed_data))
+
+
+directory = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'catroot')
+with open(os.path.join(directory, 'signed.cat'), 'wb') as out:
+    out.write(catalog([
+        tag_member(hashlib.sha1(b'tagged sha-1 member').digest()),
+        tag_member(hashlib.sha256(b'tagged sha-256 member').digest()),
+        indirect_member('driver.sys', hashlib.sha256(b'indirect sha-256 member').digest(), SHA256),
+        seq(octets(b'not a hash tag')),
+    ], True))
+with open(os.path.join(directory, 'unsigned.cat'), 'wb') as out:
+    out.write(catalog([tag_member(hashlib.sha256(b'unsigned member').digest())], False))
@@ -0,0 +1,85 @@
+# writes tests/fixtures/SYSTEM, a minimal regf hive with the keys the hive mode reads:
+# Select\Current pointing at ControlSet002 (ControlSet001 is a decoy), bam\State\UserSettings with two SIDs,
+# Control\ComputerName\ComputerName and MountedDevices
+import os
+import struct
+
+cells = bytearray(b'hbin' + b'\0' * 28)
+
+
+def alloc(data):
+    global cells
+    offset = len(cells)
+    size = (len(data) + 4 + 7) & ~7
+    cells += struct.pack('<i', -size) + data + b'\0' * (size - 4 - len(data))
+    return offset
+
+
+def value(name, type, data):
+    if len(data) <= 4:
+        size = len(data) | 0x80000000
+        offset = struct.unpack('<I', data.ljust(4, b'\0'))[0]
+    else:
+        size = len(data)
+        offset = alloc(data)
+    encoded = name.encode('utf-16le')
+    return alloc(b'vk' + struct.pack('<HIIIHH', len(encoded), size, offset, type, 0, 0) + encoded)
+
+
+def key(name, subkeys, values):
+    subkeyList = 0xFFFFFFFF
+    if subkeys:
+        subkeyList = alloc(b'lh' + struct.pack('<H', len(subkeys)) + b''.join(struct.pack('<II', s, 0) for s in subkeys))
+    valueList = 0xFFFFFFFF
+    if values:
+        valueList = alloc(b''.join(struct.pack('<I', v) for v in values))
+    encoded = name.encode('latin-1')
+    header = (b'nk' + struct.pack('<H', 0x20) + struct.pack('<Q', 132000000000000000) + struct.pack('<II', 0, 0)
+        + struct.pack('<II', len(subkeys), 0) + struct.pack('<II', subkeyList, 0xFFFFFFFF)
+        + struct.pack('<II', len(values), valueList) + struct.pack('<II', 0, 0) + b'\0' * (0x48 - 0x34)
+        + struct.pack('<HH', len(encoded), 0) + encoded)
+    return alloc(header)
+
+
+def sz(text):
+    return (text + '\0').encode('utf-16le')
+
+
+def bam(filetime):
+    return struct.pack('<Q', filetime) + b'\0' * 16
+
+
+def controlSet(name, computerName, userSettings):
+    bamKey = key('bam', [key('State', [key('UserSettings', userSettings, [])], [])], [])
+    computerNameKey = key('ComputerName', [key('ComputerName', [], [value('ComputerName', 1, sz(computerName))])], [])
+    return key(name, [key('Control', [computerNameKey], []), key('Services', [bamKey], [])], [])
+
+
+first = key('S-1-5-21-1000', [], [
+    value('\\Device\\HarddiskVolume3\\Windows\\System32\\cmd.exe', 3, bam(133000000000000000)),
+    value('Version', 4, struct.pack('<I', 1)),
+    value('SequenceNumber', 4, struct.pack('<I', 7)),
+])
+second = key('S-1-5-21-1001', [], [
+    value('\\Device\\HarddiskVolume4\\Tools\\été.exe', 3, bam(133100000000000000)),
+    value('Microsoft.Windows.Explorer', 3, bam(133200000000000000)),
+])
+
+disk = struct.pack('<I', 0x12345678) + struct.pack('<Q', 0x100000)
+mounted = key('MountedDevices', [], [
+    value('\\DosDevices\\C:', 3, disk),
+    value('\\??\\Volume{11111111-2222-3333-4444-555555555555}', 3, disk),
+])
+
+root = key('ROOT', [
+    controlSet('ControlSet001', 'DECOY', []),
+    controlSet('ControlSet002', 'EVIDENCE-PC', [first, second]),
+    key('Select', [], [value('Current', 4, struct.pack('<I', 2))]),
+    mounted,
+], [])
+
+base = bytearray(4096)
+base[0:4] = b'regf'
+base[0x24:0x28] = struct.pack('<I', root)
+with open(os.path.join(os.path.dirname(os.path.abspath(__file__)), 'SYSTEM'), 'wb') as out:
+    out.write(bytes(base) + bytes(cells))
@@ -0,0 +1,495 @@
+#include "Digest.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define DIGEST_X86 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define DIGEST_SHANI_TARGET
+#else
+#include <cpuid.h>
+#define DIGEST_SHANI_TARGET __attribute__((target("sha,sse4.1,ssse3")))
+#endif
+#endif
+
+static std::atomic<long long> hashedFiles{ 0 };
+static std::atomic<long long> hashedBytes{ 0 };
+static std::atomic<long long> hashNanoseconds{ 0 };
+
+namespace {
+    inline uint32_t Rotl(uint32_t x, int n) { return (x << n) | (x >> (32 - n)); }
+    inline uint32_t Rotr(uint32_t x, int n) { return (x >> n) | (x << (32 - n)); }
+
+    inline uint32_t LoadBig(const uint8_t* p) {
+        return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+    }
+
+    inline uint32_t LoadLittle(const uint8_t* p) {
+        return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+    }
+
+    inline void StoreBig(uint8_t* p, uint32_t v) {
+        p[0] = (uint8_t)(v >> 24);
+        p[1] = (uint8_t)(v >> 16);
+        p[2] = (uint8_t)(v >> 8);
+        p[3] = (uint8_t)v;
+    }
+
+    inline void StoreLittle(uint8_t* p, uint32_t v) {
+        p[0] = (uint8_t)v;
+        p[1] = (uint8_t)(v >> 8);
+        p[2] = (uint8_t)(v >> 16);
+        p[3] = (uint8_t)(v >> 24);
+    }
+
+    // shared md-style buffering, runs of whole blocks go straight from the input
+    template <typename Blocks>
+    void Absorb(Blocks&& blocks, uint8_t* buffer, size_t& buffered, uint64_t& total, const uint8_t* data, size_t length) {
+        total += length;
+        if (buffered) {
+            size_t take = (std::min)(length, (size_t)64 - buffered);
+            memcpy(buffer + buffered, data, take);
+            buffered += take;
+            data += take;
+            length -= take;
+            if (buffered < 64) {
+                return;
+            }
+            blocks(buffer, 1);
+            buffered = 0;
+        }
+        if (length >= 64) {
+            blocks(data, length / 64);
+            data += length & ~(size_t)63;
+            length &= 63;
+        }
+        memcpy(buffer, data, length);
+        buffered = length;
+    }
+
+    // 0x80, zeros, then the bit length (big endian for sha, little endian for md5)
+    template <typename Blocks>
+    void Pad(Blocks&& blocks, uint8_t* buffer, size_t buffered, uint64_t total, bool bigEndian) {
+        buffer[buffered++] = 0x80;
+        if (buffered > 56) {
+            memset(buffer + buffered, 0, 64 - buffered);
+            blocks(buffer, 1);
+            buffered = 0;
+        }
+        memset(buffer + buffered, 0, 56 - buffered);
+        uint64_t bits = total * 8;
+        if (bigEndian) {
+            StoreBig(buffer + 56, (uint32_t)(bits >> 32));
+            StoreBig(buffer + 60, (uint32_t)bits);
+        }
+        else {
+            StoreLittle(buffer + 56, (uint32_t)bits);
+            StoreLittle(buffer + 60, (uint32_t)(bits >> 32));
+        }
+        blocks(buffer, 1);
+    }
+
+    const uint32_t Sha256K[64] = {
+        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+        0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+        0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+        0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+        0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+        0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+    };
+
+    const uint32_t Md5K[64] = {
+        0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee, 0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+        0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be, 0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+        0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa, 0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+        0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed, 0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+        0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c, 0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+        0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05, 0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+        0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039, 0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+        0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1, 0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391,
+    };
+
+    const int Md5Shift[64] = {
+        7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22,
+        5, 9, 14, 20, 5, 9, 14, 20, 5, 9, 14, 20, 5, 9, 14, 20,
+        4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
+        6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21,
+    };
+
+    // one loop per round function, so the compiler can unroll each one without a branch per step
+    void Md5Blocks(uint32_t* state, const uint8_t* data, size_t blocks) {
+        for (; blocks; blocks--, data += 64) {
+            uint32_t m[16];
+            for (int i = 0; i < 16; i++) {
+                m[i] = LoadLittle(data + i * 4);
+            }
+            uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+            auto step = [&](uint32_t f, int i, int g) {
+                uint32_t next = b + Rotl(a + f + Md5K[i] + m[g], Md5Shift[i]);
+                a = d;
+                d = c;
+                c = b;
+                b = next;
+            };
+            for (int i = 0; i < 16; i++) step(d ^ (b & (c ^ d)), i, i);
+            for (int i = 16; i < 32; i++) step(c ^ (d & (b ^ c)), i, (5 * i + 1) & 15);
+            for (int i = 32; i < 48; i++) step(b ^ c ^ d, i, (3 * i + 5) & 15);
+            for (int i = 48; i < 64; i++) step(c ^ (b | ~d), i, (7 * i) & 15);
+            state[0] += a;
+            state[1] += b;
+            state[2] += c;
+            state[3] += d;
+        }
+    }
+
+    void Sha1BlocksScalar(uint32_t* state, const uint8_t* data, size_t blocks) {
+        for (; blocks; blocks--, data += 64) {
+            uint32_t w[80];
+            for (int i = 0; i < 16; i++) {
+                w[i] = LoadBig(data + i * 4);
+            }
+            for (int i = 16; i < 80; i++) {
+                w[i] = Rotl(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+            }
+
+            uint32_t a = state[0], b = state[1], c = state[2], d = state[3], e = state[4];
+            for (int i = 0; i < 80; i++) {
+                uint32_t f, k;
+                if (i < 20) { f = (b & c) | (~b & d); k = 0x5A827999; }
+                else if (i < 40) { f = b ^ c ^ d; k = 0x6ED9EBA1; }
+                else if (i < 60) { f = (b & c) | (b & d) | (c & d); k = 0x8F1BBCDC; }
+                else { f = b ^ c ^ d; k = 0xCA62C1D6; }
+                uint32_t t = Rotl(a, 5) + f + e + k + w[i];
+                e = d;
+                d = c;
+                c = Rotl(b, 30);
+                b = a;
+                a = t;
+            }
+            state[0] += a;
+            state[1] += b;
+            state[2] += c;
+            state[3] += d;
+            state[4] += e;
+        }
+    }
+
+    void Sha256BlocksScalar(uint32_t* state, const uint8_t* data, size_t blocks) {
+        for (; blocks; blocks--, data += 64) {
+            uint32_t w[64];
+            for (int i = 0; i < 16; i++) {
+                w[i] = LoadBig(data + i * 4);
+            }
+            for (int i = 16; i < 64; i++) {
+                uint32_t s0 = Rotr(w[i - 15], 7) ^ Rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+                uint32_t s1 = Rotr(w[i - 2], 17) ^ Rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+                w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+            }
+
+            uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+            uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+            for (int i = 0; i < 64; i++) {
+                uint32_t s1 = Rotr(e, 6) ^ Rotr(e, 11) ^ Rotr(e, 25);
+                uint32_t ch = (e & f) ^ (~e & g);
+                uint32_t t1 = h + s1 + ch + Sha256K[i] + w[i];
+                uint32_t s0 = Rotr(a, 2) ^ Rotr(a, 13) ^ Rotr(a, 22);
+                uint32_t maj = (a & b) ^ (a & c) ^ (b & c);
+                uint32_t t2 = s0 + maj;
+                h = g;
+                g = f;
+                f = e;
+                e = d + t1;
+                d = c;
+                c = b;
+                b = a;
+                a = t1 + t2;
+            }
+            state[0] += a;
+            state[1] += b;
+            state[2] += c;
+            state[3] += d;
+            state[4] += e;
+            state[5] += f;
+            state[6] += g;
+            state[7] += h;
+        }
+    }
+
+#ifdef DIGEST_X86
+    bool CpuHasShaExtensions() {
+        unsigned int leaf1[4] = {}, leaf7[4] = {};
+#ifdef _MSC_VER
+        int regs[4];
+        __cpuid(regs, 0);
+        if (regs[0] < 7) return false;
+        __cpuid(regs, 1);
+        memcpy(leaf1, regs, sizeof(leaf1));
+        __cpuidex(regs, 7, 0);
+        memcpy(leaf7, regs, sizeof(leaf7));
+#else
+        if (__get_cpuid_max(0, nullptr) < 7) return false;
+        __cpuid(1, leaf1[0], leaf1[1], leaf1[2], leaf1[3]);
+        __cpuid_count(7, 0, leaf7[0], leaf7[1], leaf7[2], leaf7[3]);
+#endif
+        bool ssse3 = (leaf1[2] >> 9) & 1;
+        bool sse41 = (leaf1[2] >> 19) & 1;
+        bool sha = (leaf7[1] >> 29) & 1;
+        return ssse3 && sse41 && sha;
+    }
+
+    // message words of group j (4 words each) live in w[j % 4], the schedule overwrites the group 4 back
+    DIGEST_SHANI_TARGET void Sha1BlocksShaNi(uint32_t* state, const uint8_t* data, size_t blocks) {
+        const __m128i byteSwap = _mm_set_epi64x(0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL);
+        __m128i abcd = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)state), 0x1B);
+        __m128i e0 = _mm_set_epi32((int)state[4], 0, 0, 0);
+
+        for (; blocks; blocks--, data += 64) {
+            __m128i abcdSave = abcd;
+            __m128i e0Save = e0;
+            __m128i w[4];
+            for (int i = 0; i < 4; i++) {
+                w[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(data + i * 16)), byteSwap);
+            }
+
+            __m128i previous = abcd;
+            abcd = _mm_sha1rnds4_epu32(abcd, _mm_add_epi32(e0, w[0]), 0);
+            for (int j = 1; j < 20; j++) {
+                if (j >= 4) {
+                    w[j % 4] = _mm_sha1msg2_epu32(_mm_xor_si128(_mm_sha1msg1_epu32(w[j % 4], w[(j + 1) % 4]), w[(j + 2) % 4]), w[(j + 3) % 4]);
+                }
+                __m128i e = _mm_sha1nexte_epu32(previous, w[j % 4]);
+                previous = abcd;
+                // the round function is an immediate
+                switch (j / 5) {
+                case 0: abcd = _mm_sha1rnds4_epu32(abcd, e, 0); break;
+                case 1: abcd = _mm_sha1rnds4_epu32(abcd, e, 1); break;
+                case 2: abcd = _mm_sha1rnds4_epu32(abcd, e, 2); break;
+                default: abcd = _mm_sha1rnds4_epu32(abcd, e, 3); break;
+                }
+            }
+            e0 = _mm_sha1nexte_epu32(previous, e0Save);
+            abcd = _mm_add_epi32(abcd, abcdSave);
+        }
+
+        _mm_storeu_si128((__m128i*)state, _mm_shuffle_epi32(abcd, 0x1B));
+        state[4] = (uint32_t)_mm_extract_epi32(e0, 3);
+    }
+
+    DIGEST_SHANI_TARGET void Sha256BlocksShaNi(uint32_t* state, const uint8_t* data, size_t blocks) {
+        const __m128i byteSwap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+        // the instructions want the state as ABEF / CDGH
+        __m128i tmp = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)&state[0]), 0xB1);
+        __m128i state1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)&state[4]), 0x1B);
+        __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);
+        state1 = _mm_blend_epi16(state1, tmp, 0xF0);
+
+        for (; blocks; blocks--, data += 64) {
+            __m128i state0Save = state0;
+            __m128i state1Save = state1;
+            __m128i w[4];
+            for (int i = 0; i < 4; i++) {
+                w[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(data + i * 16)), byteSwap);
+            }
+
+            for (int j = 0; j < 16; j++) {
+                if (j >= 4) {
+                    __m128i t = _mm_add_epi32(_mm_sha256msg1_epu32(w[j % 4], w[(j + 1) % 4]), _mm_alignr_epi8(w[(j + 3) % 4], w[(j + 2) % 4], 4));
+                    w[j % 4] = _mm_sha256msg2_epu32(t, w[(j + 3) % 4]);
+                }
+                __m128i message = _mm_add_epi32(w[j % 4], _mm_loadu_si128((const __m128i*)&Sha256K[j * 4]));
+                state1 = _mm_sha256rnds2_epu32(state1, state0, message);
+                state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(message, 0x0E));
+            }
+            state0 = _mm_add_epi32(state0, state0Save);
+            state1 = _mm_add_epi32(state1, state1Save);
+        }
+
+        tmp = _mm_shuffle_epi32(state0, 0x1B);
+        state1 = _mm_shuffle_epi32(state1, 0xB1);
+        _mm_storeu_si128((__m128i*)&state[0], _mm_blend_epi16(tmp, state1, 0xF0));
+        _mm_storeu_si128((__m128i*)&state[4], _mm_alignr_epi8(state1, tmp, 8));
+    }
+
+    const bool UseShaExtensions = CpuHasShaExtensions();
+#else
+    const bool UseShaExtensions = false;
+#endif
+
+    void Sha1Blocks(uint32_t* state, const uint8_t* data, size_t blocks) {
+#ifdef DIGEST_X86
+        if (UseShaExtensions) {
+            Sha1BlocksShaNi(state, data, blocks);
+            return;
+        }
+#endif
+        Sha1BlocksScalar(state, data, blocks);
+    }
+
+    void Sha256Blocks(uint32_t* state, const uint8_t* data, size_t blocks) {
+#ifdef DIGEST_X86
+        if (UseShaExtensions) {
+            Sha256BlocksShaNi(state, data, blocks);
+            return;
+        }
+#endif
+        Sha256BlocksScalar(state, data, blocks);
+    }
+}
+
+void Md5::Reset() {
+    state[0] = 0x67452301;
+    state[1] = 0xefcdab89;
+    state[2] = 0x98badcfe;
+    state[3] = 0x10325476;
+    buffered = 0;
+    total = 0;
+}
+
+void Md5::Update(const uint8_t* data, size_t length) {
+    Absorb([this](const uint8_t* blocks, size_t count) { Md5Blocks(state, blocks, count); }, buffer, buffered, total, data, length);
+}
+
+std::string Md5::Final() {
+    Pad([this](const uint8_t* blocks, size_t count) { Md5Blocks(state, blocks, count); }, buffer, buffered, total, false);
+    uint8_t digest[DigestSize];
+    for (int i = 0; i < 4; i++) {
+        StoreLittle(digest + i * 4, state[i]);
+    }
+    Reset();
+    return std::string((const char*)digest, sizeof(digest));
+}
+
+void Sha1::Reset() {
+    state[0] = 0x67452301;
+    state[1] = 0xEFCDAB89;
+    state[2] = 0x98BADCFE;
+    state[3] = 0x10325476;
+    state[4] = 0xC3D2E1F0;
+    buffered = 0;
+    total = 0;
+}
+
+void Sha1::Update(const uint8_t* data, size_t length) {
+    Absorb([this](const uint8_t* blocks, size_t count) { Sha1Blocks(state, blocks, count); }, buffer, buffered, total, data, length);
+}
+
+std::string Sha1::Final() {
+    Pad([this](const uint8_t* blocks, size_t count) { Sha1Blocks(state, blocks, count); }, buffer, buffered, total, true);
+    uint8_t digest[DigestSize];
+    for (int i = 0; i < 5; i++) {
+        StoreBig(digest + i * 4, state[i]);
+    }
+    Reset();
+    return std::string((const char*)digest, sizeof(digest));
+}
+
+void Sha256::Reset() {
+    state[0] = 0x6a09e667;
+    state[1] = 0xbb67ae85;
+    state[2] = 0x3c6ef372;
+    state[3] = 0xa54ff53a;
+    state[4] = 0x510e527f;
+    state[5] = 0x9b05688c;
+    state[6] = 0x1f83d9ab;
+    state[7] = 0x5be0cd19;
+    buffered = 0;
+    total = 0;
+}
+
+void Sha256::Update(const uint8_t* data, size_t length) {
+    Absorb([this](const uint8_t* blocks, size_t count) { Sha256Blocks(state, blocks, count); }, buffer, buffered, total, data, length);
+}
+
+std::string Sha256::Final() {
+    Pad([this](const uint8_t* blocks, size_t count) { Sha256Blocks(state, blocks, count); }, buffer, buffered, total, true);
+    uint8_t digest[DigestSize];
+    for (int i = 0; i < 8; i++) {
+        StoreBig(digest + i * 4, state[i]);
+    }
+    Reset();
+    return std::string((const char*)digest, sizeof(digest));
+}
+
+void MultiHasher::Update(const uint8_t* data, size_t length) {
+    auto start = std::chrono::steady_clock::now();
+    bytes += length;
+    for (size_t offset = 0; offset < length; offset += SliceSize) {
+        size_t slice = (std::min)(SliceSize, length - offset);
+        md5.Update(data + offset, slice);
+        sha1.Update(data + offset, slice);
+        sha256.Update(data + offset, slice);
+    }
+    nanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+FileHashes MultiHasher::Final() {
+    FileHashes hashes;
+    hashes.md5 = md5.Final();
+    hashes.sha1 = sha1.Final();
+    hashes.sha256 = sha256.Final();
+
+    hashedFiles++;
+    hashedBytes += (long long)bytes;
+    hashNanoseconds += nanoseconds;
+    bytes = 0;
+    nanoseconds = 0;
+    return hashes;
+}
+
+const char* MultiHasher::Implementation() {
+    return UseShaExtensions ? "sha-ni" : "scalar";
+}
+
+void MultiHasher::ResetStats() {
+    hashedFiles = 0;
+    hashedBytes = 0;
+    hashNanoseconds = 0;
+}
+
+void MultiHasher::ReportStats() {
+    double mb = hashedBytes.load() / (1024.0 * 1024.0);
+    double ms = hashNanoseconds.load() / 1e6;
+    std::cout << "Hashes: " << hashedFiles.load() << " files (md5 + sha-1 + sha-256, " << Implementation() << "), "
+        << std::fixed << std::setprecision(2) << mb << " MB in " << ms << " ms ("
+        << (ms > 0 ? mb / 1024.0 / (ms / 1000.0) : 0.0) << " GB/s per thread)" << std::endl;
+}
+
+std::string DigestToHex(const std::string& digest) {
+    static const char digits[] = "0123456789abcdef";
+    std::string hex;
+    hex.reserve(digest.size() * 2);
+    for (unsigned char c : digest) {
+        hex += digits[c >> 4];
+        hex += digits[c & 15];
+    }
+    return hex;
+}
+
+bool HexToDigest(const std::string& hex, uint8_t* out, size_t size) {
+    if (hex.size() != size * 2) {
+        return false;
+    }
+    auto value = [](char c) -> int {
+        if (c >= '0' && c <= '9') return c - '0';
+        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+        return -1;
+    };
+    for (size_t i = 0; i < size; i++) {
+        int high = value(hex[i * 2]);
+        int low = value(hex[i * 2 + 1]);
+        if (high < 0 || low < 0) {
+            return false;
+        }
+        out[i] = (uint8_t)((high << 4) | low);
+    }
+    return true;
+}
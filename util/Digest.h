@@ -0,0 +1,92 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// portable streaming hashes for the code that has to run without bcrypt (offline catalogs, linux)
+// Final() returns the raw digest and leaves the object ready for a new message
+// sha-1 and sha-256 use the x86 sha extensions when the cpu has them, plain c++ otherwise
+
+class Md5 {
+public:
+    static constexpr size_t DigestSize = 16;
+
+    Md5() { Reset(); }
+    void Reset();
+    void Update(const uint8_t* data, size_t length);
+    std::string Final();
+
+private:
+    uint32_t state[4];
+    uint8_t buffer[64];
+    size_t buffered = 0;
+    uint64_t total = 0;
+};
+
+class Sha1 {
+public:
+    static constexpr size_t DigestSize = 20;
+
+    Sha1() { Reset(); }
+    void Reset();
+    void Update(const uint8_t* data, size_t length);
+    std::string Final();
+
+private:
+    uint32_t state[5];
+    uint8_t buffer[64];
+    size_t buffered = 0;
+    uint64_t total = 0;
+};
+
+class Sha256 {
+public:
+    static constexpr size_t DigestSize = 32;
+
+    Sha256() { Reset(); }
+    void Reset();
+    void Update(const uint8_t* data, size_t length);
+    std::string Final();
+
+private:
+    uint32_t state[8];
+    uint8_t buffer[64];
+    size_t buffered = 0;
+    uint64_t total = 0;
+};
+
+// raw digests of one file, empty strings when it wasn't hashed
+struct FileHashes {
+    std::string md5;
+    std::string sha1;
+    std::string sha256;
+
+    bool Empty() const { return sha256.empty(); }
+};
+
+// md5, sha-1 and sha-256 in one pass: every slice is run through all three while it is still in L1,
+// so the file is read (or faulted in) once no matter how many digests are wanted
+class MultiHasher {
+public:
+    static constexpr size_t SliceSize = 16 << 10;
+
+    void Update(const uint8_t* data, size_t length);
+    FileHashes Final();
+
+    // "sha-ni" or "scalar", what sha-1 / sha-256 run on this cpu
+    static const char* Implementation();
+
+    static void ResetStats();
+    static void ReportStats();
+
+private:
+    Md5 md5;
+    Sha1 sha1;
+    Sha256 sha256;
+    uint64_t bytes = 0;
+    long long nanoseconds = 0;
+};
+
+// lowercase hex for display and export, and back (false on anything but 2 * size hex digits)
+std::string DigestToHex(const std::string& digest);
+bool HexToDigest(const std::string& hex, uint8_t* out, size_t size);
@@ -0,0 +1,120 @@
+#include "Utf8.h"
+#include <cstdint>
+
+static void AppendUtf8(std::string& out, uint32_t c) {
+    if (c < 0x80) {
+        out += (char)c;
+    }
+    else if (c < 0x800) {
+        out += (char)(0xC0 | (c >> 6));
+        out += (char)(0x80 | (c & 0x3F));
+    }
+    else if (c < 0x10000) {
+        out += (char)(0xE0 | (c >> 12));
+        out += (char)(0x80 | ((c >> 6) & 0x3F));
+        out += (char)(0x80 | (c & 0x3F));
+    }
+    else {
+        out += (char)(0xF0 | (c >> 18));
+        out += (char)(0x80 | ((c >> 12) & 0x3F));
+        out += (char)(0x80 | ((c >> 6) & 0x3F));
+        out += (char)(0x80 | (c & 0x3F));
+    }
+}
+
+static void AppendWide(std::wstring& out, uint32_t c) {
+    if constexpr (sizeof(wchar_t) == 2) {
+        if (c >= 0x10000) {
+            c -= 0x10000;
+            out += (wchar_t)(0xD800 + (c >> 10));
+            out += (wchar_t)(0xDC00 + (c & 0x3FF));
+            return;
+        }
+    }
+    out += (wchar_t)c;
+}
+
+std::string WideToUtf8(const std::wstring& text) {
+    std::string out;
+    out.reserve(text.size());
+    for (size_t i = 0; i < text.size(); i++) {
+        uint32_t c = (uint32_t)text[i];
+        if (c >= 0xD800 && c <= 0xDBFF) {
+            if (i + 1 < text.size() && (uint32_t)text[i + 1] >= 0xDC00 && (uint32_t)text[i + 1] <= 0xDFFF) {
+                c = 0x10000 + ((c - 0xD800) << 10) + ((uint32_t)text[i + 1] - 0xDC00);
+                i++;
+            }
+            else {
+                c = 0xFFFD;
+            }
+        }
+        else if ((c >= 0xDC00 && c <= 0xDFFF) || c > 0x10FFFF) {
+            c = 0xFFFD;
+        }
+        AppendUtf8(out, c);
+    }
+    return out;
+}
+
+std::wstring Utf8ToWide(std::string_view text) {
+    // the ascii prefix (all of nearly every path) is widened in one go, the decode loop only sees the rest
+    size_t i = 0;
+    while (i < text.size() && (uint8_t)text[i] < 0x80) {
+        i++;
+    }
+    std::wstring out(text.begin(), text.begin() + i);
+    if (i == text.size()) {
+        return out;
+    }
+    out.reserve(text.size());
+    while (i < text.size()) {
+        uint8_t lead = (uint8_t)text[i];
+        uint32_t c;
+        size_t length;
+        if (lead < 0x80) {
+            c = lead;
+            length = 1;
+        }
+        else if ((lead & 0xE0) == 0xC0) {
+            c = lead & 0x1F;
+            length = 2;
+        }
+        else if ((lead & 0xF0) == 0xE0) {
+            c = lead & 0x0F;
+            length = 3;
+        }
+        else if ((lead & 0xF8) == 0xF0) {
+            c = lead & 0x07;
+            length = 4;
+        }
+        else {
+            AppendWide(out, 0xFFFD);
+            i++;
+            continue;
+        }
+
+        if (i + length > text.size()) {
+            AppendWide(out, 0xFFFD);
+            break;
+        }
+        bool valid = true;
+        for (size_t k = 1; k < length; k++) {
+            uint8_t next = (uint8_t)text[i + k];
+            if ((next & 0xC0) != 0x80) {
+                valid = false;
+                break;
+            }
+            c = (c << 6) | (next & 0x3F);
+        }
+        // overlong forms and surrogates are rejected as well
+        static const uint32_t minimum[] = { 0, 0, 0x80, 0x800, 0x10000 };
+        if (!valid || c < minimum[length] || c > 0x10FFFF || (c >= 0xD800 && c <= 0xDFFF)) {
+            AppendWide(out, 0xFFFD);
+            i++;
+            continue;
+        }
+        AppendWide(out, c);
+        i += length;
+    }
+    return out;
+}
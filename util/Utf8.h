@@ -0,0 +1,7 @@
+#pragma once
+#include <string>
+#include <string_view>
+
+// portable utf-8 <-> wstring (utf-16 on windows, utf-32 elsewhere), invalid input becomes U+FFFD
+std::string WideToUtf8(const std::wstring& text);
+std::wstring Utf8ToWide(std::string_view text);
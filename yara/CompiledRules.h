@@ -0,0 +1,22 @@
+/*
+Precompiled version of the rules in initializeGenericRules(), saved with yr_rules_save_stream.
+This file is generated by rulesgen.exe (yara/rulesgen.cpp), yara\rulesgen.cmd runs it as the pre-build step:
+
+    rulesgen.exe yara\CompiledRules.h
+
+CompiledRulesDigest is digestGenericRules() of the sources the blob was compiled from. A blob whose digest doesn't
+match the current sources is stale and never loaded, and yr_rules_load_stream refuses blobs from other yara versions;
+in both cases the parser falls back to compiling the sources.
+While CompiledRulesSize is 0 the sources are always compiled at startup.
+*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+static const unsigned char CompiledRulesHex[] = {
+	0x00
+};
+
+static const size_t CompiledRulesSize = 0;
+
+static const uint64_t CompiledRulesDigest = 0;
@@ -0,0 +1,35 @@
+@echo off
+rem pre-build step of BAMParser.exe / BAMParserCLI.exe: builds rulesgen.exe and regenerates yara\CompiledRules.h,
+rem the header is only rewritten when the rules or libyara changed. in Visual Studio, Project > Properties >
+rem Build Events > Pre-Build Event > Command Line:
+rem
+rem     call "$(ProjectDir)yara\rulesgen.cmd" "$(IntDir)" $(Configuration)
+rem
+rem the pre-build event runs in the developer prompt, so cl is on the path. libyara.lib (and the libcrypto.lib it was
+rem built against) are taken from ext\libs like the rest of the libraries
+setlocal
+set ROOT=%~dp0..
+rem full paths, the build runs from %OUT%
+for %%I in ("%ROOT%") do set ROOT=%%~fI
+set OUT=%~1
+if "%OUT%"=="" set OUT=%ROOT%\yara\
+if not exist "%OUT%" mkdir "%OUT%"
+for %%I in ("%OUT%.") do set OUT=%%~fI
+set RUNTIME=/MT
+if /i "%~2"=="Debug" set RUNTIME=/MTd
+
+rem objects and rulesgen.exe go to the current directory, a quoted path ending in \ would confuse cl
+pushd "%OUT%"
+cl /nologo /std:c++17 /EHsc /O2 %RUNTIME% /I"%ROOT%\ext\Include" /I"%ROOT%\ext\Include\yara" /Fe:rulesgen.exe ^
+    "%ROOT%\yara\rulesgen.cpp" "%ROOT%\yara\yara.cpp" ^
+    /link /LIBPATH:"%ROOT%\ext\libs" libyara.lib libcrypto.lib crypt32.lib ws2_32.lib advapi32.lib user32.lib
+set BUILT=%ERRORLEVEL%
+popd
+if not "%BUILT%"=="0" (
+    echo rulesgen: building rulesgen.exe failed 1>&2
+    exit /b 1
+)
+
+"%OUT%\rulesgen.exe" "%ROOT%\yara\CompiledRules.h"
+if errorlevel 1 exit /b 1
+exit /b 0
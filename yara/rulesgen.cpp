@@ -0,0 +1,87 @@
+// rulesgen.exe, compiles the rules from initializeGenericRules() and dumps them as CompiledRules.h
+// link it with yara.cpp and libyara, yara\rulesgen.cmd builds and runs it before BAMParser.exe is built
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include "yara.h"
+
+std::vector<GenericRule> genericRules;
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: rulesgen <output header>" << std::endl;
+        return 1;
+    }
+
+    if (yr_initialize() != ERROR_SUCCESS) {
+        std::cerr << "Failed to initialize libyara." << std::endl;
+        return 1;
+    }
+
+    initializeGenericRules();
+
+    YR_RULES* rules = compileRulesFromSource();
+    if (!rules) {
+        std::cerr << "Failed to compile rules." << std::endl;
+        yr_finalize();
+        return 1;
+    }
+
+    std::vector<unsigned char> blob;
+    bool saved = saveRulesToBuffer(rules, blob);
+    yr_rules_destroy(rules);
+    yr_finalize();
+
+    if (!saved || blob.empty()) {
+        std::cerr << "Failed to serialize rules." << std::endl;
+        return 1;
+    }
+
+    std::ostringstream out;
+    out << "/*\n"
+        << "Precompiled version of the rules in initializeGenericRules(), saved with yr_rules_save_stream.\n"
+        << "Generated by rulesgen.exe (yara/rulesgen.cpp), do not edit by hand.\n"
+        << "*/\n"
+        << "#pragma once\n"
+        << "#include <cstddef>\n"
+        << "#include <cstdint>\n\n"
+        << "static const unsigned char CompiledRulesHex[" << blob.size() << "] = {";
+
+    out << std::hex << std::uppercase << std::setfill('0');
+    for (size_t i = 0; i < blob.size(); i++) {
+        if (i % 12 == 0) out << "\n\t";
+        out << "0x" << std::setw(2) << (int)blob[i];
+        if (i + 1 < blob.size()) out << (i % 12 == 11 ? "," : ", ");
+    }
+    out << std::dec << "\n};\n\nstatic const size_t CompiledRulesSize = " << blob.size() << ";\n";
+    out << "\nstatic const uint64_t CompiledRulesDigest = 0x" << std::hex << std::setw(16) << digestGenericRules() << "ULL;\n";
+
+    // runs before every build, an unchanged header is left alone so nothing that includes it gets rebuilt
+    std::string header = out.str();
+    {
+        std::ifstream existing(argv[1], std::ios::binary);
+        std::stringstream current;
+        current << existing.rdbuf();
+        if (existing && current.str() == header) {
+            std::cout << "Compiled rules in " << argv[1] << " are up to date" << std::endl;
+            return 0;
+        }
+    }
+
+    std::ofstream file(argv[1], std::ios::binary);
+    if (!file) {
+        std::cerr << "Failed to open output: " << argv[1] << std::endl;
+        return 1;
+    }
+    file << header;
+    if (!file) {
+        std::cerr << "Error while writing " << argv[1] << std::endl;
+        return 1;
+    }
+
+    std::cout << "Wrote " << blob.size() << " bytes of compiled rules to " << argv[1] << std::endl;
+    return 0;
+}
@@ -1,5 +1,12 @@
 #include "yara.h"
 #include <yara/yara.h>
+#include "CompiledRules.h"
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
 
 void addGenericRule(const std::string& name, const std::string& rule) {
     genericRules.push_back({ name, rule });
@@ -70,6 +77,28 @@ rule sA
 
 
 
+// written under compiledRulesMutex, read without it by the scan threads: published only once the digest is set
+static std::atomic<YR_RULES*> compiledRules{ nullptr };
+static std::mutex compiledRulesMutex;
+static double compileMilliseconds = 0.0;
+static bool compiledFromBlob = false;
+static uint64_t rulesetDigest = 0;
+static std::atomic<long long> scanMicroseconds{ 0 };
+static std::atomic<int> scannedFiles{ 0 };
+
+struct ThreadScanner {
+    YR_SCANNER* scanner = nullptr;
+    YR_RULES* rules = nullptr;
+
+    ~ThreadScanner() {
+        if (scanner) {
+            yr_scanner_destroy(scanner);
+        }
+    }
+};
+
+static thread_local ThreadScanner threadScanner;
+
 int yara_callback(YR_SCAN_CONTEXT* context, int message, void* message_data, void* user_data) {
     if (message == CALLBACK_MSG_RULE_MATCHING) {
         YR_RULE* rule = (YR_RULE*)message_data;
@@ -83,41 +112,235 @@ void compiler_error_callback(int error_level, const char* file_name, int line_nu
     fprintf(stderr, "Error: %s at line %d: %s\n", file_name ? file_name : "N/A", line_number, message);
 }
 
-bool scan_with_yara(const std::string& path, std::vector<std::string>& matched_rules) {
-    YR_COMPILER* compiler = NULL;
-    YR_RULES* rules = NULL;
-    int result = yr_initialize();
-    if (result != ERROR_SUCCESS) return false;
+struct BlobReader {
+    const unsigned char* data;
+    size_t size;
+    size_t offset;
+};
 
-    result = yr_compiler_create(&compiler);
-    if (result != ERROR_SUCCESS) {
-        yr_finalize();
-        return false;
-    }
+static size_t blob_read(void* ptr, size_t size, size_t count, void* user_data) {
+    BlobReader* reader = (BlobReader*)user_data;
+    if (size == 0) return 0;
+    size_t available = (reader->size - reader->offset) / size;
+    size_t items = count < available ? count : available;
+    memcpy(ptr, reader->data + reader->offset, items * size);
+    reader->offset += items * size;
+    return items;
+}
+
+static size_t vector_write(const void* ptr, size_t size, size_t count, void* user_data) {
+    std::vector<unsigned char>* out = (std::vector<unsigned char>*)user_data;
+    const unsigned char* bytes = (const unsigned char*)ptr;
+    out->insert(out->end(), bytes, bytes + size * count);
+    return count;
+}
+
+YR_RULES* compileRulesFromSource() {
+    YR_COMPILER* compiler = NULL;
+    if (yr_compiler_create(&compiler) != ERROR_SUCCESS) return nullptr;
 
     yr_compiler_set_callback(compiler, compiler_error_callback, NULL);
 
     for (const auto& rule : genericRules) {
-        result = yr_compiler_add_string(compiler, rule.rule.c_str(), NULL);
-        if (result != 0) {
+        if (yr_compiler_add_string(compiler, rule.rule.c_str(), NULL) != 0) {
             yr_compiler_destroy(compiler);
-            yr_finalize();
-            return false;
+            return nullptr;
+        }
+    }
+
+    YR_RULES* rules = nullptr;
+    if (yr_compiler_get_rules(compiler, &rules) != ERROR_SUCCESS) {
+        rules = nullptr;
+    }
+    yr_compiler_destroy(compiler);
+    return rules;
+}
+
+YR_RULES* loadRulesFromBlob(const unsigned char* data, size_t size) {
+    if (data == nullptr || size == 0) return nullptr;
+
+    BlobReader reader{ data, size, 0 };
+    YR_STREAM stream{};
+    stream.user_data = &reader;
+    stream.read = blob_read;
+
+    YR_RULES* rules = nullptr;
+    if (yr_rules_load_stream(&stream, &rules) != ERROR_SUCCESS) {
+        return nullptr;
+    }
+    return rules;
+}
+
+bool saveRulesToBuffer(YR_RULES* rules, std::vector<unsigned char>& out) {
+    YR_STREAM stream{};
+    stream.user_data = &out;
+    stream.write = vector_write;
+    return yr_rules_save_stream(rules, &stream) == ERROR_SUCCESS;
+}
+
+uint64_t digestGenericRules() {
+    // fnv-1a over the rule sources, rulesgen writes it next to the blob
+    uint64_t digest = 14695981039346656037ULL;
+    for (const auto& rule : genericRules) {
+        for (unsigned char c : rule.name + '\0' + rule.rule) {
+            digest = (digest ^ c) * 1099511628211ULL;
         }
     }
+    return digest;
+}
+
+bool compileGenericRules(bool fromSource) {
+    std::lock_guard<std::mutex> lock(compiledRulesMutex);
+    if (compiledRules.load()) return true;
+
+    auto start = std::chrono::steady_clock::now();
+
+    if (yr_initialize() != ERROR_SUCCESS) return false;
+
+    if (genericRules.empty()) {
+        initializeGenericRules();
+    }
+    uint64_t sourceDigest = digestGenericRules();
+
+    // the blob is produced by rulesgen at build time, an empty one means it wasnt generated and one made from
+    // other sources (a rule changed since) would run the old rules, both are compiled from source instead
+    YR_RULES* rules = nullptr;
+    if (!fromSource && CompiledRulesDigest == sourceDigest) {
+        rules = loadRulesFromBlob(CompiledRulesHex, CompiledRulesSize);
+        compiledFromBlob = rules != nullptr;
+    }
+    else if (!fromSource && CompiledRulesSize != 0) {
+        std::cerr << "YARA: precompiled rules are stale, compiling from source" << std::endl;
+    }
+
+    if (!rules) {
+        rules = compileRulesFromSource();
+    }
 
-    result = yr_compiler_get_rules(compiler, &rules);
-    if (result != ERROR_SUCCESS) {
-        yr_compiler_destroy(compiler);
+    if (!rules) {
         yr_finalize();
         return false;
     }
 
-    result = yr_rules_scan_file(rules, path.c_str(), 0, yara_callback, &matched_rules, 0);
+    // the digest of the rules that actually got loaded, cached verdicts from another ruleset are ignored
+    rulesetDigest = compiledFromBlob ? CompiledRulesDigest : sourceDigest;
+
+    compileMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    compiledRules.store(rules);
+    return true;
+}
+
+uint64_t getRulesetDigest() {
+    return rulesetDigest;
+}
+
+void benchmarkRuleLoading() {
+    if (yr_initialize() != ERROR_SUCCESS) return;
+
+    if (genericRules.empty()) {
+        initializeGenericRules();
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    YR_RULES* sourceRules = compileRulesFromSource();
+    double sourceMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    bool stale = CompiledRulesDigest != digestGenericRules();
+    start = std::chrono::steady_clock::now();
+    YR_RULES* blobRules = loadRulesFromBlob(CompiledRulesHex, CompiledRulesSize);
+    double blobMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "YARA startup: source compile " << std::fixed << std::setprecision(2) << sourceMs << " ms";
+    if (blobRules) {
+        std::cout << ", blob load " << blobMs << " ms (" << CompiledRulesSize << " bytes" << (stale ? ", stale" : "") << ")" << std::endl;
+    }
+    else {
+        std::cout << ", no precompiled blob available" << std::endl;
+    }
+
+    if (sourceRules) yr_rules_destroy(sourceRules);
+    if (blobRules) yr_rules_destroy(blobRules);
+    yr_finalize();
+}
+
+void destroyGenericRules() {
+    std::lock_guard<std::mutex> lock(compiledRulesMutex);
+    YR_RULES* rules = compiledRules.exchange(nullptr);
+    if (!rules) return;
+
+    if (threadScanner.scanner) {
+        yr_scanner_destroy(threadScanner.scanner);
+        threadScanner.scanner = nullptr;
+        threadScanner.rules = nullptr;
+    }
 
     yr_rules_destroy(rules);
-    yr_compiler_destroy(compiler);
+    compiledFromBlob = false;
     yr_finalize();
+}
+
+void resetYaraTimings() {
+    scanMicroseconds = 0;
+    scannedFiles = 0;
+}
+
+void reportYaraTimings() {
+    std::cout << "YARA: rules " << (compiledFromBlob ? "loaded from blob" : "compiled once") << " in " << std::fixed << std::setprecision(2) << compileMilliseconds
+        << " ms, " << scannedFiles.load() << " files scanned in " << (scanMicroseconds.load() / 1000.0) << " ms" << std::endl;
+}
+
+// scanners are not thread safe, so every worker keeps its own one bound to the shared ruleset
+static YR_SCANNER* acquireThreadScanner() {
+    YR_RULES* rules = compiledRules.load();
+    if (!rules) {
+        if (!compileGenericRules()) return nullptr;
+        rules = compiledRules.load();
+    }
+
+    if (!threadScanner.scanner || threadScanner.rules != rules) {
+        if (threadScanner.scanner) {
+            yr_scanner_destroy(threadScanner.scanner);
+            threadScanner.scanner = nullptr;
+        }
+        if (yr_scanner_create(rules, &threadScanner.scanner) != ERROR_SUCCESS) {
+            threadScanner.scanner = nullptr;
+            return nullptr;
+        }
+        threadScanner.rules = rules;
+    }
+    return threadScanner.scanner;
+}
+
+template <typename Scan>
+static bool runThreadScan(std::vector<std::string>& matched_rules, Scan&& scan) {
+    YR_SCANNER* scanner = acquireThreadScanner();
+    if (!scanner) return false;
+
+    auto start = std::chrono::steady_clock::now();
+
+    yr_scanner_set_callback(scanner, yara_callback, &matched_rules);
+    int result = scan(scanner);
+
+    scanMicroseconds += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    scannedFiles++;
+
+    return result == ERROR_SUCCESS;
+}
+
+bool scan_with_yara(const std::string& path, std::vector<std::string>& matched_rules) {
+    return runThreadScan(matched_rules, [&path](YR_SCANNER* scanner) {
+        return yr_scanner_scan_file(scanner, path.c_str());
+    });
+}
+
+bool scan_with_yara_memory(const uint8_t* data, size_t size, std::vector<std::string>& matched_rules) {
+    return runThreadScan(matched_rules, [data, size](YR_SCANNER* scanner) {
+        return yr_scanner_scan_mem(scanner, data, size);
+    });
+}
 
-    return !matched_rules.empty();
+bool scan_with_yara_fd(YR_FILE_DESCRIPTOR fd, std::vector<std::string>& matched_rules) {
+    return runThreadScan(matched_rules, [fd](YR_SCANNER* scanner) {
+        return yr_scanner_scan_fd(scanner, fd);
+    });
 }
@@ -14,4 +14,32 @@ void addGenericRule(const std::string& name, const std::string& rule);
 
 void initializeGenericRules();
 
-bool scan_with_yara(const std::string& path, std::vector<std::string>& matched_rules);
\ No newline at end of file
+YR_RULES* compileRulesFromSource();
+
+YR_RULES* loadRulesFromBlob(const unsigned char* data, size_t size);
+
+bool saveRulesToBuffer(YR_RULES* rules, std::vector<unsigned char>& out);
+
+// digest of the rule sources in genericRules, a blob made from other sources is not loaded
+uint64_t digestGenericRules();
+
+bool compileGenericRules(bool fromSource = false);
+
+void benchmarkRuleLoading();
+
+void destroyGenericRules();
+
+uint64_t getRulesetDigest();
+
+void resetYaraTimings();
+
+void reportYaraTimings();
+
+// false when the scan didn't run to the end (no rules, unreadable file, a mapped page that couldn't be read),
+// matched_rules only holds what matched up to there
+bool scan_with_yara(const std::string& path, std::vector<std::string>& matched_rules);
+
+// same scan over bytes that are already mapped, or an open handle, so yara doesn't open the file again
+bool scan_with_yara_memory(const uint8_t* data, size_t size, std::vector<std::string>& matched_rules);
+
+bool scan_with_yara_fd(YR_FILE_DESCRIPTOR fd, std::vector<std::string>& matched_rules);
\ No newline at end of file